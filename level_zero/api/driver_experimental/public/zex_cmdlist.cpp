@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -52,4 +52,97 @@ zexCommandListAppendWriteToMemory(
         return ZE_RESULT_ERROR_UNKNOWN;
     }
 }
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListAppendMutableLaunchKernel(
+    zex_command_list_handle_t hCommandList,
+    ze_kernel_handle_t hKernel,
+    const ze_group_count_t *pLaunchFuncArgs,
+    zex_event_handle_t hSignalEvent,
+    uint32_t numWaitEvents,
+    ze_event_handle_t *phWaitEvents,
+    uint64_t *pCommandId) {
+    try {
+        {
+            if (nullptr == hCommandList || nullptr == hKernel)
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if (nullptr == pLaunchFuncArgs || nullptr == pCommandId)
+                return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+            if ((nullptr == phWaitEvents) && (0 < numWaitEvents))
+                return ZE_RESULT_ERROR_INVALID_SIZE;
+        }
+        return L0::CommandList::fromHandle(hCommandList)->appendMutableLaunchKernel(hKernel, *pLaunchFuncArgs, static_cast<ze_event_handle_t>(hSignalEvent),
+                                                                             numWaitEvents, phWaitEvents, pCommandId);
+    } catch (ze_result_t &result) {
+        return result;
+    } catch (std::bad_alloc &) {
+        return ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    } catch (std::exception &) {
+        return ZE_RESULT_ERROR_UNKNOWN;
+    }
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListUpdateMutableKernelArgument(
+    zex_command_list_handle_t hCommandList,
+    uint64_t commandId,
+    uint32_t argIndex,
+    size_t argSize,
+    const void *pArgValue) {
+    try {
+        {
+            if (nullptr == hCommandList)
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+        return L0::CommandList::fromHandle(hCommandList)->updateMutableKernelArgument(commandId, argIndex, argSize, pArgValue);
+    } catch (ze_result_t &result) {
+        return result;
+    } catch (std::bad_alloc &) {
+        return ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    } catch (std::exception &) {
+        return ZE_RESULT_ERROR_UNKNOWN;
+    }
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListUpdateMutableGroupCount(
+    zex_command_list_handle_t hCommandList,
+    uint64_t commandId,
+    const ze_group_count_t *pLaunchFuncArgs) {
+    try {
+        {
+            if (nullptr == hCommandList)
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if (nullptr == pLaunchFuncArgs)
+                return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+        return L0::CommandList::fromHandle(hCommandList)->updateMutableGroupCount(commandId, *pLaunchFuncArgs);
+    } catch (ze_result_t &result) {
+        return result;
+    } catch (std::bad_alloc &) {
+        return ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    } catch (std::exception &) {
+        return ZE_RESULT_ERROR_UNKNOWN;
+    }
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListUpdateMutableSignalEvent(
+    zex_command_list_handle_t hCommandList,
+    uint64_t commandId,
+    zex_event_handle_t hSignalEvent) {
+    try {
+        {
+            if (nullptr == hCommandList || nullptr == hSignalEvent)
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+        return L0::CommandList::fromHandle(hCommandList)->updateMutableSignalEvent(commandId, static_cast<ze_event_handle_t>(hSignalEvent));
+    } catch (ze_result_t &result) {
+        return result;
+    } catch (std::bad_alloc &) {
+        return ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    } catch (std::exception &) {
+        return ZE_RESULT_ERROR_UNKNOWN;
+    }
+}
 } // namespace L0
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,4 +24,34 @@ zexCommandListAppendWriteToMemory(
     zex_write_to_mem_desc_t *desc,
     void *ptr,
     uint64_t data);
+
+// Kernel dispatches appended with zexCommandListAppendMutableLaunchKernel to a regular command list
+// can be updated in place, without re-recording the command list. Updates must not be done while
+// the command list is executing and are valid until the command list is reset.
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListAppendMutableLaunchKernel(
+    zex_command_list_handle_t hCommandList,
+    ze_kernel_handle_t hKernel,
+    const ze_group_count_t *pLaunchFuncArgs,
+    zex_event_handle_t hSignalEvent,
+    uint32_t numWaitEvents,
+    ze_event_handle_t *phWaitEvents,
+    uint64_t *pCommandId);
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListUpdateMutableKernelArgument(
+    zex_command_list_handle_t hCommandList,
+    uint64_t commandId,
+    uint32_t argIndex,
+    size_t argSize,
+    const void *pArgValue);
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListUpdateMutableGroupCount(
+    zex_command_list_handle_t hCommandList,
+    uint64_t commandId,
+    const ze_group_count_t *pLaunchFuncArgs);
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListUpdateMutableSignalEvent(
+    zex_command_list_handle_t hCommandList,
+    uint64_t commandId,
+    zex_event_handle_t hSignalEvent);
 } // namespace L0
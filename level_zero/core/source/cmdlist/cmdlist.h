@@ -34,6 +34,25 @@ struct Event;
 struct Kernel;
 struct CommandQueue;
 
+// Patch locations of a kernel dispatch recorded with appendMutableLaunchKernel.
+// First inlineDataSize bytes of cross thread data are programmed in walker's inline data,
+// the remainder lives in the indirect object heap.
+struct MutableKernelCommand {
+    Kernel *kernel = nullptr;
+    void *walker = nullptr;
+    void *inlineData = nullptr;
+    void *indirectCrossThreadData = nullptr;
+    uint64_t signalEventAddress = 0;
+    ze_group_count_t groupCount = {};
+    uint32_t groupSize[3] = {};
+    uint32_t crossThreadDataSize = 0;
+    uint32_t inlineDataSize = 0;
+    bool isTimestampEvent = false;
+    bool isHostSignalScopeEvent = false;
+    bool isGroupCountMutable = false;
+    bool isCooperative = false;
+};
+
 struct CmdListKernelLaunchParams {
     bool isIndirect = false;
     bool isPredicate = false;
@@ -45,6 +64,7 @@ struct CmdListKernelLaunchParams {
     bool skipInOrderNonWalkerSignaling = false;
     uint32_t numKernelsInSplitLaunch = 0;
     uint32_t numKernelsExecutedInSplitLaunch = 0;
+    MutableKernelCommand *outMutableKernelCommand = nullptr;
 };
 
 struct CmdListReturnPoint {
@@ -127,7 +147,7 @@ struct CommandList : _ze_command_list_handle_t {
     virtual ze_result_t appendMemoryCopy(void *dstptr, const void *srcptr, size_t size,
                                          ze_event_handle_t hSignalEvent, uint32_t numWaitEvents,
                                          ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch, bool forceDisableCopyOnlyInOrderSignaling) = 0;
-    virtual ze_result_t appendPageFaultCopy(NEO::GraphicsAllocation *dstptr, NEO::GraphicsAllocation *srcptr, size_t size, bool flushHost) = 0;
+    virtual ze_result_t appendPageFaultCopy(NEO::GraphicsAllocation *dstptr, NEO::GraphicsAllocation *srcptr, size_t offset, size_t size, bool flushHost) = 0;
     virtual ze_result_t appendMemoryCopyRegion(void *dstPtr,
                                                const ze_copy_region_t *dstRegion,
                                                uint32_t dstPitch,
@@ -181,6 +201,12 @@ struct CommandList : _ze_command_list_handle_t {
                                            uint32_t data, ze_event_handle_t signalEventHandle) = 0;
     virtual ze_result_t appendWriteToMemory(void *desc, void *ptr,
                                             uint64_t data) = 0;
+    virtual ze_result_t appendMutableLaunchKernel(ze_kernel_handle_t kernelHandle, const ze_group_count_t &threadGroupDimensions,
+                                                  ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents,
+                                                  uint64_t *pCommandId) = 0;
+    virtual ze_result_t updateMutableKernelArgument(uint64_t commandId, uint32_t argIndex, size_t argSize, const void *pArgValue) = 0;
+    virtual ze_result_t updateMutableGroupCount(uint64_t commandId, const ze_group_count_t &threadGroupDimensions) = 0;
+    virtual ze_result_t updateMutableSignalEvent(uint64_t commandId, ze_event_handle_t hSignalEvent) = 0;
     virtual ze_result_t hostSynchronize(uint64_t timeout) = 0;
 
     static CommandList *create(uint32_t productFamily, Device *device, NEO::EngineGroupType engineGroupType,
@@ -431,6 +457,7 @@ struct CommandList : _ze_command_list_handle_t {
     bool dispatchCmdListBatchBufferAsPrimary = false;
     bool copyThroughLockedPtrEnabled = false;
     bool useOnlyGlobalTimestamps = false;
+    bool appendCoalescingEnabled = false;
 };
 
 using CommandListAllocatorFn = CommandList *(*)(uint32_t);
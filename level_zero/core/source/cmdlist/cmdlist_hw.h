@@ -130,6 +130,7 @@ struct CommandListCoreFamily : CommandListImp {
                                  ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch, bool forceDisableCopyOnlyInOrderSignaling) override;
     ze_result_t appendPageFaultCopy(NEO::GraphicsAllocation *dstAllocation,
                                     NEO::GraphicsAllocation *srcAllocation,
+                                    size_t offset,
                                     size_t size,
                                     bool flushHost) override;
     ze_result_t appendMemoryCopyRegion(void *dstPtr,
@@ -170,6 +171,13 @@ struct CommandListCoreFamily : CommandListImp {
                                             uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) override;
     ze_result_t hostSynchronize(uint64_t timeout) override;
 
+    ze_result_t appendMutableLaunchKernel(ze_kernel_handle_t kernelHandle, const ze_group_count_t &threadGroupDimensions,
+                                          ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents,
+                                          uint64_t *pCommandId) override;
+    ze_result_t updateMutableKernelArgument(uint64_t commandId, uint32_t argIndex, size_t argSize, const void *pArgValue) override;
+    ze_result_t updateMutableGroupCount(uint64_t commandId, const ze_group_count_t &threadGroupDimensions) override;
+    ze_result_t updateMutableSignalEvent(uint64_t commandId, ze_event_handle_t hSignalEvent) override;
+
     ze_result_t appendSignalEvent(ze_event_handle_t hEvent) override;
     ze_result_t appendWaitOnEvents(uint32_t numEvents, ze_event_handle_t *phEvent, bool relaxedOrderingAllowed, bool trackDependencies, bool signalInOrderCompletion) override;
     void appendWaitOnInOrderDependency(std::shared_ptr<InOrderExecInfo> &inOrderExecInfo, uint64_t waitValue, uint32_t offset, bool relaxedOrderingAllowed, bool implicitDependency);
@@ -332,6 +340,7 @@ struct CommandListCoreFamily : CommandListImp {
     NEO::PreemptionMode obtainKernelPreemptionMode(Kernel *kernel);
     virtual bool isRelaxedOrderingDispatchAllowed(uint32_t numWaitEvents) const { return false; }
     virtual void setupFlushMethod(const NEO::RootDeviceEnvironment &rootDeviceEnvironment) {}
+    virtual void prepareCoalescedKernelDispatch(Kernel &kernel, const CmdListKernelLaunchParams &launchParams, const ze_group_count_t &threadGroupDimensions) {}
     bool canSkipInOrderEventWait(const Event &event) const;
     void handleInOrderImplicitDependencies(bool relaxedOrderingAllowed);
     bool isQwordInOrderCounter() const { return GfxFamily::isQwordInOrderCounter; }
@@ -340,7 +349,13 @@ struct CommandListCoreFamily : CommandListImp {
 
     void addCmdForPatching(std::shared_ptr<InOrderExecInfo> *externalInOrderExecInfo, void *cmd, uint64_t counterValue, InOrderPatchCommandHelpers::PatchCmdType patchCmdType);
 
+    bool isMutableKernelDispatchSupported() const;
+    bool isMutableSignalEvent(Event &event) const;
+    void patchMutableCrossThreadData(MutableKernelCommand &command, NEO::CrossThreadDataOffset offset, const void *data, uint32_t size);
+    void patchMutableWalker(const MutableKernelCommand &command);
+
     InOrderPatchCommandsContainer<GfxFamily> inOrderPatchCmds;
+    std::vector<MutableKernelCommand> mutableKernelCommands;
 
     bool latestOperationRequiredNonWalkerInOrderCmdsChaining = false;
 };
@@ -138,6 +138,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::reset() {
     cmdListCurrentStartOffset = 0;
 
     mappedTsEventList.clear();
+    mutableKernelCommands.clear();
 
     inOrderAllocationOffset = 0;
 
@@ -1268,13 +1269,13 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendCopyImageBlit(NEO::Graph
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(NEO::GraphicsAllocation *dstAllocation,
                                                                       NEO::GraphicsAllocation *srcAllocation,
-                                                                      size_t size, bool flushHost) {
+                                                                      size_t offset, size_t size, bool flushHost) {
 
     size_t middleElSize = sizeof(uint32_t) * 4;
     uintptr_t rightSize = size % middleElSize;
     bool isStateless = false;
 
-    if (size >= 4ull * MemoryConstants::gigaByte) {
+    if (offset + size >= 4ull * MemoryConstants::gigaByte) {
         isStateless = true;
     }
 
@@ -1282,17 +1283,17 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(NEO::Graph
     uintptr_t srcAddress = static_cast<uintptr_t>(srcAllocation->getGpuAddress());
     ze_result_t ret = ZE_RESULT_ERROR_UNKNOWN;
     if (isCopyOnly()) {
-        return appendMemoryCopyBlit(dstAddress, dstAllocation, 0u,
-                                    srcAddress, srcAllocation, 0u,
+        return appendMemoryCopyBlit(dstAddress, dstAllocation, offset,
+                                    srcAddress, srcAllocation, offset,
                                     size);
     } else {
         CmdListKernelLaunchParams launchParams = {};
         launchParams.isKernelSplitOperation = rightSize > 0;
         launchParams.numKernelsInSplitLaunch = 2;
         ret = appendMemoryCopyKernelWithGA(reinterpret_cast<void *>(&dstAddress),
-                                           dstAllocation, 0,
+                                           dstAllocation, offset,
                                            reinterpret_cast<void *>(&srcAddress),
-                                           srcAllocation, 0,
+                                           srcAllocation, offset,
                                            size - rightSize,
                                            middleElSize,
                                            Builtin::CopyBufferToBufferMiddle,
@@ -1302,9 +1303,9 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(NEO::Graph
         launchParams.numKernelsExecutedInSplitLaunch++;
         if (ret == ZE_RESULT_SUCCESS && rightSize) {
             ret = appendMemoryCopyKernelWithGA(reinterpret_cast<void *>(&dstAddress),
-                                               dstAllocation, size - rightSize,
+                                               dstAllocation, offset + size - rightSize,
                                                reinterpret_cast<void *>(&srcAddress),
-                                               srcAllocation, size - rightSize,
+                                               srcAllocation, offset + size - rightSize,
                                                rightSize, 1UL,
                                                Builtin::CopyBufferToBufferSide,
                                                nullptr,
@@ -2754,6 +2755,243 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::hostSynchronize(uint64_t timeo
     return ZE_RESULT_ERROR_INVALID_ARGUMENT;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMutableLaunchKernel(ze_kernel_handle_t kernelHandle,
+                                                                            const ze_group_count_t &threadGroupDimensions,
+                                                                            ze_event_handle_t hSignalEvent,
+                                                                            uint32_t numWaitEvents,
+                                                                            ze_event_handle_t *phWaitEvents,
+                                                                            uint64_t *pCommandId) {
+    if (!isMutableKernelDispatchSupported() || this->cmdListType == CommandListType::TYPE_IMMEDIATE || isCopyOnly() ||
+        this->partitionCount > 1 || isInOrderExecutionEnabled()) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    if (pCommandId == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    Event *signalEvent = nullptr;
+    if (hSignalEvent) {
+        signalEvent = Event::fromHandle(hSignalEvent);
+        if (!isMutableSignalEvent(*signalEvent)) {
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        }
+    }
+
+    MutableKernelCommand mutableCommand = {};
+    CmdListKernelLaunchParams launchParams = {};
+    launchParams.outMutableKernelCommand = &mutableCommand;
+
+    auto ret = CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernel(kernelHandle, threadGroupDimensions, hSignalEvent,
+                                                                        numWaitEvents, phWaitEvents, launchParams, false);
+    if (ret != ZE_RESULT_SUCCESS) {
+        return ret;
+    }
+    UNRECOVERABLE_IF(mutableCommand.walker == nullptr);
+
+    auto kernel = Kernel::fromHandle(kernelHandle);
+    auto &kernelAttributes = kernel->getKernelDescriptor().kernelAttributes;
+    memcpy_s(mutableCommand.groupSize, sizeof(mutableCommand.groupSize), kernel->getGroupSize(), sizeof(mutableCommand.groupSize));
+    mutableCommand.kernel = kernel;
+    mutableCommand.groupCount = threadGroupDimensions;
+    mutableCommand.isCooperative = launchParams.isCooperative;
+    // implicit args, sync buffer and EU fusion programming depend on group count, such dispatches need to be re-recorded
+    mutableCommand.isGroupCountMutable = (kernel->getImplicitArgs() == nullptr) && !kernel->usesSyncBuffer() &&
+                                         !(static_cast<DeviceImp *>(device)->calculationForDisablingEuFusionWithDpasNeeded && kernelAttributes.flags.usesSystolicPipelineSelectMode);
+    if (signalEvent) {
+        mutableCommand.signalEventAddress = signalEvent->getPacketAddress(this->device);
+        mutableCommand.isTimestampEvent = signalEvent->isUsingContextEndOffset();
+        mutableCommand.isHostSignalScopeEvent = signalEvent->isSignalScope(ZE_EVENT_SCOPE_FLAG_HOST);
+    }
+
+    *pCommandId = mutableKernelCommands.size();
+    mutableKernelCommands.push_back(std::move(mutableCommand));
+
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::updateMutableKernelArgument(uint64_t commandId, uint32_t argIndex, size_t argSize, const void *pArgValue) {
+    if (commandId >= mutableKernelCommands.size()) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto &mutableCommand = mutableKernelCommands[commandId];
+    const auto &explicitArgs = mutableCommand.kernel->getKernelDescriptor().payloadMappings.explicitArgs;
+    if (argIndex >= explicitArgs.size()) {
+        return ZE_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX;
+    }
+
+    // only recorded cross thread data is patched - kernel object, surface states and SLM sizes stay as they were
+    const auto &arg = explicitArgs[argIndex];
+    if (arg.is<NEO::ArgDescriptor::ArgTValue>()) {
+        const auto &elements = arg.as<NEO::ArgDescValue>().elements;
+        for (const auto &element : elements) {
+            if (element.sourceOffset >= argSize) {
+                return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+            }
+        }
+        for (const auto &element : elements) {
+            StackVec<uint8_t, 16> elementData;
+            elementData.resize(element.size, 0u);
+            if (pArgValue) {
+                auto bytesToCopy = std::min(static_cast<size_t>(element.size), argSize - element.sourceOffset);
+                memcpy_s(elementData.data(), element.size, ptrOffset(pArgValue, element.sourceOffset), bytesToCopy);
+            }
+            patchMutableCrossThreadData(mutableCommand, element.offset, elementData.data(), element.size);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    if (!arg.is<NEO::ArgDescriptor::ArgTPointer>()) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    const auto &argPointer = arg.as<NEO::ArgDescPointer>();
+    if (arg.getTraits().getAddressQualifier() == NEO::KernelArgMetadata::AddrLocal ||
+        NEO::isValidOffset(argPointer.bindful) || NEO::isValidOffset(argPointer.bindless)) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    uint64_t gpuAddress = 0u;
+    if (pArgValue) {
+        auto driverHandle = static_cast<DriverHandleImp *>(device->getDriverHandle());
+        auto requestedAddress = *reinterpret_cast<void *const *>(pArgValue);
+        uintptr_t allocationGpuAddress = 0u;
+        auto allocation = driverHandle->getDriverSystemMemoryAllocation(requestedAddress, 1u, device->getRootDeviceIndex(), &allocationGpuAddress);
+        auto allocData = driverHandle->getSvmAllocsManager()->getSVMAlloc(requestedAddress);
+        if (allocData == nullptr) {
+            if (NEO::DebugManager.flags.DisableSystemPointerKernelArgument.get() == 1) {
+                return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+            }
+            gpuAddress = reinterpret_cast<uintptr_t>(requestedAddress);
+        } else {
+            // peer access and uncached MOCS change programming outside of cross thread data
+            if (driverHandle->isRemoteResourceNeeded(requestedAddress, allocation, allocData, device) ||
+                allocData->allocationFlagsProperty.flags.locallyUncachedResource) {
+                return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+            }
+            gpuAddress = allocationGpuAddress;
+            commandContainer.addToResidencyContainer(allocation);
+            if (allocData->virtualReservationData) {
+                for (const auto &mappedAllocationData : allocData->virtualReservationData->mappedAllocations) {
+                    commandContainer.addToResidencyContainer(mappedAllocationData.second->mappedAllocation->allocation);
+                }
+            }
+        }
+    }
+    if (NEO::isValidOffset(argPointer.stateless)) {
+        patchMutableCrossThreadData(mutableCommand, argPointer.stateless, &gpuAddress, argPointer.pointerSize);
+    }
+
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::updateMutableGroupCount(uint64_t commandId, const ze_group_count_t &threadGroupDimensions) {
+    if (commandId >= mutableKernelCommands.size()) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto &mutableCommand = mutableKernelCommands[commandId];
+    if (!mutableCommand.isGroupCountMutable) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    // group size is taken from the recorded dispatch, same values as KernelImp::setGroupCount would patch
+    uint32_t groupCount[3] = {threadGroupDimensions.groupCountX, threadGroupDimensions.groupCountY, threadGroupDimensions.groupCountZ};
+    for (uint32_t i = 0; i < 3; i++) {
+        if (static_cast<uint64_t>(groupCount[i]) * mutableCommand.groupSize[i] > std::numeric_limits<uint32_t>::max()) {
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+    }
+    if (mutableCommand.isCooperative) {
+        uint32_t maxGroupCount = 0;
+        auto ret = mutableCommand.kernel->suggestMaxCooperativeGroupCount(&maxGroupCount, this->engineGroupType, device->getNEODevice()->isEngineInstanced());
+        UNRECOVERABLE_IF(ret != ZE_RESULT_SUCCESS);
+        if (static_cast<uint64_t>(groupCount[0]) * groupCount[1] * groupCount[2] > maxGroupCount) {
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+    }
+    uint32_t globalWorkSize[3] = {groupCount[0] * mutableCommand.groupSize[0], groupCount[1] * mutableCommand.groupSize[1],
+                                  groupCount[2] * mutableCommand.groupSize[2]};
+    uint32_t workDim = 1;
+    if (globalWorkSize[2] > 1) {
+        workDim = 3;
+    } else if (globalWorkSize[1] > 1) {
+        workDim = 2;
+    }
+
+    const auto &dispatchTraits = mutableCommand.kernel->getKernelDescriptor().payloadMappings.dispatchTraits;
+    for (uint32_t i = 0; i < 3; i++) {
+        patchMutableCrossThreadData(mutableCommand, dispatchTraits.numWorkGroups[i], &groupCount[i], sizeof(uint32_t));
+        patchMutableCrossThreadData(mutableCommand, dispatchTraits.globalWorkSize[i], &globalWorkSize[i], sizeof(uint32_t));
+    }
+    patchMutableCrossThreadData(mutableCommand, dispatchTraits.workDim, &workDim, sizeof(uint32_t));
+
+    mutableCommand.groupCount = threadGroupDimensions;
+    patchMutableWalker(mutableCommand);
+
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::updateMutableSignalEvent(uint64_t commandId, ze_event_handle_t hSignalEvent) {
+    if (commandId >= mutableKernelCommands.size()) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (hSignalEvent == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+    }
+    auto &mutableCommand = mutableKernelCommands[commandId];
+    auto signalEvent = Event::fromHandle(hSignalEvent);
+
+    // post sync operation of the walker is kept, only its destination is replaced
+    if (mutableCommand.signalEventAddress == 0 ||
+        !isMutableSignalEvent(*signalEvent) ||
+        signalEvent->isUsingContextEndOffset() != mutableCommand.isTimestampEvent ||
+        signalEvent->isSignalScope(ZE_EVENT_SCOPE_FLAG_HOST) != mutableCommand.isHostSignalScopeEvent) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    signalEvent->resetKernelCountAndPacketUsedCount();
+    signalEvent->setPacketsInUse(this->partitionCount);
+    if (mutableCommand.kernel->getPrintfBufferAllocation() != nullptr) {
+        signalEvent->setKernelForPrintf(mutableCommand.kernel);
+    }
+    commandContainer.addToResidencyContainer(&signalEvent->getAllocation(this->device));
+    addToMappedEventList(signalEvent);
+
+    mutableCommand.signalEventAddress = signalEvent->getPacketAddress(this->device);
+    patchMutableWalker(mutableCommand);
+
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamily<gfxCoreFamily>::isMutableSignalEvent(Event &event) const {
+    // events signaled by additional commands next to the walker can't be replaced by patching the walker
+    return !getDcFlushRequired(event.isSignalScope()) &&
+           (!this->signalAllEventPackets || event.getMaxPacketsCount() == 1);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::patchMutableCrossThreadData(MutableKernelCommand &command, NEO::CrossThreadDataOffset offset, const void *data, uint32_t size) {
+    if (NEO::isUndefinedOffset(offset)) {
+        return;
+    }
+    uint32_t patchOffset = offset;
+    UNRECOVERABLE_IF(patchOffset + size > command.crossThreadDataSize);
+
+    if (patchOffset < command.inlineDataSize) {
+        auto inlineBytes = std::min(size, command.inlineDataSize - patchOffset);
+        memcpy_s(ptrOffset(command.inlineData, patchOffset), inlineBytes, data, inlineBytes);
+        data = ptrOffset(data, inlineBytes);
+        patchOffset += inlineBytes;
+        size -= inlineBytes;
+    }
+    if (size > 0) {
+        memcpy_s(ptrOffset(command.indirectCrossThreadData, patchOffset - command.inlineDataSize), size, data, size);
+    }
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::reserveSpace(size_t size, void **ptr) {
     auto availableSpace = commandContainer.getCommandStream()->getAvailableSpace();
@@ -9,10 +9,14 @@
 
 #include "shared/source/command_stream/csr_definitions.h"
 #include "shared/source/command_stream/task_count_helper.h"
+#include "shared/source/utilities/deferred_submission_flusher.h"
 
 #include "level_zero/core/source/cmdlist/cmdlist_hw.h"
 
+#include <array>
 #include <atomic>
+#include <chrono>
+#include <mutex>
 
 namespace NEO {
 struct SvmAllocationData;
@@ -37,7 +41,7 @@ struct CpuMemCopyInfo {
 };
 
 template <GFXCORE_FAMILY gfxCoreFamily>
-struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFamily> {
+struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFamily>, public NEO::DeferredSubmissionClient {
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
     using BaseClass = CommandListCoreFamily<gfxCoreFamily>;
     using BaseClass::BaseClass;
@@ -97,7 +101,7 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
 
     ze_result_t appendPageFaultCopy(NEO::GraphicsAllocation *dstAllocation,
                                     NEO::GraphicsAllocation *srcAllocation,
-                                    size_t size, bool flushHost) override;
+                                    size_t offset, size_t size, bool flushHost) override;
 
     ze_result_t appendWaitOnEvents(uint32_t numEvents, ze_event_handle_t *phEvent, bool relaxedOrderingAllowed, bool trackDependencies, bool signalInOrderCompletion) override;
 
@@ -161,6 +165,9 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
         return ZE_RESULT_SUCCESS;
     }
 
+    ze_result_t destroy() override;
+    ze_result_t reset() override;
+
     MOCKABLE_VIRTUAL ze_result_t executeCommandListImmediateWithFlushTask(bool performMigration, bool hasStallingCmds, bool hasRelaxedOrderingDependencies, bool kernelOperation);
     ze_result_t executeCommandListImmediateWithFlushTaskImpl(bool performMigration, bool hasStallingCmds, bool hasRelaxedOrderingDependencies, bool kernelOperation, CommandQueue *cmdQ);
 
@@ -172,6 +179,9 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     void updateDispatchFlagsWithRequiredStreamState(NEO::DispatchFlags &dispatchFlags);
 
     MOCKABLE_VIRTUAL ze_result_t flushImmediate(ze_result_t inputRet, bool performMigration, bool hasStallingCmds, bool hasRelaxedOrderingDependencies, bool kernelOperation, ze_event_handle_t hSignalEvent);
+    ze_result_t flushCoalescedAppends();
+    bool flushDeferredSubmission(bool onlyStale) override;
+    const NEO::CommandStreamReceiver *getDeferredSubmissionCsr() const override;
 
     bool preferCopyThroughLockedPtr(CpuMemCopyInfo &cpuMemCopyInfo, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents);
     bool isSuitableUSMHostAlloc(NEO::SvmAllocationData *alloc);
@@ -198,11 +208,40 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     bool isSkippingInOrderBarrierAllowed(ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) const;
     void allocateOrReuseKernelPrivateMemoryIfNeeded(Kernel *kernel, uint32_t sizePerHwThread) override;
     void handleInOrderNonWalkerSignaling(Event *event, bool &hasStallingCmds, bool &relaxedOrderingDispatch, ze_result_t &result);
+    void prepareCoalescedKernelDispatch(Kernel &kernel, const CmdListKernelLaunchParams &launchParams, const ze_group_count_t &threadGroupDimensions) override;
+    bool isCoalescedStreamStateCompatible(Kernel &kernel, const CmdListKernelLaunchParams &launchParams, const ze_group_count_t &threadGroupDimensions);
+    bool isCoalescedHeapSpaceAvailable(Kernel &kernel);
+    ze_result_t coalesceAppend(bool performMigration, bool hasStallingCmds, bool kernelOperation, bool hasSignalEvent);
+    void submitCoalescedAppends();
+    std::unique_lock<std::recursive_mutex> obtainCoalescingLock();
+    void printAppendCoalescingStatistics() const;
 
     MOCKABLE_VIRTUAL void checkAssert();
     ComputeFlushMethodType computeFlushMethod = nullptr;
     std::atomic<bool> dependenciesPresent{false};
     bool latestFlushIsHostVisible = false;
+
+    struct AppendCoalescingStatistics {
+        static constexpr uint32_t histogramBucketCount = 8;
+
+        uint64_t flushCount = 0;
+        uint64_t appendCount = 0;
+        uint32_t maxAppendsPerFlush = 0;
+        std::array<uint64_t, histogramBucketCount> appendsPerFlushHistogram = {}; // bucket n counts flushes of [2^n, 2^(n+1)) appends, last one is open ended
+    };
+
+    AppendCoalescingStatistics coalescingStatistics;
+    std::chrono::steady_clock::time_point coalescingStartTime;
+    std::chrono::microseconds coalescingTimeout = NEO::DeferredSubmissionFlusher::defaultIdleFlushInterval;
+    size_t coalescingMaxBytes = 16 * MemoryConstants::kiloByte;
+    ze_result_t coalescedFlushResult = ZE_RESULT_SUCCESS;
+    uint32_t coalescedAppendsCount = 0;
+    bool coalescedPerformMigration = false;
+    bool coalescedHasStallingCmds = false;
+    bool coalescedKernelOperation = false;
+    // held for whole append, so deferred submission flushed from other threads never sees partially encoded commands
+    std::recursive_mutex coalescingMutex;
+    NEO::DeferredSubmissionFlusher *deferredSubmissionFlusher = nullptr;
 };
 
 template <PRODUCT_FAMILY gfxProductFamily>
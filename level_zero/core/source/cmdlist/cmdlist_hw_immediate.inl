@@ -15,9 +15,11 @@
 #include "shared/source/debugger/debugger_l0.h"
 #include "shared/source/direct_submission/relaxed_ordering_helper.h"
 #include "shared/source/helpers/api_specific_config.h"
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/bindless_heaps_helper.h"
 #include "shared/source/helpers/completion_stamp.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/kernel/implicit_args.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
@@ -31,6 +33,8 @@
 
 #include "encode_surface_state_args.h"
 
+#include <algorithm>
+#include <cinttypes>
 #include <cmath>
 
 namespace L0 {
@@ -38,6 +42,35 @@ namespace L0 {
 template <GFXCORE_FAMILY gfxCoreFamily>
 CommandListCoreFamilyImmediate<gfxCoreFamily>::CommandListCoreFamilyImmediate(uint32_t numIddsPerBlock) : BaseClass(numIddsPerBlock) {
     computeFlushMethod = &CommandListCoreFamilyImmediate<gfxCoreFamily>::flushRegularTask;
+
+    if (NEO::DebugManager.flags.ImmediateCmdListCoalescingMaxBytes.get() != -1) {
+        coalescingMaxBytes = static_cast<size_t>(NEO::DebugManager.flags.ImmediateCmdListCoalescingMaxBytes.get());
+    }
+    if (NEO::DebugManager.flags.ImmediateCmdListCoalescingTimeoutUs.get() != -1) {
+        coalescingTimeout = std::chrono::microseconds(NEO::DebugManager.flags.ImmediateCmdListCoalescingTimeoutUs.get());
+    }
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::destroy() {
+    if (this->deferredSubmissionFlusher) {
+        this->deferredSubmissionFlusher->unregisterClient(this);
+    }
+    flushCoalescedAppends();
+    if (NEO::DebugManager.flags.PrintImmediateCmdListCoalescingStatistics.get() && this->appendCoalescingEnabled) {
+        printAppendCoalescingStatistics();
+    }
+    return BaseClass::destroy();
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::reset() {
+    auto coalescingLock = obtainCoalescingLock();
+    auto ret = flushCoalescedAppends();
+    if (ret != ZE_RESULT_SUCCESS) {
+        return ret;
+    }
+    return BaseClass::reset();
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
@@ -47,6 +80,7 @@ void CommandListCoreFamilyImmediate<gfxCoreFamily>::checkAvailableSpace(uint32_t
     /* Command container might has two command buffers. If it has, one is in local memory, because relaxed ordering requires that and one in system for copying it into ring buffer.
        If relaxed ordering is needed in given dispatch and current command stream is in system memory, swap of command streams is required to ensure local memory. Same in the opposite scenario. */
     if (hasRelaxedOrderingDependencies == NEO::MemoryPoolHelper::isSystemMemoryPool(this->commandContainer.getCommandStream()->getGraphicsAllocation()->getMemoryPool())) {
+        submitCoalescedAppends();
         if (this->commandContainer.swapStreams()) {
             this->cmdListCurrentStartOffset = this->commandContainer.getCommandStream()->getUsed();
         }
@@ -56,6 +90,8 @@ void CommandListCoreFamilyImmediate<gfxCoreFamily>::checkAvailableSpace(uint32_t
     if (this->commandContainer.getCommandStream()->getAvailableSpace() < commandSize + semaphoreSize) {
         bool requireSystemMemoryCommandBuffer = !hasRelaxedOrderingDependencies;
 
+        submitCoalescedAppends();
+
         auto alloc = this->commandContainer.reuseExistingCmdBuffer(requireSystemMemoryCommandBuffer);
         this->commandContainer.addCurrentCommandBufferToReusableAllocationList();
 
@@ -426,6 +462,7 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernel(
     ze_kernel_handle_t kernelHandle, const ze_group_count_t &threadGroupDimensions,
     ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents,
     const CmdListKernelLaunchParams &launchParams, bool relaxedOrderingDispatch) {
+    auto coalescingLock = obtainCoalescingLock();
 
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
     bool stallingCmdsForRelaxedOrdering = hasStallingCmdsForRelaxedOrdering(numWaitEvents, relaxedOrderingDispatch);
@@ -478,6 +515,7 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernelIndirect(
     ze_kernel_handle_t kernelHandle, const ze_group_count_t &pDispatchArgumentsBuffer,
     ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    auto coalescingLock = obtainCoalescingLock();
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize);
@@ -512,6 +550,7 @@ bool CommandListCoreFamilyImmediate<gfxCoreFamily>::isSkippingInOrderBarrierAllo
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendBarrier(ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    auto coalescingLock = obtainCoalescingLock();
     ze_result_t ret = ZE_RESULT_SUCCESS;
 
     bool isStallingOperation = true;
@@ -547,6 +586,7 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopy(
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch, bool forceDisableCopyOnlyInOrderSignaling) {
+    auto coalescingLock = obtainCoalescingLock();
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     auto estimatedSize = commonImmediateCommandSize;
@@ -605,6 +645,7 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopyRegio
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch, bool forceDisableCopyOnlyInOrderSignaling) {
+    auto coalescingLock = obtainCoalescingLock();
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     auto estimatedSize = commonImmediateCommandSize;
@@ -659,6 +700,7 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryFill(void
                                                                             ze_event_handle_t hSignalEvent,
                                                                             uint32_t numWaitEvents,
                                                                             ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    auto coalescingLock = obtainCoalescingLock();
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize);
@@ -673,6 +715,7 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryFill(void
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendSignalEvent(ze_event_handle_t hSignalEvent) {
+    auto coalescingLock = obtainCoalescingLock();
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
     ze_result_t ret = ZE_RESULT_SUCCESS;
 
@@ -683,6 +726,7 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendSignalEvent(ze_
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendEventReset(ze_event_handle_t hSignalEvent) {
+    auto coalescingLock = obtainCoalescingLock();
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
     ze_result_t ret = ZE_RESULT_SUCCESS;
 
@@ -694,7 +738,8 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendEventReset(ze_e
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPageFaultCopy(NEO::GraphicsAllocation *dstAllocation,
                                                                                NEO::GraphicsAllocation *srcAllocation,
-                                                                               size_t size, bool flushHost) {
+                                                                               size_t offset, size_t size, bool flushHost) {
+    auto coalescingLock = obtainCoalescingLock();
 
     checkAvailableSpace(0, false, commonImmediateCommandSize);
 
@@ -707,8 +752,8 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPageFaultCopy(N
 
     if (isSplitNeeded) {
         relaxedOrdering = isRelaxedOrderingDispatchAllowed(1); // split generates more than 1 event
-        uintptr_t dstAddress = static_cast<uintptr_t>(dstAllocation->getGpuAddress());
-        uintptr_t srcAddress = static_cast<uintptr_t>(srcAllocation->getGpuAddress());
+        uintptr_t dstAddress = static_cast<uintptr_t>(dstAllocation->getGpuAddress() + offset);
+        uintptr_t srcAddress = static_cast<uintptr_t>(srcAllocation->getGpuAddress() + offset);
         ret = static_cast<DeviceImp *>(this->device)->bcsSplit.appendSplitCall<gfxCoreFamily, uintptr_t, uintptr_t>(this, dstAddress, srcAddress, size, nullptr, 0u, nullptr, false, relaxedOrdering, direction, [&](uintptr_t dstAddressParam, uintptr_t srcAddressParam, size_t sizeParam, ze_event_handle_t hSignalEventParam) {
             this->appendMemoryCopyBlit(dstAddressParam, dstAllocation, 0u,
                                        srcAddressParam, srcAllocation, 0u,
@@ -716,13 +761,14 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPageFaultCopy(N
             return CommandListCoreFamily<gfxCoreFamily>::appendSignalEvent(hSignalEventParam);
         });
     } else {
-        ret = CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(dstAllocation, srcAllocation, size, flushHost);
+        ret = CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(dstAllocation, srcAllocation, offset, size, flushHost);
     }
     return flushImmediate(ret, false, false, relaxedOrdering, true, nullptr);
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWaitOnEvents(uint32_t numEvents, ze_event_handle_t *phWaitEvents, bool relaxedOrderingAllowed, bool trackDependencies, bool signalInOrderCompletion) {
+    auto coalescingLock = obtainCoalescingLock();
     bool allSignaled = true;
     for (auto i = 0u; i < numEvents; i++) {
         allSignaled &= (!this->dcFlushSupport && Event::fromHandle(phWaitEvents[i])->isAlreadyCompleted());
@@ -743,6 +789,7 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWriteGlobalTimestamp(
     uint64_t *dstptr, ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    auto coalescingLock = obtainCoalescingLock();
 
     checkAvailableSpace(numWaitEvents, false, commonImmediateCommandSize);
     if (this->isFlushTaskSubmissionEnabled) {
@@ -780,6 +827,7 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyRegion
                                                                                  ze_event_handle_t hSignalEvent,
                                                                                  uint32_t numWaitEvents,
                                                                                  ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    auto coalescingLock = obtainCoalescingLock();
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     auto estimatedSize = commonImmediateCommandSize;
@@ -809,6 +857,7 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyFromMe
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    auto coalescingLock = obtainCoalescingLock();
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize);
@@ -830,6 +879,7 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyToMemo
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    auto coalescingLock = obtainCoalescingLock();
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize);
@@ -850,6 +900,7 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryRangesBar
                                                                                      ze_event_handle_t hSignalEvent,
                                                                                      uint32_t numWaitEvents,
                                                                                      ze_event_handle_t *phWaitEvents) {
+    auto coalescingLock = obtainCoalescingLock();
     checkAvailableSpace(numWaitEvents, false, commonImmediateCommandSize);
     if (this->isFlushTaskSubmissionEnabled) {
         checkWaitEventsState(numWaitEvents, phWaitEvents);
@@ -864,6 +915,7 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchCooperati
                                                                                          ze_event_handle_t hSignalEvent,
                                                                                          uint32_t numWaitEvents,
                                                                                          ze_event_handle_t *waitEventHandles, bool relaxedOrderingDispatch) {
+    auto coalescingLock = obtainCoalescingLock();
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize);
@@ -878,16 +930,26 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchCooperati
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWaitOnMemory(void *desc, void *ptr, uint32_t data, ze_event_handle_t signalEventHandle) {
+    auto coalescingLock = obtainCoalescingLock();
     checkAvailableSpace(0, false, commonImmediateCommandSize);
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendWaitOnMemory(desc, ptr, data, signalEventHandle);
-    return flushImmediate(ret, true, false, false, false, signalEventHandle);
+    ret = flushImmediate(ret, true, false, false, false, signalEventHandle);
+    if (ret == ZE_RESULT_SUCCESS) {
+        ret = flushCoalescedAppends();
+    }
+    return ret;
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWriteToMemory(void *desc, void *ptr, uint64_t data) {
+    auto coalescingLock = obtainCoalescingLock();
     checkAvailableSpace(0, false, commonImmediateCommandSize);
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendWriteToMemory(desc, ptr, data);
-    return flushImmediate(ret, true, false, false, false, nullptr);
+    ret = flushImmediate(ret, true, false, false, false, nullptr);
+    if (ret == ZE_RESULT_SUCCESS) {
+        ret = flushCoalescedAppends();
+    }
+    return ret;
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
@@ -932,6 +994,11 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::hostSynchronize(uint6
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::hostSynchronize(uint64_t timeout) {
+    // waited task count belongs to this list, so only its own deferred appends need to be submitted
+    auto ret = flushCoalescedAppends();
+    if (ret != ZE_RESULT_SUCCESS) {
+        return ret;
+    }
     return hostSynchronize(timeout, this->cmdQImmediate->getTaskCount(), true);
 }
 
@@ -945,7 +1012,11 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushImmediate(ze_res
             if (signalEvent && (NEO::DebugManager.flags.TrackNumCsrClientsOnSyncPoints.get() != 0)) {
                 signalEvent->setLatestUsedCmdQueue(this->cmdQImmediate);
             }
-            inputRet = executeCommandListImmediateWithFlushTask(performMigration, hasStallingCmds, hasRelaxedOrderingDependencies, kernelOperation);
+            if (this->appendCoalescingEnabled) {
+                inputRet = coalesceAppend(performMigration, hasStallingCmds, kernelOperation, signalEvent != nullptr);
+            } else {
+                inputRet = executeCommandListImmediateWithFlushTask(performMigration, hasStallingCmds, hasRelaxedOrderingDependencies, kernelOperation);
+            }
         } else {
             inputRet = executeCommandListImmediate(performMigration);
         }
@@ -961,6 +1032,181 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushImmediate(ze_res
     return inputRet;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::coalesceAppend(bool performMigration, bool hasStallingCmds, bool kernelOperation, bool hasSignalEvent) {
+    auto now = std::chrono::steady_clock::now();
+    if (this->coalescedAppendsCount == 0) {
+        this->coalescingStartTime = now;
+    }
+    this->coalescedAppendsCount++;
+    this->coalescedPerformMigration |= performMigration;
+    this->coalescedHasStallingCmds |= hasStallingCmds;
+    this->coalescedKernelOperation |= kernelOperation;
+
+    // signaled events may be observed by host or other queues, so they always close the batch
+    auto pendingSize = this->commandContainer.getCommandStream()->getUsed() - this->cmdListCurrentStartOffset;
+    bool flushRequired = hasSignalEvent ||
+                         this->printfKernelContainer.size() > 0u ||
+                         pendingSize >= this->coalescingMaxBytes ||
+                         (now - this->coalescingStartTime) >= this->coalescingTimeout;
+    if (flushRequired) {
+        submitCoalescedAppends();
+    } else if (this->coalescedAppendsCount == 1) {
+        // host may never call into this list again, so stale batch has to be submitted by idle flusher
+        if (this->deferredSubmissionFlusher == nullptr) {
+            this->deferredSubmissionFlusher = this->device->getNEODevice()->getDeferredSubmissionFlusher();
+            this->deferredSubmissionFlusher->registerClient(this);
+        }
+        this->deferredSubmissionFlusher->notifyDeferredSubmission();
+    }
+
+    auto ret = this->coalescedFlushResult;
+    this->coalescedFlushResult = ZE_RESULT_SUCCESS;
+    return ret;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushCoalescedAppends() {
+    auto coalescingLock = obtainCoalescingLock();
+    submitCoalescedAppends();
+
+    auto ret = this->coalescedFlushResult;
+    this->coalescedFlushResult = ZE_RESULT_SUCCESS;
+    return ret;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamilyImmediate<gfxCoreFamily>::flushDeferredSubmission(bool onlyStale) {
+    // list is busy with append, which checks the timeout itself
+    std::unique_lock<std::recursive_mutex> coalescingLock(this->coalescingMutex, std::try_to_lock);
+    if (!coalescingLock.owns_lock()) {
+        return true;
+    }
+    if (this->coalescedAppendsCount == 0) {
+        return false;
+    }
+    if (onlyStale && (std::chrono::steady_clock::now() - this->coalescingStartTime) < this->coalescingTimeout) {
+        return true;
+    }
+    submitCoalescedAppends();
+    return false;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+const NEO::CommandStreamReceiver *CommandListCoreFamilyImmediate<gfxCoreFamily>::getDeferredSubmissionCsr() const {
+    return this->csr;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+std::unique_lock<std::recursive_mutex> CommandListCoreFamilyImmediate<gfxCoreFamily>::obtainCoalescingLock() {
+    if (!this->appendCoalescingEnabled) {
+        return {};
+    }
+    return std::unique_lock<std::recursive_mutex>(this->coalescingMutex);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamilyImmediate<gfxCoreFamily>::submitCoalescedAppends() {
+    if (this->coalescedAppendsCount == 0) {
+        return;
+    }
+
+    auto ret = executeCommandListImmediateWithFlushTask(this->coalescedPerformMigration, this->coalescedHasStallingCmds, false, this->coalescedKernelOperation);
+    if (ret != ZE_RESULT_SUCCESS) {
+        this->coalescedFlushResult = ret;
+    }
+
+    auto &statistics = this->coalescingStatistics;
+    statistics.flushCount++;
+    statistics.appendCount += this->coalescedAppendsCount;
+    statistics.maxAppendsPerFlush = std::max(statistics.maxAppendsPerFlush, this->coalescedAppendsCount);
+    auto bucket = std::min(static_cast<uint32_t>(Math::log2(this->coalescedAppendsCount)), AppendCoalescingStatistics::histogramBucketCount - 1);
+    statistics.appendsPerFlushHistogram[bucket]++;
+
+    this->coalescedAppendsCount = 0;
+    this->coalescedPerformMigration = false;
+    this->coalescedHasStallingCmds = false;
+    this->coalescedKernelOperation = false;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamilyImmediate<gfxCoreFamily>::prepareCoalescedKernelDispatch(Kernel &kernel, const CmdListKernelLaunchParams &launchParams, const ze_group_count_t &threadGroupDimensions) {
+    if (this->coalescedAppendsCount == 0) {
+        return;
+    }
+
+    // stream state and heaps are programmed once per flush, so batch has to be closed before they change
+    if (!isCoalescedStreamStateCompatible(kernel, launchParams, threadGroupDimensions) || !isCoalescedHeapSpaceAvailable(kernel)) {
+        submitCoalescedAppends();
+    }
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamilyImmediate<gfxCoreFamily>::isCoalescedStreamStateCompatible(Kernel &kernel, const CmdListKernelLaunchParams &launchParams, const ze_group_count_t &threadGroupDimensions) {
+    auto currentStreamState = this->requiredStreamState;
+    this->updateStreamProperties(kernel, launchParams.isCooperative, threadGroupDimensions, launchParams.isIndirect);
+    auto &kernelStreamState = this->requiredStreamState;
+
+    bool compatible = currentStreamState.frontEndState.computeDispatchAllWalkerEnable.value == kernelStreamState.frontEndState.computeDispatchAllWalkerEnable.value &&
+                      currentStreamState.frontEndState.disableEUFusion.value == kernelStreamState.frontEndState.disableEUFusion.value &&
+                      currentStreamState.stateComputeMode.largeGrfMode.value == kernelStreamState.stateComputeMode.largeGrfMode.value &&
+                      currentStreamState.stateComputeMode.threadArbitrationPolicy.value == kernelStreamState.stateComputeMode.threadArbitrationPolicy.value &&
+                      currentStreamState.pipelineSelect.systolicMode.value == kernelStreamState.pipelineSelect.systolicMode.value &&
+                      currentStreamState.stateBaseAddress.statelessMocs.value == kernelStreamState.stateBaseAddress.statelessMocs.value;
+
+    this->requiredStreamState = currentStreamState;
+    return compatible;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamilyImmediate<gfxCoreFamily>::isCoalescedHeapSpaceAvailable(Kernel &kernel) {
+    auto &gfxCoreHelper = this->device->getGfxCoreHelper();
+    auto &kernelDescriptor = kernel.getKernelDescriptor();
+
+    size_t iohSize = kernel.getPerThreadDataSizeForWholeThreadGroup() + kernel.getCrossThreadDataSize() +
+                     NEO::ImplicitArgsHelper::getSizeForImplicitArgsPatching(kernel.getImplicitArgs(), kernelDescriptor, !kernel.requiresGenerationOfLocalIdsByRuntime(), gfxCoreHelper);
+    iohSize = alignUp(iohSize, GfxFamily::WALKER_TYPE::INDIRECTDATASTARTADDRESS_ALIGN_SIZE) + GfxFamily::WALKER_TYPE::INDIRECTDATASTARTADDRESS_ALIGN_SIZE;
+    auto ioh = this->commandContainer.getIndirectHeap(NEO::IndirectHeap::Type::INDIRECT_OBJECT);
+    if (ioh->getAvailableSpace() < iohSize) {
+        return false;
+    }
+
+    if (this->cmdListHeapAddressModel == NEO::HeapAddressModel::GlobalStateless) {
+        return true;
+    }
+
+    auto &kernelInfo = *kernel.getImmutableData()->getKernelInfo();
+    auto ssh = this->commandContainer.getIndirectHeap(NEO::IndirectHeap::Type::SURFACE_STATE);
+    size_t sshSize = NEO::EncodeDispatchKernel<GfxFamily>::getSizeRequiredSsh(kernelInfo) + NEO::EncodeDispatchKernel<GfxFamily>::getDefaultSshAlignment();
+    if (ssh && ssh->getAvailableSpace() < sshSize) {
+        return false;
+    }
+
+    auto dsh = this->commandContainer.getIndirectHeap(NEO::IndirectHeap::Type::DYNAMIC_STATE);
+    if (this->dynamicHeapRequired && dsh) {
+        size_t dshSize = NEO::EncodeDispatchKernel<GfxFamily>::getSizeRequiredDsh(kernelDescriptor, this->commandContainer.getNumIddPerBlock()) + NEO::EncodeDispatchKernel<GfxFamily>::getDefaultDshAlignment();
+        if (dsh->getAvailableSpace() < dshSize) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamilyImmediate<gfxCoreFamily>::printAppendCoalescingStatistics() const {
+    auto &statistics = this->coalescingStatistics;
+    printf("Immediate command list %p append coalescing: appends %" PRIu64 ", flushes %" PRIu64 ", max appends per flush %u\n",
+           this, statistics.appendCount, statistics.flushCount, statistics.maxAppendsPerFlush);
+    for (uint32_t bucket = 0; bucket < AppendCoalescingStatistics::histogramBucketCount; bucket++) {
+        auto lowerBound = 1u << bucket;
+        if (bucket == AppendCoalescingStatistics::histogramBucketCount - 1) {
+            printf("  %u+ appends: %" PRIu64 " flushes\n", lowerBound, statistics.appendsPerFlushHistogram[bucket]);
+        } else {
+            printf("  %u-%u appends: %" PRIu64 " flushes\n", lowerBound, (lowerBound << 1) - 1, statistics.appendsPerFlushHistogram[bucket]);
+        }
+    }
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 bool CommandListCoreFamilyImmediate<gfxCoreFamily>::preferCopyThroughLockedPtr(CpuMemCopyInfo &cpuMemCopyInfo, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
     if (NEO::DebugManager.flags.ExperimentalForceCopyThroughLock.get() == 1) {
@@ -1029,6 +1275,11 @@ bool CommandListCoreFamilyImmediate<gfxCoreFamily>::isSuitableUSMSharedAlloc(NEO
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::performCpuMemcpy(const CpuMemCopyInfo &cpuMemCopyInfo, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    auto ret = flushCoalescedAppends();
+    if (ret != ZE_RESULT_SUCCESS) {
+        return ret;
+    }
+
     bool lockingFailed = false;
     auto srcLockPointer = obtainLockedPtrFromDevice(cpuMemCopyInfo.srcAllocData, const_cast<void *>(cpuMemCopyInfo.srcPtr), lockingFailed);
     if (lockingFailed) {
@@ -1282,6 +1533,10 @@ void CommandListCoreFamilyImmediate<gfxCoreFamily>::checkAssert() {
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 bool CommandListCoreFamilyImmediate<gfxCoreFamily>::isRelaxedOrderingDispatchAllowed(uint32_t numWaitEvents) const {
+    if (this->appendCoalescingEnabled) {
+        return false;
+    }
+
     auto numEvents = numWaitEvents + (this->hasInOrderDependencies() ? 1 : 0);
 
     return NEO::RelaxedOrderingHelper::isRelaxedOrderingDispatchAllowed(*this->csr, numEvents);
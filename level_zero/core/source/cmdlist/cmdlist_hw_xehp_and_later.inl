@@ -111,6 +111,8 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(K
         }
     }
 
+    this->prepareCoalescedKernelDispatch(*kernel, launchParams, threadGroupDimensions);
+
     auto kernelInfo = kernelImmutableData->getKernelInfo();
 
     NEO::IndirectHeap *ssh = nullptr;
@@ -280,6 +282,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(K
         dsh,                                                    // dynamicStateHeap
         reinterpret_cast<const void *>(&threadGroupDimensions), // threadGroupDimensions
         nullptr,                                                // outWalkerPtr
+        nullptr,                                                // outCrossThreadDataPtr
         &additionalCommands,                                    // additionalCommands
         kernelPreemptionMode,                                   // preemptionMode
         this->partitionCount,                                   // partitionCount
@@ -315,6 +318,18 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(K
         this->containsStatelessUncachedResource = dispatchKernelArgs.requiresUncachedMocs;
     }
 
+    if (launchParams.outMutableKernelCommand) {
+        auto &mutableCommand = *launchParams.outMutableKernelCommand;
+        auto walker = reinterpret_cast<typename GfxFamily::COMPUTE_WALKER *>(dispatchKernelArgs.outWalkerPtr);
+        mutableCommand.walker = walker;
+        mutableCommand.crossThreadDataSize = kernel->getCrossThreadDataSize();
+        if (NEO::EncodeDispatchKernel<GfxFamily>::inlineDataProgrammingRequired(kernelDescriptor)) {
+            mutableCommand.inlineData = walker->getInlineDataPointer();
+            mutableCommand.inlineDataSize = std::min(static_cast<uint32_t>(sizeof(typename GfxFamily::INLINE_DATA)), mutableCommand.crossThreadDataSize);
+        }
+        mutableCommand.indirectCrossThreadData = dispatchKernelArgs.outCrossThreadDataPtr;
+    }
+
     if (compactEvent) {
         appendEventForProfilingAllWalkers(compactEvent, false, true);
     } else if (event) {
@@ -403,6 +418,28 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(K
     return ZE_RESULT_SUCCESS;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamily<gfxCoreFamily>::isMutableKernelDispatchSupported() const {
+    return true;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::patchMutableWalker(const MutableKernelCommand &command) {
+    auto walker = reinterpret_cast<typename GfxFamily::COMPUTE_WALKER *>(command.walker);
+    walker->setThreadGroupIdXDimension(command.groupCount.groupCountX);
+    walker->setThreadGroupIdYDimension(command.groupCount.groupCountY);
+    walker->setThreadGroupIdZDimension(command.groupCount.groupCountZ);
+
+    // thread group dispatch size is selected for the group count, encoder reprograms it the same way
+    auto neoDevice = device->getNEODevice();
+    auto threadGroupCount = command.groupCount.groupCountX * command.groupCount.groupCountY * command.groupCount.groupCountZ;
+    NEO::EncodeDispatchKernel<GfxFamily>::adjustInterfaceDescriptorData(walker->getInterfaceDescriptor(), *neoDevice, neoDevice->getHardwareInfo(), threadGroupCount,
+                                                                        command.kernel->getKernelDescriptor().kernelAttributes.numGrfRequired, *walker);
+    if (command.signalEventAddress != 0) {
+        walker->getPostSync().setDestinationAddress(command.signalEventAddress);
+    }
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 void CommandListCoreFamily<gfxCoreFamily>::appendMultiPartitionPrologue(uint32_t partitionDataSize) {
     NEO::ImplicitScalingDispatch<GfxFamily>::dispatchOffsetRegister(*commandContainer.getCommandStream(),
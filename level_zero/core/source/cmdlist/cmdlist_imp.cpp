@@ -177,6 +177,10 @@ CommandList *CommandList::createImmediate(uint32_t productFamily, Device *device
             auto &rootDeviceEnvironment = device->getNEODevice()->getRootDeviceEnvironment();
             bool enabledCmdListSharing = !NEO::EngineHelper::isCopyOnlyEngineType(engineGroupType) && commandList->isFlushTaskSubmissionEnabled;
             commandList->immediateCmdListHeapSharing = L0GfxCoreHelper::enableImmediateCmdListHeapSharing(rootDeviceEnvironment, enabledCmdListSharing);
+
+            if (NEO::DebugManager.flags.ImmediateCmdListAppendCoalescing.get() == 1) {
+                commandList->appendCoalescingEnabled = commandList->isFlushTaskSubmissionEnabled && !commandList->isSyncModeQueue && !commandList->immediateCmdListHeapSharing;
+            }
         }
         csr->initializeResources();
         csr->initDirectSubmission();
@@ -21,6 +21,7 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/product_helper.h"
+#include "shared/source/utilities/deferred_submission_flusher.h"
 
 #include "level_zero/core/source/cmdqueue/cmdqueue_imp.h"
 #include "level_zero/core/source/device/device.h"
@@ -147,6 +148,10 @@ NEO::SubmissionStatus CommandQueueImp::submitBatchBuffer(size_t offset, NEO::Res
 }
 
 ze_result_t CommandQueueImp::synchronize(uint64_t timeout) {
+    if (NEO::DeferredSubmissionFlusher::isEnabled()) {
+        device->getNEODevice()->getDeferredSubmissionFlusher()->flushClientsOf(csr);
+    }
+
     if ((timeout == std::numeric_limits<uint64_t>::max()) && useKmdWaitFunction) {
         auto &waitPair = buffers.getCurrentFlushStamp();
         const auto waitStatus = csr->waitForTaskCountWithKmdNotifyFallback(waitPair.first, waitPair.second, false, NEO::QueueThrottle::MEDIUM);
@@ -389,7 +389,7 @@ void ContextImp::freePeerAllocations(const void *ptr, bool blocking, Device *dev
         } else {
             this->driverHandle->svmAllocsManager->freeSVMAlloc(peerPtr, blocking);
         }
-        deviceImp->peerAllocations.allocations.erase(iter);
+        deviceImp->peerAllocations.erase(iter);
     }
 
     for (auto &subDevice : deviceImp->subDevices) {
@@ -13,6 +13,8 @@
 
 #include "level_zero/core/source/device/device_imp.h"
 
+#include <algorithm>
+
 namespace L0 {
 
 bool BcsSplit::setupDevice(uint32_t productFamily, bool internalUsage, const ze_command_queue_desc_t *desc, NEO::CommandStreamReceiver *csr) {
@@ -66,6 +68,18 @@ bool BcsSplit::setupDevice(uint32_t productFamily, bool internalUsage, const ze_
         this->cmdQs.push_back(commandQueue);
     }
 
+    {
+        std::lock_guard<std::mutex> loadsLock(this->engineLoadsMtx);
+        this->engineLoads.resize(csrs.size());
+        for (size_t i = 0; i < csrs.size(); i++) {
+            this->engineLoads[i].csr = csrs[i];
+        }
+    }
+    this->loadAwareSplit = NEO::DebugManager.flags.SplitBcsLoadAware.get() == 1;
+    if (NEO::DebugManager.flags.SplitBcsMinChunkSize.get() != -1) {
+        this->minChunkSize = NEO::DebugManager.flags.SplitBcsMinChunkSize.get() * MemoryConstants::kiloByte;
+    }
+
     if (NEO::DebugManager.flags.SplitBcsMaskH2D.get() > 0) {
         this->h2dEngines = NEO::DebugManager.flags.SplitBcsMaskH2D.get();
     }
@@ -100,6 +114,10 @@ void BcsSplit::releaseResources() {
         cmdQs.clear();
         d2hCmdQs.clear();
         h2dCmdQs.clear();
+        {
+            std::lock_guard<std::mutex> loadsLock(this->engineLoadsMtx);
+            engineLoads.clear();
+        }
         this->events.releaseResources();
     }
 }
@@ -114,9 +132,87 @@ std::vector<CommandQueue *> &BcsSplit::getCmdQsForSplit(NEO::TransferDirection d
     return this->cmdQs;
 }
 
+BcsSplit::EngineLoad &BcsSplit::getEngineLoad(CommandQueue *cmdQ) {
+    auto index = std::distance(this->cmdQs.begin(), std::find(this->cmdQs.begin(), this->cmdQs.end(), cmdQ));
+    return this->engineLoads[index];
+}
+
+void BcsSplit::retireCompletedCopies(EngineLoad &engineLoad) {
+    auto completedTaskCount = *engineLoad.csr->getTagAddress();
+    auto &pendingCopies = engineLoad.pendingCopies;
+    while (!pendingCopies.empty() &&
+           (pendingCopies.front().first <= completedTaskCount || pendingCopies.size() > maxPendingCopiesPerEngine)) {
+        engineLoad.inFlightBytes -= pendingCopies.front().second;
+        pendingCopies.pop_front();
+    }
+}
+
+void BcsSplit::recordSubmission(CommandQueue *cmdQ, size_t size) {
+    if (!this->loadAwareSplit) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(this->engineLoadsMtx);
+    auto &engineLoad = getEngineLoad(cmdQ);
+    engineLoad.pendingCopies.push_back({engineLoad.csr->peekTaskCount(), size});
+    engineLoad.inFlightBytes += size;
+    retireCompletedCopies(engineLoad);
+}
+
+void BcsSplit::getChunkSizesForSplit(const std::vector<CommandQueue *> &cmdQsForSplit, size_t size, StackVec<size_t, 4> &chunkSizes) {
+    auto engineCount = cmdQsForSplit.size();
+    chunkSizes.resize(engineCount, 0u);
+
+    if (!this->loadAwareSplit) {
+        auto remainingSize = size;
+        for (size_t i = 0; i < engineCount; i++) {
+            chunkSizes[i] = remainingSize / (engineCount - i);
+            remainingSize -= chunkSizes[i];
+        }
+        return;
+    }
+
+    // use least loaded engines, no more than transfer size allows with minimal chunk size
+    StackVec<std::pair<size_t, size_t>, 4> loads;
+    {
+        std::lock_guard<std::mutex> lock(this->engineLoadsMtx);
+        for (size_t i = 0; i < engineCount; i++) {
+            auto &engineLoad = getEngineLoad(cmdQsForSplit[i]);
+            retireCompletedCopies(engineLoad);
+            loads.push_back({engineLoad.inFlightBytes, i});
+        }
+    }
+    std::sort(loads.begin(), loads.end());
+
+    auto usedEngines = std::clamp<size_t>(size / std::max<size_t>(this->minChunkSize, 1u), 1u, engineCount);
+
+    // fill engines up to common level of in flight bytes, skip engines already above that level
+    size_t level = 0u;
+    while (true) {
+        size_t loadsSum = 0u;
+        for (size_t i = 0; i < usedEngines; i++) {
+            loadsSum += loads[i].first;
+        }
+        level = (loadsSum + size) / usedEngines;
+        if (usedEngines == 1u || loads[usedEngines - 1].first < level) {
+            break;
+        }
+        usedEngines--;
+    }
+
+    auto remainingSize = size;
+    for (size_t i = 0; i < usedEngines; i++) {
+        auto chunkSize = (i == usedEngines - 1) ? remainingSize : std::min(remainingSize, level - loads[i].first);
+        chunkSizes[loads[i].second] = chunkSize;
+        remainingSize -= chunkSize;
+    }
+}
+
 size_t BcsSplit::Events::obtainForSplit(Context *context, size_t maxEventCountInPool) {
     std::lock_guard<std::mutex> lock(this->mtx);
-    for (size_t i = 0; i < this->marker.size(); i++) {
+    // markers are reused in submission order, so oldest one is the most likely to be already completed
+    for (size_t checked = 0; checked < this->marker.size(); checked++) {
+        auto i = (this->nextMarkerToCheck + checked) % this->marker.size();
         auto ret = this->marker[i]->queryStatus();
         if (ret == ZE_RESULT_SUCCESS) {
             this->marker[i]->reset();
@@ -124,6 +220,7 @@ size_t BcsSplit::Events::obtainForSplit(Context *context, size_t maxEventCountIn
             for (size_t j = 0; j < this->bcsSplit.cmdQs.size(); j++) {
                 this->subcopy[i * this->bcsSplit.cmdQs.size() + j]->reset();
             }
+            this->nextMarkerToCheck = (i + 1) % this->marker.size();
             return i;
         }
     }
@@ -197,5 +294,6 @@ void BcsSplit::Events::releaseResources() {
         pool->destroy();
     }
     pools.clear();
+    nextMarkerToCheck = 0u;
 }
 } // namespace L0
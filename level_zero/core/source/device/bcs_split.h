@@ -16,6 +16,7 @@
 #include "level_zero/core/source/context/context.h"
 #include "level_zero/core/source/event/event.h"
 
+#include <deque>
 #include <functional>
 #include <mutex>
 #include <vector>
@@ -43,6 +44,7 @@ struct BcsSplit {
         std::vector<Event *> subcopy;
         std::vector<Event *> marker;
         size_t createdFromLatestPool = 0u;
+        size_t nextMarkerToCheck = 0u;
 
         size_t obtainForSplit(Context *context, size_t maxEventCountInPool);
         size_t allocateNew(Context *context, size_t maxEventCountInPool);
@@ -56,6 +58,19 @@ struct BcsSplit {
     std::vector<CommandQueue *> h2dCmdQs;
     std::vector<CommandQueue *> d2hCmdQs;
 
+    // copies submitted to given split engine that were not yet observed as completed
+    struct EngineLoad {
+        NEO::CommandStreamReceiver *csr = nullptr;
+        std::deque<std::pair<TaskCountType, size_t>> pendingCopies;
+        size_t inFlightBytes = 0u;
+    };
+    static constexpr size_t maxPendingCopiesPerEngine = 64u;
+
+    std::mutex engineLoadsMtx;
+    std::vector<EngineLoad> engineLoads;
+    bool loadAwareSplit = false;
+    size_t minChunkSize = MemoryConstants::megaByte;
+
     NEO::BcsInfoMask engines = NEO::EngineHelpers::oddLinkedCopyEnginesMask;
     NEO::BcsInfoMask h2dEngines = NEO::EngineHelpers::h2dCopyEngineMask;
     NEO::BcsInfoMask d2hEngines = NEO::EngineHelpers::d2hCopyEngineMask;
@@ -85,12 +100,18 @@ struct BcsSplit {
         StackVec<ze_event_handle_t, 4> eventHandles;
 
         auto &cmdQsForSplit = this->getCmdQsForSplit(direction);
+        StackVec<size_t, 4> chunkSizes;
+        this->getChunkSizesForSplit(cmdQsForSplit, size, chunkSizes);
 
         auto signalEvent = Event::fromHandle(hSignalEvent);
 
-        auto totalSize = size;
-        auto engineCount = cmdQsForSplit.size();
+        size_t offset = 0u;
         for (size_t i = 0; i < cmdQsForSplit.size(); i++) {
+            auto localSize = chunkSizes[i];
+            if (localSize == 0u) {
+                continue;
+            }
+
             if (barrierRequired) {
                 auto barrierEventHandle = this->events.barrier[markerEventIndex]->toHandle();
                 cmdList->addEventsToCmdList(1u, &barrierEventHandle, hasRelaxedOrderingDependencies, false, true);
@@ -98,13 +119,12 @@ struct BcsSplit {
 
             cmdList->addEventsToCmdList(numWaitEvents, phWaitEvents, hasRelaxedOrderingDependencies, false, true);
 
-            if (signalEvent && i == 0u) {
+            if (signalEvent && eventHandles.empty()) {
                 cmdList->appendEventForProfilingAllWalkers(signalEvent, true, true);
             }
 
-            auto localSize = totalSize / engineCount;
-            auto localDstPtr = ptrOffset(dstptr, size - totalSize);
-            auto localSrcPtr = ptrOffset(srcptr, size - totalSize);
+            auto localDstPtr = ptrOffset(dstptr, offset);
+            auto localSrcPtr = ptrOffset(srcptr, offset);
 
             auto eventHandle = this->events.subcopy[subcopyEventIndex + i]->toHandle();
             result = appendCall(localDstPtr, localSrcPtr, localSize, eventHandle);
@@ -115,17 +135,17 @@ struct BcsSplit {
                 cmdList->executeCommandListImmediateImpl(performMigration, cmdQsForSplit[i]);
             }
 
+            this->recordSubmission(cmdQsForSplit[i], localSize);
             eventHandles.push_back(eventHandle);
 
-            totalSize -= localSize;
-            engineCount--;
+            offset += localSize;
 
             if (signalEvent) {
                 signalEvent->appendAdditionalCsr(static_cast<CommandQueueImp *>(cmdQsForSplit[i])->getCsr());
             }
         }
 
-        cmdList->addEventsToCmdList(static_cast<uint32_t>(cmdQsForSplit.size()), eventHandles.data(), hasRelaxedOrderingDependencies, false, true);
+        cmdList->addEventsToCmdList(static_cast<uint32_t>(eventHandles.size()), eventHandles.data(), hasRelaxedOrderingDependencies, false, true);
         if (signalEvent) {
             cmdList->appendEventForProfilingAllWalkers(signalEvent, false, true);
         }
@@ -142,6 +162,10 @@ struct BcsSplit {
     bool setupDevice(uint32_t productFamily, bool internalUsage, const ze_command_queue_desc_t *desc, NEO::CommandStreamReceiver *csr);
     void releaseResources();
     std::vector<CommandQueue *> &getCmdQsForSplit(NEO::TransferDirection direction);
+    void getChunkSizesForSplit(const std::vector<CommandQueue *> &cmdQsForSplit, size_t size, StackVec<size_t, 4> &chunkSizes);
+    void recordSubmission(CommandQueue *cmdQ, size_t size);
+    EngineLoad &getEngineLoad(CommandQueue *cmdQ);
+    static void retireCompletedCopies(EngineLoad &engineLoad);
 
     BcsSplit(DeviceImp &device) : device(device), events(*this){};
 };
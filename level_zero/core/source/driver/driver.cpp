@@ -17,6 +17,7 @@
 #include "level_zero/core/source/device/device.h"
 #include "level_zero/core/source/driver/driver_handle_imp.h"
 #include "level_zero/core/source/driver/driver_imp.h"
+#include "level_zero/experimental/source/tracing/tracing_recorder.h"
 #include "level_zero/tools/source/metrics/metric.h"
 
 #include <memory>
@@ -90,6 +91,10 @@ void DriverImp::initialize(ze_result_t *result) {
                     GlobalDriver = nullptr;
                 }
             }
+
+            if (*result == ZE_RESULT_SUCCESS) {
+                TraceRecorder::createGlobal();
+            }
         }
     }
 }
@@ -160,6 +160,7 @@ DriverHandleImp::~DriverHandleImp() {
         memoryManager->peekExecutionEnvironment().prepareForCleanup();
         if (this->svmAllocsManager) {
             this->svmAllocsManager->trimUSMDeviceAllocCache();
+            this->svmAllocsManager->trimUSMHostAllocCache();
         }
     }
 
@@ -182,6 +183,7 @@ DriverHandleImp::~DriverHandleImp() {
 
     if (this->svmAllocsManager) {
         this->svmAllocsManager->trimUSMDeviceAllocCache();
+        this->svmAllocsManager->trimUSMHostAllocCache();
         delete this->svmAllocsManager;
         this->svmAllocsManager = nullptr;
     }
@@ -14,6 +14,8 @@
 #include "shared/source/memory_manager/memory_operations_handler.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/os_time.h"
+#include "shared/source/utilities/deferred_submission_flusher.h"
+#include "shared/source/utilities/host_wait_multiplexer.h"
 
 #include "level_zero/core/source/event/event_imp.h"
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
@@ -444,10 +446,20 @@ ze_result_t EventImp<TagSizeT>::hostSynchronize(uint64_t timeout) {
         timeout = NEO::DebugManager.flags.OverrideEventSynchronizeTimeout.get();
     }
 
+    if (NEO::DeferredSubmissionFlusher::isEnabled()) {
+        device->getNEODevice()->getDeferredSubmissionFlusher()->flushClientsOf(this->csrs[0]);
+    }
+
+    const bool useUserFenceWait = NEO::DebugManager.flags.WaitForUserFenceOnEventHostSynchronize.get() == 1 && this->inOrderExecEvent;
+    NEO::HostWaitMultiplexer *hostWaitMultiplexer = nullptr;
+    if (!useUserFenceWait && timeout != 0 && NEO::HostWaitMultiplexer::isEnabled()) {
+        hostWaitMultiplexer = device->getNEODevice()->getHostWaitMultiplexer();
+    }
+
     waitStartTime = std::chrono::high_resolution_clock::now();
     lastHangCheckTime = waitStartTime;
     do {
-        if (NEO::DebugManager.flags.WaitForUserFenceOnEventHostSynchronize.get() == 1 && this->inOrderExecEvent) {
+        if (useUserFenceWait) {
             ret = waitForUserFence(timeout);
         } else {
             ret = queryStatus();
@@ -476,6 +488,19 @@ ze_result_t EventImp<TagSizeT>::hostSynchronize(uint64_t timeout) {
             }
         }
 
+        if (hostWaitMultiplexer) {
+            auto parkTime = this->gpuHangCheckPeriod;
+            if (timeout != std::numeric_limits<uint64_t>::max()) {
+                uint64_t elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(currentTime - waitStartTime).count();
+                uint64_t remainingTime = elapsedTime < timeout ? timeout - elapsedTime : 0;
+                parkTime = std::min(parkTime, std::chrono::microseconds(remainingTime / 1000));
+            }
+            if (parkTime.count() > 0) {
+                hostWaitMultiplexer->wait([this]() { return queryStatus() == ZE_RESULT_SUCCESS; }, parkTime);
+                currentTime = std::chrono::high_resolution_clock::now();
+            }
+        }
+
         if (timeout == std::numeric_limits<uint64_t>::max()) {
             continue;
         } else if (timeout == 0) {
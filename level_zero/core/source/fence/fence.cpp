@@ -8,8 +8,11 @@
 #include "level_zero/core/source/fence/fence.h"
 
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/device/device.h"
+#include "shared/source/utilities/deferred_submission_flusher.h"
 
 #include "level_zero/core/source/cmdqueue/cmdqueue_imp.h"
+#include "level_zero/core/source/device/device.h"
 
 namespace L0 {
 namespace FenceDefinition {
@@ -61,6 +64,10 @@ ze_result_t Fence::hostSynchronize(uint64_t timeout) {
         return ZE_RESULT_NOT_READY;
     }
 
+    if (NEO::DeferredSubmissionFlusher::isEnabled()) {
+        cmdQueue->getDevice()->getNEODevice()->getDeferredSubmissionFlusher()->flushClientsOf(csr);
+    }
+
     waitStartTime = std::chrono::high_resolution_clock::now();
     lastHangCheckTime = waitStartTime;
     do {
@@ -25,6 +25,10 @@ std::unordered_map<std::string, void *> getExtensionFunctionsLookupMap() {
 
     addToMap(lookupMap, zexCommandListAppendWaitOnMemory);
     addToMap(lookupMap, zexCommandListAppendWriteToMemory);
+    addToMap(lookupMap, zexCommandListAppendMutableLaunchKernel);
+    addToMap(lookupMap, zexCommandListUpdateMutableKernelArgument);
+    addToMap(lookupMap, zexCommandListUpdateMutableGroupCount);
+    addToMap(lookupMap, zexCommandListUpdateMutableSignalEvent);
 #undef addToMap
 
     return lookupMap;
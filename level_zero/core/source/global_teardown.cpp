@@ -6,11 +6,13 @@
  */
 
 #include "level_zero/core/source/driver/driver_handle_imp.h"
+#include "level_zero/experimental/source/tracing/tracing_recorder.h"
 #include "level_zero/sysman/source/driver/sysman_driver_handle_imp.h"
 
 namespace L0 {
 
 void globalDriverTeardown() {
+    TraceRecorder::destroyGlobal();
     if (GlobalDriver != nullptr) {
         delete GlobalDriver;
         GlobalDriver = nullptr;
@@ -17,6 +17,7 @@
 #include <level_zero/zet_api.h>
 
 #include <memory>
+#include <mutex>
 #include <vector>
 
 struct _ze_kernel_handle_t {};
@@ -82,7 +83,14 @@ struct KernelImmutableData {
     MOCKABLE_VIRTUAL void createRelocatedDebugData(NEO::GraphicsAllocation *globalConstBuffer,
                                                    NEO::GraphicsAllocation *globalVarBuffer);
 
+    // when set, parts of initialization touching state shared between kernels are serialized with this mutex
+    void setSharedStateMutex(std::mutex *mutex) { sharedStateMutex = mutex; }
+
   protected:
+    std::unique_lock<std::mutex> lockSharedState() {
+        return sharedStateMutex ? std::unique_lock<std::mutex>(*sharedStateMutex) : std::unique_lock<std::mutex>();
+    }
+
     Device *device = nullptr;
     NEO::KernelInfo *kernelInfo = nullptr;
     NEO::KernelDescriptor *kernelDescriptor = nullptr;
@@ -101,6 +109,7 @@ struct KernelImmutableData {
     std::unique_ptr<uint8_t[]> dynamicStateHeapTemplate = nullptr;
 
     std::vector<NEO::GraphicsAllocation *> residencyContainer;
+    std::mutex *sharedStateMutex = nullptr;
 
     bool isaCopiedToAllocation = false;
 };
@@ -25,7 +25,19 @@ void PageFaultManager::transferToCpu(void *ptr, size_t size, void *device) {
     auto ret =
         deviceImp->pageFaultCommandList->appendPageFaultCopy(allocData->cpuAllocation,
                                                              allocData->gpuAllocations.getGraphicsAllocation(deviceImp->getRootDeviceIndex()),
-                                                             allocData->size, true);
+                                                             0u, allocData->size, true);
+    UNRECOVERABLE_IF(ret);
+}
+void PageFaultManager::transferRangeToCpu(void *ptr, size_t offset, size_t size, void *device) {
+    L0::DeviceImp *deviceImp = static_cast<L0::DeviceImp *>(device);
+
+    NEO::SvmAllocationData *allocData = deviceImp->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(ptr);
+    UNRECOVERABLE_IF(allocData == nullptr);
+
+    auto ret =
+        deviceImp->pageFaultCommandList->appendPageFaultCopy(allocData->cpuAllocation,
+                                                             allocData->gpuAllocations.getGraphicsAllocation(deviceImp->getRootDeviceIndex()),
+                                                             offset, size, true);
     UNRECOVERABLE_IF(ret);
 }
 void PageFaultManager::transferToGpu(void *ptr, void *device) {
@@ -37,7 +49,21 @@ void PageFaultManager::transferToGpu(void *ptr, void *device) {
     auto ret =
         deviceImp->pageFaultCommandList->appendPageFaultCopy(allocData->gpuAllocations.getGraphicsAllocation(deviceImp->getRootDeviceIndex()),
                                                              allocData->cpuAllocation,
-                                                             allocData->size, false);
+                                                             0u, allocData->size, false);
+    UNRECOVERABLE_IF(ret);
+
+    this->evictMemoryAfterImplCopy(allocData->cpuAllocation, deviceImp->getNEODevice());
+}
+void PageFaultManager::transferRangeToGpu(void *ptr, size_t offset, size_t size, void *device) {
+    L0::DeviceImp *deviceImp = static_cast<L0::DeviceImp *>(device);
+
+    NEO::SvmAllocationData *allocData = deviceImp->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(ptr);
+    UNRECOVERABLE_IF(allocData == nullptr);
+
+    auto ret =
+        deviceImp->pageFaultCommandList->appendPageFaultCopy(allocData->gpuAllocations.getGraphicsAllocation(deviceImp->getRootDeviceIndex()),
+                                                             allocData->cpuAllocation,
+                                                             offset, size, false);
     UNRECOVERABLE_IF(ret);
 
     this->evictMemoryAfterImplCopy(allocData->cpuAllocation, deviceImp->getNEODevice());
@@ -39,6 +39,7 @@
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/program/program_initialization.h"
+#include "shared/source/utilities/worker_pool.h"
 
 #include "level_zero/core/source/device/device.h"
 #include "level_zero/core/source/driver/driver_handle.h"
@@ -52,6 +53,7 @@
 #include <algorithm>
 #include <list>
 #include <memory>
+#include <thread>
 #include <unordered_map>
 namespace L0 {
 
@@ -756,22 +758,60 @@ ze_result_t ModuleImp::initializeKernelImmutableDatas() {
         if (result = this->allocateKernelImmutableDatas(kernelsCount); result != ZE_RESULT_SUCCESS) {
             return result;
         }
+
+        std::vector<ze_result_t> results(kernelsCount, ZE_RESULT_SUCCESS);
+        auto initializeKernelsRange = [this, &results](size_t first, size_t last) {
+            for (size_t i = first; i < last; i++) {
+                kernelImmDatas[i]->setSharedStateMutex(&this->kernelsInitializationMutex);
+                results[i] = kernelImmDatas[i]->initialize(this->translationUnit->programInfo.kernelInfos[i],
+                                                           device,
+                                                           device->getNEODevice()->getDeviceInfo().computeUnitsUsedForScratch,
+                                                           this->translationUnit->globalConstBuffer,
+                                                           this->translationUnit->globalVarBuffer,
+                                                           this->type == ModuleType::Builtin);
+                kernelImmDatas[i]->setSharedStateMutex(nullptr);
+            }
+        };
+
+        auto numWorkers = this->getNumWorkersForKernelsInitialization(kernelsCount);
+        if (numWorkers <= 1) {
+            initializeKernelsRange(0lu, kernelsCount);
+        } else {
+            // each task gets a contiguous range of kernels, ranges are picked up by calling thread and shared worker pool
+            auto kernelsPerRange = (kernelsCount + numWorkers - 1) / numWorkers;
+            auto numRanges = (kernelsCount + kernelsPerRange - 1) / kernelsPerRange;
+            auto workerPool = device->getNEODevice()->getExecutionEnvironment()->getWorkerPool();
+            workerPool->runTasks(numRanges, [&](size_t range) {
+                auto first = range * kernelsPerRange;
+                initializeKernelsRange(first, std::min(first + kernelsPerRange, kernelsCount));
+            });
+        }
+
+        result = ZE_RESULT_SUCCESS;
         for (size_t i = 0lu; i < kernelsCount; i++) {
-            result = kernelImmDatas[i]->initialize(this->translationUnit->programInfo.kernelInfos[i],
-                                                   device,
-                                                   device->getNEODevice()->getDeviceInfo().computeUnitsUsedForScratch,
-                                                   this->translationUnit->globalConstBuffer,
-                                                   this->translationUnit->globalVarBuffer,
-                                                   this->type == ModuleType::Builtin);
-            if (result != ZE_RESULT_SUCCESS) {
+            if (results[i] != ZE_RESULT_SUCCESS) {
                 kernelImmDatas[i].reset();
-                return result;
+                if (result == ZE_RESULT_SUCCESS) {
+                    result = results[i];
+                }
             }
         }
+        return result;
     }
     return ZE_RESULT_SUCCESS;
 }
 
+size_t ModuleImp::getNumWorkersForKernelsInitialization(size_t kernelsCount) const {
+    size_t maxWorkers = defaultMaxKernelsInitializationWorkers;
+    if (NEO::DebugManager.flags.ModuleInitializationWorkers.get() != -1) {
+        maxWorkers = static_cast<size_t>(std::max(NEO::DebugManager.flags.ModuleInitializationWorkers.get(), 1));
+    } else {
+        maxWorkers = std::min(maxWorkers, static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 1u)));
+        maxWorkers = std::min(maxWorkers, std::max(kernelsCount / minKernelsPerInitializationWorker, static_cast<size_t>(1u)));
+    }
+    return std::min(maxWorkers, kernelsCount);
+}
+
 ze_result_t ModuleImp::allocateKernelImmutableDatas(size_t kernelsCount) {
     if (this->kernelImmDatas.size() == kernelsCount) {
         return ZE_RESULT_SUCCESS;
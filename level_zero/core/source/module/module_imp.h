@@ -17,6 +17,7 @@
 
 #include <list>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 
@@ -89,6 +90,9 @@ struct ModuleTranslationUnit {
 };
 
 struct ModuleImp : public Module {
+    static constexpr size_t defaultMaxKernelsInitializationWorkers = 8u;
+    static constexpr size_t minKernelsPerInitializationWorker = 64u;
+
     ModuleImp() = delete;
 
     ModuleImp(Device *device, ModuleBuildLog *moduleBuildLog, ModuleType type);
@@ -160,6 +164,7 @@ struct ModuleImp : public Module {
     ze_result_t checkIfBuildShouldBeFailed(NEO::Device *neoDevice);
     ze_result_t allocateKernelImmutableDatas(size_t kernelsCount);
     ze_result_t initializeKernelImmutableDatas();
+    size_t getNumWorkersForKernelsInitialization(size_t kernelsCount) const;
     void copyPatchedSegments(const NEO::Linker::PatchableSegments &isaSegmentsForPatching);
     void verifyDebugCapabilities();
     void checkIfPrivateMemoryPerDispatchIsNeeded() override;
@@ -183,6 +188,7 @@ struct ModuleImp : public Module {
     NEO::GraphicsAllocation *exportedFunctionsSurface = nullptr;
     std::unique_ptr<NEO::GraphicsAllocation> kernelsIsaParentRegion;
     std::vector<std::unique_ptr<KernelImmutableData>> kernelImmDatas;
+    std::mutex kernelsInitializationMutex;
     NEO::Linker::RelocatedSymbolsMap symbols;
 
     struct HostGlobalSymbol {
@@ -89,6 +89,7 @@ struct WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>
     using BaseClass::isSyncModeQueue;
     using BaseClass::isTbxMode;
     using BaseClass::isTimestampEventForMultiTile;
+    using BaseClass::mutableKernelCommands;
     using BaseClass::partitionCount;
     using BaseClass::patternAllocations;
     using BaseClass::pipeControlMultiKernelEventSync;
@@ -211,6 +212,9 @@ struct MockCommandListImmediate : public CommandListCoreFamilyImmediate<gfxCoreF
     using BaseClass::checkAssert;
     using BaseClass::cmdListCurrentStartOffset;
     using BaseClass::cmdQImmediate;
+    using BaseClass::coalescedAppendsCount;
+    using BaseClass::coalescingMutex;
+    using BaseClass::coalescingStatistics;
     using BaseClass::commandContainer;
     using BaseClass::compactL3FlushEventPacket;
     using BaseClass::containsAnyKernel;
@@ -380,6 +384,7 @@ struct MockCommandList : public CommandList {
     ADDMETHOD_NOBASE(appendPageFaultCopy, ze_result_t, ZE_RESULT_SUCCESS,
                      (NEO::GraphicsAllocation * dstptr,
                       NEO::GraphicsAllocation *srcptr,
+                      size_t offset,
                       size_t size,
                       bool flushHost));
 
@@ -501,6 +506,28 @@ struct MockCommandList : public CommandList {
                      (void *desc, void *ptr,
                       uint64_t data));
 
+    ADDMETHOD_NOBASE(appendMutableLaunchKernel, ze_result_t, ZE_RESULT_SUCCESS,
+                     (ze_kernel_handle_t kernelHandle,
+                      const ze_group_count_t &threadGroupDimensions,
+                      ze_event_handle_t hSignalEvent,
+                      uint32_t numWaitEvents,
+                      ze_event_handle_t *phWaitEvents,
+                      uint64_t *pCommandId));
+
+    ADDMETHOD_NOBASE(updateMutableKernelArgument, ze_result_t, ZE_RESULT_SUCCESS,
+                     (uint64_t commandId,
+                      uint32_t argIndex,
+                      size_t argSize,
+                      const void *pArgValue));
+
+    ADDMETHOD_NOBASE(updateMutableGroupCount, ze_result_t, ZE_RESULT_SUCCESS,
+                     (uint64_t commandId,
+                      const ze_group_count_t &threadGroupDimensions));
+
+    ADDMETHOD_NOBASE(updateMutableSignalEvent, ze_result_t, ZE_RESULT_SUCCESS,
+                     (uint64_t commandId,
+                      ze_event_handle_t hSignalEvent));
+
     ADDMETHOD_NOBASE(executeCommandListImmediate, ze_result_t, ZE_RESULT_SUCCESS,
                      (bool perforMigration));
 
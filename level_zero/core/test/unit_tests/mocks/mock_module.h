@@ -109,6 +109,7 @@ struct MockModule : public L0::ModuleImp {
     using ModuleImp::computeKernelIsaAllocationAlignedSizeWithPadding;
     using ModuleImp::debugModuleHandle;
     using ModuleImp::getModuleAllocations;
+    using ModuleImp::getNumWorkersForKernelsInitialization;
     using ModuleImp::initializeKernelImmutableDatas;
     using ModuleImp::isaAllocationPageSize;
     using ModuleImp::isFunctionSymbolExportEnabled;
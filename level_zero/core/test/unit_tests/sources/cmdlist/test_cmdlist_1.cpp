@@ -1117,7 +1117,7 @@ HWTEST2_F(CommandListCreate, givenDirectSubmissionAndImmCmdListWhenDispatchingTh
 
     verifyFlags(commandList->appendSignalEvent(event), true, true);
 
-    verifyFlags(commandList->appendPageFaultCopy(kernel.getIsaAllocation(), kernel.getIsaAllocation(), 1, false), false, false);
+    verifyFlags(commandList->appendPageFaultCopy(kernel.getIsaAllocation(), kernel.getIsaAllocation(), 0u, 1, false), false, false);
 
     verifyFlags(commandList->appendWaitOnEvents(1, &event, false, true, false), true, true);
 
@@ -1491,7 +1491,7 @@ HWTEST2_F(CommandListCreate, givenDirectSubmissionAndImmCmdListWhenDispatchingTh
 
         verifyFlags(commandList->appendSignalEvent(event), false, false);
 
-        verifyFlags(commandList->appendPageFaultCopy(kernel.getIsaAllocation(), kernel.getIsaAllocation(), 1, false),
+        verifyFlags(commandList->appendPageFaultCopy(kernel.getIsaAllocation(), kernel.getIsaAllocation(), 0u, 1, false),
                     false, false);
 
         verifyFlags(commandList->appendWaitOnEvents(1, &event, false, true, false), false, false);
@@ -56,6 +56,9 @@ class MockCommandListHw : public WhiteBox<::L0::CommandListCoreFamily<gfxCoreFam
                                              bool isStateless,
                                              CmdListKernelLaunchParams &launchParams) override {
         appendMemoryCopyKernelWithGACalledTimes++;
+        appendMemoryCopyKernelWithGADstOffsets.push_back(dstOffset);
+        appendMemoryCopyKernelWithGASrcOffsets.push_back(srcOffset);
+        appendMemoryCopyKernelWithGASizes.push_back(size);
         if (isStateless) {
             appendMemoryCopyKernelWithGAStatelessCalledTimes++;
         }
@@ -77,6 +80,9 @@ class MockCommandListHw : public WhiteBox<::L0::CommandListCoreFamily<gfxCoreFam
                                      uint64_t srcOffset,
                                      uint64_t size) override {
         appendMemoryCopyBlitCalledTimes++;
+        appendMemoryCopyBlitDstOffset = dstOffset;
+        appendMemoryCopyBlitSrcOffset = srcOffset;
+        appendMemoryCopyBlitSize = size;
         if (failOnFirstCopy && appendMemoryCopyBlitCalledTimes == 1) {
             return ZE_RESULT_ERROR_UNKNOWN;
         }
@@ -162,6 +168,13 @@ class MockCommandListHw : public WhiteBox<::L0::CommandListCoreFamily<gfxCoreFam
 
     NEO::MockGraphicsAllocation alignedAlloc{alignedDataPtr, reinterpret_cast<uint64_t>(alignedDataPtr), MemoryConstants::pageSize};
 
+    std::vector<uint64_t> appendMemoryCopyKernelWithGADstOffsets;
+    std::vector<uint64_t> appendMemoryCopyKernelWithGASrcOffsets;
+    std::vector<uint64_t> appendMemoryCopyKernelWithGASizes;
+    uint64_t appendMemoryCopyBlitDstOffset = 0;
+    uint64_t appendMemoryCopyBlitSrcOffset = 0;
+    uint64_t appendMemoryCopyBlitSize = 0;
+
     uint32_t appendMemoryCopyKernelWithGACalledTimes = 0;
     uint32_t appendMemoryCopyKernelWithGAStatelessCalledTimes = 0;
     uint32_t appendMemoryCopyBlitCalledTimes = 0;
@@ -332,7 +345,7 @@ HWTEST2_F(CommandListCreate, givenCommandListWhenPageFaultCopyCalledThenappendPa
                                                   MemoryPool::System4KBPages,
                                                   MemoryManager::maxOsContextCount,
                                                   canonizedGpuAddress);
-    cmdList.appendPageFaultCopy(&mockAllocationDst, &mockAllocationSrc, size, false);
+    cmdList.appendPageFaultCopy(&mockAllocationDst, &mockAllocationSrc, 0u, size, false);
     EXPECT_EQ(cmdList.appendMemoryCopyKernelWithGACalledTimes, 1u);
     EXPECT_EQ(cmdList.appendMemoryCopyKernelWithGAStatelessCalledTimes, 0u);
 }
@@ -360,7 +373,7 @@ HWTEST2_F(CommandListAppend, givenCommandListWhenPageFaultCopyCalledWithCopyEngi
                                                   MemoryPool::System4KBPages,
                                                   MemoryManager::maxOsContextCount,
                                                   canonizedGpuAddress);
-    cmdList.appendPageFaultCopy(&mockAllocationDst, &mockAllocationSrc, size, false);
+    cmdList.appendPageFaultCopy(&mockAllocationDst, &mockAllocationSrc, 0u, size, false);
     EXPECT_EQ(cmdList.appendMemoryCopyBlitCalledTimes, 1u);
 }
 
@@ -387,7 +400,7 @@ HWTEST2_F(CommandListAppend, givenCommandListWhenPageFaultCopyCalledThenappendPa
                                                   MemoryPool::System4KBPages,
                                                   MemoryManager::maxOsContextCount,
                                                   canonizedGpuAddress);
-    cmdList.appendPageFaultCopy(&mockAllocationDst, &mockAllocationSrc, size, false);
+    cmdList.appendPageFaultCopy(&mockAllocationDst, &mockAllocationSrc, 0u, size, false);
     EXPECT_EQ(cmdList.appendMemoryCopyKernelWithGACalledTimes, 2u);
     EXPECT_EQ(cmdList.appendMemoryCopyKernelWithGAStatelessCalledTimes, 0u);
 }
@@ -415,7 +428,7 @@ HWTEST2_F(CommandListAppend, givenCommandListWhenPageFaultCopyCalledAndErrorOnMi
                                                   MemoryPool::System4KBPages,
                                                   MemoryManager::maxOsContextCount,
                                                   canonizedGpuAddress);
-    cmdList.appendPageFaultCopy(&mockAllocationDst, &mockAllocationSrc, size, false);
+    cmdList.appendPageFaultCopy(&mockAllocationDst, &mockAllocationSrc, 0u, size, false);
     EXPECT_EQ(cmdList.appendMemoryCopyKernelWithGACalledTimes, 1u);
     EXPECT_EQ(cmdList.appendMemoryCopyKernelWithGAStatelessCalledTimes, 0u);
 }
@@ -443,7 +456,7 @@ HWTEST2_F(CommandListAppend, givenCommandListWhenPageFaultCopyCalledWithCopyEngi
                                                   MemoryPool::System4KBPages,
                                                   MemoryManager::maxOsContextCount,
                                                   canonizedGpuAddress);
-    cmdList.appendPageFaultCopy(&mockAllocationDst, &mockAllocationSrc, size, false);
+    cmdList.appendPageFaultCopy(&mockAllocationDst, &mockAllocationSrc, 0u, size, false);
     EXPECT_EQ(cmdList.appendMemoryCopyBlitCalledTimes, 1u);
 }
 
@@ -470,7 +483,7 @@ HWTEST2_F(CommandListAppend, givenCommandListWhenPageFaultCopyCalledWithCopyEngi
                                                   MemoryPool::System4KBPages,
                                                   MemoryManager::maxOsContextCount,
                                                   canonizedGpuAddress);
-    cmdList.appendPageFaultCopy(&mockAllocationDst, &mockAllocationSrc, size, false);
+    cmdList.appendPageFaultCopy(&mockAllocationDst, &mockAllocationSrc, 0u, size, false);
     EXPECT_EQ(cmdList.appendMemoryCopyBlitCalledTimes, 1u);
 }
 
@@ -497,7 +510,7 @@ HWTEST2_F(CommandListAppend, givenCommandListWhen4GBytePageFaultCopyCalledThenPa
                                                   MemoryPool::System4KBPages,
                                                   MemoryManager::maxOsContextCount,
                                                   canonizedGpuAddress);
-    cmdList.appendPageFaultCopy(&mockAllocationDst, &mockAllocationSrc, size, false);
+    cmdList.appendPageFaultCopy(&mockAllocationDst, &mockAllocationSrc, 0u, size, false);
     EXPECT_EQ(cmdList.appendMemoryCopyKernelWithGACalledTimes, 1u);
     EXPECT_EQ(cmdList.appendMemoryCopyKernelWithGAStatelessCalledTimes, 1u);
 }
@@ -525,11 +538,121 @@ HWTEST2_F(CommandListAppend, givenCommandListWhen4GBytePageFaultCopyCalledThenPa
                                                   MemoryPool::System4KBPages,
                                                   MemoryManager::maxOsContextCount,
                                                   canonizedGpuAddress);
-    cmdList.appendPageFaultCopy(&mockAllocationDst, &mockAllocationSrc, size, false);
+    cmdList.appendPageFaultCopy(&mockAllocationDst, &mockAllocationSrc, 0u, size, false);
     EXPECT_EQ(cmdList.appendMemoryCopyKernelWithGACalledTimes, 2u);
     EXPECT_EQ(cmdList.appendMemoryCopyKernelWithGAStatelessCalledTimes, 2u);
 }
 
+HWTEST2_F(CommandListAppend, givenOffsetWhenPageFaultCopyCalledThenMiddleAndRightKernelsCopyRangeStartingAtOffset, IsAtLeastSkl) {
+    MockCommandListHw<gfxCoreFamily> cmdList;
+    size_t offset = MemoryConstants::pageSize;
+    size_t size = ((sizeof(uint32_t) * 4) + 1);
+    cmdList.initialize(device, NEO::EngineGroupType::RenderCompute, 0u);
+    auto ptr = reinterpret_cast<void *>(0x1234);
+    auto gmmHelper = device->getNEODevice()->getGmmHelper();
+    auto canonizedGpuAddress = gmmHelper->canonize(castToUint64(ptr));
+    NEO::MockGraphicsAllocation mockAllocationSrc(0,
+                                                  AllocationType::INTERNAL_HOST_MEMORY,
+                                                  ptr,
+                                                  offset + size,
+                                                  0u,
+                                                  MemoryPool::System4KBPages,
+                                                  MemoryManager::maxOsContextCount,
+                                                  canonizedGpuAddress);
+    NEO::MockGraphicsAllocation mockAllocationDst(0,
+                                                  AllocationType::INTERNAL_HOST_MEMORY,
+                                                  ptr,
+                                                  offset + size,
+                                                  0u,
+                                                  MemoryPool::System4KBPages,
+                                                  MemoryManager::maxOsContextCount,
+                                                  canonizedGpuAddress);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendPageFaultCopy(&mockAllocationDst, &mockAllocationSrc, offset, size, false));
+    ASSERT_EQ(cmdList.appendMemoryCopyKernelWithGACalledTimes, 2u);
+    EXPECT_EQ(cmdList.appendMemoryCopyKernelWithGAStatelessCalledTimes, 0u);
+
+    EXPECT_EQ(offset, cmdList.appendMemoryCopyKernelWithGADstOffsets[0]);
+    EXPECT_EQ(offset, cmdList.appendMemoryCopyKernelWithGASrcOffsets[0]);
+    EXPECT_EQ(size - 1, cmdList.appendMemoryCopyKernelWithGASizes[0]);
+
+    EXPECT_EQ(offset + size - 1, cmdList.appendMemoryCopyKernelWithGADstOffsets[1]);
+    EXPECT_EQ(offset + size - 1, cmdList.appendMemoryCopyKernelWithGASrcOffsets[1]);
+    EXPECT_EQ(1u, cmdList.appendMemoryCopyKernelWithGASizes[1]);
+}
+
+HWTEST2_F(CommandListAppend, givenOffsetWhenPageFaultCopyCalledWithCopyEngineThenBlitCopiesRangeStartingAtOffset, IsAtLeastSkl) {
+    MockCommandListHw<gfxCoreFamily> cmdList;
+    size_t offset = MemoryConstants::pageSize;
+    size_t size = ((sizeof(uint32_t) * 4) + 1);
+    cmdList.initialize(device, NEO::EngineGroupType::Copy, 0u);
+    auto ptr = reinterpret_cast<void *>(0x1234);
+    auto gmmHelper = device->getNEODevice()->getGmmHelper();
+    auto canonizedGpuAddress = gmmHelper->canonize(castToUint64(ptr));
+    NEO::MockGraphicsAllocation mockAllocationSrc(0,
+                                                  AllocationType::INTERNAL_HOST_MEMORY,
+                                                  ptr,
+                                                  offset + size,
+                                                  0u,
+                                                  MemoryPool::System4KBPages,
+                                                  MemoryManager::maxOsContextCount,
+                                                  canonizedGpuAddress);
+    NEO::MockGraphicsAllocation mockAllocationDst(0,
+                                                  AllocationType::INTERNAL_HOST_MEMORY,
+                                                  ptr,
+                                                  offset + size,
+                                                  0u,
+                                                  MemoryPool::System4KBPages,
+                                                  MemoryManager::maxOsContextCount,
+                                                  canonizedGpuAddress);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendPageFaultCopy(&mockAllocationDst, &mockAllocationSrc, offset, size, false));
+    EXPECT_EQ(cmdList.appendMemoryCopyBlitCalledTimes, 1u);
+    EXPECT_EQ(offset, cmdList.appendMemoryCopyBlitDstOffset);
+    EXPECT_EQ(offset, cmdList.appendMemoryCopyBlitSrcOffset);
+    EXPECT_EQ(size, cmdList.appendMemoryCopyBlitSize);
+}
+
+HWTEST2_F(CommandListAppend, givenOffsetAndSizeReaching4GByteWhenPageFaultCopyCalledThenStatelessKernelIsUsedOnlyIfRangeEndReaches4GByte, IsAtLeastSkl) {
+    size_t size = MemoryConstants::pageSize;
+    auto ptr = reinterpret_cast<void *>(0x1234);
+    auto gmmHelper = device->getNEODevice()->getGmmHelper();
+    auto canonizedGpuAddress = gmmHelper->canonize(castToUint64(ptr));
+    NEO::MockGraphicsAllocation mockAllocationSrc(0,
+                                                  AllocationType::INTERNAL_HOST_MEMORY,
+                                                  ptr,
+                                                  4ull * MemoryConstants::gigaByte,
+                                                  0u,
+                                                  MemoryPool::System4KBPages,
+                                                  MemoryManager::maxOsContextCount,
+                                                  canonizedGpuAddress);
+    NEO::MockGraphicsAllocation mockAllocationDst(0,
+                                                  AllocationType::INTERNAL_HOST_MEMORY,
+                                                  ptr,
+                                                  4ull * MemoryConstants::gigaByte,
+                                                  0u,
+                                                  MemoryPool::System4KBPages,
+                                                  MemoryManager::maxOsContextCount,
+                                                  canonizedGpuAddress);
+
+    {
+        MockCommandListHw<gfxCoreFamily> cmdList;
+        cmdList.initialize(device, NEO::EngineGroupType::RenderCompute, 0u);
+        size_t offset = 4ull * MemoryConstants::gigaByte - 2 * size;
+        EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendPageFaultCopy(&mockAllocationDst, &mockAllocationSrc, offset, size, false));
+        EXPECT_EQ(cmdList.appendMemoryCopyKernelWithGACalledTimes, 1u);
+        EXPECT_EQ(cmdList.appendMemoryCopyKernelWithGAStatelessCalledTimes, 0u);
+    }
+    {
+        MockCommandListHw<gfxCoreFamily> cmdList;
+        cmdList.initialize(device, NEO::EngineGroupType::RenderCompute, 0u);
+        size_t offset = 4ull * MemoryConstants::gigaByte - size;
+        EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendPageFaultCopy(&mockAllocationDst, &mockAllocationSrc, offset, size, false));
+        EXPECT_EQ(cmdList.appendMemoryCopyKernelWithGACalledTimes, 1u);
+        EXPECT_EQ(cmdList.appendMemoryCopyKernelWithGAStatelessCalledTimes, 1u);
+        EXPECT_EQ(offset, cmdList.appendMemoryCopyKernelWithGADstOffsets[0]);
+        EXPECT_EQ(offset, cmdList.appendMemoryCopyKernelWithGASrcOffsets[0]);
+    }
+}
+
 HWTEST2_F(CommandListAppend, givenCommandListAnd3DWhbufferenMemoryCopyRegionCalledThenCopyKernel3DCalled, IsAtLeastSkl) {
     MockCommandListHw<gfxCoreFamily> cmdList;
     cmdList.initialize(device, NEO::EngineGroupType::RenderCompute, 0u);
@@ -12,6 +12,7 @@
 #include "shared/source/indirect_heap/indirect_heap.h"
 #include "shared/source/kernel/kernel_descriptor.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
+#include "shared/source/utilities/deferred_submission_flusher.h"
 #include "shared/test/common/helpers/unit_test_helper.h"
 #include "shared/test/common/libult/ult_command_stream_receiver.h"
 #include "shared/test/common/mocks/mock_command_stream_receiver.h"
@@ -28,6 +29,8 @@
 #include "level_zero/core/test/unit_tests/mocks/mock_image.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_kernel.h"
 
+#include <thread>
+
 namespace L0 {
 namespace ult {
 
@@ -128,6 +131,190 @@ HWTEST2_F(CommandListExecuteImmediate, whenExecutingCommandListImmediateWithFlus
     EXPECT_EQ(expectedThreadArbitrationPolicy, currentCsrStreamProperties.stateComputeMode.threadArbitrationPolicy.value);
 }
 
+struct CommandListAppendCoalescingTest : public CommandListExecuteImmediate {
+    void SetUp() override {
+        DebugManager.flags.EnableFlushTaskSubmission.set(1);
+        DebugManager.flags.EnableImmediateCmdListHeapSharing.set(0);
+        DebugManager.flags.ImmediateCmdListAppendCoalescing.set(1);
+        DebugManager.flags.ImmediateCmdListCoalescingTimeoutUs.set(60 * 1000 * 1000);
+        CommandListExecuteImmediate::SetUp();
+    }
+
+    void TearDown() override {
+        commandList.reset();
+        CommandListExecuteImmediate::TearDown();
+    }
+
+    template <GFXCORE_FAMILY gfxCoreFamily>
+    MockCommandListImmediate<gfxCoreFamily> &createImmediateCmdList(ze_command_queue_mode_t mode) {
+        ze_command_queue_desc_t desc = {};
+        desc.mode = mode;
+        ze_result_t returnValue;
+        commandList.reset(CommandList::createImmediate(productFamily, device, &desc, false, NEO::EngineGroupType::RenderCompute, returnValue));
+        return static_cast<MockCommandListImmediate<gfxCoreFamily> &>(*commandList);
+    }
+
+    DebugManagerStateRestore restorer;
+    std::unique_ptr<L0::CommandList> commandList;
+};
+
+HWTEST2_F(CommandListAppendCoalescingTest, givenAppendCoalescingNotRequestedWhenCreatingImmediateCommandListThenCoalescingIsDisabled, IsAtLeastSkl) {
+    DebugManager.flags.ImmediateCmdListAppendCoalescing.set(-1);
+    auto &commandListImmediate = createImmediateCmdList<gfxCoreFamily>(ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS);
+    EXPECT_FALSE(commandListImmediate.appendCoalescingEnabled);
+
+    DebugManager.flags.ImmediateCmdListAppendCoalescing.set(1);
+    auto &syncCommandListImmediate = createImmediateCmdList<gfxCoreFamily>(ZE_COMMAND_QUEUE_MODE_SYNCHRONOUS);
+    EXPECT_FALSE(syncCommandListImmediate.appendCoalescingEnabled);
+}
+
+HWTEST2_F(CommandListAppendCoalescingTest, givenAppendCoalescingEnabledWhenAppendingWithoutSignalEventThenSubmissionIsDeferredUntilHostSynchronize, IsAtLeastSkl) {
+    auto &commandListImmediate = createImmediateCmdList<gfxCoreFamily>(ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS);
+    ASSERT_TRUE(commandListImmediate.appendCoalescingEnabled);
+    EXPECT_FALSE(commandListImmediate.isRelaxedOrderingDispatchAllowed(1));
+
+    auto ultCsr = static_cast<NEO::UltCommandStreamReceiver<FamilyType> *>(commandListImmediate.csr);
+    ultCsr->callBaseWaitForCompletionWithTimeout = false;
+    ultCsr->returnWaitForCompletionWithTimeout = WaitStatus::Ready;
+    auto taskCountBefore = ultCsr->peekTaskCount();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandListImmediate.appendBarrier(nullptr, 0, nullptr, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandListImmediate.appendBarrier(nullptr, 0, nullptr, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandListImmediate.appendBarrier(nullptr, 0, nullptr, false));
+    EXPECT_EQ(taskCountBefore, ultCsr->peekTaskCount());
+    EXPECT_EQ(3u, commandListImmediate.coalescedAppendsCount);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandListImmediate.hostSynchronize(std::numeric_limits<uint64_t>::max()));
+    EXPECT_EQ(taskCountBefore + 1, ultCsr->peekTaskCount());
+    EXPECT_EQ(0u, commandListImmediate.coalescedAppendsCount);
+
+    auto &statistics = commandListImmediate.coalescingStatistics;
+    EXPECT_EQ(1u, statistics.flushCount);
+    EXPECT_EQ(3u, statistics.appendCount);
+    EXPECT_EQ(3u, statistics.maxAppendsPerFlush);
+    EXPECT_EQ(1u, statistics.appendsPerFlushHistogram[1]);
+}
+
+HWTEST2_F(CommandListAppendCoalescingTest, givenAppendCoalescingEnabledWhenAppendingWithSignalEventThenPendingAppendsAreSubmittedTogether, IsAtLeastSkl) {
+    auto &commandListImmediate = createImmediateCmdList<gfxCoreFamily>(ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS);
+    ASSERT_TRUE(commandListImmediate.appendCoalescingEnabled);
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.count = 1;
+    auto eventPool = std::unique_ptr<L0::EventPool>(L0::EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ze_event_desc_t eventDesc = {};
+    auto event = std::unique_ptr<L0::Event>(L0::Event::create<typename FamilyType::TimestampPacketType>(eventPool.get(), &eventDesc, device));
+
+    auto taskCountBefore = commandListImmediate.csr->peekTaskCount();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandListImmediate.appendBarrier(nullptr, 0, nullptr, false));
+    EXPECT_EQ(taskCountBefore, commandListImmediate.csr->peekTaskCount());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandListImmediate.appendBarrier(event->toHandle(), 0, nullptr, false));
+    EXPECT_EQ(taskCountBefore + 1, commandListImmediate.csr->peekTaskCount());
+    EXPECT_EQ(0u, commandListImmediate.coalescedAppendsCount);
+    EXPECT_EQ(2u, commandListImmediate.coalescingStatistics.maxAppendsPerFlush);
+}
+
+HWTEST2_F(CommandListAppendCoalescingTest, givenPendingCommandsAboveCoalescingSizeThresholdWhenAppendingThenAppendIsSubmittedImmediately, IsAtLeastSkl) {
+    DebugManager.flags.ImmediateCmdListCoalescingMaxBytes.set(1);
+    auto &commandListImmediate = createImmediateCmdList<gfxCoreFamily>(ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS);
+    ASSERT_TRUE(commandListImmediate.appendCoalescingEnabled);
+
+    auto taskCountBefore = commandListImmediate.csr->peekTaskCount();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandListImmediate.appendBarrier(nullptr, 0, nullptr, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandListImmediate.appendBarrier(nullptr, 0, nullptr, false));
+    EXPECT_EQ(taskCountBefore + 2, commandListImmediate.csr->peekTaskCount());
+    EXPECT_EQ(2u, commandListImmediate.coalescingStatistics.appendsPerFlushHistogram[0]);
+}
+
+HWTEST2_F(CommandListAppendCoalescingTest, givenCoalescingTimeoutElapsedWhenAppendingThenPendingAppendsAreSubmitted, IsAtLeastSkl) {
+    DebugManager.flags.ImmediateCmdListCoalescingTimeoutUs.set(0);
+    auto &commandListImmediate = createImmediateCmdList<gfxCoreFamily>(ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS);
+    ASSERT_TRUE(commandListImmediate.appendCoalescingEnabled);
+
+    auto taskCountBefore = commandListImmediate.csr->peekTaskCount();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandListImmediate.appendBarrier(nullptr, 0, nullptr, false));
+    EXPECT_EQ(taskCountBefore + 1, commandListImmediate.csr->peekTaskCount());
+}
+
+HWTEST2_F(CommandListAppendCoalescingTest, givenPendingCoalescedAppendsWhenNoFurtherAppendComesThenStaleAppendsAreSubmittedByDeferredSubmissionFlusher, IsAtLeastSkl) {
+    DebugManager.flags.ImmediateCmdListCoalescingTimeoutUs.set(1000);
+    auto &commandListImmediate = createImmediateCmdList<gfxCoreFamily>(ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS);
+    ASSERT_TRUE(commandListImmediate.appendCoalescingEnabled);
+
+    auto taskCountBefore = commandListImmediate.csr->peekTaskCount();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandListImmediate.appendBarrier(nullptr, 0, nullptr, false));
+    EXPECT_EQ(1u, device->getNEODevice()->getDeferredSubmissionFlusher()->getNumClients());
+
+    while (commandListImmediate.csr->peekTaskCount() == taskCountBefore) {
+        std::this_thread::yield();
+    }
+
+    std::lock_guard<std::recursive_mutex> lock(commandListImmediate.coalescingMutex);
+    EXPECT_EQ(taskCountBefore + 1, commandListImmediate.csr->peekTaskCount());
+    EXPECT_EQ(0u, commandListImmediate.coalescedAppendsCount);
+    EXPECT_EQ(1u, commandListImmediate.coalescingStatistics.flushCount);
+}
+
+HWTEST2_F(CommandListAppendCoalescingTest, givenAppendInProgressOnOtherThreadWhenDeferredSubmissionIsFlushedThenFlushIsSkippedUntilAppendFinishes, IsAtLeastSkl) {
+    auto &commandListImmediate = createImmediateCmdList<gfxCoreFamily>(ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS);
+    ASSERT_TRUE(commandListImmediate.appendCoalescingEnabled);
+
+    auto taskCountBefore = commandListImmediate.csr->peekTaskCount();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandListImmediate.appendBarrier(nullptr, 0, nullptr, false));
+
+    std::atomic<bool> appendLockTaken{false};
+    std::atomic<bool> releaseAppendLock{false};
+    std::thread appendingThread([&]() {
+        std::lock_guard<std::recursive_mutex> lock(commandListImmediate.coalescingMutex);
+        appendLockTaken = true;
+        while (!releaseAppendLock) {
+            std::this_thread::yield();
+        }
+    });
+    while (!appendLockTaken) {
+        std::this_thread::yield();
+    }
+
+    EXPECT_TRUE(commandListImmediate.flushDeferredSubmission(false));
+    EXPECT_EQ(taskCountBefore, commandListImmediate.csr->peekTaskCount());
+
+    releaseAppendLock = true;
+    appendingThread.join();
+
+    EXPECT_TRUE(commandListImmediate.flushDeferredSubmission(true));
+    EXPECT_EQ(taskCountBefore, commandListImmediate.csr->peekTaskCount());
+
+    EXPECT_FALSE(commandListImmediate.flushDeferredSubmission(false));
+    EXPECT_EQ(taskCountBefore + 1, commandListImmediate.csr->peekTaskCount());
+    EXPECT_EQ(0u, commandListImmediate.coalescedAppendsCount);
+}
+
+HWTEST2_F(CommandListAppendCoalescingTest, givenPendingCoalescedAppendsWhenHostSynchronizesOnUnrelatedEventThenPendingAppendsAreSubmitted, IsAtLeastSkl) {
+    auto &commandListImmediate = createImmediateCmdList<gfxCoreFamily>(ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS);
+    ASSERT_TRUE(commandListImmediate.appendCoalescingEnabled);
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.count = 1;
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+    auto eventPool = std::unique_ptr<L0::EventPool>(L0::EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ze_event_desc_t eventDesc = {};
+    auto event = std::unique_ptr<L0::Event>(L0::Event::create<typename FamilyType::TimestampPacketType>(eventPool.get(), &eventDesc, device));
+
+    auto taskCountBefore = commandListImmediate.csr->peekTaskCount();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandListImmediate.appendBarrier(nullptr, 0, nullptr, false));
+    EXPECT_EQ(taskCountBefore, commandListImmediate.csr->peekTaskCount());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->hostSignal());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->hostSynchronize(0));
+    EXPECT_EQ(taskCountBefore + 1, commandListImmediate.csr->peekTaskCount());
+    EXPECT_EQ(0u, commandListImmediate.coalescedAppendsCount);
+}
+
 HWTEST2_F(CommandListExecuteImmediate, whenExecutingCommandListImmediateWithFlushTaskThenContainsAnyKernelFlagIsReset, IsAtLeastSkl) {
     std::unique_ptr<L0::CommandList> commandList;
     DebugManagerStateRestore restorer;
@@ -191,6 +191,7 @@ HWTEST2_F(CommandListAppendLaunchKernel, givenNotEnoughSpaceInCommandStreamWhenA
         nullptr,                              // dynamicStateHeap
         threadGroupDimensions,                // threadGroupDimensions
         nullptr,                              // outWalkerPtr
+        nullptr,                              // outCrossThreadDataPtr
         nullptr,                              // additionalCommands
         PreemptionMode::MidBatch,             // preemptionMode
         0,                                    // partitionCount
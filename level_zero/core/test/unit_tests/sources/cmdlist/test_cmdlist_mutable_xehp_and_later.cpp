@@ -0,0 +1,343 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/test_macros/hw_test.h"
+
+#include "level_zero/core/source/cmdlist/cmdlist_hw.h"
+#include "level_zero/core/source/event/event.h"
+#include "level_zero/core/test/unit_tests/fixtures/device_fixture.h"
+#include "level_zero/core/test/unit_tests/mocks/mock_cmdlist.h"
+#include "level_zero/core/test/unit_tests/mocks/mock_kernel.h"
+#include "level_zero/core/test/unit_tests/mocks/mock_module.h"
+
+namespace L0 {
+namespace ult {
+
+struct MutableCommandListFixture : public DeviceFixture {
+    static constexpr NEO::CrossThreadDataOffset valueArgOffset = 28;
+
+    void setUp() {
+        DebugManager.flags.SignalAllEventPackets.set(0);
+        DeviceFixture::setUp();
+
+        module = std::make_unique<Mock<Module>>(device, nullptr);
+        kernel.module = module.get();
+        kernel.setGroupSize(4, 2, 1);
+        kernel.crossThreadDataSize = 64;
+        memset(kernel.crossThreadData.get(), 0, kernel.crossThreadDataSize);
+
+        auto &dispatchTraits = kernel.descriptor.payloadMappings.dispatchTraits;
+        dispatchTraits.numWorkGroups[0] = 0;
+        dispatchTraits.numWorkGroups[1] = 4;
+        dispatchTraits.numWorkGroups[2] = 8;
+        dispatchTraits.globalWorkSize[0] = 12;
+        dispatchTraits.globalWorkSize[1] = 16;
+        dispatchTraits.globalWorkSize[2] = 20;
+        dispatchTraits.workDim = 24;
+
+        auto &explicitArgs = kernel.descriptor.payloadMappings.explicitArgs;
+        explicitArgs.resize(2);
+        explicitArgs[0].as<NEO::ArgDescValue>(true).elements.push_back({valueArgOffset, sizeof(uint64_t), 0, false});
+        explicitArgs[1].as<NEO::ArgDescSampler>(true);
+        kernel.kernelArgHandlers.push_back(&KernelImp::setArgImmediate);
+        kernel.kernelArgHandlers.push_back(&KernelImp::setArgUnknown);
+
+        ze_event_pool_desc_t eventPoolDesc = {};
+        eventPoolDesc.count = 2;
+        ze_result_t result = ZE_RESULT_SUCCESS;
+        eventPool.reset(L0::EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+        ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    }
+
+    void tearDown() {
+        eventPool.reset();
+        DeviceFixture::tearDown();
+    }
+
+    template <typename FamilyType>
+    std::unique_ptr<L0::Event> createEvent(L0::EventPool *pool, uint32_t index) {
+        ze_event_desc_t eventDesc = {};
+        eventDesc.index = index;
+        return std::unique_ptr<L0::Event>(L0::Event::create<typename FamilyType::TimestampPacketType>(pool, &eventDesc, device));
+    }
+
+    template <GFXCORE_FAMILY gfxCoreFamily>
+    std::unique_ptr<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>> createCommandList() {
+        auto commandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+        commandList->initialize(device, NEO::EngineGroupType::Compute, 0u);
+        return commandList;
+    }
+
+    DebugManagerStateRestore restorer;
+    std::unique_ptr<Mock<Module>> module;
+    std::unique_ptr<L0::EventPool> eventPool;
+    Mock<::L0::KernelImp> kernel;
+};
+
+using MutableCommandListTest = Test<MutableCommandListFixture>;
+
+HWTEST2_F(MutableCommandListTest, givenAppendedMutableKernelWhenUpdatingValueArgumentThenRecordedCrossThreadDataIsPatched, IsAtLeastXeHpCore) {
+    auto commandList = createCommandList<gfxCoreFamily>();
+    ze_group_count_t groupCount{8, 1, 1};
+
+    uint64_t commandId = std::numeric_limits<uint64_t>::max();
+    auto result = commandList->appendMutableLaunchKernel(kernel.toHandle(), groupCount, nullptr, 0, nullptr, &commandId);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(0u, commandId);
+    ASSERT_EQ(1u, commandList->mutableKernelCommands.size());
+
+    auto &mutableCommand = commandList->mutableKernelCommands[0];
+    EXPECT_EQ(&kernel, mutableCommand.kernel);
+    EXPECT_EQ(kernel.crossThreadDataSize, mutableCommand.crossThreadDataSize);
+    EXPECT_EQ(0u, mutableCommand.inlineDataSize);
+    ASSERT_NE(nullptr, mutableCommand.indirectCrossThreadData);
+
+    uint64_t argValue = 0x1234567890abcdefull;
+    result = commandList->updateMutableKernelArgument(commandId, 0, sizeof(argValue), &argValue);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+
+    uint64_t patchedValue = 0;
+    memcpy(&patchedValue, ptrOffset(mutableCommand.indirectCrossThreadData, valueArgOffset), sizeof(patchedValue));
+    EXPECT_EQ(argValue, patchedValue);
+
+    uint64_t kernelValue = 0;
+    memcpy(&kernelValue, ptrOffset(kernel.crossThreadData.get(), valueArgOffset), sizeof(kernelValue));
+    EXPECT_EQ(0u, kernelValue);
+
+    uint32_t shortArgValue = 0xabcd;
+    result = commandList->updateMutableKernelArgument(commandId, 0, sizeof(shortArgValue), &shortArgValue);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    memcpy(&patchedValue, ptrOffset(mutableCommand.indirectCrossThreadData, valueArgOffset), sizeof(patchedValue));
+    EXPECT_EQ(0xabcdu, patchedValue);
+}
+
+HWTEST2_F(MutableCommandListTest, givenAppendedMutableKernelWhenUpdatingPointerArgumentThenRecordedCrossThreadDataIsPatchedAndAllocationIsResident, IsAtLeastXeHpCore) {
+    constexpr NEO::CrossThreadDataOffset pointerArgOffset = 40;
+    auto &pointerArg = kernel.descriptor.payloadMappings.explicitArgs[1].as<NEO::ArgDescPointer>(true);
+    pointerArg.stateless = pointerArgOffset;
+    pointerArg.pointerSize = sizeof(uint64_t);
+
+    auto commandList = createCommandList<gfxCoreFamily>();
+    ze_group_count_t groupCount{8, 1, 1};
+    uint64_t commandId = 0;
+    auto result = commandList->appendMutableLaunchKernel(kernel.toHandle(), groupCount, nullptr, 0, nullptr, &commandId);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    auto &mutableCommand = commandList->mutableKernelCommands[commandId];
+
+    void *buffer = nullptr;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    result = context->allocDeviceMem(device->toHandle(), &deviceDesc, 4096u, 4096u, &buffer);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    auto bufferOffset = ptrOffset(buffer, 0x40);
+
+    result = commandList->updateMutableKernelArgument(commandId, 1, sizeof(bufferOffset), &bufferOffset);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+
+    uint64_t patchedValue = 0;
+    memcpy(&patchedValue, ptrOffset(mutableCommand.indirectCrossThreadData, pointerArgOffset), sizeof(patchedValue));
+    EXPECT_EQ(reinterpret_cast<uint64_t>(bufferOffset), patchedValue);
+
+    auto allocation = driverHandle->getSvmAllocsManager()->getSVMAlloc(buffer)->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+    auto &residencyContainer = commandList->getCmdContainer().getResidencyContainer();
+    EXPECT_NE(residencyContainer.end(), std::find(residencyContainer.begin(), residencyContainer.end(), allocation));
+
+    result = commandList->updateMutableKernelArgument(commandId, 1, sizeof(void *), nullptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    memcpy(&patchedValue, ptrOffset(mutableCommand.indirectCrossThreadData, pointerArgOffset), sizeof(patchedValue));
+    EXPECT_EQ(0u, patchedValue);
+
+    context->freeMem(buffer);
+}
+
+HWTEST2_F(MutableCommandListTest, givenKernelPassingInlineDataWhenUpdatingArgumentCrossingInlineDataBoundaryThenInlineDataAndIndirectDataArePatched, IsAtLeastXeHpCore) {
+    using INLINE_DATA = typename FamilyType::INLINE_DATA;
+
+    kernel.descriptor.kernelAttributes.flags.passInlineData = true;
+    auto commandList = createCommandList<gfxCoreFamily>();
+    ze_group_count_t groupCount{8, 1, 1};
+
+    uint64_t commandId = 0;
+    auto result = commandList->appendMutableLaunchKernel(kernel.toHandle(), groupCount, nullptr, 0, nullptr, &commandId);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    auto &mutableCommand = commandList->mutableKernelCommands[commandId];
+    ASSERT_EQ(sizeof(INLINE_DATA), mutableCommand.inlineDataSize);
+    ASSERT_NE(nullptr, mutableCommand.inlineData);
+
+    uint64_t argValue = 0x1122334455667788ull;
+    result = commandList->updateMutableKernelArgument(commandId, 0, sizeof(argValue), &argValue);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+
+    uint32_t inlinePart = 0;
+    uint32_t indirectPart = 0;
+    memcpy(&inlinePart, ptrOffset(mutableCommand.inlineData, valueArgOffset), sizeof(inlinePart));
+    memcpy(&indirectPart, mutableCommand.indirectCrossThreadData, sizeof(indirectPart));
+    EXPECT_EQ(0x55667788u, inlinePart);
+    EXPECT_EQ(0x11223344u, indirectPart);
+}
+
+HWTEST2_F(MutableCommandListTest, givenAppendedMutableKernelWhenUpdatingGroupCountThenWalkerAndDispatchTraitsArePatched, IsAtLeastXeHpCore) {
+    using COMPUTE_WALKER = typename FamilyType::COMPUTE_WALKER;
+
+    auto commandList = createCommandList<gfxCoreFamily>();
+    ze_group_count_t groupCount{8, 1, 1};
+
+    uint64_t commandId = 0;
+    auto result = commandList->appendMutableLaunchKernel(kernel.toHandle(), groupCount, nullptr, 0, nullptr, &commandId);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    auto &mutableCommand = commandList->mutableKernelCommands[commandId];
+    EXPECT_TRUE(mutableCommand.isGroupCountMutable);
+
+    ze_group_count_t newGroupCount{3, 5, 7};
+    result = commandList->updateMutableGroupCount(commandId, newGroupCount);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+
+    auto walker = reinterpret_cast<COMPUTE_WALKER *>(mutableCommand.walker);
+    EXPECT_EQ(3u, walker->getThreadGroupIdXDimension());
+    EXPECT_EQ(5u, walker->getThreadGroupIdYDimension());
+    EXPECT_EQ(7u, walker->getThreadGroupIdZDimension());
+
+    auto crossThreadData = reinterpret_cast<uint32_t *>(mutableCommand.indirectCrossThreadData);
+    EXPECT_EQ(3u, crossThreadData[0]);
+    EXPECT_EQ(5u, crossThreadData[1]);
+    EXPECT_EQ(7u, crossThreadData[2]);
+    EXPECT_EQ(12u, crossThreadData[3]);
+    EXPECT_EQ(10u, crossThreadData[4]);
+    EXPECT_EQ(7u, crossThreadData[5]);
+    EXPECT_EQ(3u, crossThreadData[6]);
+}
+
+HWTEST2_F(MutableCommandListTest, givenAppendedMutableKernelWhenUpdatingGroupCountThenInterfaceDescriptorIsAdjustedForNewGroupCount, IsAtLeastXeHpCore) {
+    using COMPUTE_WALKER = typename FamilyType::COMPUTE_WALKER;
+
+    auto commandList = createCommandList<gfxCoreFamily>();
+    ze_group_count_t groupCount{1, 1, 1};
+
+    uint64_t commandId = 0;
+    auto result = commandList->appendMutableLaunchKernel(kernel.toHandle(), groupCount, nullptr, 0, nullptr, &commandId);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    auto &mutableCommand = commandList->mutableKernelCommands[commandId];
+    auto walker = reinterpret_cast<COMPUTE_WALKER *>(mutableCommand.walker);
+
+    auto expectedWalker = *walker;
+    expectedWalker.setThreadGroupIdXDimension(64);
+    expectedWalker.setThreadGroupIdYDimension(16);
+    expectedWalker.setThreadGroupIdZDimension(1);
+    NEO::EncodeDispatchKernel<FamilyType>::adjustInterfaceDescriptorData(expectedWalker.getInterfaceDescriptor(), *device->getNEODevice(), device->getHwInfo(), 64 * 16,
+                                                                         kernel.getKernelDescriptor().kernelAttributes.numGrfRequired, expectedWalker);
+
+    result = commandList->updateMutableGroupCount(commandId, {64, 16, 1});
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedWalker.getInterfaceDescriptor().getThreadGroupDispatchSize(), walker->getInterfaceDescriptor().getThreadGroupDispatchSize());
+}
+
+HWTEST2_F(MutableCommandListTest, givenInvalidGroupCountWhenUpdatingMutableGroupCountThenErrorIsReturnedAndCommandIsNotPatched, IsAtLeastXeHpCore) {
+    using COMPUTE_WALKER = typename FamilyType::COMPUTE_WALKER;
+
+    auto commandList = createCommandList<gfxCoreFamily>();
+    ze_group_count_t groupCount{8, 1, 1};
+
+    uint64_t commandId = 0;
+    auto result = commandList->appendMutableLaunchKernel(kernel.toHandle(), groupCount, nullptr, 0, nullptr, &commandId);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    auto &mutableCommand = commandList->mutableKernelCommands[commandId];
+    auto walker = reinterpret_cast<COMPUTE_WALKER *>(mutableCommand.walker);
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateMutableGroupCount(commandId, {std::numeric_limits<uint32_t>::max(), 1, 1}));
+
+    uint32_t maxCooperativeGroupCount = 0;
+    kernel.suggestMaxCooperativeGroupCount(&maxCooperativeGroupCount, NEO::EngineGroupType::Compute, false);
+    mutableCommand.isCooperative = true;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateMutableGroupCount(commandId, {maxCooperativeGroupCount + 1, 1, 1}));
+
+    EXPECT_EQ(8u, walker->getThreadGroupIdXDimension());
+    EXPECT_EQ(8u, mutableCommand.groupCount.groupCountX);
+}
+
+HWTEST2_F(MutableCommandListTest, givenAppendedMutableKernelWithSignalEventWhenUpdatingSignalEventThenWalkerPostSyncAddressIsPatched, IsAtLeastXeHpCore) {
+    using COMPUTE_WALKER = typename FamilyType::COMPUTE_WALKER;
+
+    auto commandList = createCommandList<gfxCoreFamily>();
+    auto event0 = createEvent<FamilyType>(eventPool.get(), 0);
+    auto event1 = createEvent<FamilyType>(eventPool.get(), 1);
+    ze_group_count_t groupCount{8, 1, 1};
+
+    uint64_t commandId = 0;
+    auto result = commandList->appendMutableLaunchKernel(kernel.toHandle(), groupCount, event0->toHandle(), 0, nullptr, &commandId);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    auto &mutableCommand = commandList->mutableKernelCommands[commandId];
+    auto walker = reinterpret_cast<COMPUTE_WALKER *>(mutableCommand.walker);
+    EXPECT_EQ(event0->getPacketAddress(device), walker->getPostSync().getDestinationAddress());
+
+    result = commandList->updateMutableSignalEvent(commandId, event1->toHandle());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(event1->getPacketAddress(device), walker->getPostSync().getDestinationAddress());
+
+    ze_event_pool_desc_t timestampPoolDesc = {};
+    timestampPoolDesc.count = 1;
+    timestampPoolDesc.flags = ZE_EVENT_POOL_FLAG_KERNEL_TIMESTAMP;
+    auto timestampPool = std::unique_ptr<L0::EventPool>(L0::EventPool::create(driverHandle.get(), context, 0, nullptr, &timestampPoolDesc, result));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    auto timestampEvent = createEvent<FamilyType>(timestampPool.get(), 0);
+
+    result = commandList->updateMutableSignalEvent(commandId, timestampEvent->toHandle());
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, result);
+    EXPECT_EQ(event1->getPacketAddress(device), walker->getPostSync().getDestinationAddress());
+}
+
+HWTEST2_F(MutableCommandListTest, givenMutableKernelWithoutSignalEventWhenUpdatingSignalEventThenUnsupportedFeatureIsReturned, IsAtLeastXeHpCore) {
+    auto commandList = createCommandList<gfxCoreFamily>();
+    auto event = createEvent<FamilyType>(eventPool.get(), 0);
+    ze_group_count_t groupCount{8, 1, 1};
+
+    uint64_t commandId = 0;
+    auto result = commandList->appendMutableLaunchKernel(kernel.toHandle(), groupCount, nullptr, 0, nullptr, &commandId);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->updateMutableSignalEvent(commandId, event->toHandle()));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_HANDLE, commandList->updateMutableSignalEvent(commandId, nullptr));
+}
+
+HWTEST2_F(MutableCommandListTest, givenInvalidCommandIdOrArgumentWhenUpdatingMutableKernelThenErrorIsReturned, IsAtLeastXeHpCore) {
+    auto commandList = createCommandList<gfxCoreFamily>();
+    ze_group_count_t groupCount{8, 1, 1};
+    uint64_t argValue = 0;
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateMutableKernelArgument(0, 0, sizeof(argValue), &argValue));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateMutableGroupCount(0, groupCount));
+
+    uint64_t commandId = 0;
+    auto result = commandList->appendMutableLaunchKernel(kernel.toHandle(), groupCount, nullptr, 0, nullptr, &commandId);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX, commandList->updateMutableKernelArgument(commandId, 2, sizeof(argValue), &argValue));
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->updateMutableKernelArgument(commandId, 1, sizeof(argValue), &argValue));
+
+    commandList->reset();
+    EXPECT_TRUE(commandList->mutableKernelCommands.empty());
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateMutableKernelArgument(commandId, 0, sizeof(argValue), &argValue));
+}
+
+HWTEST2_F(MutableCommandListTest, givenImmediateCommandListWhenAppendingMutableKernelThenUnsupportedFeatureIsReturned, IsAtLeastXeHpCore) {
+    auto commandList = createCommandList<gfxCoreFamily>();
+    ze_group_count_t groupCount{8, 1, 1};
+    uint64_t commandId = 0;
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, commandList->appendMutableLaunchKernel(kernel.toHandle(), groupCount, nullptr, 0, nullptr, nullptr));
+
+    commandList->cmdListType = CommandList::CommandListType::TYPE_IMMEDIATE;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->appendMutableLaunchKernel(kernel.toHandle(), groupCount, nullptr, 0, nullptr, &commandId));
+    EXPECT_TRUE(commandList->mutableKernelCommands.empty());
+}
+
+} // namespace ult
+} // namespace L0
@@ -567,7 +567,7 @@ HWTEST2_F(L0DebuggerSimpleTest, givenUseCsrImmediateSubmissionEnabledCommandList
                                    reinterpret_cast<void *>(0x2345), size, 0, sizeof(uint32_t),
                                    MemoryPool::System4KBPages, MemoryManager::maxOsContextCount);
 
-    auto result = commandList->appendPageFaultCopy(&dstPtr, &srcPtr, 0x100, false);
+    auto result = commandList->appendPageFaultCopy(&dstPtr, &srcPtr, 0u, 0x100, false);
     ASSERT_EQ(ZE_RESULT_SUCCESS, result);
 
     commandList->destroy();
@@ -590,7 +590,7 @@ HWTEST2_F(L0DebuggerSimpleTest, givenUseCsrImmediateSubmissionDisabledCommandLis
                                    reinterpret_cast<void *>(0x2345), size, 0, sizeof(uint32_t),
                                    MemoryPool::System4KBPages, MemoryManager::maxOsContextCount);
 
-    auto result = commandList->appendPageFaultCopy(&dstPtr, &srcPtr, 0x100, false);
+    auto result = commandList->appendPageFaultCopy(&dstPtr, &srcPtr, 0u, 0x100, false);
     ASSERT_EQ(ZE_RESULT_SUCCESS, result);
 
     commandList->destroy();
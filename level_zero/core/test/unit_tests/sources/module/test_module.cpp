@@ -3830,6 +3830,41 @@ struct ModuleIsaAllocationsFixture : public DeviceFixture {
         EXPECT_NE(kernelImmDatas[1]->getIsaGraphicsAllocation(), nullptr);
     }
 
+    void givenMultipleKernelsWhenKernelImmutableDatasAreInitializedByWorkersThenResultsMatchKernelOrderAndFailingKernelsAreCleaned() {
+        DebugManager.flags.ModuleInitializationWorkers.set(3);
+        constexpr size_t kernelsCount = 8u;
+        auto requestedSize = 0x40;
+        for (size_t i = 0lu; i < kernelsCount; i++) {
+            this->prepareKernelInfoAndAddToTranslationUnit(requestedSize);
+        }
+
+        auto &kernelImmDatas = this->mockModule->getKernelImmutableDataVectorRef();
+        kernelImmDatas.reserve(kernelsCount);
+        for (size_t i = 0lu; i < kernelsCount; i++) {
+            kernelImmDatas.emplace_back(new ProxyKernelImmutableData(this->device));
+        }
+        EXPECT_EQ(ZE_RESULT_SUCCESS, this->mockModule->setIsaGraphicsAllocations());
+        ASSERT_EQ(3u, this->mockModule->getNumWorkersForKernelsInitialization(kernelsCount));
+
+        static_cast<ProxyKernelImmutableData *>(kernelImmDatas[1].get())->initializeCallBase = false;
+        static_cast<ProxyKernelImmutableData *>(kernelImmDatas[6].get())->initializeCallBase = false;
+        static_cast<ProxyKernelImmutableData *>(kernelImmDatas[6].get())->initializeResult = ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+
+        auto result = this->mockModule->initializeKernelImmutableDatas();
+        EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, result);
+
+        auto &kernelInfos = this->mockModule->translationUnit->programInfo.kernelInfos;
+        for (size_t i = 0lu; i < kernelsCount; i++) {
+            if ((i == 1) || (i == 6)) {
+                EXPECT_EQ(nullptr, kernelImmDatas[i].get());
+                continue;
+            }
+            ASSERT_NE(nullptr, kernelImmDatas[i].get());
+            EXPECT_EQ(1u, static_cast<ProxyKernelImmutableData *>(kernelImmDatas[i].get())->initializeCalled);
+            EXPECT_EQ(kernelInfos[i], kernelImmDatas[i]->getKernelInfo());
+        }
+    }
+
     size_t isaPadding;
     size_t kernelStartPointerAlignment;
     NEO::Device *neoDevice = nullptr;
@@ -3877,6 +3912,25 @@ TEST_F(ModuleIsaAllocationsInLocalMemoryTest, givenMultipleKernelIsasWhenKernelI
     this->givenMultipleKernelIsasWhenKernelInitializationFailsThenItIsProperlyCleanedAndPreviouslyInitializedKernelsLeftUntouched();
 }
 
+TEST_F(ModuleIsaAllocationsInLocalMemoryTest, givenMultipleKernelsWhenKernelImmutableDatasAreInitializedByWorkersThenResultsMatchKernelOrderAndFailingKernelsAreCleaned) {
+    this->givenMultipleKernelsWhenKernelImmutableDatasAreInitializedByWorkersThenResultsMatchKernelOrderAndFailingKernelsAreCleaned();
+}
+
+TEST_F(ModuleIsaAllocationsInLocalMemoryTest, givenModuleInitializationWorkersWhenGettingNumWorkersForKernelsInitializationThenValueIsBoundedByKernelsCount) {
+    constexpr auto minKernelsPerWorker = ModuleImp::minKernelsPerInitializationWorker;
+    EXPECT_EQ(1u, this->mockModule->getNumWorkersForKernelsInitialization(1u));
+    EXPECT_EQ(1u, this->mockModule->getNumWorkersForKernelsInitialization(2 * minKernelsPerWorker - 1));
+    EXPECT_LE(this->mockModule->getNumWorkersForKernelsInitialization(2 * minKernelsPerWorker), 2u);
+    EXPECT_LE(this->mockModule->getNumWorkersForKernelsInitialization(1000 * minKernelsPerWorker), ModuleImp::defaultMaxKernelsInitializationWorkers);
+
+    DebugManager.flags.ModuleInitializationWorkers.set(0);
+    EXPECT_EQ(1u, this->mockModule->getNumWorkersForKernelsInitialization(1000u));
+
+    DebugManager.flags.ModuleInitializationWorkers.set(4);
+    EXPECT_EQ(2u, this->mockModule->getNumWorkersForKernelsInitialization(2u));
+    EXPECT_EQ(4u, this->mockModule->getNumWorkersForKernelsInitialization(100u));
+}
+
 using ModuleIsaAllocationsInSystemMemoryTest = Test<ModuleIsaAllocationsFixture<false>>;
 
 TEST_F(ModuleIsaAllocationsInSystemMemoryTest, givenKernelIsaWhichCouldFitInPages4KBWhenKernelImmutableDatasInitializedThenKernelIsasCanGetSeparateAllocationsDependingOnPaddingSize) {
@@ -0,0 +1,254 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/io_functions.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/helpers/variable_backup.h"
+
+#include "level_zero/experimental/source/tracing/tracing_recorder.h"
+
+#include "test_api_tracing_common.h"
+
+#include <cstring>
+#include <thread>
+
+namespace L0 {
+namespace ult {
+
+class MockTraceRecorder : public TraceRecorder {
+  public:
+    using TraceRecorder::ringBuffers;
+
+    MockTraceRecorder(size_t recordsPerThread) : TraceRecorder(recordsPerThread, "", false) {}
+
+    ~MockTraceRecorder() override {
+        drain();
+        if (destroyed) {
+            destroyed->store(true);
+        }
+    }
+
+    void writeTraceData(const void *data, size_t size) override {
+        auto bytes = reinterpret_cast<const uint8_t *>(data);
+        binaryTrace.insert(binaryTrace.end(), bytes, bytes + size);
+    }
+
+    std::vector<uint8_t> binaryTrace;
+    std::atomic<bool> *destroyed = nullptr;
+};
+
+TEST(TraceRingBufferTest, givenRequestedCapacityWhenCreatingRingBufferThenCapacityIsRoundedUpToPowerOfTwo) {
+    TraceRingBuffer ringBuffer(5, 0);
+    EXPECT_EQ(8u, ringBuffer.getCapacity());
+}
+
+TEST(TraceRingBufferTest, givenFullRingBufferWhenPushingRecordThenRecordIsDroppedAndCountedUntilRingBufferIsDrained) {
+    TraceRingBuffer ringBuffer(2, 3);
+    TraceRecord record = {};
+
+    record.apiId = 1;
+    EXPECT_TRUE(ringBuffer.push(record));
+    record.apiId = 2;
+    EXPECT_TRUE(ringBuffer.push(record));
+    record.apiId = 3;
+    EXPECT_FALSE(ringBuffer.push(record));
+    EXPECT_EQ(1u, ringBuffer.getDroppedRecordsCount());
+
+    std::vector<TraceRecord> drainedRecords;
+    EXPECT_EQ(2u, ringBuffer.drain(drainedRecords));
+    ASSERT_EQ(2u, drainedRecords.size());
+    EXPECT_EQ(1u, drainedRecords[0].apiId);
+    EXPECT_EQ(2u, drainedRecords[1].apiId);
+
+    record.apiId = 4;
+    EXPECT_TRUE(ringBuffer.push(record));
+    drainedRecords.clear();
+    EXPECT_EQ(1u, ringBuffer.drain(drainedRecords));
+    EXPECT_EQ(4u, drainedRecords[0].apiId);
+    EXPECT_EQ(0u, ringBuffer.drain(drainedRecords));
+}
+
+TEST(TraceRecorderTest, givenCallbackNamesWhenRegisteringApiThenL0ApiNameIsStored) {
+    auto apiId = TraceRecorder::registerApi("CommandList", "pfnAppendLaunchKernelCb");
+    EXPECT_EQ("zeCommandListAppendLaunchKernel", TraceRecorder::getApiName(apiId));
+    EXPECT_EQ("", TraceRecorder::getApiName(apiId + 1000));
+}
+
+TEST(TraceRecorderTest, givenRecordsFromTwoThreadsWhenDrainedThenEachThreadGetsOwnRingBufferAndChromeTraceContainsAllRecords) {
+    auto apiId = TraceRecorder::registerApi("CommandList", "pfnCloseCb");
+    MockTraceRecorder recorder(16);
+
+    recorder.record(apiId, 1000, 3500, 0x1234, 64, ZE_RESULT_SUCCESS);
+    std::thread otherThread([&]() {
+        recorder.record(apiId, 2000, 2250, 0x5678, 0, ZE_RESULT_ERROR_INVALID_ARGUMENT);
+    });
+    otherThread.join();
+    recorder.record(apiId, 4000, 5000, 0x1234, 0, ZE_RESULT_SUCCESS);
+
+    EXPECT_EQ(2u, recorder.ringBuffers.size());
+
+    recorder.drain();
+    EXPECT_EQ(1u, recorder.ringBuffers.size());
+
+    TraceFileHeader header = {};
+    ASSERT_LE(sizeof(header), recorder.binaryTrace.size());
+    memcpy(&header, recorder.binaryTrace.data(), sizeof(header));
+    EXPECT_EQ(TraceRecorder::traceFileMagic, header.magic);
+    EXPECT_EQ(TraceRecorder::traceFileVersion, header.version);
+
+    std::string chromeTrace;
+    ASSERT_TRUE(TraceRecorder::convertToChromeTrace(recorder.binaryTrace, chromeTrace));
+    EXPECT_NE(std::string::npos, chromeTrace.find("{\"name\":\"zeCommandListClose\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":1.000,\"dur\":2.500,\"args\":{\"handle\":\"0x1234\",\"size\":64,\"result\":0}}"));
+    EXPECT_NE(std::string::npos, chromeTrace.find("\"tid\":0,\"ts\":4.000,\"dur\":1.000"));
+    EXPECT_NE(std::string::npos, chromeTrace.find("\"tid\":1,\"ts\":2.000,\"dur\":0.250,\"args\":{\"handle\":\"0x5678\",\"size\":0,\"result\":2013265924}"));
+    EXPECT_EQ(0u, recorder.getDroppedRecordsCount());
+}
+
+TEST(TraceRecorderTest, givenAlreadyDrainedRecordsWhenDrainingAgainThenOnlyNewRecordsAreWritten) {
+    auto apiId = TraceRecorder::registerApi("Event", "pfnHostSynchronizeCb");
+    MockTraceRecorder recorder(4);
+
+    recorder.record(apiId, 0, 1, 0, 0, ZE_RESULT_SUCCESS);
+    recorder.drain();
+    auto drainedSize = recorder.binaryTrace.size();
+
+    recorder.drain();
+    EXPECT_EQ(drainedSize, recorder.binaryTrace.size());
+
+    recorder.record(apiId, 2, 3, 0, 0, ZE_RESULT_SUCCESS);
+    recorder.drain();
+    EXPECT_EQ(drainedSize + sizeof(TraceChunkHeader) + sizeof(TraceRecord), recorder.binaryTrace.size());
+}
+
+TEST(TraceRecorderTest, givenNoRecordsWhenDrainingThenNothingIsWritten) {
+    MockTraceRecorder recorder(4);
+    recorder.drain();
+    EXPECT_TRUE(recorder.binaryTrace.empty());
+}
+
+TEST(TraceRecorderTest, givenExitedThreadWhenDrainingThenItsRecordsAreWrittenAndRingBufferIsFreedWithDroppedRecordsKept) {
+    auto apiId = TraceRecorder::registerApi("Event", "pfnQueryStatusCb");
+    MockTraceRecorder recorder(1);
+
+    std::thread otherThread([&]() {
+        recorder.record(apiId, 0, 1, 0, 0, ZE_RESULT_SUCCESS);
+        recorder.record(apiId, 2, 3, 0, 0, ZE_RESULT_SUCCESS);
+    });
+    otherThread.join();
+    ASSERT_EQ(1u, recorder.ringBuffers.size());
+    EXPECT_TRUE(recorder.ringBuffers[0]->isReleased());
+
+    recorder.drain();
+    EXPECT_EQ(0u, recorder.ringBuffers.size());
+    EXPECT_EQ(1u, recorder.getDroppedRecordsCount());
+
+    std::string chromeTrace;
+    ASSERT_TRUE(TraceRecorder::convertToChromeTrace(recorder.binaryTrace, chromeTrace));
+    EXPECT_NE(std::string::npos, chromeTrace.find("\"tid\":0,\"ts\":0.000"));
+}
+
+TEST(TraceRecorderTest, givenGlobalRecorderInUseWhenDestroyingGlobalRecorderThenItIsDeletedOnlyAfterUseEnds) {
+    std::atomic<bool> destroyed{false};
+    auto recorder = new MockTraceRecorder(4);
+    recorder->destroyed = &destroyed;
+    pGlobalTraceRecorder.store(recorder);
+
+    std::thread destroyThread;
+    {
+        GlobalTraceRecorderUse traceRecorderUse;
+        EXPECT_EQ(recorder, traceRecorderUse.get());
+
+        destroyThread = std::thread([]() { TraceRecorder::destroyGlobal(); });
+        while (pGlobalTraceRecorder.load() != nullptr) {
+            std::this_thread::yield();
+        }
+        EXPECT_FALSE(destroyed.load());
+
+        GlobalTraceRecorderUse lateTraceRecorderUse;
+        EXPECT_EQ(nullptr, lateTraceRecorderUse.get());
+    }
+    destroyThread.join();
+    EXPECT_TRUE(destroyed.load());
+    EXPECT_EQ(0u, globalTraceRecorderUsers.load());
+}
+
+TEST(TraceRecorderTest, givenMalformedBinaryTraceWhenConvertingToChromeTraceThenFalseIsReturned) {
+    std::string chromeTrace;
+    std::vector<uint8_t> binaryTrace(sizeof(TraceFileHeader), 0u);
+    EXPECT_FALSE(TraceRecorder::convertToChromeTrace(binaryTrace, chromeTrace));
+
+    TraceFileHeader header = {TraceRecorder::traceFileMagic, TraceRecorder::traceFileVersion};
+    TraceChunkHeader chunkHeader = {TraceChunkType::records, 0, 1};
+    binaryTrace.resize(sizeof(header) + sizeof(chunkHeader));
+    memcpy(binaryTrace.data(), &header, sizeof(header));
+    memcpy(binaryTrace.data() + sizeof(header), &chunkHeader, sizeof(chunkHeader));
+    EXPECT_FALSE(TraceRecorder::convertToChromeTrace(binaryTrace, chromeTrace));
+
+    binaryTrace.resize(sizeof(header));
+    EXPECT_TRUE(TraceRecorder::convertToChromeTrace(binaryTrace, chromeTrace));
+    EXPECT_EQ("{\"traceEvents\":[\n]}\n", chromeTrace);
+}
+
+TEST(TraceRecorderTest, givenOutputFileWhichCannotBeOpenedWhenDrainingMultipleTimesThenOpenIsAttemptedOnlyOnceAfterFirstRecordsAreDrained) {
+    static uint32_t fopenCalled = 0;
+    fopenCalled = 0;
+    VariableBackup<NEO::IoFunctions::fopenFuncPtr> fopenBackup(&NEO::IoFunctions::fopenPtr, [](const char *filename, const char *mode) -> FILE * {
+        fopenCalled++;
+        return nullptr;
+    });
+    auto apiId = TraceRecorder::registerApi("Event", "pfnHostResetCb");
+
+    {
+        TraceRecorder recorder(4, "trace.bin", false);
+        recorder.drain();
+        EXPECT_EQ(0u, fopenCalled);
+
+        recorder.record(apiId, 0, 1, 0, 0, ZE_RESULT_SUCCESS);
+        recorder.drain();
+        EXPECT_EQ(1u, fopenCalled);
+
+        recorder.record(apiId, 2, 3, 0, 0, ZE_RESULT_SUCCESS);
+        recorder.drain();
+    }
+    EXPECT_EQ(1u, fopenCalled);
+}
+
+TEST(TraceRecorderTest, givenTraceRecorderEnabledWithoutTracingLayerWhenCreatingGlobalRecorderThenRecorderIsNotCreated) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.L0TraceRecorderRecordsPerThread.set(16);
+    VariableBackup<bool> enableTracingBackup(&driverDdiTable.enableTracing, false);
+
+    TraceRecorder::createGlobal();
+    EXPECT_EQ(nullptr, pGlobalTraceRecorder.load());
+}
+
+TEST_F(ZeApiTracingCoreTests, givenGlobalTraceRecorderWhenCallingTracedApiThenCallIsRecordedWithHandleSizeAndResult) {
+    VariableBackup<ze_pfnCommandListAppendMemoryCopy_t> appendMemoryCopyBackup(&driverDdiTable.coreDdiTable.CommandList.pfnAppendMemoryCopy,
+                                                                               [](ze_command_list_handle_t hCommandList, void *dstptr, const void *srcptr, size_t size,
+                                                                                  ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) { return ZE_RESULT_ERROR_INVALID_SIZE; });
+    MockTraceRecorder recorder(16);
+    pGlobalTraceRecorder.store(&recorder);
+
+    auto commandList = reinterpret_cast<ze_command_list_handle_t>(0xabc0);
+    uint8_t dst[64];
+    uint8_t src[64];
+    auto result = zeCommandListAppendMemoryCopyTracing(commandList, dst, src, sizeof(dst), nullptr, 0u, nullptr);
+    pGlobalTraceRecorder.store(nullptr);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_SIZE, result);
+
+    ASSERT_EQ(1u, recorder.ringBuffers.size());
+    std::vector<TraceRecord> records;
+    EXPECT_EQ(1u, recorder.ringBuffers[0]->drain(records));
+    EXPECT_EQ("zeCommandListAppendMemoryCopy", TraceRecorder::getApiName(records[0].apiId));
+    EXPECT_EQ(0xabc0u, records[0].handle);
+    EXPECT_EQ(sizeof(dst), records[0].size);
+    EXPECT_EQ(static_cast<int32_t>(ZE_RESULT_ERROR_INVALID_SIZE), records[0].result);
+    EXPECT_LE(records[0].startTimestamp, records[0].endTimestamp);
+}
+
+} // namespace ult
+} // namespace L0
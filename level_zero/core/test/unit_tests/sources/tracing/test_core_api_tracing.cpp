@@ -203,7 +203,7 @@ TEST_F(ZeApiTracingCoreTests, WhenCallingTracerWrapperWithOnePrologAndNoEpilogWi
     prologCallbacks.push_back(prologCallback);
     ze_pfnCommandListCloseCb_t apiOrdinal = {};
 
-    result = apiTracerWrapperImp(zeCommandListClose, &tracerParams, apiOrdinal, prologCallbacks, epilogCallbacks, *tracerParams.phCommandList);
+    result = apiTracerWrapperImp(zeCommandListClose, &tracerParams, apiOrdinal, prologCallbacks, epilogCallbacks, 0u, *tracerParams.phCommandList);
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
@@ -233,7 +233,7 @@ TEST_F(ZeApiTracingCoreTests, WhenCallingTracerWrapperWithOneSetOfPrologEpilogsW
     epilogCallbacks.push_back(epilogCallback);
     ze_pfnCommandListCloseCb_t apiOrdinal = {};
 
-    result = apiTracerWrapperImp(zeCommandListClose, &tracerParams, apiOrdinal, prologCallbacks, epilogCallbacks, *tracerParams.phCommandList);
+    result = apiTracerWrapperImp(zeCommandListClose, &tracerParams, apiOrdinal, prologCallbacks, epilogCallbacks, 0u, *tracerParams.phCommandList);
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
@@ -263,7 +263,7 @@ TEST_F(ZeApiTracingCoreTests, WhenCallingTracerWrapperWithOneSetOfPrologEpilogsW
     epilogCallbacks.push_back(epilogCallback);
     ze_pfnCommandListCloseCb_t apiOrdinal = {};
 
-    result = apiTracerWrapperImp(zeCommandListClose, &tracerParams, apiOrdinal, prologCallbacks, epilogCallbacks, *tracerParams.phCommandList);
+    result = apiTracerWrapperImp(zeCommandListClose, &tracerParams, apiOrdinal, prologCallbacks, epilogCallbacks, 0u, *tracerParams.phCommandList);
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
@@ -292,7 +292,7 @@ TEST_F(ZeApiTracingCoreTests, WhenCallingTracerWrapperWithOneSetOfPrologEpilogsW
     epilogCallbacks.push_back(epilogCallback);
     ze_pfnCommandListCloseCb_t apiOrdinal = {};
 
-    result = apiTracerWrapperImp(zeCommandListClose, &tracerParams, apiOrdinal, prologCallbacks, epilogCallbacks, *tracerParams.phCommandList);
+    result = apiTracerWrapperImp(zeCommandListClose, &tracerParams, apiOrdinal, prologCallbacks, epilogCallbacks, 0u, *tracerParams.phCommandList);
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
@@ -325,7 +325,7 @@ TEST_F(ZeApiTracingCoreTests, WhenCallingTracerWrapperWithOneSetOfPrologEpilogsW
     result = callHandleTracerRecursion(zeCommandListClose, commandListHandle);
     EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, result);
 
-    result = apiTracerWrapperImp(zeCommandListClose, &tracerParams, apiOrdinal, prologCallbacks, epilogCallbacks, *tracerParams.phCommandList);
+    result = apiTracerWrapperImp(zeCommandListClose, &tracerParams, apiOrdinal, prologCallbacks, epilogCallbacks, 0u, *tracerParams.phCommandList);
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 
     result = callHandleTracerRecursion(zeCommandListClose, commandListHandle);
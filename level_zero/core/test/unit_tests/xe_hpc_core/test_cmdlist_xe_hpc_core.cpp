@@ -896,7 +896,7 @@ HWTEST2_F(CommandListAppendLaunchKernelXeHpcCore,
     result = commandList->initialize(device, NEO::EngineGroupType::Compute, 0u);
     ASSERT_EQ(ZE_RESULT_SUCCESS, result);
 
-    result = commandList->appendPageFaultCopy(dstAllocation, srcAllocation, size, false);
+    result = commandList->appendPageFaultCopy(dstAllocation, srcAllocation, 0u, size, false);
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
     EXPECT_TRUE(commandList->usedKernelLaunchParams.isBuiltInKernel);
     EXPECT_FALSE(commandList->usedKernelLaunchParams.isKernelSplitOperation);
@@ -1408,6 +1408,7 @@ HWTEST2_F(CommandQueueCommandsXeHpc, givenSplitBcsCopyAndImmediateCommandListWhe
 
     auto result = commandList0->appendPageFaultCopy(testL0Device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(dstPtr)->gpuAllocations.getDefaultGraphicsAllocation(),
                                                     testL0Device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(srcPtr)->gpuAllocations.getDefaultGraphicsAllocation(),
+                                                    0u,
                                                     size,
                                                     false);
     ASSERT_EQ(ZE_RESULT_SUCCESS, result);
@@ -1420,5 +1421,112 @@ HWTEST2_F(CommandQueueCommandsXeHpc, givenSplitBcsCopyAndImmediateCommandListWhe
     context->freeMem(dstPtr);
 }
 
+HWTEST2_F(CommandQueueCommandsXeHpc, givenLoadAwareSplitBcsCopyWhenGettingChunkSizesThenBusyEnginesGetSmallerChunksAndSmallCopiesUseFewerEngines, IsXeHpcCore) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SplitBcsCopy.set(1);
+    DebugManager.flags.SplitBcsLoadAware.set(1);
+
+    ze_result_t returnValue;
+    auto hwInfo = *NEO::defaultHwInfo;
+    hwInfo.featureTable.ftrBcsInfo = 0b111111111;
+    hwInfo.capabilityTable.blitterOperationsSupported = true;
+    auto testNeoDevice = NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo);
+    auto testL0Device = std::unique_ptr<L0::Device>(L0::Device::create(driverHandle.get(), testNeoDevice, false, &returnValue));
+
+    ze_command_queue_desc_t desc = {};
+    desc.ordinal = static_cast<uint32_t>(testNeoDevice->getEngineGroupIndexFromEngineGroupType(NEO::EngineGroupType::Copy));
+
+    std::unique_ptr<L0::CommandList> commandList0(CommandList::createImmediate(productFamily,
+                                                                               testL0Device.get(),
+                                                                               &desc,
+                                                                               false,
+                                                                               NEO::EngineGroupType::Copy,
+                                                                               returnValue));
+    ASSERT_NE(nullptr, commandList0);
+    auto &bcsSplit = static_cast<DeviceImp *>(testL0Device.get())->bcsSplit;
+    ASSERT_EQ(4u, bcsSplit.cmdQs.size());
+    EXPECT_TRUE(bcsSplit.loadAwareSplit);
+
+    auto &busyEngineLoad = bcsSplit.getEngineLoad(bcsSplit.cmdQs[1]);
+    *busyEngineLoad.csr->getTagAddress() = 0u;
+    busyEngineLoad.pendingCopies.push_back({100u, 4 * MemoryConstants::megaByte});
+    busyEngineLoad.inFlightBytes = 4 * MemoryConstants::megaByte;
+
+    StackVec<size_t, 4> chunkSizes;
+    bcsSplit.getChunkSizesForSplit(bcsSplit.cmdQs, 8 * MemoryConstants::megaByte, chunkSizes);
+    ASSERT_EQ(4u, chunkSizes.size());
+    EXPECT_EQ(chunkSizes[0], chunkSizes[2]);
+    EXPECT_LT(chunkSizes[1], chunkSizes[0]);
+    EXPECT_EQ(8 * MemoryConstants::megaByte, chunkSizes[0] + chunkSizes[1] + chunkSizes[2] + chunkSizes[3]);
+
+    chunkSizes.clear();
+    bcsSplit.getChunkSizesForSplit(bcsSplit.cmdQs, 2 * MemoryConstants::megaByte, chunkSizes);
+    EXPECT_EQ(0u, chunkSizes[1]);
+    EXPECT_EQ(2u, static_cast<size_t>(std::count(chunkSizes.begin(), chunkSizes.end(), 0u)));
+    EXPECT_EQ(2 * MemoryConstants::megaByte, chunkSizes[0] + chunkSizes[2] + chunkSizes[3]);
+
+    *busyEngineLoad.csr->getTagAddress() = 100u;
+    chunkSizes.clear();
+    bcsSplit.getChunkSizesForSplit(bcsSplit.cmdQs, 8 * MemoryConstants::megaByte, chunkSizes);
+    EXPECT_EQ(0u, busyEngineLoad.inFlightBytes);
+    EXPECT_TRUE(busyEngineLoad.pendingCopies.empty());
+    for (auto &chunkSize : chunkSizes) {
+        EXPECT_EQ(2 * MemoryConstants::megaByte, chunkSize);
+    }
+}
+
+HWTEST2_F(CommandQueueCommandsXeHpc, givenLoadAwareSplitBcsCopyAndBusyEngineWhenAppendingMemoryCopyD2HThenBusyEngineIsSkipped, IsXeHpcCore) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SplitBcsCopy.set(1);
+    DebugManager.flags.SplitBcsLoadAware.set(1);
+    DebugManager.flags.EnableFlushTaskSubmission.set(0);
+
+    ze_result_t returnValue;
+    auto hwInfo = *NEO::defaultHwInfo;
+    hwInfo.featureTable.ftrBcsInfo = 0b111111111;
+    hwInfo.capabilityTable.blitterOperationsSupported = true;
+    auto testNeoDevice = NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo);
+    auto testL0Device = std::unique_ptr<L0::Device>(L0::Device::create(driverHandle.get(), testNeoDevice, false, &returnValue));
+
+    ze_command_queue_desc_t desc = {};
+    desc.ordinal = static_cast<uint32_t>(testNeoDevice->getEngineGroupIndexFromEngineGroupType(NEO::EngineGroupType::Copy));
+
+    std::unique_ptr<L0::CommandList> commandList0(CommandList::createImmediate(productFamily,
+                                                                               testL0Device.get(),
+                                                                               &desc,
+                                                                               false,
+                                                                               NEO::EngineGroupType::Copy,
+                                                                               returnValue));
+    ASSERT_NE(nullptr, commandList0);
+    auto &bcsSplit = static_cast<DeviceImp *>(testL0Device.get())->bcsSplit;
+    ASSERT_EQ(4u, bcsSplit.cmdQs.size());
+
+    auto &busyEngineLoad = bcsSplit.getEngineLoad(bcsSplit.cmdQs[2]);
+    *busyEngineLoad.csr->getTagAddress() = 0u;
+    busyEngineLoad.pendingCopies.push_back({100u, 64 * MemoryConstants::megaByte});
+    busyEngineLoad.inFlightBytes = 64 * MemoryConstants::megaByte;
+
+    constexpr size_t alignment = 4096u;
+    constexpr size_t size = 8 * MemoryConstants::megaByte;
+    void *srcPtr;
+    void *dstPtr;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    context->allocDeviceMem(device->toHandle(),
+                            &deviceDesc,
+                            size, alignment, &srcPtr);
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    context->allocHostMem(&hostDesc, size, alignment, &dstPtr);
+
+    auto result = commandList0->appendMemoryCopy(dstPtr, srcPtr, size, nullptr, 0, nullptr, false, false);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(static_cast<CommandQueueImp *>(bcsSplit.cmdQs[2])->getTaskCount(), 0u);
+    EXPECT_EQ(static_cast<CommandQueueImp *>(bcsSplit.cmdQs[3])->getTaskCount(), 1u);
+
+    EXPECT_EQ(64 * MemoryConstants::megaByte, busyEngineLoad.inFlightBytes);
+
+    context->freeMem(srcPtr);
+    context->freeMem(dstPtr);
+}
+
 } // namespace ult
 } // namespace L0
@@ -34,6 +34,7 @@ zeCommandListAppendBarrierTracing(ze_command_list_handle_t hCommandList,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phCommandList,
                                    *tracerParams.phSignalEvent,
                                    *tracerParams.pnumWaitEvents,
@@ -76,6 +77,7 @@ zeCommandListAppendMemoryRangesBarrierTracing(ze_command_list_handle_t hCommandL
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phCommandList,
                                    *tracerParams.pnumRanges,
                                    *tracerParams.ppRangeSizes,
@@ -34,6 +34,7 @@ zeCommandListCreateTracing(ze_context_handle_t hContext,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phContext,
                                    *tracerParams.phDevice,
                                    *tracerParams.pdesc,
@@ -67,6 +68,7 @@ zeCommandListCreateImmediateTracing(ze_context_handle_t hContext,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phContext,
                                    *tracerParams.phDevice,
                                    *tracerParams.paltdesc,
@@ -90,6 +92,7 @@ zeCommandListDestroyTracing(ze_command_list_handle_t hCommandList) {
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phCommandList);
 }
 
@@ -110,6 +113,7 @@ zeCommandListCloseTracing(ze_command_list_handle_t hCommandList) {
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phCommandList);
 }
 
@@ -131,6 +135,7 @@ zeCommandListResetTracing(ze_command_list_handle_t hCommandList) {
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phCommandList);
 }
 
@@ -164,6 +169,7 @@ zeCommandListAppendWriteGlobalTimestampTracing(ze_command_list_handle_t hCommand
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phCommandList,
                                    *tracerParams.pdstptr,
                                    *tracerParams.phSignalEvent,
@@ -210,6 +216,7 @@ zeCommandListAppendQueryKernelTimestampsTracing(ze_command_list_handle_t hComman
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phCommandList,
                                    *tracerParams.pnumEvents,
                                    *tracerParams.pphEvents,
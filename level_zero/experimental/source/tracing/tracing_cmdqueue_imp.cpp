@@ -33,6 +33,7 @@ zeCommandQueueCreateTracing(ze_context_handle_t hContext,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phContext,
                                    *tracerParams.phDevice,
                                    *tracerParams.pdesc,
@@ -57,6 +58,7 @@ zeCommandQueueDestroyTracing(ze_command_queue_handle_t hCommandQueue) {
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phCommandQueue);
 }
 ZE_APIEXPORT ze_result_t ZE_APICALL
@@ -85,6 +87,7 @@ zeCommandQueueExecuteCommandListsTracing(ze_command_queue_handle_t hCommandQueue
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phCommandQueue,
                                    *tracerParams.pnumCommandLists,
                                    *tracerParams.pphCommandLists,
@@ -112,6 +115,7 @@ zeCommandQueueSynchronizeTracing(ze_command_queue_handle_t hCommandQueue,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phCommandQueue,
                                    *tracerParams.ptimeout);
 }
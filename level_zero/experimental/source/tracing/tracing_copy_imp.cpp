@@ -43,6 +43,7 @@ zeCommandListAppendMemoryCopyTracing(ze_command_list_handle_t hCommandList,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phCommandList,
                                    *tracerParams.pdstptr,
                                    *tracerParams.psrcptr,
@@ -91,6 +92,7 @@ zeCommandListAppendMemoryFillTracing(ze_command_list_handle_t hCommandList,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phCommandList,
                                    *tracerParams.pptr,
                                    *tracerParams.ppattern,
@@ -152,6 +154,7 @@ zeCommandListAppendMemoryCopyRegionTracing(ze_command_list_handle_t hCommandList
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phCommandList,
                                    *tracerParams.pdstptr,
                                    *tracerParams.pdstRegion,
@@ -205,6 +208,7 @@ zeCommandListAppendMemoryCopyFromContextTracing(ze_command_list_handle_t hComman
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phCommandList,
                                    *tracerParams.pdstptr,
                                    *tracerParams.phContextSrc,
@@ -248,6 +252,7 @@ zeCommandListAppendImageCopyTracing(ze_command_list_handle_t hCommandList,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phCommandList,
                                    *tracerParams.phDstImage,
                                    *tracerParams.phSrcImage,
@@ -295,6 +300,7 @@ zeCommandListAppendImageCopyRegionTracing(ze_command_list_handle_t hCommandList,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phCommandList,
                                    *tracerParams.phDstImage,
                                    *tracerParams.phSrcImage,
@@ -341,6 +347,7 @@ zeCommandListAppendImageCopyToMemoryTracing(ze_command_list_handle_t hCommandLis
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phCommandList,
                                    *tracerParams.pdstptr,
                                    *tracerParams.phSrcImage,
@@ -386,6 +393,7 @@ zeCommandListAppendImageCopyFromMemoryTracing(ze_command_list_handle_t hCommandL
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phCommandList,
                                    *tracerParams.phDstImage,
                                    *tracerParams.psrcptr,
@@ -419,6 +427,7 @@ zeCommandListAppendMemoryPrefetchTracing(ze_command_list_handle_t hCommandList,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phCommandList,
                                    *tracerParams.pptr,
                                    *tracerParams.psize);
@@ -454,6 +463,7 @@ zeCommandListAppendMemAdviseTracing(ze_command_list_handle_t hCommandList,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phCommandList,
                                    *tracerParams.phDevice,
                                    *tracerParams.pptr,
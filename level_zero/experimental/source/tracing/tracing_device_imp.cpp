@@ -31,6 +31,7 @@ zeDeviceGetTracing(ze_driver_handle_t hDriver,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phDriver,
                                    *tracerParams.ppCount,
                                    *tracerParams.pphDevices);
@@ -57,6 +58,7 @@ zeDeviceGetPropertiesTracing(ze_device_handle_t hDevice,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phDevice,
                                    *tracerParams.ppDeviceProperties);
 }
@@ -82,6 +84,7 @@ zeDeviceGetComputePropertiesTracing(ze_device_handle_t hDevice,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phDevice,
                                    *tracerParams.ppComputeProperties);
 }
@@ -110,6 +113,7 @@ zeDeviceGetMemoryPropertiesTracing(ze_device_handle_t hDevice,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phDevice,
                                    *tracerParams.ppCount,
                                    *tracerParams.ppMemProperties);
@@ -139,6 +143,7 @@ zeDeviceGetCachePropertiesTracing(ze_device_handle_t hDevice,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phDevice,
                                    *tracerParams.ppCount,
                                    *tracerParams.ppCacheProperties);
@@ -165,6 +170,7 @@ zeDeviceGetImagePropertiesTracing(ze_device_handle_t hDevice,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phDevice,
                                    *tracerParams.ppImageProperties);
 }
@@ -193,6 +199,7 @@ zeDeviceGetSubDevicesTracing(ze_device_handle_t hDevice,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phDevice,
                                    *tracerParams.ppCount,
                                    *tracerParams.pphSubdevices);
@@ -222,6 +229,7 @@ zeDeviceGetP2PPropertiesTracing(ze_device_handle_t hDevice,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phDevice,
                                    *tracerParams.phPeerDevice,
                                    *tracerParams.ppP2PProperties);
@@ -251,6 +259,7 @@ zeDeviceCanAccessPeerTracing(ze_device_handle_t hDevice,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phDevice,
                                    *tracerParams.phPeerDevice,
                                    *tracerParams.pvalue);
@@ -277,6 +286,7 @@ zeKernelSetCacheConfigTracing(ze_kernel_handle_t hKernel,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phKernel,
                                    *tracerParams.pflags);
 }
@@ -303,6 +313,7 @@ zeDeviceGetMemoryAccessPropertiesTracing(ze_device_handle_t hDevice,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phDevice,
                                    *tracerParams.ppMemAccessProperties);
 }
@@ -328,6 +339,7 @@ zeDeviceGetModulePropertiesTracing(ze_device_handle_t hDevice,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phDevice,
                                    *tracerParams.ppModuleProperties);
 }
@@ -356,6 +368,7 @@ zeDeviceGetCommandQueueGroupPropertiesTracing(ze_device_handle_t hDevice,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phDevice,
                                    *tracerParams.ppCount,
                                    *tracerParams.ppCommandQueueGroupProperties);
@@ -382,6 +395,7 @@ zeDeviceGetExternalMemoryPropertiesTracing(ze_device_handle_t hDevice,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phDevice,
                                    *tracerParams.ppExternalMemoryProperties);
 }
@@ -404,5 +418,6 @@ zeDeviceGetStatusTracing(ze_device_handle_t hDevice) {
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phDevice);
 }
@@ -28,6 +28,7 @@ zeDriverGetTracing(uint32_t *pCount,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.ppCount,
                                    *tracerParams.pphDrivers);
 }
@@ -52,6 +53,7 @@ zeDriverGetPropertiesTracing(ze_driver_handle_t hDriver,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phDriver,
                                    *tracerParams.ppDriverProperties);
 }
@@ -75,6 +77,7 @@ zeDriverGetApiVersionTracing(ze_driver_handle_t hDrivers,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phDriver,
                                    *tracerParams.pversion);
 }
@@ -100,6 +103,7 @@ zeDriverGetIpcPropertiesTracing(ze_driver_handle_t hDriver,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phDriver,
                                    *tracerParams.ppIpcProperties);
 }
@@ -128,6 +132,7 @@ zeDriverGetExtensionPropertiesTracing(ze_driver_handle_t hDriver,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phDriver,
                                    *tracerParams.ppCount,
                                    *tracerParams.ppExtensionProperties);
@@ -37,6 +37,7 @@ zeEventPoolCreateTracing(ze_context_handle_t hContext,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phContext,
                                    *tracerParams.pdesc,
                                    *tracerParams.pnumDevices,
@@ -62,6 +63,7 @@ zeEventPoolDestroyTracing(ze_event_pool_handle_t hEventPool) {
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phEventPool);
 }
 
@@ -89,6 +91,7 @@ zeEventCreateTracing(ze_event_pool_handle_t hEventPool,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phEventPool,
                                    *tracerParams.pdesc,
                                    *tracerParams.pphEvent);
@@ -112,6 +115,7 @@ zeEventDestroyTracing(ze_event_handle_t hEvent) {
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phEvent);
 }
 
@@ -136,6 +140,7 @@ zeEventPoolGetIpcHandleTracing(ze_event_pool_handle_t hEventPool,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phEventPool,
                                    *tracerParams.pphIpc);
 }
@@ -164,6 +169,7 @@ zeEventPoolOpenIpcHandleTracing(ze_context_handle_t hContext,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phContext,
                                    *tracerParams.phIpc,
                                    *tracerParams.pphEventPool);
@@ -187,6 +193,7 @@ zeEventPoolCloseIpcHandleTracing(ze_event_pool_handle_t hEventPool) {
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phEventPool);
 }
 
@@ -211,6 +218,7 @@ zeCommandListAppendSignalEventTracing(ze_command_list_handle_t hCommandList,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phCommandList,
                                    *tracerParams.phEvent);
 }
@@ -239,6 +247,7 @@ zeCommandListAppendWaitOnEventsTracing(ze_command_list_handle_t hCommandList,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phCommandList,
                                    *tracerParams.pnumEvents,
                                    *tracerParams.pphEvents);
@@ -262,6 +271,7 @@ zeEventHostSignalTracing(ze_event_handle_t hEvent) {
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phEvent);
 }
 
@@ -286,6 +296,7 @@ zeEventHostSynchronizeTracing(ze_event_handle_t hEvent,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phEvent,
                                    *tracerParams.ptimeout);
 }
@@ -308,6 +319,7 @@ zeEventQueryStatusTracing(ze_event_handle_t hEvent) {
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phEvent);
 }
 
@@ -329,6 +341,7 @@ zeEventHostResetTracing(ze_event_handle_t hEvent) {
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phEvent);
 }
 
@@ -354,6 +367,7 @@ zeCommandListAppendEventResetTracing(ze_command_list_handle_t hCommandList,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phCommandList,
                                    *tracerParams.phEvent);
 }
@@ -379,6 +393,7 @@ zeEventQueryKernelTimestampTracing(ze_event_handle_t hEvent,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phEvent,
                                    *tracerParams.pdstptr);
 }
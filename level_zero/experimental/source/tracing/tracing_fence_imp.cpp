@@ -31,6 +31,7 @@ zeFenceCreateTracing(ze_command_queue_handle_t hCommandQueue,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phCommandQueue,
                                    *tracerParams.pdesc,
                                    *tracerParams.pphFence);
@@ -54,6 +55,7 @@ zeFenceDestroyTracing(ze_fence_handle_t hFence) {
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phFence);
 }
 
@@ -78,6 +80,7 @@ zeFenceHostSynchronizeTracing(ze_fence_handle_t hFence,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phFence,
                                    *tracerParams.ptimeout);
 }
@@ -100,6 +103,7 @@ zeFenceQueryStatusTracing(ze_fence_handle_t hFence) {
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phFence);
 }
 
@@ -121,5 +125,6 @@ zeFenceResetTracing(ze_fence_handle_t hFence) {
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phFence);
 }
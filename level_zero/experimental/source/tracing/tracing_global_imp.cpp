@@ -24,5 +24,6 @@ zeInitTracing(ze_init_flags_t flags) {
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.pflags);
 }
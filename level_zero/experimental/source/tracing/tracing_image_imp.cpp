@@ -31,6 +31,7 @@ zeImageGetPropertiesTracing(ze_device_handle_t hDevice,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phDevice,
                                    *tracerParams.pdesc,
                                    *tracerParams.ppImageProperties);
@@ -63,6 +64,7 @@ zeImageCreateTracing(ze_context_handle_t hContext,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phContext,
                                    *tracerParams.phDevice,
                                    *tracerParams.pdesc,
@@ -87,5 +89,6 @@ zeImageDestroyTracing(ze_image_handle_t hImage) {
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phImage);
 }
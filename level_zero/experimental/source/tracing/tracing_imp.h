@@ -20,6 +20,7 @@
 #include "level_zero/experimental/source/tracing/tracing_image_imp.h"
 #include "level_zero/experimental/source/tracing/tracing_memory_imp.h"
 #include "level_zero/experimental/source/tracing/tracing_module_imp.h"
+#include "level_zero/experimental/source/tracing/tracing_recorder.h"
 #include "level_zero/experimental/source/tracing/tracing_residency_imp.h"
 #include "level_zero/experimental/source/tracing/tracing_sampler_imp.h"
 #include <level_zero/ze_api.h>
@@ -144,6 +145,7 @@ template <class T>
 class APITracerCallbackDataImp {
   public:
     T apiOrdinal = {};
+    uint32_t traceRecorderApiId = 0;
     std::vector<L0::APITracerCallbackStateImp<T>> prologCallbacks;
     std::vector<L0::APITracerCallbackStateImp<T>> epilogCallbacks;
 };
@@ -162,6 +164,8 @@ class APITracerCallbackDataImp {
     } while (0)
 
 #define ZE_GEN_PER_API_CALLBACK_STATE(perApiCallbackData, tracerType, callbackCategory, callbackFunctionType)                               \
+    static const uint32_t traceRecorderApiId = L0::TraceRecorder::registerApi(#callbackCategory, #callbackFunctionType);                    \
+    perApiCallbackData.traceRecorderApiId = traceRecorderApiId;                                                                             \
     L0::tracer_array_t *currentTracerArray;                                                                                                 \
     currentTracerArray = (L0::tracer_array_t *)L0::pGlobalAPITracerContextImp->getActiveTracersList();                                      \
     if (currentTracerArray) {                                                                                                               \
@@ -189,6 +193,7 @@ ze_result_t apiTracerWrapperImp(TFunction_pointer zeApiPtr,
                                 TTracer apiOrdinal,
                                 TTracerPrologCallbacks prologCallbacks,
                                 TTracerEpilogCallbacks epilogCallbacks,
+                                uint32_t traceRecorderApiId,
                                 Args &&...args) {
     ze_result_t ret = ZE_RESULT_SUCCESS;
     std::vector<APITracerCallbackStateImp<TTracer>> *callbacksPrologs = &prologCallbacks;
@@ -200,7 +205,13 @@ ze_result_t apiTracerWrapperImp(TFunction_pointer zeApiPtr,
         if (callbacksPrologs->at(i).currentApiCallback != nullptr)
             callbacksPrologs->at(i).currentApiCallback(paramsStruct, ret, callbacksPrologs->at(i).pUserData, &ppTracerInstanceUserData[i]);
     }
+    GlobalTraceRecorderUse traceRecorderUse;
+    auto traceRecorder = traceRecorderUse.get();
+    uint64_t startTimestamp = traceRecorder ? TraceRecorder::getTimestamp() : 0u;
     ret = zeApiPtr(args...);
+    if (traceRecorder) {
+        traceRecorder->record(traceRecorderApiId, startTimestamp, TraceRecorder::getTimestamp(), getTraceRecordHandle(args...), getTraceRecordSize(args...), ret);
+    }
     std::vector<APITracerCallbackStateImp<TTracer>> *callbacksEpilogs = &epilogCallbacks;
     for (size_t i = 0; i < callbacksEpilogs->size(); i++) {
         if (callbacksEpilogs->at(i).currentApiCallback != nullptr)
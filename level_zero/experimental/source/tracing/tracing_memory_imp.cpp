@@ -43,6 +43,7 @@ zeMemAllocSharedTracing(ze_context_handle_t hContext,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phContext,
                                    *tracerParams.pdevice_desc,
                                    *tracerParams.phost_desc,
@@ -85,6 +86,7 @@ zeMemAllocDeviceTracing(ze_context_handle_t hContext,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phContext,
                                    *tracerParams.pdevice_desc,
                                    *tracerParams.psize,
@@ -123,6 +125,7 @@ zeMemAllocHostTracing(ze_context_handle_t hContext,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phContext,
                                    *tracerParams.phost_desc,
                                    *tracerParams.psize,
@@ -151,6 +154,7 @@ zeMemFreeTracing(ze_context_handle_t hContext,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phContext,
                                    *tracerParams.pptr);
 }
@@ -182,6 +186,7 @@ zeMemGetAllocPropertiesTracing(ze_context_handle_t hContext,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phContext,
                                    *tracerParams.pptr,
                                    *tracerParams.ppMemAllocProperties,
@@ -215,6 +220,7 @@ zeMemGetAddressRangeTracing(ze_context_handle_t hContext,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phContext,
                                    *tracerParams.pptr,
                                    *tracerParams.ppBase,
@@ -245,6 +251,7 @@ zeMemGetIpcHandleTracing(ze_context_handle_t hContext,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phContext,
                                    *tracerParams.pptr,
                                    *tracerParams.ppIpcHandle);
@@ -280,6 +287,7 @@ zeMemOpenIpcHandleTracing(ze_context_handle_t hContext,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phContext,
                                    *tracerParams.phDevice,
                                    *tracerParams.phandle,
@@ -308,6 +316,7 @@ zeMemCloseIpcHandleTracing(ze_context_handle_t hContext,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phContext,
                                    *tracerParams.pptr);
 }
@@ -339,6 +348,7 @@ zeVirtualMemReserveTracing(ze_context_handle_t hContext,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phContext,
                                    *tracerParams.ppStart,
                                    *tracerParams.psize,
@@ -369,6 +379,7 @@ zeVirtualMemFreeTracing(ze_context_handle_t hContext,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phContext,
                                    *tracerParams.pptr,
                                    *tracerParams.psize);
@@ -401,6 +412,7 @@ zeVirtualMemQueryPageSizeTracing(ze_context_handle_t hContext,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phContext,
                                    *tracerParams.phDevice,
                                    *tracerParams.psize,
@@ -440,6 +452,7 @@ zeVirtualMemMapTracing(ze_context_handle_t hContext,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phContext,
                                    *tracerParams.pptr,
                                    *tracerParams.psize,
@@ -472,6 +485,7 @@ zeVirtualMemUnmapTracing(ze_context_handle_t hContext,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phContext,
                                    *tracerParams.pptr,
                                    *tracerParams.psize);
@@ -504,6 +518,7 @@ zeVirtualMemSetAccessAttributeTracing(ze_context_handle_t hContext,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phContext,
                                    *tracerParams.pptr,
                                    *tracerParams.psize,
@@ -540,6 +555,7 @@ zeVirtualMemGetAccessAttributeTracing(ze_context_handle_t hContext,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phContext,
                                    *tracerParams.pptr,
                                    *tracerParams.psize,
@@ -574,6 +590,7 @@ zePhysicalMemCreateTracing(ze_context_handle_t hContext,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phContext,
                                    *tracerParams.phDevice,
                                    *tracerParams.pdesc,
@@ -601,6 +618,7 @@ zePhysicalMemDestroyTracing(ze_context_handle_t hContext,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phContext,
                                    *tracerParams.phPhysicalMemory);
 }
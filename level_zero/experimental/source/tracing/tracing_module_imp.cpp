@@ -37,6 +37,7 @@ zeModuleCreateTracing(ze_context_handle_t hContext,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phContext,
                                    *tracerParams.phDevice,
                                    *tracerParams.pdesc,
@@ -62,6 +63,7 @@ zeModuleDestroyTracing(ze_module_handle_t hModule) {
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phModule);
 }
 
@@ -83,6 +85,7 @@ zeModuleBuildLogDestroyTracing(ze_module_build_log_handle_t hModuleBuildLog) {
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phModuleBuildLog);
 }
 
@@ -110,6 +113,7 @@ zeModuleBuildLogGetStringTracing(ze_module_build_log_handle_t hModuleBuildLog,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phModuleBuildLog,
                                    *tracerParams.ppSize,
                                    *tracerParams.ppBuildLog);
@@ -139,6 +143,7 @@ zeModuleGetNativeBinaryTracing(ze_module_handle_t hModule,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phModule,
                                    *tracerParams.ppSize,
                                    *tracerParams.ppModuleNativeBinary);
@@ -171,6 +176,7 @@ zeModuleGetGlobalPointerTracing(ze_module_handle_t hModule,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phModule,
                                    *tracerParams.ppGlobalName,
                                    *tracerParams.ppSize,
@@ -201,6 +207,7 @@ zeModuleDynamicLinkTracing(uint32_t numModules,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.pnumModules,
                                    *tracerParams.pphModules,
                                    *tracerParams.pphLinkLog);
@@ -227,6 +234,7 @@ zeModuleGetPropertiesTracing(ze_module_handle_t hModule,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phModule,
                                    *tracerParams.ppModuleProperties);
 }
@@ -255,6 +263,7 @@ zeKernelCreateTracing(ze_module_handle_t hModule,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phModule,
                                    *tracerParams.pdesc,
                                    *tracerParams.pphKernel);
@@ -278,6 +287,7 @@ zeKernelDestroyTracing(ze_kernel_handle_t hKernel) {
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phKernel);
 }
 
@@ -305,6 +315,7 @@ zeModuleGetFunctionPointerTracing(ze_module_handle_t hModule,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phModule,
                                    *tracerParams.ppFunctionName,
                                    *tracerParams.ppfnFunction);
@@ -337,6 +348,7 @@ zeKernelSetGroupSizeTracing(ze_kernel_handle_t hKernel,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phKernel,
                                    *tracerParams.pgroupSizeX,
                                    *tracerParams.pgroupSizeY,
@@ -379,6 +391,7 @@ zeKernelSuggestGroupSizeTracing(ze_kernel_handle_t hKernel,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phKernel,
                                    *tracerParams.pglobalSizeX,
                                    *tracerParams.pglobalSizeY,
@@ -415,6 +428,7 @@ zeKernelSetArgumentValueTracing(ze_kernel_handle_t hKernel,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phKernel,
                                    *tracerParams.pargIndex,
                                    *tracerParams.pargSize,
@@ -442,6 +456,7 @@ zeKernelGetPropertiesTracing(ze_kernel_handle_t hKernel,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phKernel,
                                    *tracerParams.ppKernelProperties);
 }
@@ -481,6 +496,7 @@ zeCommandListAppendLaunchKernelTracing(ze_command_list_handle_t hCommandList,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phCommandList,
                                    *tracerParams.phKernel,
                                    *tracerParams.ppLaunchFuncArgs,
@@ -524,6 +540,7 @@ zeCommandListAppendLaunchKernelIndirectTracing(ze_command_list_handle_t hCommand
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phCommandList,
                                    *tracerParams.phKernel,
                                    *tracerParams.ppLaunchArgumentsBuffer,
@@ -573,6 +590,7 @@ zeCommandListAppendLaunchMultipleKernelsIndirectTracing(ze_command_list_handle_t
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phCommandList,
                                    *tracerParams.pnumKernels,
                                    *tracerParams.pphKernels,
@@ -617,6 +635,7 @@ zeCommandListAppendLaunchCooperativeKernelTracing(ze_command_list_handle_t hComm
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phCommandList,
                                    *tracerParams.phKernel,
                                    *tracerParams.ppLaunchFuncArgs,
@@ -649,6 +668,7 @@ zeModuleGetKernelNamesTracing(ze_module_handle_t hModule,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phModule,
                                    *tracerParams.ppCount,
                                    *tracerParams.ppNames);
@@ -676,6 +696,7 @@ zeKernelSuggestMaxCooperativeGroupCountTracing(ze_kernel_handle_t hKernel,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phKernel,
                                    *tracerParams.ptotalGroupCount);
 }
@@ -702,6 +723,7 @@ zeKernelGetIndirectAccessTracing(ze_kernel_handle_t hKernel,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phKernel,
                                    *tracerParams.ppFlags);
 }
@@ -731,6 +753,7 @@ zeKernelGetNameTracing(ze_kernel_handle_t hKernel,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phKernel,
                                    *tracerParams.ppSize,
                                    *tracerParams.ppName);
@@ -761,6 +784,7 @@ zeKernelGetSourceAttributesTracing(ze_kernel_handle_t hKernel,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phKernel,
                                    *tracerParams.ppSize,
                                    *tracerParams.ppString);
@@ -788,6 +812,7 @@ zeKernelSetIndirectAccessTracing(ze_kernel_handle_t hKernel,
                                    apiCallbackData.apiOrdinal,
                                    apiCallbackData.prologCallbacks,
                                    apiCallbackData.epilogCallbacks,
+                                   apiCallbackData.traceRecorderApiId,
                                    *tracerParams.phKernel,
                                    *tracerParams.pflags);
 }
@@ -0,0 +1,318 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/experimental/source/tracing/tracing_recorder.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/string.h"
+#include "shared/source/os_interface/os_thread.h"
+#include "shared/source/utilities/io_functions.h"
+
+#include "ze_ddi_tables.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <map>
+#include <sstream>
+#include <thread>
+
+extern ze_gpu_driver_dditable_t driverDdiTable;
+
+namespace L0 {
+
+std::atomic<TraceRecorder *> pGlobalTraceRecorder{nullptr};
+std::atomic<uint32_t> globalTraceRecorderUsers{0};
+
+namespace {
+std::mutex apiNamesMutex;
+std::vector<std::string> apiNames;
+
+std::atomic<uint32_t> recorderGenerationCounter{0};
+
+struct ThreadTraceRingBuffer {
+    ~ThreadTraceRingBuffer() {
+        // recorder may be already gone, ring buffer is shared so it is safe to mark
+        if (ringBuffer) {
+            ringBuffer->release();
+        }
+    }
+
+    uint32_t recorderGeneration = 0;
+    std::shared_ptr<TraceRingBuffer> ringBuffer;
+};
+thread_local ThreadTraceRingBuffer threadTraceRingBuffer;
+
+size_t getRingBufferCapacity(size_t requestedCapacity) {
+    size_t capacity = 1;
+    while (capacity < requestedCapacity) {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+} // namespace
+
+TraceRingBuffer::TraceRingBuffer(size_t requestedCapacity, uint32_t threadId)
+    : capacity(getRingBufferCapacity(requestedCapacity)), threadId(threadId) {
+    this->records = std::make_unique<TraceRecord[]>(this->capacity);
+    this->mask = this->capacity - 1;
+}
+
+size_t TraceRingBuffer::drain(std::vector<TraceRecord> &outRecords) {
+    auto currentTail = tail.load(std::memory_order_relaxed);
+    auto currentHead = head.load(std::memory_order_acquire);
+    for (auto position = currentTail; position != currentHead; position++) {
+        outRecords.push_back(records[position & mask]);
+    }
+    tail.store(currentHead, std::memory_order_release);
+    return static_cast<size_t>(currentHead - currentTail);
+}
+
+TraceRecorder::TraceRecorder(size_t recordsPerThread, const std::string &outputFileName, bool startDrainThread)
+    : outputFileName(outputFileName), recordsPerThread(recordsPerThread) {
+    this->generation = ++recorderGenerationCounter;
+    if (startDrainThread) {
+        keepDraining.store(true);
+        drainThread = NEO::Thread::create(drainRecords, reinterpret_cast<void *>(this));
+    }
+}
+
+TraceRecorder::~TraceRecorder() {
+    keepDraining.store(false);
+    if (drainThread) {
+        drainThread->join();
+        drainThread.reset();
+    }
+    drain();
+    if (outputFile) {
+        NEO::IoFunctions::fclosePtr(outputFile);
+        outputFile = nullptr;
+    }
+}
+
+void TraceRecorder::createGlobal() {
+    auto recordsPerThread = NEO::DebugManager.flags.L0TraceRecorderRecordsPerThread.get();
+    if (!driverDdiTable.enableTracing || recordsPerThread <= 0 || pGlobalTraceRecorder.load() != nullptr) {
+        return;
+    }
+    pGlobalTraceRecorder.store(new TraceRecorder(static_cast<size_t>(recordsPerThread), NEO::DebugManager.flags.L0TraceRecorderOutputFile.get(), true));
+}
+
+void TraceRecorder::destroyGlobal() {
+    auto recorder = pGlobalTraceRecorder.exchange(nullptr);
+    if (recorder == nullptr) {
+        return;
+    }
+    while (globalTraceRecorderUsers.load() != 0) {
+        std::this_thread::yield();
+    }
+    delete recorder;
+}
+
+uint32_t TraceRecorder::registerApi(const char *callbackCategory, const char *callbackFunction) {
+    // "CommandList", "pfnAppendLaunchKernelCb" -> "zeCommandListAppendLaunchKernel"
+    std::string function(callbackFunction);
+    constexpr size_t prefixLength = 3;
+    constexpr size_t suffixLength = 2;
+    if (function.size() > prefixLength + suffixLength) {
+        function = function.substr(prefixLength, function.size() - prefixLength - suffixLength);
+    }
+
+    std::lock_guard<std::mutex> lock(apiNamesMutex);
+    apiNames.push_back(std::string("ze") + callbackCategory + function);
+    return static_cast<uint32_t>(apiNames.size() - 1);
+}
+
+std::string TraceRecorder::getApiName(uint32_t apiId) {
+    std::lock_guard<std::mutex> lock(apiNamesMutex);
+    if (apiId >= apiNames.size()) {
+        return "";
+    }
+    return apiNames[apiId];
+}
+
+TraceRingBuffer *TraceRecorder::getThreadRingBuffer() {
+    if (threadTraceRingBuffer.recorderGeneration == this->generation) {
+        return threadTraceRingBuffer.ringBuffer.get();
+    }
+
+    if (threadTraceRingBuffer.ringBuffer) {
+        threadTraceRingBuffer.ringBuffer->release();
+    }
+
+    std::lock_guard<std::mutex> lock(ringBuffersMutex);
+    ringBuffers.push_back(std::make_shared<TraceRingBuffer>(recordsPerThread, nextThreadId++));
+
+    threadTraceRingBuffer.recorderGeneration = this->generation;
+    threadTraceRingBuffer.ringBuffer = ringBuffers.back();
+    return threadTraceRingBuffer.ringBuffer.get();
+}
+
+void *TraceRecorder::drainRecords(void *arg) {
+    auto recorder = reinterpret_cast<TraceRecorder *>(arg);
+    while (recorder->keepDraining.load()) {
+        recorder->drain();
+        std::this_thread::sleep_for(drainInterval);
+    }
+    return nullptr;
+}
+
+void TraceRecorder::drain() {
+    std::lock_guard<std::mutex> drainLock(drainMutex);
+
+    std::vector<std::shared_ptr<TraceRingBuffer>> currentRingBuffers;
+    {
+        std::lock_guard<std::mutex> lock(ringBuffersMutex);
+        currentRingBuffers = ringBuffers;
+    }
+
+    std::vector<std::pair<uint32_t, size_t>> recordsPerRingBuffer;
+    std::vector<TraceRingBuffer *> releasedRingBuffers;
+    drainedRecords.clear();
+    for (auto &ringBuffer : currentRingBuffers) {
+        // released flag is checked before draining, so records pushed by exiting thread are not lost
+        if (ringBuffer->isReleased()) {
+            releasedRingBuffers.push_back(ringBuffer.get());
+        }
+        auto drainedCount = ringBuffer->drain(drainedRecords);
+        if (drainedCount > 0) {
+            recordsPerRingBuffer.push_back({ringBuffer->getThreadId(), drainedCount});
+        }
+    }
+
+    if (!releasedRingBuffers.empty()) {
+        std::lock_guard<std::mutex> lock(ringBuffersMutex);
+        for (auto releasedRingBuffer : releasedRingBuffers) {
+            releasedRingBuffersDroppedRecords += releasedRingBuffer->getDroppedRecordsCount();
+        }
+        ringBuffers.erase(std::remove_if(ringBuffers.begin(), ringBuffers.end(), [&releasedRingBuffers](const auto &ringBuffer) {
+                              return std::find(releasedRingBuffers.begin(), releasedRingBuffers.end(), ringBuffer.get()) != releasedRingBuffers.end();
+                          }),
+                          ringBuffers.end());
+    }
+
+    if (drainedRecords.empty()) {
+        return;
+    }
+
+    if (!headerWritten) {
+        TraceFileHeader header = {traceFileMagic, traceFileVersion};
+        writeTraceData(&header, sizeof(header));
+        headerWritten = true;
+    }
+
+    // names are registered before any record using them is pushed, so all
+    // names referenced by drained records are already known at this point
+    {
+        std::lock_guard<std::mutex> lock(apiNamesMutex);
+        for (; writtenApiNamesCount < apiNames.size(); writtenApiNamesCount++) {
+            auto &name = apiNames[writtenApiNamesCount];
+            TraceChunkHeader chunkHeader = {TraceChunkType::apiName, writtenApiNamesCount, name.size()};
+            writeTraceData(&chunkHeader, sizeof(chunkHeader));
+            writeTraceData(name.data(), name.size());
+        }
+    }
+
+    auto record = drainedRecords.data();
+    for (auto &[threadId, count] : recordsPerRingBuffer) {
+        TraceChunkHeader chunkHeader = {TraceChunkType::records, threadId, count};
+        writeTraceData(&chunkHeader, sizeof(chunkHeader));
+        writeTraceData(record, count * sizeof(TraceRecord));
+        record += count;
+    }
+}
+
+uint64_t TraceRecorder::getDroppedRecordsCount() {
+    std::lock_guard<std::mutex> lock(ringBuffersMutex);
+    uint64_t droppedRecords = releasedRingBuffersDroppedRecords;
+    for (auto &ringBuffer : ringBuffers) {
+        droppedRecords += ringBuffer->getDroppedRecordsCount();
+    }
+    return droppedRecords;
+}
+
+void TraceRecorder::writeTraceData(const void *data, size_t size) {
+    if (outputFileOpenFailed) {
+        return;
+    }
+    if (outputFile == nullptr) {
+        outputFile = NEO::IoFunctions::fopenPtr(outputFileName.c_str(), "wb");
+        if (outputFile == nullptr) {
+            PRINT_DEBUG_STRING(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr, "Failed to open trace recorder output file %s\n", outputFileName.c_str());
+            outputFileOpenFailed = true;
+            return;
+        }
+    }
+    NEO::IoFunctions::fwritePtr(data, 1, size, outputFile);
+}
+
+bool TraceRecorder::convertToChromeTrace(const std::vector<uint8_t> &binaryTrace, std::string &chromeTraceJson) {
+    size_t offset = 0;
+    auto read = [&](void *dst, size_t size) {
+        if (binaryTrace.size() - offset < size) {
+            return false;
+        }
+        memcpy_s(dst, size, binaryTrace.data() + offset, size);
+        offset += size;
+        return true;
+    };
+
+    TraceFileHeader header = {};
+    if (!read(&header, sizeof(header)) || header.magic != traceFileMagic || header.version != traceFileVersion) {
+        return false;
+    }
+
+    std::map<uint32_t, std::string> names;
+    std::ostringstream json;
+    json << "{\"traceEvents\":[";
+    bool firstEvent = true;
+    char handleString[24];
+    auto toMicroseconds = [](uint64_t nanoseconds) {
+        char microseconds[32];
+        snprintf(microseconds, sizeof(microseconds), "%" PRIu64 ".%03" PRIu64, nanoseconds / 1000, nanoseconds % 1000);
+        return std::string(microseconds);
+    };
+
+    while (offset < binaryTrace.size()) {
+        TraceChunkHeader chunkHeader = {};
+        if (!read(&chunkHeader, sizeof(chunkHeader))) {
+            return false;
+        }
+
+        if (chunkHeader.type == TraceChunkType::apiName) {
+            if (binaryTrace.size() - offset < chunkHeader.count) {
+                return false;
+            }
+            names[chunkHeader.id] = std::string(reinterpret_cast<const char *>(binaryTrace.data() + offset), static_cast<size_t>(chunkHeader.count));
+            offset += static_cast<size_t>(chunkHeader.count);
+        } else if (chunkHeader.type == TraceChunkType::records) {
+            for (uint64_t i = 0; i < chunkHeader.count; i++) {
+                TraceRecord record = {};
+                if (!read(&record, sizeof(record))) {
+                    return false;
+                }
+                auto name = names.find(record.apiId);
+                snprintf(handleString, sizeof(handleString), "0x%" PRIx64, record.handle);
+
+                json << (firstEvent ? "" : ",") << "\n{\"name\":\"" << (name != names.end() ? name->second : std::to_string(record.apiId))
+                     << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << chunkHeader.id
+                     << ",\"ts\":" << toMicroseconds(record.startTimestamp)
+                     << ",\"dur\":" << toMicroseconds(record.endTimestamp - record.startTimestamp)
+                     << ",\"args\":{\"handle\":\"" << handleString << "\",\"size\":" << record.size << ",\"result\":" << record.result << "}}";
+                firstEvent = false;
+            }
+        } else {
+            return false;
+        }
+    }
+
+    json << "\n]}\n";
+    chromeTraceJson = json.str();
+    return true;
+}
+
+} // namespace L0
@@ -0,0 +1,203 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <level_zero/ze_api.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace NEO {
+class Thread;
+} // namespace NEO
+
+namespace L0 {
+
+struct TraceRecord {
+    uint64_t startTimestamp;
+    uint64_t endTimestamp;
+    uint64_t handle;
+    uint64_t size;
+    uint32_t apiId;
+    int32_t result;
+};
+static_assert(sizeof(TraceRecord) == 40, "TraceRecord is part of binary trace format");
+
+struct TraceFileHeader {
+    uint32_t magic;
+    uint32_t version;
+};
+
+enum class TraceChunkType : uint32_t {
+    apiName = 1,
+    records = 2
+};
+
+// apiName chunk: id = api id, count = name length, followed by name characters
+// records chunk: id = thread id, count = number of records, followed by records
+struct TraceChunkHeader {
+    TraceChunkType type;
+    uint32_t id;
+    uint64_t count;
+};
+
+// Single producer (owning thread) / single consumer (drain) ring of trace records.
+// Producer never blocks - when ring is full record is dropped and counted.
+// Owning thread marks ring as released on exit, it is freed by recorder once drained.
+class TraceRingBuffer : NEO::NonCopyableOrMovableClass {
+  public:
+    TraceRingBuffer(size_t capacity, uint32_t threadId);
+
+    bool push(const TraceRecord &record) {
+        auto currentHead = head.load(std::memory_order_relaxed);
+        if (currentHead - cachedTail >= capacity) {
+            cachedTail = tail.load(std::memory_order_acquire);
+            if (currentHead - cachedTail >= capacity) {
+                droppedRecords.store(droppedRecords.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                return false;
+            }
+        }
+        records[currentHead & mask] = record;
+        head.store(currentHead + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t drain(std::vector<TraceRecord> &outRecords);
+
+    size_t getCapacity() const { return capacity; }
+    uint32_t getThreadId() const { return threadId; }
+    uint64_t getDroppedRecordsCount() const { return droppedRecords.load(std::memory_order_relaxed); }
+    void release() { released.store(true, std::memory_order_release); }
+    bool isReleased() const { return released.load(std::memory_order_acquire); }
+
+  protected:
+    std::unique_ptr<TraceRecord[]> records;
+    size_t capacity;
+    size_t mask;
+    uint32_t threadId;
+
+    alignas(64) std::atomic<uint64_t> head{0};
+    uint64_t cachedTail = 0;
+    std::atomic<uint64_t> droppedRecords{0};
+
+    alignas(64) std::atomic<uint64_t> tail{0};
+    std::atomic<bool> released{false};
+};
+
+class TraceRecorder : NEO::NonCopyableOrMovableClass {
+  public:
+    static constexpr uint32_t traceFileMagic = 0x52544c5a;
+    static constexpr uint32_t traceFileVersion = 1;
+    static constexpr std::chrono::milliseconds drainInterval{10};
+
+    TraceRecorder(size_t recordsPerThread, const std::string &outputFileName, bool startDrainThread);
+    virtual ~TraceRecorder();
+
+    static void createGlobal();
+    static void destroyGlobal();
+
+    static uint32_t registerApi(const char *callbackCategory, const char *callbackFunction);
+    static std::string getApiName(uint32_t apiId);
+
+    static uint64_t getTimestamp() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    void record(uint32_t apiId, uint64_t startTimestamp, uint64_t endTimestamp, uint64_t handle, uint64_t size, ze_result_t result) {
+        getThreadRingBuffer()->push({startTimestamp, endTimestamp, handle, size, apiId, static_cast<int32_t>(result)});
+    }
+
+    void drain();
+    uint64_t getDroppedRecordsCount();
+
+    static bool convertToChromeTrace(const std::vector<uint8_t> &binaryTrace, std::string &chromeTraceJson);
+
+  protected:
+    static void *drainRecords(void *arg);
+
+    TraceRingBuffer *getThreadRingBuffer();
+    virtual void writeTraceData(const void *data, size_t size);
+
+    std::vector<std::shared_ptr<TraceRingBuffer>> ringBuffers;
+    std::mutex ringBuffersMutex;
+    uint32_t nextThreadId = 0;
+    uint64_t releasedRingBuffersDroppedRecords = 0;
+
+    std::mutex drainMutex;
+    std::vector<TraceRecord> drainedRecords;
+    uint32_t writtenApiNamesCount = 0;
+    bool headerWritten = false;
+
+    std::string outputFileName;
+    FILE *outputFile = nullptr;
+    bool outputFileOpenFailed = false;
+    size_t recordsPerThread;
+    uint32_t generation;
+
+    std::unique_ptr<NEO::Thread> drainThread;
+    std::atomic<bool> keepDraining{false};
+};
+
+extern std::atomic<TraceRecorder *> pGlobalTraceRecorder;
+extern std::atomic<uint32_t> globalTraceRecorderUsers;
+
+// Keeps global recorder alive for the duration of a traced call - destroyGlobal waits until all users are gone.
+class GlobalTraceRecorderUse : NEO::NonCopyableOrMovableClass {
+  public:
+    GlobalTraceRecorderUse() {
+        if (pGlobalTraceRecorder.load(std::memory_order_relaxed) != nullptr) {
+            globalTraceRecorderUsers++;
+            registered = true;
+            recorder = pGlobalTraceRecorder.load();
+        }
+    }
+
+    ~GlobalTraceRecorderUse() {
+        if (registered) {
+            globalTraceRecorderUsers--;
+        }
+    }
+
+    TraceRecorder *get() const { return recorder; }
+
+  protected:
+    TraceRecorder *recorder = nullptr;
+    bool registered = false;
+};
+
+inline uint64_t getTraceRecordHandle() { return 0u; }
+
+template <typename T, typename... Rest>
+uint64_t getTraceRecordHandle(const T &first, const Rest &...) {
+    if constexpr (std::is_pointer_v<T>) {
+        return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(first));
+    }
+    return 0u;
+}
+
+inline uint64_t getTraceRecordSize() { return 0u; }
+
+template <typename T, typename... Rest>
+uint64_t getTraceRecordSize(const T &first, const Rest &...rest) {
+    if constexpr (std::is_same_v<T, size_t>) {
+        return static_cast<uint64_t>(first);
+    } else {
+        return getTraceRecordSize(rest...);
+    }
+}
+
+} // namespace L0
@@ -33,6 +33,10 @@ ze_result_t PlatformMonitoringTech::readValue(const std::string key, uint32_t &v
     if (offset == keyOffsetMap.end()) {
         return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
+    if (pTelemetrySampler) {
+        auto bytesRead = pTelemetrySampler->read(telemetryDeviceEntry, &value, sizeof(uint32_t), baseOffset + offset->second);
+        return (bytesRead == sizeof(uint32_t)) ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
+    }
     auto fd = NEO::FileDescriptor(telemetryDeviceEntry.c_str(), O_RDONLY);
     if (fd == -1) {
         return ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
@@ -50,6 +54,10 @@ ze_result_t PlatformMonitoringTech::readValue(const std::string key, uint64_t &v
     if (offset == keyOffsetMap.end()) {
         return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
+    if (pTelemetrySampler) {
+        auto bytesRead = pTelemetrySampler->read(telemetryDeviceEntry, &value, sizeof(uint64_t), baseOffset + offset->second);
+        return (bytesRead == sizeof(uint64_t)) ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
+    }
     auto fd = NEO::FileDescriptor(telemetryDeviceEntry.c_str(), O_RDONLY);
     if (fd == -1) {
         return ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
@@ -164,6 +172,15 @@ ze_result_t PlatformMonitoringTech::init(FsAccess *pFsAccess, const std::string
         return result;
     }
 
+    pTelemetrySampler = SysmanTelemetrySampler::create();
+    if (pTelemetrySampler && !keyOffsetMap.empty()) {
+        // All keys of this telemetry node are captured with single read of the region spanning them.
+        auto minMaxOffset = std::minmax_element(keyOffsetMap.begin(), keyOffsetMap.end(),
+                                                [](const auto &lhs, const auto &rhs) { return lhs.second < rhs.second; });
+        auto regionSize = minMaxOffset.second->second + sizeof(uint64_t) - minMaxOffset.first->second;
+        pTelemetrySampler->addRegion(telemetryDeviceEntry, static_cast<size_t>(regionSize), baseOffset + minMaxOffset.first->second);
+    }
+
     return ZE_RESULT_SUCCESS;
 }
 
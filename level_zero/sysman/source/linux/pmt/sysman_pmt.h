@@ -10,6 +10,7 @@
 #include "shared/source/os_interface/linux/sys_calls.h"
 
 #include "level_zero/sysman/source/linux/sysman_fs_access.h"
+#include "level_zero/sysman/source/linux/sysman_telemetry_sampler.h"
 
 #include "igfxfmid.h"
 
@@ -45,6 +46,7 @@ class PlatformMonitoringTech : NEO::NonCopyableOrMovableClass {
     static void doInitPmtObject(FsAccess *pFsAccess, uint32_t subdeviceId, PlatformMonitoringTech *pPmt, const std::string &gpuUpstreamPortPath,
                                 std::map<uint32_t, L0::Sysman::PlatformMonitoringTech *> &mapOfSubDeviceIdToPmtObject, PRODUCT_FAMILY productFamily);
     decltype(&NEO::SysCalls::pread) preadFunction = NEO::SysCalls::pread;
+    std::unique_ptr<SysmanTelemetrySampler> pTelemetrySampler = nullptr;
 
   private:
     static const std::string baseTelemSysFS;
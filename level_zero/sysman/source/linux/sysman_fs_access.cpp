@@ -76,14 +76,20 @@ template <typename T>
 ze_result_t FsAccess::readValue(const std::string file, T &val) {
 
     std::string readVal(64, '\0');
-    int fd = pFdCache->getFd(file);
-    if (fd < 0) {
-        return getResult(errno);
-    }
+    if (pTelemetrySampler) {
+        if (pTelemetrySampler->read(file, readVal.data(), readVal.size(), 0) < 0) {
+            return getResult(errno);
+        }
+    } else {
+        int fd = pFdCache->getFd(file);
+        if (fd < 0) {
+            return getResult(errno);
+        }
 
-    ssize_t bytesRead = NEO::SysCalls::pread(fd, readVal.data(), readVal.size(), 0);
-    if (bytesRead < 0) {
-        return getResult(errno);
+        ssize_t bytesRead = NEO::SysCalls::pread(fd, readVal.data(), readVal.size(), 0);
+        if (bytesRead < 0) {
+            return getResult(errno);
+        }
     }
 
     std::istringstream stream(readVal);
@@ -97,9 +103,10 @@ ze_result_t FsAccess::readValue(const std::string file, T &val) {
 // Generic Filesystem Access
 FsAccess::FsAccess() {
     pFdCache = std::make_unique<FdCache>();
+    pTelemetrySampler = SysmanTelemetrySampler::create();
 }
 
-FsAccess::FsAccess(const FsAccess &fsAccess) : pFdCache(std::unique_ptr<FdCache>(new FdCache())) {}
+FsAccess::FsAccess(const FsAccess &fsAccess) : pFdCache(std::unique_ptr<FdCache>(new FdCache())), pTelemetrySampler(SysmanTelemetrySampler::create()) {}
 
 FsAccess *FsAccess::create() {
     return new FsAccess();
@@ -181,6 +188,10 @@ ze_result_t FsAccess::write(const std::string file, const std::string val) {
         return getResult(errno);
     }
     sysfs.close();
+    if (pTelemetrySampler) {
+        // Written value may affect other sampled values, so next read takes new snapshot.
+        pTelemetrySampler->invalidate();
+    }
     return ZE_RESULT_SUCCESS;
 }
 
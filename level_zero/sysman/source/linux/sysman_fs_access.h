@@ -9,6 +9,7 @@
 
 #include "shared/source/os_interface/linux/sys_calls.h"
 
+#include "level_zero/sysman/source/linux/sysman_telemetry_sampler.h"
 #include "level_zero/ze_api.h"
 #include "level_zero/zet_api.h"
 
@@ -82,6 +83,7 @@ class FsAccess {
     template <typename T>
     ze_result_t readValue(const std::string file, T &val);
     std::unique_ptr<FdCache> pFdCache = nullptr;
+    std::unique_ptr<SysmanTelemetrySampler> pTelemetrySampler = nullptr;
 };
 
 class ProcfsAccess : private FsAccess {
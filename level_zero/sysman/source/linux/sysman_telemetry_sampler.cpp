@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/sysman/source/linux/sysman_telemetry_sampler.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+
+namespace L0 {
+namespace Sysman {
+
+std::unique_ptr<SysmanTelemetrySampler> SysmanTelemetrySampler::create() {
+    auto maxSnapshotAge = NEO::DebugManager.flags.SysmanTelemetrySnapshotMaxAgeUs.get();
+    if (maxSnapshotAge < 0) {
+        return nullptr;
+    }
+    return std::make_unique<SysmanTelemetrySampler>(std::chrono::microseconds(maxSnapshotAge));
+}
+
+SysmanTelemetrySampler::SysmanTelemetrySampler(std::chrono::microseconds maxSnapshotAge)
+    : maxSnapshotAge(maxSnapshotAge), sourceIdleTimeout(std::max(maxSnapshotAge * idleSnapshotsBeforeEviction, minSourceIdleTimeout)) {}
+
+SysmanTelemetrySampler::~SysmanTelemetrySampler() {
+    for (auto &source : sources) {
+        this->closeFunction(source->fd);
+    }
+}
+
+std::chrono::steady_clock::time_point SysmanTelemetrySampler::getCurrentTime() {
+    return std::chrono::steady_clock::now();
+}
+
+void SysmanTelemetrySampler::addRegion(const std::string &file, size_t size, uint64_t offset) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto &regions = regionsByFile[file];
+    auto regionKnown = std::any_of(regions.begin(), regions.end(), [&](const Region &region) {
+        return region.offset == offset && region.size == size;
+    });
+    if (!regionKnown) {
+        regions.push_back({offset, size});
+    }
+}
+
+ssize_t SysmanTelemetrySampler::read(const std::string &file, void *buf, size_t count, uint64_t offset) {
+    std::lock_guard<std::mutex> lock(mutex);
+    startSnapshotIfStale();
+
+    auto source = findSource(file, count, offset);
+    if (source == nullptr) {
+        source = registerSource(file, count, offset);
+        if (source == nullptr) {
+            return -1;
+        }
+    }
+    if (source->snapshotCount != snapshotCount) {
+        refreshSource(*source);
+    }
+
+    if (source->bytesRead < 0) {
+        errno = source->error;
+        return -1;
+    }
+
+    auto sourceOffset = static_cast<size_t>(offset - source->offset);
+    auto bytesAvailable = static_cast<size_t>(source->bytesRead) > sourceOffset ? static_cast<size_t>(source->bytesRead) - sourceOffset : 0u;
+    auto bytesCopied = std::min(count, bytesAvailable);
+    memcpy(buf, source->data.data() + sourceOffset, bytesCopied);
+    return static_cast<ssize_t>(bytesCopied);
+}
+
+void SysmanTelemetrySampler::invalidate() {
+    std::lock_guard<std::mutex> lock(mutex);
+    snapshotValid = false;
+}
+
+SysmanTelemetrySampler::Source *SysmanTelemetrySampler::findSource(const std::string &file, size_t count, uint64_t offset) {
+    auto fileSources = sourcesByFile.find(file);
+    if (fileSources == sourcesByFile.end()) {
+        return nullptr;
+    }
+    for (auto source : fileSources->second) {
+        if (offset >= source->offset && offset + count <= source->offset + source->data.size()) {
+            return source;
+        }
+    }
+    return nullptr;
+}
+
+SysmanTelemetrySampler::Source *SysmanTelemetrySampler::registerSource(const std::string &file, size_t count, uint64_t offset) {
+    auto fd = this->openFunction(file.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    auto source = std::make_unique<Source>();
+    source->file = file;
+    source->offset = offset;
+    source->fd = fd;
+    source->data.resize(count);
+
+    auto fileRegions = regionsByFile.find(file);
+    if (fileRegions != regionsByFile.end()) {
+        for (auto &region : fileRegions->second) {
+            if (offset >= region.offset && offset + count <= region.offset + region.size) {
+                source->offset = region.offset;
+                source->data.resize(region.size);
+                break;
+            }
+        }
+    }
+
+    auto pSource = source.get();
+    sources.push_back(std::move(source));
+    sourcesByFile[file].push_back(pSource);
+    return pSource;
+}
+
+void SysmanTelemetrySampler::refreshSource(Source &source) {
+    preadCount++;
+    source.bytesRead = this->preadFunction(source.fd, source.data.data(), source.data.size(), static_cast<off_t>(source.offset));
+    source.error = source.bytesRead < 0 ? errno : 0;
+    source.snapshotCount = snapshotCount;
+    source.snapshotTime = snapshotTime;
+}
+
+void SysmanTelemetrySampler::startSnapshotIfStale() {
+    auto currentTime = getCurrentTime();
+    if (snapshotValid && (currentTime - snapshotTime) <= maxSnapshotAge) {
+        return;
+    }
+
+    evictIdleSources(currentTime);
+    snapshotTime = currentTime;
+    snapshotValid = true;
+    snapshotCount++;
+}
+
+void SysmanTelemetrySampler::evictIdleSources(std::chrono::steady_clock::time_point currentTime) {
+    // sources read less often than every window stay open, so polling them does not reopen files
+    auto isStale = [this, currentTime](const Source *source) { return (currentTime - source->snapshotTime) > sourceIdleTimeout; };
+    for (auto fileSources = sourcesByFile.begin(); fileSources != sourcesByFile.end();) {
+        auto &fileSourcesList = fileSources->second;
+        fileSourcesList.erase(std::remove_if(fileSourcesList.begin(), fileSourcesList.end(), isStale), fileSourcesList.end());
+        fileSources = fileSourcesList.empty() ? sourcesByFile.erase(fileSources) : std::next(fileSources);
+    }
+
+    std::vector<std::unique_ptr<Source>> sourcesInUse;
+    sourcesInUse.reserve(sources.size());
+    for (auto &source : sources) {
+        if (isStale(source.get())) {
+            this->closeFunction(source->fd);
+        } else {
+            sourcesInUse.push_back(std::move(source));
+        }
+    }
+    sources.swap(sourcesInUse);
+}
+
+} // namespace Sysman
+} // namespace L0
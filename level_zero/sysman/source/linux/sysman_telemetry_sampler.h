@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/os_interface/linux/sys_calls.h"
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace L0 {
+namespace Sysman {
+
+// Time bounded snapshot of sysman telemetry sources (sysfs values, PMT telemetry regions).
+// Snapshot is a window of maxSnapshotAge started by first read after previous one expired.
+// Source is refreshed with one pread on its first read within a window, following reads
+// are served from memory. Sources keep their file descriptor open while in use, sources
+// not read for sourceIdleTimeout (several windows, at least minSourceIdleTimeout) are closed
+// when new window starts. Reads within region registered with addRegion are captured with
+// single pread of the whole region.
+class SysmanTelemetrySampler : NEO::NonCopyableOrMovableClass {
+  public:
+    static constexpr uint32_t idleSnapshotsBeforeEviction = 8;
+    static constexpr std::chrono::microseconds minSourceIdleTimeout = std::chrono::seconds(1);
+
+    static std::unique_ptr<SysmanTelemetrySampler> create();
+
+    SysmanTelemetrySampler(std::chrono::microseconds maxSnapshotAge);
+    virtual ~SysmanTelemetrySampler();
+
+    // Registers region of file sampled as a whole, reads of any range within the region are served from its snapshot.
+    void addRegion(const std::string &file, size_t size, uint64_t offset);
+    // Same semantics as pread, returns number of bytes copied or -1 with errno set.
+    ssize_t read(const std::string &file, void *buf, size_t count, uint64_t offset);
+    void invalidate();
+
+    uint64_t getSnapshotCount() const { return snapshotCount; }
+    uint64_t getPreadCount() const { return preadCount; }
+
+  protected:
+    struct Region {
+        uint64_t offset = 0;
+        size_t size = 0;
+    };
+
+    struct Source {
+        std::string file;
+        uint64_t offset = 0;
+        int fd = -1;
+        std::vector<uint8_t> data;
+        ssize_t bytesRead = 0;
+        int error = 0;
+        uint64_t snapshotCount = 0;
+        std::chrono::steady_clock::time_point snapshotTime{};
+    };
+
+    Source *findSource(const std::string &file, size_t count, uint64_t offset);
+    Source *registerSource(const std::string &file, size_t count, uint64_t offset);
+    void refreshSource(Source &source);
+    void startSnapshotIfStale();
+    void evictIdleSources(std::chrono::steady_clock::time_point currentTime);
+    MOCKABLE_VIRTUAL std::chrono::steady_clock::time_point getCurrentTime();
+
+    decltype(&NEO::SysCalls::open) openFunction = NEO::SysCalls::open;
+    decltype(&NEO::SysCalls::pread) preadFunction = NEO::SysCalls::pread;
+    decltype(&NEO::SysCalls::close) closeFunction = NEO::SysCalls::close;
+
+    std::vector<std::unique_ptr<Source>> sources;
+    std::unordered_map<std::string, std::vector<Source *>> sourcesByFile;
+    std::unordered_map<std::string, std::vector<Region>> regionsByFile;
+    std::chrono::microseconds maxSnapshotAge;
+    std::chrono::microseconds sourceIdleTimeout;
+    std::chrono::steady_clock::time_point snapshotTime{};
+    bool snapshotValid = false;
+    uint64_t snapshotCount = 0;
+    uint64_t preadCount = 0;
+    std::mutex mutex;
+};
+
+} // namespace Sysman
+} // namespace L0
@@ -149,6 +149,7 @@ class PublicPlatformMonitoringTech : public L0::Sysman::PlatformMonitoringTech {
     using PlatformMonitoringTech::doInitPmtObject;
     using PlatformMonitoringTech::init;
     using PlatformMonitoringTech::keyOffsetMap;
+    using PlatformMonitoringTech::pTelemetrySampler;
     using PlatformMonitoringTech::preadFunction;
     using PlatformMonitoringTech::rootDeviceTelemNodeIndex;
     using PlatformMonitoringTech::telemetryDeviceEntry;
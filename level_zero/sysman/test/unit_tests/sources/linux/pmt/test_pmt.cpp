@@ -5,10 +5,14 @@
  *
  */
 
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+
 #include "level_zero/sysman/test/unit_tests/sources/linux/mock_sysman_fixture.h"
 
 #include "mock_pmt.h"
 
+#include <limits>
+
 namespace L0 {
 namespace Sysman {
 namespace ult {
@@ -188,6 +192,86 @@ TEST_F(ZesPmtFixtureMultiDevice, GivenValidSyscallsWhenCallingreadValueWithUint6
     EXPECT_EQ(ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE, pPmt->readValue("DUMMY_KEY", val));
 }
 
+TEST_F(ZesPmtFixtureMultiDevice, GivenTelemetrySamplerWithRegionWhenCallingReadValueForKeysWithinRegionThenValuesAreReadWithSinglePread) {
+    static uint32_t openCalled = 0;
+    static uint32_t preadCalled = 0;
+    openCalled = 0;
+    preadCalled = 0;
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> openBackup(&NEO::SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int {
+        openCalled++;
+        return 1;
+    });
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPread)> preadBackup(&NEO::SysCalls::sysCallsPread, [](int fd, void *buf, size_t count, off_t offset) -> ssize_t {
+        preadCalled++;
+        // every qword of telemetry holds its own offset
+        for (size_t i = 0; i < count / sizeof(uint64_t); i++) {
+            reinterpret_cast<uint64_t *>(buf)[i] = offset + i * sizeof(uint64_t);
+        }
+        return count;
+    });
+
+    auto pPmt = std::make_unique<PublicPlatformMonitoringTech>(pTestFsAccess.get(), 1, 0);
+    pPmt->telemetryDeviceEntry = baseTelemSysFS + "/" + telemNodeForSubdevice0 + "/" + telem;
+    pPmt->keyOffsetMap = {{"KEY_A", 0x0}, {"KEY_B", 0x8}, {"KEY_C", 0x10}};
+    pPmt->pTelemetrySampler = std::make_unique<SysmanTelemetrySampler>(std::chrono::microseconds(std::numeric_limits<int32_t>::max()));
+    pPmt->pTelemetrySampler->addRegion(pPmt->telemetryDeviceEntry, 3 * sizeof(uint64_t), 0x0);
+
+    uint64_t val64 = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue("KEY_C", val64));
+    EXPECT_EQ(0x10u, val64);
+    uint32_t val32 = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue("KEY_B", val32));
+    EXPECT_EQ(0x8u, val32);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue("KEY_A", val64));
+    EXPECT_EQ(0x0u, val64);
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, pPmt->readValue("SOMETHING", val64));
+
+    EXPECT_EQ(1u, openCalled);
+    EXPECT_EQ(1u, preadCalled);
+    EXPECT_EQ(1u, pPmt->pTelemetrySampler->getPreadCount());
+}
+
+TEST_F(ZesPmtFixtureMultiDevice, GivenTelemetrySamplerAndPreadFailsWhenCallingReadValueThenDependencyUnavailableIsReturned) {
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> openBackup(&NEO::SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int { return 1; });
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPread)> preadBackup(&NEO::SysCalls::sysCallsPread, preadMockPmtFailure);
+
+    auto pPmt = std::make_unique<PublicPlatformMonitoringTech>(pTestFsAccess.get(), 1, 0);
+    pPmt->telemetryDeviceEntry = baseTelemSysFS + "/" + telemNodeForSubdevice0 + "/" + telem;
+    pPmt->keyOffsetMap = dummyKeyOffsetMap;
+    pPmt->pTelemetrySampler = std::make_unique<SysmanTelemetrySampler>(std::chrono::microseconds(0));
+
+    uint32_t val32 = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE, pPmt->readValue("DUMMY_KEY", val32));
+    uint64_t val64 = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE, pPmt->readValue("DUMMY_KEY", val64));
+}
+
+TEST_F(ZesPmtFixtureMultiDevice, GivenTelemetrySnapshotEnabledWhenDoingPMTInitThenAllKeysAreReadFromSingleRegionSnapshot) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SysmanTelemetrySnapshotMaxAgeUs.set(std::numeric_limits<int32_t>::max());
+    static uint32_t preadCalled = 0;
+    preadCalled = 0;
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> openBackup(&NEO::SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int { return 1; });
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPread)> preadBackup(&NEO::SysCalls::sysCallsPread, [](int fd, void *buf, size_t count, off_t offset) -> ssize_t {
+        preadCalled++;
+        memset(buf, 0x5a, count);
+        return count;
+    });
+
+    auto pPmt = std::make_unique<PublicPlatformMonitoringTech>(pTestFsAccess.get(), 1, 0);
+    PublicPlatformMonitoringTech::rootDeviceTelemNodeIndex = 1;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->init(pTestFsAccess.get(), gpuUpstreamPortPathInPmt, pSysmanDeviceImp->getProductFamily()));
+    ASSERT_NE(nullptr, pPmt->pTelemetrySampler);
+    ASSERT_FALSE(pPmt->keyOffsetMap.empty());
+
+    for (auto &keyOffset : pPmt->keyOffsetMap) {
+        uint64_t val = 0;
+        EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue(keyOffset.first, val));
+        EXPECT_EQ(0x5a5a5a5a5a5a5a5au, val);
+    }
+    EXPECT_EQ(1u, preadCalled);
+}
+
 TEST_F(ZesPmtFixtureMultiDevice, GivenValidSyscallsWhenDoingPMTInitThenPMTmapOfSubDeviceIdToPmtObjectWouldContainValidEntries) {
     std::map<uint32_t, L0::Sysman::PlatformMonitoringTech *> mapOfSubDeviceIdToPmtObject;
     auto subDeviceCount = pLinuxSysmanImp->getSubDeviceCount();
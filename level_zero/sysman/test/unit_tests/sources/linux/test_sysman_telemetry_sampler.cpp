@@ -0,0 +1,277 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/helpers/variable_backup.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include "level_zero/sysman/source/linux/sysman_telemetry_sampler.h"
+#include "level_zero/sysman/test/unit_tests/sources/linux/mock_sysman_fixture.h"
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <limits>
+#include <unistd.h>
+
+namespace L0 {
+namespace Sysman {
+namespace ult {
+
+class MockSysmanTelemetrySampler : public SysmanTelemetrySampler {
+  public:
+    MockSysmanTelemetrySampler(std::chrono::microseconds maxSnapshotAge) : SysmanTelemetrySampler(maxSnapshotAge) {
+        openFunction = [](const char *pathname, int flags) -> int { return ::open(pathname, flags); };
+        preadFunction = ::pread;
+        closeFunction = ::close;
+    }
+
+    std::chrono::steady_clock::time_point getCurrentTime() override {
+        return currentTime;
+    }
+
+    using SysmanTelemetrySampler::sourceIdleTimeout;
+    using SysmanTelemetrySampler::sources;
+
+    std::chrono::steady_clock::time_point currentTime{};
+};
+
+class SysmanTelemetrySamplerTest : public ::testing::Test {
+  public:
+    void SetUp() override {
+        char dirTemplate[] = "/tmp/sysman_sampler_XXXXXX";
+        ASSERT_NE(nullptr, mkdtemp(dirTemplate));
+        fakeSysfsDir = dirTemplate;
+    }
+
+    void TearDown() override {
+        for (auto &file : createdFiles) {
+            ::unlink(file.c_str());
+        }
+        ::rmdir(fakeSysfsDir.c_str());
+    }
+
+    std::string writeFile(const std::string &name, const std::string &content) {
+        auto path = fakeSysfsDir + "/" + name;
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << content;
+        createdFiles.push_back(path);
+        return path;
+    }
+
+    static uint64_t readU64(SysmanTelemetrySampler &sampler, const std::string &file) {
+        char buf[64] = {};
+        EXPECT_LT(0, sampler.read(file, buf, sizeof(buf) - 1, 0));
+        return std::strtoull(buf, nullptr, 10);
+    }
+
+    std::string fakeSysfsDir;
+    std::vector<std::string> createdFiles;
+};
+
+TEST_F(SysmanTelemetrySamplerTest, givenSnapshotNotExpiredWhenReadingAgainThenValuesAreServedFromSnapshotWithoutPread) {
+    MockSysmanTelemetrySampler sampler(std::chrono::microseconds(100));
+    auto freqFile = writeFile("cur_freq", "1200\n");
+    auto powerFile = writeFile("energy", "5000\n");
+
+    EXPECT_EQ(1200u, readU64(sampler, freqFile));
+    EXPECT_EQ(5000u, readU64(sampler, powerFile));
+    EXPECT_EQ(2u, sampler.getPreadCount());
+    EXPECT_EQ(1u, sampler.getSnapshotCount());
+
+    writeFile("cur_freq", "1300\n");
+    sampler.currentTime += std::chrono::microseconds(100);
+    EXPECT_EQ(1200u, readU64(sampler, freqFile));
+    EXPECT_EQ(5000u, readU64(sampler, powerFile));
+    EXPECT_EQ(2u, sampler.getPreadCount());
+    EXPECT_EQ(1u, sampler.getSnapshotCount());
+}
+
+TEST_F(SysmanTelemetrySamplerTest, givenSnapshotExpiredWhenReadingThenOnlySourceBeingReadIsRefreshed) {
+    MockSysmanTelemetrySampler sampler(std::chrono::microseconds(100));
+    auto freqFile = writeFile("cur_freq", "1200\n");
+    auto powerFile = writeFile("energy", "5000\n");
+    readU64(sampler, freqFile);
+    readU64(sampler, powerFile);
+
+    writeFile("cur_freq", "1300\n");
+    writeFile("energy", "6000\n");
+    sampler.currentTime += std::chrono::microseconds(101);
+
+    EXPECT_EQ(1300u, readU64(sampler, freqFile));
+    EXPECT_EQ(3u, sampler.getPreadCount());
+    EXPECT_EQ(2u, sampler.getSnapshotCount());
+    EXPECT_EQ(6000u, readU64(sampler, powerFile));
+    EXPECT_EQ(4u, sampler.getPreadCount());
+    EXPECT_EQ(6000u, readU64(sampler, powerFile));
+    EXPECT_EQ(4u, sampler.getPreadCount());
+    EXPECT_EQ(2u, sampler.sources.size());
+}
+
+TEST_F(SysmanTelemetrySamplerTest, givenSamplerWhenCreatedThenSourceIdleTimeoutSpansSeveralSnapshotsAndIsNotShorterThanMinimum) {
+    MockSysmanTelemetrySampler shortSnapshotSampler(std::chrono::microseconds(100));
+    EXPECT_EQ(SysmanTelemetrySampler::minSourceIdleTimeout, shortSnapshotSampler.sourceIdleTimeout);
+
+    MockSysmanTelemetrySampler longSnapshotSampler(std::chrono::milliseconds(500));
+    EXPECT_EQ(std::chrono::milliseconds(500) * SysmanTelemetrySampler::idleSnapshotsBeforeEviction, longSnapshotSampler.sourceIdleTimeout);
+}
+
+TEST_F(SysmanTelemetrySamplerTest, givenSourceNotReadInSomeSnapshotsWhenIdleTimeoutDidNotPassThenSourceStaysOpen) {
+    MockSysmanTelemetrySampler sampler(std::chrono::microseconds(100));
+    auto freqFile = writeFile("cur_freq", "1200\n");
+    auto powerFile = writeFile("energy", "5000\n");
+    readU64(sampler, freqFile);
+    readU64(sampler, powerFile);
+
+    for (uint32_t i = 0; i < 3; i++) {
+        sampler.currentTime += std::chrono::microseconds(101);
+        readU64(sampler, freqFile);
+    }
+    sampler.currentTime += sampler.sourceIdleTimeout - std::chrono::microseconds(303);
+    readU64(sampler, freqFile);
+    EXPECT_EQ(2u, sampler.sources.size());
+
+    writeFile("energy", "6000\n");
+    EXPECT_EQ(6000u, readU64(sampler, powerFile));
+    EXPECT_EQ(2u, sampler.sources.size());
+    EXPECT_EQ(7u, sampler.getPreadCount());
+}
+
+TEST_F(SysmanTelemetrySamplerTest, givenSourceNotReadForIdleTimeoutWhenNextSnapshotStartsThenSourceIsEvictedAndReopenedOnNextRead) {
+    MockSysmanTelemetrySampler sampler(std::chrono::microseconds(100));
+    auto freqFile = writeFile("cur_freq", "1200\n");
+    auto powerFile = writeFile("energy", "5000\n");
+    readU64(sampler, freqFile);
+    readU64(sampler, powerFile);
+    EXPECT_EQ(2u, sampler.sources.size());
+
+    sampler.currentTime += std::chrono::microseconds(101);
+    readU64(sampler, freqFile);
+    EXPECT_EQ(2u, sampler.sources.size());
+
+    sampler.currentTime += sampler.sourceIdleTimeout;
+    readU64(sampler, freqFile);
+    ASSERT_EQ(1u, sampler.sources.size());
+    EXPECT_EQ(freqFile, sampler.sources[0]->file);
+    EXPECT_EQ(4u, sampler.getPreadCount());
+
+    writeFile("energy", "7000\n");
+    EXPECT_EQ(7000u, readU64(sampler, powerFile));
+    EXPECT_EQ(2u, sampler.sources.size());
+    EXPECT_EQ(5u, sampler.getPreadCount());
+}
+
+TEST_F(SysmanTelemetrySamplerTest, givenRegisteredRegionWhenReadingValuesWithinRegionThenRegionIsSampledWithSinglePread) {
+    MockSysmanTelemetrySampler sampler(std::chrono::microseconds(100));
+    uint64_t telemetry[4] = {0x11, 0x22, 0x33, 0x44};
+    auto telemFile = writeFile("telem", std::string(reinterpret_cast<char *>(telemetry), sizeof(telemetry)));
+
+    constexpr uint64_t baseOffset = sizeof(uint64_t);
+    sampler.addRegion(telemFile, 3 * sizeof(uint64_t), baseOffset);
+    EXPECT_EQ(0u, sampler.getPreadCount());
+
+    for (uint32_t i = 1; i < 4; i++) {
+        uint64_t value = 0;
+        EXPECT_EQ(static_cast<ssize_t>(sizeof(value)), sampler.read(telemFile, &value, sizeof(value), i * sizeof(uint64_t)));
+        EXPECT_EQ(telemetry[i], value);
+    }
+    uint32_t lowPart = 0;
+    EXPECT_EQ(static_cast<ssize_t>(sizeof(lowPart)), sampler.read(telemFile, &lowPart, sizeof(lowPart), sizeof(uint64_t)));
+    EXPECT_EQ(0x22u, lowPart);
+    EXPECT_EQ(1u, sampler.getPreadCount());
+    EXPECT_EQ(1u, sampler.sources.size());
+
+    uint64_t value = 0;
+    EXPECT_EQ(static_cast<ssize_t>(sizeof(value)), sampler.read(telemFile, &value, sizeof(value), 0));
+    EXPECT_EQ(0x11u, value);
+    EXPECT_EQ(2u, sampler.getPreadCount());
+    EXPECT_EQ(2u, sampler.sources.size());
+}
+
+TEST_F(SysmanTelemetrySamplerTest, givenEvictedRegionWhenReadingValueWithinRegionAgainThenWholeRegionIsSampledAgain) {
+    MockSysmanTelemetrySampler sampler(std::chrono::microseconds(100));
+    uint64_t telemetry[4] = {0x11, 0x22, 0x33, 0x44};
+    auto telemFile = writeFile("telem", std::string(reinterpret_cast<char *>(telemetry), sizeof(telemetry)));
+    sampler.addRegion(telemFile, sizeof(telemetry), 0);
+
+    uint64_t value = 0;
+    EXPECT_EQ(static_cast<ssize_t>(sizeof(value)), sampler.read(telemFile, &value, sizeof(value), 0));
+    sampler.currentTime += std::chrono::microseconds(101);
+    auto otherFile = writeFile("cur_freq", "1200\n");
+    readU64(sampler, otherFile);
+    sampler.currentTime += sampler.sourceIdleTimeout;
+    readU64(sampler, otherFile);
+    ASSERT_EQ(1u, sampler.sources.size());
+    EXPECT_EQ(otherFile, sampler.sources[0]->file);
+
+    EXPECT_EQ(static_cast<ssize_t>(sizeof(value)), sampler.read(telemFile, &value, sizeof(value), 3 * sizeof(uint64_t)));
+    EXPECT_EQ(0x44u, value);
+    EXPECT_EQ(static_cast<ssize_t>(sizeof(value)), sampler.read(telemFile, &value, sizeof(value), sizeof(uint64_t)));
+    EXPECT_EQ(0x22u, value);
+    EXPECT_EQ(2u, sampler.sources.size());
+    EXPECT_EQ(4u, sampler.getPreadCount());
+}
+
+TEST_F(SysmanTelemetrySamplerTest, givenSnapshotInvalidatedWhenReadingThenNewSnapshotIsTaken) {
+    MockSysmanTelemetrySampler sampler(std::chrono::microseconds(100));
+    auto freqFile = writeFile("min_freq", "300\n");
+    EXPECT_EQ(300u, readU64(sampler, freqFile));
+
+    writeFile("min_freq", "400\n");
+    sampler.invalidate();
+    EXPECT_EQ(400u, readU64(sampler, freqFile));
+    EXPECT_EQ(2u, sampler.getSnapshotCount());
+}
+
+TEST_F(SysmanTelemetrySamplerTest, givenMissingFileWhenReadingThenErrorIsReturnedAndNoSourceIsRegistered) {
+    MockSysmanTelemetrySampler sampler(std::chrono::microseconds(100));
+    char buf[64] = {};
+    errno = 0;
+    EXPECT_EQ(-1, sampler.read(fakeSysfsDir + "/missing", buf, sizeof(buf), 0));
+    EXPECT_EQ(ENOENT, errno);
+    EXPECT_EQ(0u, sampler.sources.size());
+}
+
+TEST(SysmanTelemetrySamplerCreateTest, givenSnapshotDebugFlagWhenCreatingSamplerThenSamplerIsCreatedOnlyWhenEnabled) {
+    DebugManagerStateRestore restorer;
+    EXPECT_EQ(nullptr, SysmanTelemetrySampler::create());
+
+    DebugManager.flags.SysmanTelemetrySnapshotMaxAgeUs.set(0);
+    EXPECT_NE(nullptr, SysmanTelemetrySampler::create());
+}
+
+TEST_F(SysmanDeviceFixture, GivenTelemetrySnapshotEnabledWhenReadingSysfsValuesThenRepeatedReadsAreServedFromSnapshot) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SysmanTelemetrySnapshotMaxAgeUs.set(std::numeric_limits<int32_t>::max());
+
+    static uint32_t preadCalled = 0;
+    preadCalled = 0;
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> mockOpen(&NEO::SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int {
+        return 1;
+    });
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPread)> mockPread(&NEO::SysCalls::sysCallsPread, [](int fd, void *buf, size_t count, off_t offset) -> ssize_t {
+        preadCalled++;
+        std::string value = "123";
+        memcpy(buf, value.data(), value.size());
+        return value.size();
+    });
+
+    auto pSysfsAccess = std::make_unique<PublicSysfsAccess>();
+    uint32_t val = 0;
+    for (auto i = 0; i < 3; i++) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, pSysfsAccess->read("mockfile0.txt", val));
+        EXPECT_EQ(123u, val);
+        EXPECT_EQ(ZE_RESULT_SUCCESS, pSysfsAccess->read("mockfile1.txt", val));
+    }
+    EXPECT_EQ(2u, preadCalled);
+}
+
+} // namespace ult
+} // namespace Sysman
+} // namespace L0
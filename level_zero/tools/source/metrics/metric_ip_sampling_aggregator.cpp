@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/tools/source/metrics/metric_ip_sampling_aggregator.h"
+
+#include "shared/source/helpers/string.h"
+
+#include <algorithm>
+
+namespace L0 {
+
+/*
+ * stall sample data item format:
+ *
+ * Bits		Field
+ * 0  to 28	IP (addr)
+ * 29 to 36	active count
+ * 37 to 44	other count
+ * 45 to 52	control count
+ * 53 to 60	pipestall count
+ * 61 to 68	send count
+ * 69 to 76	dist_acc count
+ * 77 to 84	sbid count
+ * 85 to 92	sync count
+ * 93 to 100	inst_fetch count
+ *
+ * bytes 49 and 50, subSlice
+ * bytes 51 and 52, flags
+ *
+ * total size 64 bytes
+ */
+bool IpSamplingStallAggregator::addReport(const uint8_t *pRawIpData) {
+    if (keys.empty()) {
+        keys.assign(initialCapacity, emptyKey);
+        counters.resize(initialCapacity);
+    }
+
+    uint64_t ip = 0ULL;
+    memcpy_s(&ip, sizeof(ip), pRawIpData, sizeof(ip));
+    ip &= ipMask;
+
+    // Every counter is 8 bits wide starting at bit 5 of bytes 3 to 11.
+    uint8_t rawCounters[stallCounterCount + 1] = {};
+    memcpy_s(rawCounters, sizeof(rawCounters), pRawIpData + 3, sizeof(rawCounters));
+    StallCounters reportCounters;
+    for (uint32_t i = 0; i < stallCounterCount; i++) {
+        reportCounters[i] = ((static_cast<uint32_t>(rawCounters[i + 1]) << 8 | rawCounters[i]) >> 5) & 0xff;
+    }
+
+    auto slot = findSlot(ip);
+    if (keys[slot] == emptyKey) {
+        if ((ipCount + 1) * 2 > keys.size()) {
+            grow();
+            slot = findSlot(ip);
+        }
+        keys[slot] = ip;
+        counters[slot] = {};
+        ipCount++;
+    }
+
+    auto &ipCounters = counters[slot];
+    for (uint32_t i = 0; i < stallCounterCount; i++) {
+        ipCounters[i] += reportCounters[i];
+    }
+
+    uint16_t flags = 0;
+    memcpy_s(&flags, sizeof(flags), pRawIpData + 50, sizeof(flags));
+    constexpr uint16_t overflowDropFlag = (1 << 8);
+    return flags & overflowDropFlag;
+}
+
+bool IpSamplingStallAggregator::addReports(const uint8_t *pRawData, size_t rawReportCount) {
+    bool dataOverflow = false;
+    for (size_t i = 0; i < rawReportCount; i++) {
+        dataOverflow |= addReport(pRawData + i * rawReportSize);
+    }
+    return dataOverflow;
+}
+
+void IpSamplingStallAggregator::reset() {
+    std::fill(keys.begin(), keys.end(), emptyKey);
+    ipCount = 0;
+}
+
+const IpSamplingStallAggregator::StallCounters *IpSamplingStallAggregator::getCounters(uint64_t ip) const {
+    if (keys.empty()) {
+        return nullptr;
+    }
+    auto slot = findSlot(ip & ipMask);
+    return keys[slot] == emptyKey ? nullptr : &counters[slot];
+}
+
+void IpSamplingStallAggregator::getSortedSlots(std::vector<uint32_t> &slots) const {
+    slots.clear();
+    slots.reserve(ipCount);
+    for (uint32_t slot = 0; slot < keys.size(); slot++) {
+        if (keys[slot] != emptyKey) {
+            slots.push_back(slot);
+        }
+    }
+    std::sort(slots.begin(), slots.end(), [this](uint32_t lhs, uint32_t rhs) { return keys[lhs] < keys[rhs]; });
+}
+
+size_t IpSamplingStallAggregator::findSlot(uint64_t ip) const {
+    const size_t mask = keys.size() - 1;
+    size_t slot = static_cast<size_t>((ip * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+    while (keys[slot] != emptyKey && keys[slot] != ip) {
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+void IpSamplingStallAggregator::grow() {
+    std::vector<uint64_t> oldKeys(keys.size() * 2, emptyKey);
+    std::vector<StallCounters> oldCounters(counters.size() * 2);
+    keys.swap(oldKeys);
+    counters.swap(oldCounters);
+
+    for (size_t i = 0; i < oldKeys.size(); i++) {
+        if (oldKeys[i] != emptyKey) {
+            auto slot = findSlot(oldKeys[i]);
+            keys[slot] = oldKeys[i];
+            counters[slot] = oldCounters[i];
+        }
+    }
+}
+
+} // namespace L0
@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace L0 {
+
+// Sums EU stall counters of raw IP sampling reports per IP.
+// Entries live in an open addressing table with linear probing, keys and counters
+// are kept in flat arrays so folding a report is a hash, a short probe and a fixed
+// length add over contiguous counters. Storage is retained on reset, so aggregator
+// reused across calculations does not allocate once it reached its working size.
+class IpSamplingStallAggregator {
+  public:
+    enum StallCounter : uint32_t {
+        active = 0,
+        other,
+        control,
+        pipeStall,
+        send,
+        distAcc,
+        sbid,
+        sync,
+        instFetch,
+        stallCounterCount
+    };
+    using StallCounters = std::array<uint64_t, stallCounterCount>;
+
+    static constexpr uint32_t rawReportSize = 64u;
+    static constexpr uint64_t ipMask = 0x1fffffff;
+    static constexpr size_t initialCapacity = 64u;
+
+    // Folds single raw report into aggregated state, returns true if report has overflow flag set.
+    bool addReport(const uint8_t *pRawIpData);
+    // Folds rawReportCount consecutive raw reports, returns true if any of them has overflow flag set.
+    bool addReports(const uint8_t *pRawData, size_t rawReportCount);
+    void reset();
+
+    size_t getIpCount() const { return ipCount; }
+    size_t getCapacity() const { return keys.size(); }
+    const StallCounters *getCounters(uint64_t ip) const;
+
+    // Returns table slots of aggregated IPs ordered by ascending IP.
+    void getSortedSlots(std::vector<uint32_t> &slots) const;
+    uint64_t getIp(uint32_t slot) const { return keys[slot]; }
+    const StallCounters &getSlotCounters(uint32_t slot) const { return counters[slot]; }
+
+  protected:
+    static constexpr uint64_t emptyKey = ~0ull;
+
+    size_t findSlot(uint64_t ip) const;
+    void grow();
+
+    std::vector<uint64_t> keys;
+    std::vector<StallCounters> counters;
+    size_t ipCount = 0;
+};
+
+} // namespace L0
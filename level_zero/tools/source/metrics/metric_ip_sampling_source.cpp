@@ -19,6 +19,8 @@
 #include "level_zero/tools/source/metrics/os_interface_metric.h"
 #include <level_zero/zet_api.h>
 
+#include <algorithm>
+#include <array>
 #include <cstring>
 
 namespace L0 {
@@ -398,9 +400,6 @@ ze_result_t IpSamplingMetricGroupImp::getCalculatedMetricValues(const zet_metric
 ze_result_t IpSamplingMetricGroupImp::getCalculatedMetricValues(const zet_metric_group_calculation_type_t type, const size_t rawDataSize, const uint8_t *pRawData,
                                                                 uint32_t &metricValueCount,
                                                                 zet_typed_value_t *pCalculatedData) {
-    bool dataOverflow = false;
-    StallSumIpDataMap_t stallSumIpDataMap;
-
     // MAX_METRIC_VALUES is not supported yet.
     if (type != ZET_METRIC_GROUP_CALCULATION_TYPE_METRIC_VALUES) {
         return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
@@ -416,127 +415,49 @@ ze_result_t IpSamplingMetricGroupImp::getCalculatedMetricValues(const zet_metric
 
     const uint32_t rawReportCount = static_cast<uint32_t>(rawDataSize) / rawReportSize;
 
-    for (const uint8_t *pRawIpData = pRawData; pRawIpData < pRawData + (rawReportCount * rawReportSize); pRawIpData += rawReportSize) {
-        dataOverflow |= stallIpDataMapUpdate(stallSumIpDataMap, pRawIpData);
-    }
+    // Aggregator storage is reused between calculations, table is only cleared here.
+    std::lock_guard<std::mutex> lock(stallAggregatorMutex);
+    stallAggregator.reset();
+    const bool dataOverflow = stallAggregator.addReports(pRawData, rawReportCount);
+    stallAggregator.getSortedSlots(sortedStallSlots);
 
-    metricValueCount = std::min<uint32_t>(metricValueCount, static_cast<uint32_t>(stallSumIpDataMap.size()) * properties.metricCount);
-    std::vector<zet_typed_value_t> ipDataValues;
+    metricValueCount = std::min<uint32_t>(metricValueCount, static_cast<uint32_t>(sortedStallSlots.size()) * properties.metricCount);
+    std::array<zet_typed_value_t, ipSamplinMetricCount> ipDataValues;
     uint32_t i = 0;
-    for (auto it = stallSumIpDataMap.begin(); it != stallSumIpDataMap.end(); ++it) {
-        stallSumIpDataToTypedValues(it->first, it->second, ipDataValues);
-        for (auto jt = ipDataValues.begin(); (jt != ipDataValues.end()) && (i < metricValueCount); jt++, i++) {
-            *(pCalculatedData + i) = *jt;
+    for (auto slot : sortedStallSlots) {
+        if (i >= metricValueCount) {
+            break;
         }
-        ipDataValues.clear();
+        stallSumIpDataToTypedValues(stallAggregator.getIp(slot), stallAggregator.getSlotCounters(slot), ipDataValues.data());
+        const uint32_t copyCount = std::min(metricValueCount - i, ipSamplinMetricCount);
+        std::copy(ipDataValues.begin(), ipDataValues.begin() + copyCount, pCalculatedData + i);
+        i += copyCount;
     }
 
     return dataOverflow ? ZE_RESULT_WARNING_DROPPED_DATA : ZE_RESULT_SUCCESS;
 }
 
-/*
- * stall sample data item format:
- *
- * Bits		Field
- * 0  to 28	IP (addr)
- * 29 to 36	active count
- * 37 to 44	other count
- * 45 to 52	control count
- * 53 to 60	pipestall count
- * 61 to 68	send count
- * 69 to 76	dist_acc count
- * 77 to 84	sbid count
- * 85 to 92	sync count
- * 93 to 100	inst_fetch count
- *
- * bytes 49 and 50, subSlice
- * bytes 51 and 52, flags
- *
- * total size 64 bytes
- */
-bool IpSamplingMetricGroupImp::stallIpDataMapUpdate(StallSumIpDataMap_t &stallSumIpDataMap, const uint8_t *pRawIpData) {
-
-    const uint8_t *tempAddr = pRawIpData;
-    uint64_t ip = 0ULL;
-    memcpy_s(reinterpret_cast<uint8_t *>(&ip), sizeof(ip), tempAddr, sizeof(ip));
-    ip &= 0x1fffffff;
-    StallSumIpData_t &stallSumData = stallSumIpDataMap[ip];
-    tempAddr += 3;
-
-    auto getCount = [&tempAddr]() {
-        uint16_t tempCount = 0;
-        memcpy_s(reinterpret_cast<uint8_t *>(&tempCount), sizeof(tempCount), tempAddr, sizeof(tempCount));
-        tempCount = (tempCount >> 5) & 0xff;
-        tempAddr += 1;
-        return static_cast<uint8_t>(tempCount);
-    };
-
-    stallSumData.activeCount += getCount();
-    stallSumData.otherCount += getCount();
-    stallSumData.controlCount += getCount();
-    stallSumData.pipeStallCount += getCount();
-    stallSumData.sendCount += getCount();
-    stallSumData.distAccCount += getCount();
-    stallSumData.sbidCount += getCount();
-    stallSumData.syncCount += getCount();
-    stallSumData.instFetchCount += getCount();
-
-    struct StallCntrInfo {
-        uint16_t subslice;
-        uint16_t flags;
-    } stallCntrInfo = {};
-
-    tempAddr = pRawIpData + 48;
-    memcpy_s(reinterpret_cast<uint8_t *>(&stallCntrInfo), sizeof(stallCntrInfo), tempAddr, sizeof(stallCntrInfo));
-
-    constexpr int overflowDropFlag = (1 << 8);
-    return stallCntrInfo.flags & overflowDropFlag;
-}
-
-// The order of push_back calls must match the order of metricPropertiesList.
+// The order of values must match the order of metricPropertiesList.
 void IpSamplingMetricGroupImp::stallSumIpDataToTypedValues(uint64_t ip,
-                                                           StallSumIpData_t &sumIpData,
-                                                           std::vector<zet_typed_value_t> &ipDataValues) {
-    zet_typed_value_t tmpValueData;
-    tmpValueData.type = ZET_VALUE_TYPE_UINT64;
-    tmpValueData.value.ui64 = ip;
-    ipDataValues.push_back(tmpValueData);
-
-    tmpValueData.type = ZET_VALUE_TYPE_UINT64;
-    tmpValueData.value.ui64 = sumIpData.activeCount;
-    ipDataValues.push_back(tmpValueData);
-
-    tmpValueData.type = ZET_VALUE_TYPE_UINT64;
-    tmpValueData.value.ui64 = sumIpData.controlCount;
-    ipDataValues.push_back(tmpValueData);
-
-    tmpValueData.type = ZET_VALUE_TYPE_UINT64;
-    tmpValueData.value.ui64 = sumIpData.pipeStallCount;
-    ipDataValues.push_back(tmpValueData);
-
-    tmpValueData.type = ZET_VALUE_TYPE_UINT64;
-    tmpValueData.value.ui64 = sumIpData.sendCount;
-    ipDataValues.push_back(tmpValueData);
-
-    tmpValueData.type = ZET_VALUE_TYPE_UINT64;
-    tmpValueData.value.ui64 = sumIpData.distAccCount;
-    ipDataValues.push_back(tmpValueData);
-
-    tmpValueData.type = ZET_VALUE_TYPE_UINT64;
-    tmpValueData.value.ui64 = sumIpData.sbidCount;
-    ipDataValues.push_back(tmpValueData);
-
-    tmpValueData.type = ZET_VALUE_TYPE_UINT64;
-    tmpValueData.value.ui64 = sumIpData.syncCount;
-    ipDataValues.push_back(tmpValueData);
-
-    tmpValueData.type = ZET_VALUE_TYPE_UINT64;
-    tmpValueData.value.ui64 = sumIpData.instFetchCount;
-    ipDataValues.push_back(tmpValueData);
-
-    tmpValueData.type = ZET_VALUE_TYPE_UINT64;
-    tmpValueData.value.ui64 = sumIpData.otherCount;
-    ipDataValues.push_back(tmpValueData);
+                                                           const IpSamplingStallAggregator::StallCounters &sumIpData,
+                                                           zet_typed_value_t *ipDataValues) {
+    constexpr std::array<IpSamplingStallAggregator::StallCounter, ipSamplinMetricCount - 1> counterOrder = {
+        IpSamplingStallAggregator::active,
+        IpSamplingStallAggregator::control,
+        IpSamplingStallAggregator::pipeStall,
+        IpSamplingStallAggregator::send,
+        IpSamplingStallAggregator::distAcc,
+        IpSamplingStallAggregator::sbid,
+        IpSamplingStallAggregator::sync,
+        IpSamplingStallAggregator::instFetch,
+        IpSamplingStallAggregator::other};
+
+    ipDataValues[0].type = ZET_VALUE_TYPE_UINT64;
+    ipDataValues[0].value.ui64 = ip;
+    for (uint32_t i = 0; i < counterOrder.size(); i++) {
+        ipDataValues[i + 1].type = ZET_VALUE_TYPE_UINT64;
+        ipDataValues[i + 1].value.ui64 = sumIpData[counterOrder[i]];
+    }
 }
 
 zet_metric_group_handle_t IpSamplingMetricGroupImp::getMetricGroupForSubDevice(const uint32_t subDeviceIndex) {
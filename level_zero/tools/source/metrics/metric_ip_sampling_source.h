@@ -8,8 +8,11 @@
 #pragma once
 
 #include "level_zero/tools/source/metrics/metric.h"
+#include "level_zero/tools/source/metrics/metric_ip_sampling_aggregator.h"
 #include "level_zero/tools/source/metrics/os_interface_metric.h"
 
+#include <mutex>
+
 namespace L0 {
 
 struct IpSamplingMetricImp;
@@ -42,20 +45,6 @@ class IpSamplingMetricSourceImp : public MetricSource {
     std::unique_ptr<MetricGroup> cachedMetricGroup = nullptr;
 };
 
-typedef struct StallSumIpData {
-    uint64_t activeCount;
-    uint64_t otherCount;
-    uint64_t controlCount;
-    uint64_t pipeStallCount;
-    uint64_t sendCount;
-    uint64_t distAccCount;
-    uint64_t sbidCount;
-    uint64_t syncCount;
-    uint64_t instFetchCount;
-} StallSumIpData_t;
-
-typedef std::map<uint64_t, StallSumIpData_t> StallSumIpDataMap_t;
-
 struct IpSamplingMetricGroupBase : public MetricGroup {
     static constexpr uint32_t rawReportSize = 64u;
     bool activate() override { return true; }
@@ -106,10 +95,12 @@ struct IpSamplingMetricGroupImp : public IpSamplingMetricGroupBase {
     ze_result_t getCalculatedMetricValues(const zet_metric_group_calculation_type_t type, const size_t rawDataSize, const uint8_t *pRawData,
                                           uint32_t &metricValueCount,
                                           zet_typed_value_t *pCalculatedData);
-    bool stallIpDataMapUpdate(StallSumIpDataMap_t &, const uint8_t *pRawIpData);
-    void stallSumIpDataToTypedValues(uint64_t ip, StallSumIpData_t &sumIpData, std::vector<zet_typed_value_t> &ipDataValues);
+    void stallSumIpDataToTypedValues(uint64_t ip, const IpSamplingStallAggregator::StallCounters &sumIpData, zet_typed_value_t *ipDataValues);
     bool isMultiDeviceCaptureData(const size_t rawDataSize, const uint8_t *pRawData);
     IpSamplingMetricSourceImp &metricSource;
+    IpSamplingStallAggregator stallAggregator;
+    std::vector<uint32_t> sortedStallSlots;
+    std::mutex stallAggregatorMutex;
 };
 
 struct MultiDeviceIpSamplingMetricGroupImp : public IpSamplingMetricGroupBase {
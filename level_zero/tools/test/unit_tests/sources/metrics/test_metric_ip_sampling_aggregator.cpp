@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/tools/source/metrics/metric_ip_sampling_aggregator.h"
+
+#include "gtest/gtest.h"
+
+#include <array>
+#include <vector>
+
+namespace L0 {
+namespace ult {
+
+using RawReport = std::array<uint8_t, IpSamplingStallAggregator::rawReportSize>;
+
+static void setReportBits(RawReport &report, uint32_t bitOffset, uint32_t bitCount, uint64_t value) {
+    for (uint32_t bit = 0; bit < bitCount; bit++) {
+        auto byteIndex = (bitOffset + bit) / 8;
+        auto bitIndex = (bitOffset + bit) % 8;
+        report[byteIndex] = static_cast<uint8_t>((report[byteIndex] & ~(1u << bitIndex)) | (((value >> bit) & 1u) << bitIndex));
+    }
+}
+
+static RawReport createReport(uint64_t ip, uint8_t baseCount, bool overflow) {
+    RawReport report = {};
+    setReportBits(report, 0, 29, ip);
+    for (uint32_t i = 0; i < IpSamplingStallAggregator::stallCounterCount; i++) {
+        setReportBits(report, 29 + 8 * i, 8, baseCount + i);
+    }
+    if (overflow) {
+        setReportBits(report, 50 * 8 + 8, 1, 1);
+    }
+    return report;
+}
+
+TEST(IpSamplingStallAggregatorTest, givenReportsWithRepeatedIpsWhenAddingReportsThenCountersAreSummedPerIp) {
+    std::vector<RawReport> reports = {createReport(0x100, 1, false), createReport(0x200, 10, false), createReport(0x100, 20, false)};
+
+    IpSamplingStallAggregator aggregator;
+    EXPECT_FALSE(aggregator.addReports(reports[0].data(), reports.size()));
+    EXPECT_EQ(2u, aggregator.getIpCount());
+
+    auto counters = aggregator.getCounters(0x100);
+    ASSERT_NE(nullptr, counters);
+    for (uint32_t i = 0; i < IpSamplingStallAggregator::stallCounterCount; i++) {
+        EXPECT_EQ(1u + 20u + 2 * i, (*counters)[i]);
+    }
+    counters = aggregator.getCounters(0x200);
+    ASSERT_NE(nullptr, counters);
+    EXPECT_EQ(10u, (*counters)[IpSamplingStallAggregator::active]);
+    EXPECT_EQ(18u, (*counters)[IpSamplingStallAggregator::instFetch]);
+    EXPECT_EQ(nullptr, aggregator.getCounters(0x300));
+}
+
+TEST(IpSamplingStallAggregatorTest, givenReportWithOverflowFlagWhenAddingReportsThenOverflowIsReturned) {
+    std::vector<RawReport> reports = {createReport(0x100, 1, false), createReport(0x100, 1, true)};
+
+    IpSamplingStallAggregator aggregator;
+    EXPECT_FALSE(aggregator.addReport(reports[0].data()));
+    EXPECT_TRUE(aggregator.addReport(reports[1].data()));
+    EXPECT_TRUE(aggregator.addReports(reports[0].data(), reports.size()));
+    EXPECT_EQ(4u, (*aggregator.getCounters(0x100))[IpSamplingStallAggregator::active]);
+}
+
+TEST(IpSamplingStallAggregatorTest, givenMoreIpsThanInitialCapacityWhenAddingReportsThenTableGrowsAndSlotsAreSortedByIp) {
+    constexpr uint64_t ipCount = 4 * IpSamplingStallAggregator::initialCapacity;
+    std::vector<RawReport> reports;
+    for (uint64_t ip = ipCount; ip > 0; ip--) {
+        reports.push_back(createReport(ip * 0x40, static_cast<uint8_t>(ip), false));
+    }
+
+    IpSamplingStallAggregator aggregator;
+    aggregator.addReports(reports[0].data(), reports.size());
+    aggregator.addReports(reports[0].data(), reports.size());
+    EXPECT_EQ(ipCount, aggregator.getIpCount());
+    EXPECT_LE(2 * ipCount, aggregator.getCapacity());
+
+    std::vector<uint32_t> slots;
+    aggregator.getSortedSlots(slots);
+    ASSERT_EQ(ipCount, slots.size());
+    for (uint64_t i = 0; i < ipCount; i++) {
+        auto ip = (i + 1) * 0x40;
+        EXPECT_EQ(ip, aggregator.getIp(slots[i]));
+        EXPECT_EQ(2u * static_cast<uint8_t>(i + 1), aggregator.getSlotCounters(slots[i])[IpSamplingStallAggregator::active]);
+    }
+}
+
+TEST(IpSamplingStallAggregatorTest, givenAggregatedReportsWhenResetIsCalledThenIpsAreClearedAndCapacityIsRetained) {
+    std::vector<RawReport> reports;
+    for (uint64_t ip = 0; ip < 2 * IpSamplingStallAggregator::initialCapacity; ip++) {
+        reports.push_back(createReport(ip, 1, false));
+    }
+
+    IpSamplingStallAggregator aggregator;
+    aggregator.addReports(reports[0].data(), reports.size());
+    auto capacity = aggregator.getCapacity();
+
+    aggregator.reset();
+    EXPECT_EQ(0u, aggregator.getIpCount());
+    EXPECT_EQ(capacity, aggregator.getCapacity());
+    EXPECT_EQ(nullptr, aggregator.getCounters(0));
+
+    aggregator.addReport(reports[1].data());
+    EXPECT_EQ(1u, aggregator.getIpCount());
+    EXPECT_EQ(1u, (*aggregator.getCounters(1))[IpSamplingStallAggregator::active]);
+    EXPECT_EQ(capacity, aggregator.getCapacity());
+}
+
+} // namespace ult
+} // namespace L0
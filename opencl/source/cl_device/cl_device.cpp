@@ -17,6 +17,7 @@
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/string.h"
+#include "shared/source/kernel/local_ids_cache.h"
 #include "shared/source/os_interface/driver_info.h"
 #include "shared/source/os_interface/os_interface.h"
 
@@ -282,6 +283,20 @@ const CompilerProductHelper &ClDevice::getCompilerProductHelper() const {
 const GTPinGfxCoreHelper &ClDevice::getGTPinGfxCoreHelper() const {
     return *gtpinGfxCoreHelper;
 }
+
+std::shared_ptr<LocalIdsCache> ClDevice::getLocalIdsCache(std::array<uint8_t, 3> wgDimOrder, uint8_t simdSize, uint8_t grfSize, bool usesOnlyImages) {
+    if (&rootClDevice != this) {
+        return rootClDevice.getLocalIdsCache(wgDimOrder, simdSize, grfSize, usesOnlyImages);
+    }
+    const auto layoutKey = LocalIdsCache::getLayoutKey(wgDimOrder, simdSize, grfSize, usesOnlyImages);
+    std::lock_guard<std::mutex> lock(localIdsCachesMutex);
+    auto &localIdsCache = localIdsCaches[layoutKey];
+    if (!localIdsCache) {
+        localIdsCache = std::make_shared<LocalIdsCache>(LocalIdsCache::getSharedCacheSize(), wgDimOrder, simdSize, grfSize, usesOnlyImages);
+    }
+    return localIdsCache;
+}
+
 cl_version ClDevice::getExtensionVersion(std::string name) {
     if (name.compare("cl_khr_integer_dot_product") == 0)
         return CL_MAKE_VERSION(2u, 0, 0);
@@ -15,7 +15,10 @@
 
 #include "igfxfmid.h"
 
+#include <array>
+#include <memory>
 #include <mutex>
+#include <unordered_map>
 #include <vector>
 
 namespace aub_stream {
@@ -31,6 +34,7 @@ class DriverInfo;
 class ExecutionEnvironment;
 class GmmHelper;
 class GmmClientContext;
+class LocalIdsCache;
 class MemoryManager;
 class PerformanceCounters;
 class Platform;
@@ -132,6 +136,7 @@ class ClDevice : public BaseObject<_cl_device_id> {
     const ProductHelper &getProductHelper() const;
     const CompilerProductHelper &getCompilerProductHelper() const;
     const GTPinGfxCoreHelper &getGTPinGfxCoreHelper() const;
+    std::shared_ptr<LocalIdsCache> getLocalIdsCache(std::array<uint8_t, 3> wgDimOrder, uint8_t simdSize, uint8_t grfSize, bool usesOnlyImages);
 
     std::unique_ptr<GTPinGfxCoreHelper> gtpinGfxCoreHelper;
     cl_version getExtensionVersion(std::string name);
@@ -163,6 +168,9 @@ class ClDevice : public BaseObject<_cl_device_id> {
     std::vector<unsigned int> simultaneousInterops = {0};
     std::string compilerExtensions;
     std::string compilerExtensionsWithFeatures;
+
+    std::unordered_map<uint64_t, std::shared_ptr<LocalIdsCache>> localIdsCaches;
+    std::mutex localIdsCachesMutex;
 };
 
 } // namespace NEO
@@ -70,6 +70,7 @@ Context::~Context() {
     }
     if (svmAllocsManager) {
         svmAllocsManager->trimUSMDeviceAllocCache();
+        svmAllocsManager->trimUSMHostAllocCache();
         delete svmAllocsManager;
     }
     if (driverDiagnostics) {
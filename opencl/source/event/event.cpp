@@ -19,6 +19,7 @@
 #include "shared/source/helpers/mt_helpers.h"
 #include "shared/source/helpers/timestamp_packet.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
+#include "shared/source/utilities/host_wait_multiplexer.h"
 #include "shared/source/utilities/perf_counter.h"
 #include "shared/source/utilities/range.h"
 #include "shared/source/utilities/tag_allocator.h"
@@ -683,6 +684,11 @@ cl_int Event::waitForEvents(cl_uint numEvents,
                 return CL_EXEC_STATUS_ERROR_FOR_EVENTS_IN_WAIT_LIST;
             }
 
+            if (HostWaitMultiplexer::isEnabled() && event->cmdQueue && event->peekTaskCount() != CompletionStamp::notReady) {
+                auto hostWaitMultiplexer = event->cmdQueue->getDevice().getHostWaitMultiplexer();
+                hostWaitMultiplexer->wait([event]() { return event->isGpuWorkCompleted(); }, HostWaitMultiplexer::defaultParkTime);
+            }
+
             eventWaitStatus = event->wait(false, false);
             if (eventWaitStatus == WaitStatus::NotReady) {
                 pendingEventsLeft->push_back(event);
@@ -715,17 +721,22 @@ inline void Event::setExecutionStatusToAbortedDueToGpuHang(cl_event *first, cl_e
 }
 
 bool Event::isCompleted() {
-    if (gpuStateWaited) {
-        return true;
+    if (isGpuWorkCompleted() || this->areTimestampsCompleted()) {
+        gpuStateWaited = true;
     }
 
-    Range<CopyEngineState> states{&bcsState, bcsState.isValid() ? 1u : 0u};
+    return gpuStateWaited;
+}
 
-    if (cmdQueue->isCompleted(getCompletionStamp(), states) || this->areTimestampsCompleted()) {
-        gpuStateWaited = true;
+// Read only completion check, safe to call from host wait multiplexer poller thread.
+// Event state is updated by subsequent wait on API thread.
+bool Event::isGpuWorkCompleted() {
+    if (gpuStateWaited) {
+        return true;
     }
 
-    return gpuStateWaited;
+    Range<CopyEngineState> states{&bcsState, bcsState.isValid() ? 1u : 0u};
+    return cmdQueue->isCompleted(getCompletionStamp(), states);
 }
 
 bool Event::isWaitForTimestampsEnabled() const {
@@ -198,6 +198,7 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
 
     bool updateStatusAndCheckCompletion();
     bool isCompleted();
+    bool isGpuWorkCompleted();
 
     // Note from OCL spec :
     //      "A negative integer value causes all enqueued commands that wait on this user event
@@ -1456,13 +1456,25 @@ cl_int Kernel::setArgBuffer(uint32_t argIndex,
         auto clMemObj = *clMem;
         DBG_LOG_INPUTS("setArgBuffer cl_mem", clMemObj);
 
+        auto &argInfo = kernelArguments[argIndex];
+        bool sameObjectPatched = argInfo.isPatched && argInfo.type == BUFFER_OBJ && argInfo.object == clMemObj;
+
         storeKernelArg(argIndex, BUFFER_OBJ, clMemObj, argVal, argSize);
 
         auto buffer = castToObject<Buffer>(clMemObj);
         if (!buffer) {
+            argInfo.memObjUniqueId = 0;
             return CL_INVALID_MEM_OBJECT;
         }
 
+        // Cross thread data and surface state already describe this buffer, unique id guards against reused cl_mem addresses.
+        // Builtins may change aux translation direction and shared objects may change allocation between calls.
+        if (sameObjectPatched && argInfo.memObjUniqueId == buffer->getUniqueId() && !isBuiltIn &&
+            !buffer->peekSharingHandler() && !DebugManager.flags.AddPatchInfoCommentsForAUBDump.get()) {
+            return CL_SUCCESS;
+        }
+        argInfo.memObjUniqueId = buffer->getUniqueId();
+
         auto gfxAllocationType = buffer->getGraphicsAllocation(rootDeviceIndex)->getAllocationType();
         if (!isBuiltIn) {
             this->anyKernelArgumentUsingSystemMemory |= Kernel::graphicsAllocationTypeUseSystemMemory(gfxAllocationType);
@@ -1522,6 +1534,7 @@ cl_int Kernel::setArgBuffer(uint32_t argIndex,
         return CL_SUCCESS;
     } else {
         storeKernelArg(argIndex, BUFFER_OBJ, nullptr, argVal, argSize);
+        kernelArguments[argIndex].memObjUniqueId = 0;
         if (isValidOffset(argAsPtr.stateless)) {
             auto patchLocation = ptrOffset(getCrossThreadData(), argAsPtr.stateless);
             patchWithRequiredSize(patchLocation, argAsPtr.pointerSize, 0u);
@@ -2286,7 +2299,7 @@ void Kernel::initializeLocalIdsCache() {
                                          workgroupDimensionsOrder[2]};
     auto simdSize = getDescriptor().kernelAttributes.simdSize;
     auto grfSize = static_cast<uint8_t>(getDevice().getHardwareInfo().capabilityTable.grfSize);
-    localIdsCache = std::make_unique<LocalIdsCache>(4, wgDimOrder, simdSize, grfSize, usingImagesOnly);
+    localIdsCache = clDevice.getLocalIdsCache(wgDimOrder, simdSize, grfSize, usingImagesOnly);
 }
 
 void Kernel::setLocalIdsForGroup(const Vec3<uint16_t> &groupSize, void *destination) const {
@@ -69,6 +69,7 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
         kernelArgType type;
         uint32_t allocId;
         uint32_t allocIdMemoryManagerCounter;
+        uint64_t memObjUniqueId = 0;
         bool isPatched = false;
         bool isStatelessUncacheable = false;
         bool isSetToNullptr = false;
@@ -475,7 +476,7 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
     bool hasRunFinished(TimestampPacketContainer *timestampContainer);
 
     void initializeLocalIdsCache();
-    std::unique_ptr<LocalIdsCache> localIdsCache;
+    std::shared_ptr<LocalIdsCache> localIdsCache;
 
     UnifiedMemoryControls unifiedMemoryControls{};
 
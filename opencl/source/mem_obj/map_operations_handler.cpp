@@ -9,6 +9,8 @@
 
 #include "shared/source/helpers/ptr_math.h"
 
+#include <algorithm>
+
 using namespace NEO;
 
 size_t MapOperationsHandler::size() const {
@@ -26,23 +28,28 @@ bool MapOperationsHandler::add(void *ptr, size_t ptrLength, cl_map_flags &mapFla
         return false;
     }
 
-    mappedPointers.push_back(mapInfo);
+    mappedPointers.emplace(castToUint64(ptr), mapInfo);
+    maxMappedLength = std::max(maxMappedLength, ptrLength);
     return true;
 }
 
+MapOperationsHandler::MappedPointers::iterator MapOperationsHandler::getFirstCandidate(uint64_t address) {
+    auto lowestStart = address > maxMappedLength ? address - maxMappedLength : 0u;
+    return mappedPointers.lower_bound(lowestStart);
+}
+
 bool MapOperationsHandler::isOverlapping(MapInfo &inputMapInfo) {
     if (inputMapInfo.readOnly) {
         return false;
     }
-    auto inputStartPtr = inputMapInfo.ptr;
-    auto inputEndPtr = ptrOffset(inputStartPtr, inputMapInfo.ptrLength);
+    auto inputStart = castToUint64(inputMapInfo.ptr);
+    auto inputEnd = inputStart + inputMapInfo.ptrLength;
 
-    for (auto &mapInfo : mappedPointers) {
-        auto mappedStartPtr = mapInfo.ptr;
-        auto mappedEndPtr = ptrOffset(mappedStartPtr, mapInfo.ptrLength);
+    for (auto it = getFirstCandidate(inputStart); it != mappedPointers.end() && it->first <= inputEnd; it++) {
+        auto mappedEnd = it->first + it->second.ptrLength;
 
         // Requested ptr starts before or inside existing ptr range and overlapping end
-        if (inputStartPtr < mappedEndPtr && inputEndPtr >= mappedStartPtr) {
+        if (inputStart < mappedEnd) {
             return true;
         }
     }
@@ -52,24 +59,23 @@ bool MapOperationsHandler::isOverlapping(MapInfo &inputMapInfo) {
 bool MapOperationsHandler::find(void *mappedPtr, MapInfo &outMapInfo) {
     std::lock_guard<std::mutex> lock(mtx);
 
-    for (auto &mapInfo : mappedPointers) {
-        if (mapInfo.ptr == mappedPtr) {
-            outMapInfo = mapInfo;
-            return true;
-        }
+    auto it = mappedPointers.find(castToUint64(mappedPtr));
+    if (it == mappedPointers.end()) {
+        return false;
     }
-    return false;
+    outMapInfo = it->second;
+    return true;
 }
 
 bool NEO::MapOperationsHandler::findInfoForHostPtr(const void *ptr, size_t size, MapInfo &outMapInfo) {
     std::lock_guard<std::mutex> lock(mtx);
 
-    for (auto &mapInfo : mappedPointers) {
-        void *ptrStart = mapInfo.ptr;
-        void *ptrEnd = ptrOffset(mapInfo.ptr, mapInfo.ptrLength);
+    auto requestedStart = castToUint64(ptr);
+    auto requestedEnd = requestedStart + size;
 
-        if (ptrStart <= ptr && ptrOffset(ptr, size) <= ptrEnd) {
-            outMapInfo = mapInfo;
+    for (auto it = getFirstCandidate(requestedStart); it != mappedPointers.end() && it->first <= requestedStart; it++) {
+        if (requestedEnd <= it->first + it->second.ptrLength) {
+            outMapInfo = it->second;
             return true;
         }
     }
@@ -79,25 +85,32 @@ bool NEO::MapOperationsHandler::findInfoForHostPtr(const void *ptr, size_t size,
 void MapOperationsHandler::remove(void *mappedPtr) {
     std::lock_guard<std::mutex> lock(mtx);
 
-    auto endIter = mappedPointers.end();
-    for (auto it = mappedPointers.begin(); it != endIter; it++) {
-        if (it->ptr == mappedPtr) {
-            std::iter_swap(it, mappedPointers.end() - 1);
-            mappedPointers.pop_back();
-            break;
-        }
+    auto it = mappedPointers.find(castToUint64(mappedPtr));
+    if (it != mappedPointers.end()) {
+        mappedPointers.erase(it);
+    }
+    if (mappedPointers.empty()) {
+        maxMappedLength = 0;
     }
 }
 
+MapOperationsStorage::HandlersShard &NEO::MapOperationsStorage::getShard(cl_mem memObj) {
+    // memory objects are much larger than 64 bytes, low bits carry no entropy
+    auto shardIndex = (reinterpret_cast<uintptr_t>(memObj) >> 6) % handlersShardsCount;
+    return shards[shardIndex];
+}
+
 MapOperationsHandler &NEO::MapOperationsStorage::getHandler(cl_mem memObj) {
-    std::lock_guard<std::mutex> lock(mutex);
-    return handlers[memObj];
+    auto &shard = getShard(memObj);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.handlers[memObj];
 }
 
 MapOperationsHandler *NEO::MapOperationsStorage::getHandlerIfExists(cl_mem memObj) {
-    std::lock_guard<std::mutex> lock(mutex);
-    auto iterator = handlers.find(memObj);
-    if (iterator == handlers.end()) {
+    auto &shard = getShard(memObj);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto iterator = shard.handlers.find(memObj);
+    if (iterator == shard.handlers.end()) {
         return nullptr;
     }
 
@@ -105,17 +118,20 @@ MapOperationsHandler *NEO::MapOperationsStorage::getHandlerIfExists(cl_mem memOb
 }
 
 bool NEO::MapOperationsStorage::getInfoForHostPtr(const void *ptr, size_t size, MapInfo &outInfo) {
-    std::lock_guard<std::mutex> lock(mutex);
-    for (auto &entry : handlers) {
-        if (entry.second.findInfoForHostPtr(ptr, size, outInfo)) {
-            return true;
+    for (auto &shard : shards) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        for (auto &entry : shard.handlers) {
+            if (entry.second.findInfoForHostPtr(ptr, size, outInfo)) {
+                return true;
+            }
         }
     }
     return false;
 }
 
 void NEO::MapOperationsStorage::removeHandler(cl_mem memObj) {
-    std::lock_guard<std::mutex> lock(mutex);
-    auto iterator = handlers.find(memObj);
-    handlers.erase(iterator);
+    auto &shard = getShard(memObj);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto iterator = shard.handlers.find(memObj);
+    shard.handlers.erase(iterator);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,9 +8,10 @@
 #pragma once
 #include "opencl/source/helpers/properties_helper.h"
 
+#include <array>
+#include <map>
 #include <mutex>
 #include <unordered_map>
-#include <vector>
 
 namespace NEO {
 
@@ -25,14 +26,22 @@ class MapOperationsHandler {
     size_t size() const;
 
   protected:
+    // Mappings ordered by start address. Only mappings starting within maxMappedLength
+    // below a queried address can cover it, which bounds overlap and host ptr searches.
+    using MappedPointers = std::multimap<uint64_t, MapInfo>;
+
     bool isOverlapping(MapInfo &inputMapInfo);
-    std::vector<MapInfo> mappedPointers;
+    MappedPointers::iterator getFirstCandidate(uint64_t address);
+
+    MappedPointers mappedPointers;
+    size_t maxMappedLength = 0;
     mutable std::mutex mtx;
 };
 
 class MapOperationsStorage {
   public:
     using HandlersMap = std::unordered_map<cl_mem, MapOperationsHandler>;
+    static constexpr size_t handlersShardsCount = 16;
 
     MapOperationsHandler &getHandler(cl_mem memObj);
     MapOperationsHandler *getHandlerIfExists(cl_mem memObj);
@@ -40,8 +49,14 @@ class MapOperationsStorage {
     void removeHandler(cl_mem memObj);
 
   protected:
-    std::mutex mutex;
-    HandlersMap handlers{};
+    struct HandlersShard {
+        std::mutex mutex;
+        HandlersMap handlers;
+    };
+
+    HandlersShard &getShard(cl_mem memObj);
+
+    std::array<HandlersShard, handlersShardsCount> shards{};
 };
 
 } // namespace NEO
@@ -24,9 +24,14 @@
 #include "opencl/source/sharings/sharing.h"
 
 #include <algorithm>
+#include <atomic>
 
 namespace NEO {
 
+namespace {
+std::atomic<uint64_t> memObjUniqueIdCounter{0};
+} // namespace
+
 MemObj::MemObj(Context *context,
                cl_mem_object_type memObjectType,
                const MemoryProperties &memoryProperties,
@@ -44,6 +49,7 @@ MemObj::MemObj(Context *context,
       isZeroCopy(zeroCopy), isHostPtrSVM(isHostPtrSVM), isObjectRedescribed(isObjectRedescribed),
       multiGraphicsAllocation(std::move(multiGraphicsAllocation)),
       mapAllocations(static_cast<uint32_t>(this->multiGraphicsAllocation.getGraphicsAllocations().size() - 1)) {
+    this->uniqueId = ++memObjUniqueIdCounter;
     if (context) {
         context->incRefInternal();
         memoryManager = context->getMemoryManager();
@@ -83,6 +83,7 @@ class MemObj : public BaseObject<_cl_mem> {
     void *getCpuAddress() const;
     void *getHostPtr() const;
     bool getIsObjectRedescribed() const { return isObjectRedescribed; };
+    uint64_t getUniqueId() const { return uniqueId; }
     size_t getSize() const;
 
     MapOperationsHandler &getMapOperationsHandler();
@@ -195,6 +196,7 @@ class MemObj : public BaseObject<_cl_mem> {
     MultiGraphicsAllocation mapAllocations;
     std::shared_ptr<SharingHandler> sharingHandler;
     std::vector<uint64_t> propertiesVector;
+    uint64_t uniqueId = 0;
 
     MemObjDestructorCallbacks destructorCallbacks;
 };
@@ -0,0 +1,330 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/tracing/tracing_latency.h"
+
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/debug_helpers.h"
+
+#include <algorithm>
+
+namespace HostSideTracing {
+
+ApiLatencyTracker globalApiLatencyTracker;
+ApiLatencyTracker *pGlobalApiLatencyTracker = &globalApiLatencyTracker;
+
+namespace {
+const char *functionNames[] = {
+    "clBuildProgram",
+    "clCloneKernel",
+    "clCompileProgram",
+    "clCreateBuffer",
+    "clCreateCommandQueue",
+    "clCreateCommandQueueWithProperties",
+    "clCreateContext",
+    "clCreateContextFromType",
+    "clCreateFromGLBuffer",
+    "clCreateFromGLRenderbuffer",
+    "clCreateFromGLTexture",
+    "clCreateFromGLTexture2D",
+    "clCreateFromGLTexture3D",
+    "clCreateImage",
+    "clCreateImage2D",
+    "clCreateImage3D",
+    "clCreateKernel",
+    "clCreateKernelsInProgram",
+    "clCreatePipe",
+    "clCreateProgramWithBinary",
+    "clCreateProgramWithBuiltInKernels",
+    "clCreateProgramWithIL",
+    "clCreateProgramWithSource",
+    "clCreateSampler",
+    "clCreateSamplerWithProperties",
+    "clCreateSubBuffer",
+    "clCreateSubDevices",
+    "clCreateUserEvent",
+    "clEnqueueAcquireGLObjects",
+    "clEnqueueBarrier",
+    "clEnqueueBarrierWithWaitList",
+    "clEnqueueCopyBuffer",
+    "clEnqueueCopyBufferRect",
+    "clEnqueueCopyBufferToImage",
+    "clEnqueueCopyImage",
+    "clEnqueueCopyImageToBuffer",
+    "clEnqueueFillBuffer",
+    "clEnqueueFillImage",
+    "clEnqueueMapBuffer",
+    "clEnqueueMapImage",
+    "clEnqueueMarker",
+    "clEnqueueMarkerWithWaitList",
+    "clEnqueueMigrateMemObjects",
+    "clEnqueueNDRangeKernel",
+    "clEnqueueNativeKernel",
+    "clEnqueueReadBuffer",
+    "clEnqueueReadBufferRect",
+    "clEnqueueReadImage",
+    "clEnqueueReleaseGLObjects",
+    "clEnqueueSVMFree",
+    "clEnqueueSVMMap",
+    "clEnqueueSVMMemFill",
+    "clEnqueueSVMMemcpy",
+    "clEnqueueSVMMigrateMem",
+    "clEnqueueSVMUnmap",
+    "clEnqueueTask",
+    "clEnqueueUnmapMemObject",
+    "clEnqueueWaitForEvents",
+    "clEnqueueWriteBuffer",
+    "clEnqueueWriteBufferRect",
+    "clEnqueueWriteImage",
+    "clFinish",
+    "clFlush",
+    "clGetCommandQueueInfo",
+    "clGetContextInfo",
+    "clGetDeviceAndHostTimer",
+    "clGetDeviceIDs",
+    "clGetDeviceInfo",
+    "clGetEventInfo",
+    "clGetEventProfilingInfo",
+    "clGetExtensionFunctionAddress",
+    "clGetExtensionFunctionAddressForPlatform",
+    "clGetGLObjectInfo",
+    "clGetGLTextureInfo",
+    "clGetHostTimer",
+    "clGetImageInfo",
+    "clGetKernelArgInfo",
+    "clGetKernelInfo",
+    "clGetKernelSubGroupInfo",
+    "clGetKernelWorkGroupInfo",
+    "clGetMemObjectInfo",
+    "clGetPipeInfo",
+    "clGetPlatformIDs",
+    "clGetPlatformInfo",
+    "clGetProgramBuildInfo",
+    "clGetProgramInfo",
+    "clGetSamplerInfo",
+    "clGetSupportedImageFormats",
+    "clLinkProgram",
+    "clReleaseCommandQueue",
+    "clReleaseContext",
+    "clReleaseDevice",
+    "clReleaseEvent",
+    "clReleaseKernel",
+    "clReleaseMemObject",
+    "clReleaseProgram",
+    "clReleaseSampler",
+    "clRetainCommandQueue",
+    "clRetainContext",
+    "clRetainDevice",
+    "clRetainEvent",
+    "clRetainKernel",
+    "clRetainMemObject",
+    "clRetainProgram",
+    "clRetainSampler",
+    "clSVMAlloc",
+    "clSVMFree",
+    "clSetCommandQueueProperty",
+    "clSetDefaultDeviceCommandQueue",
+    "clSetEventCallback",
+    "clSetKernelArg",
+    "clSetKernelArgSVMPointer",
+    "clSetKernelExecInfo",
+    "clSetMemObjectDestructorCallback",
+    "clSetUserEventStatus",
+    "clUnloadCompiler",
+    "clUnloadPlatformCompiler",
+    "clWaitForEvents",
+};
+static_assert(sizeof(functionNames) / sizeof(functionNames[0]) == CL_FUNCTION_COUNT, "Function names have to match cl_function_id");
+
+std::atomic<uint32_t> trackerGenerationCounter{0};
+} // namespace
+
+thread_local ApiLatencyTracker::ThreadRegistration ApiLatencyTracker::threadRegistration;
+
+uint32_t LatencyHistogram::getBucketIndex(uint64_t value) {
+    if (value < subBucketCount) {
+        return static_cast<uint32_t>(value);
+    }
+    uint32_t msb = Math::log2(value);
+    if (msb >= maxValueBits) {
+        return bucketCount - 1;
+    }
+    uint32_t magnitude = msb - subBucketBits + 1;
+    uint32_t subBucket = static_cast<uint32_t>(value >> (msb - subBucketBits)) & (subBucketCount - 1);
+    return magnitude * subBucketCount + subBucket;
+}
+
+uint64_t LatencyHistogram::getBucketUpperBound(uint32_t bucketIndex) {
+    uint32_t magnitude = bucketIndex / subBucketCount;
+    uint64_t subBucket = bucketIndex % subBucketCount;
+    if (magnitude == 0) {
+        return subBucket;
+    }
+    uint32_t shift = magnitude - 1;
+    return ((subBucketCount + subBucket + 1) << shift) - 1;
+}
+
+void LatencyHistogram::merge(const LatencyHistogram &other) {
+    for (uint32_t i = 0; i < bucketCount; i++) {
+        increment(buckets[i], other.getBucketCount(i));
+    }
+    increment(totalValue, other.getTotalValue());
+    if (other.getMaxValue() > maxValue.load(std::memory_order_relaxed)) {
+        maxValue.store(other.getMaxValue(), std::memory_order_relaxed);
+    }
+}
+
+ApiLatencyTracker::ApiLatencyTracker() : state(std::make_shared<SharedState>()) {
+    this->generation = ++trackerGenerationCounter;
+}
+
+ApiLatencyTracker::~ApiLatencyTracker() {
+    // flag is latched on registration, debug manager may be already destroyed here
+    if (printOnDestruction) {
+        printSnapshots(stdout);
+    }
+    if (threadRegistration.trackerGeneration == this->generation) {
+        threadRegistration.release();
+    }
+}
+
+void ApiLatencyTracker::SharedState::unregisterThread(ThreadLatencies *exitingThreadLatencies) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (uint32_t functionId = 0; functionId < CL_FUNCTION_COUNT; functionId++) {
+        auto histogram = exitingThreadLatencies->histograms[functionId].load(std::memory_order_acquire);
+        if (histogram == nullptr) {
+            continue;
+        }
+        auto &exitedHistogram = exitedThreadsLatencies.histograms[functionId];
+        if (exitedHistogram.load(std::memory_order_relaxed) == nullptr) {
+            exitedHistogram.store(new LatencyHistogram, std::memory_order_release);
+        }
+        exitedHistogram.load(std::memory_order_relaxed)->merge(*histogram);
+    }
+    threadLatencies.erase(std::remove_if(threadLatencies.begin(), threadLatencies.end(), [exitingThreadLatencies](const auto &currentThreadLatencies) {
+                              return currentThreadLatencies.get() == exitingThreadLatencies;
+                          }),
+                          threadLatencies.end());
+}
+
+ApiLatencyTracker::ThreadRegistration::~ThreadRegistration() {
+    release();
+}
+
+void ApiLatencyTracker::ThreadRegistration::release() {
+    if (state) {
+        state->unregisterThread(threadLatencies);
+        state.reset();
+        threadLatencies = nullptr;
+        trackerGeneration = 0;
+    }
+}
+
+ApiLatencyTracker::ThreadLatencies::~ThreadLatencies() {
+    for (auto &histogram : histograms) {
+        delete histogram.load(std::memory_order_relaxed);
+    }
+}
+
+const char *ApiLatencyTracker::getFunctionName(cl_function_id functionId) {
+    DEBUG_BREAK_IF(functionId >= CL_FUNCTION_COUNT);
+    return functionNames[functionId];
+}
+
+ApiLatencyTracker::ThreadLatencies *ApiLatencyTracker::registerThread() {
+    threadRegistration.release();
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->threadLatencies.push_back(std::make_unique<ThreadLatencies>());
+    printOnDestruction |= NEO::DebugManager.flags.PrintOclApiLatencyHistograms.get();
+
+    threadRegistration.state = state;
+    threadRegistration.threadLatencies = state->threadLatencies.back().get();
+    threadRegistration.trackerGeneration = this->generation;
+    return threadRegistration.threadLatencies;
+}
+
+LatencyHistogram *ApiLatencyTracker::getThreadHistogram(cl_function_id functionId) {
+    ThreadLatencies *currentThreadLatencies = nullptr;
+    if (threadRegistration.trackerGeneration == this->generation) {
+        currentThreadLatencies = threadRegistration.threadLatencies;
+    } else {
+        currentThreadLatencies = registerThread();
+    }
+
+    auto &histogram = currentThreadLatencies->histograms[functionId];
+    auto currentHistogram = histogram.load(std::memory_order_relaxed);
+    if (currentHistogram == nullptr) {
+        currentHistogram = new LatencyHistogram;
+        histogram.store(currentHistogram, std::memory_order_release);
+    }
+    return currentHistogram;
+}
+
+ApiLatencySnapshot ApiLatencyTracker::getSnapshot(cl_function_id functionId) {
+    std::array<uint64_t, LatencyHistogram::bucketCount> buckets = {};
+    ApiLatencySnapshot snapshot = {};
+    auto addHistogram = [&](const ThreadLatencies &currentThreadLatencies) {
+        auto histogram = currentThreadLatencies.histograms[functionId].load(std::memory_order_acquire);
+        if (histogram == nullptr) {
+            return;
+        }
+        for (uint32_t i = 0; i < LatencyHistogram::bucketCount; i++) {
+            auto bucketCount = histogram->getBucketCount(i);
+            buckets[i] += bucketCount;
+            snapshot.callCount += bucketCount;
+        }
+        snapshot.totalLatency += histogram->getTotalValue();
+        snapshot.maxLatency = std::max(snapshot.maxLatency, histogram->getMaxValue());
+    };
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        for (auto &currentThreadLatencies : state->threadLatencies) {
+            addHistogram(*currentThreadLatencies);
+        }
+        addHistogram(state->exitedThreadsLatencies);
+    }
+
+    if (snapshot.callCount == 0) {
+        return snapshot;
+    }
+
+    auto getPercentile = [&](uint64_t perMille) {
+        uint64_t rank = (snapshot.callCount * perMille + 999) / 1000;
+        uint64_t seenCount = 0;
+        for (uint32_t i = 0; i < LatencyHistogram::bucketCount; i++) {
+            seenCount += buckets[i];
+            if (seenCount >= rank) {
+                return std::min(LatencyHistogram::getBucketUpperBound(i), snapshot.maxLatency);
+            }
+        }
+        return snapshot.maxLatency;
+    };
+    snapshot.p50Latency = getPercentile(500);
+    snapshot.p99Latency = getPercentile(990);
+    snapshot.p999Latency = getPercentile(999);
+    return snapshot;
+}
+
+void ApiLatencyTracker::printSnapshots(FILE *stream) {
+    fprintf(stream, "OpenCL API latency [ns]:\n%-44s %12s %12s %12s %12s %12s %12s\n", "API", "calls", "avg", "p50", "p99", "p999", "max");
+    for (uint32_t functionId = 0; functionId < CL_FUNCTION_COUNT; functionId++) {
+        auto snapshot = getSnapshot(static_cast<cl_function_id>(functionId));
+        if (snapshot.callCount == 0) {
+            continue;
+        }
+        fprintf(stream, "%-44s %12llu %12llu %12llu %12llu %12llu %12llu\n", functionNames[functionId],
+                static_cast<unsigned long long>(snapshot.callCount),
+                static_cast<unsigned long long>(snapshot.totalLatency / snapshot.callCount),
+                static_cast<unsigned long long>(snapshot.p50Latency),
+                static_cast<unsigned long long>(snapshot.p99Latency),
+                static_cast<unsigned long long>(snapshot.p999Latency),
+                static_cast<unsigned long long>(snapshot.maxLatency));
+    }
+}
+
+} // namespace HostSideTracing
@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include "opencl/source/tracing/tracing_types.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace HostSideTracing {
+
+// Log-linear (HDR-style) latency histogram in nanoseconds. Values below subBucketCount
+// are exact, above that every power of two range is split into subBucketCount buckets,
+// giving relative error below 1/subBucketCount. Single writer, readers may run concurrently.
+class LatencyHistogram : NEO::NonCopyableOrMovableClass {
+  public:
+    static constexpr uint32_t subBucketBits = 4;
+    static constexpr uint32_t subBucketCount = 1u << subBucketBits;
+    static constexpr uint32_t maxValueBits = 40;
+    static constexpr uint32_t bucketCount = (maxValueBits - subBucketBits + 1) * subBucketCount;
+
+    static uint32_t getBucketIndex(uint64_t value);
+    static uint64_t getBucketUpperBound(uint32_t bucketIndex);
+
+    void record(uint64_t value) {
+        increment(buckets[getBucketIndex(value)], 1);
+        increment(totalValue, value);
+        if (value > maxValue.load(std::memory_order_relaxed)) {
+            maxValue.store(value, std::memory_order_relaxed);
+        }
+    }
+
+    void merge(const LatencyHistogram &other);
+
+    uint64_t getBucketCount(uint32_t bucketIndex) const { return buckets[bucketIndex].load(std::memory_order_relaxed); }
+    uint64_t getTotalValue() const { return totalValue.load(std::memory_order_relaxed); }
+    uint64_t getMaxValue() const { return maxValue.load(std::memory_order_relaxed); }
+
+  protected:
+    static void increment(std::atomic<uint64_t> &counter, uint64_t value) {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    std::array<std::atomic<uint64_t>, bucketCount> buckets = {};
+    std::atomic<uint64_t> totalValue{0};
+    std::atomic<uint64_t> maxValue{0};
+};
+
+struct ApiLatencySnapshot {
+    uint64_t callCount = 0;
+    uint64_t totalLatency = 0;
+    uint64_t maxLatency = 0;
+    uint64_t p50Latency = 0;
+    uint64_t p99Latency = 0;
+    uint64_t p999Latency = 0;
+};
+
+class ApiLatencyTracker : NEO::NonCopyableOrMovableClass {
+  public:
+    ApiLatencyTracker();
+    ~ApiLatencyTracker();
+
+    static const char *getFunctionName(cl_function_id functionId);
+
+    void record(cl_function_id functionId, uint64_t latency) {
+        getThreadHistogram(functionId)->record(latency);
+    }
+
+    ApiLatencySnapshot getSnapshot(cl_function_id functionId);
+    void printSnapshots(FILE *stream);
+
+  protected:
+    struct ThreadLatencies {
+        ~ThreadLatencies();
+        std::array<std::atomic<LatencyHistogram *>, CL_FUNCTION_COUNT> histograms = {};
+    };
+
+    // Shared with registered threads, so a thread exiting after tracker (or static) destruction
+    // merges its latencies into state it still keeps alive.
+    struct SharedState {
+        void unregisterThread(ThreadLatencies *exitingThreadLatencies);
+
+        std::vector<std::unique_ptr<ThreadLatencies>> threadLatencies;
+        ThreadLatencies exitedThreadsLatencies;
+        std::mutex mutex;
+    };
+
+    struct ThreadRegistration {
+        ~ThreadRegistration();
+        void release();
+
+        std::shared_ptr<SharedState> state;
+        ThreadLatencies *threadLatencies = nullptr;
+        uint32_t trackerGeneration = 0;
+    };
+    static thread_local ThreadRegistration threadRegistration;
+
+    LatencyHistogram *getThreadHistogram(cl_function_id functionId);
+    ThreadLatencies *registerThread();
+
+    std::shared_ptr<SharedState> state;
+    uint32_t generation;
+    bool printOnDestruction = false;
+};
+
+extern ApiLatencyTracker *pGlobalApiLatencyTracker;
+
+class ApiLatencyScope {
+  public:
+    ApiLatencyScope(cl_function_id functionId) {
+        if (NEO::DebugManager.flags.PrintOclApiLatencyHistograms.get()) {
+            this->functionId = functionId;
+            this->startTimestamp = getTimestamp();
+            this->enabled = true;
+        }
+    }
+
+    ~ApiLatencyScope() {
+        if (enabled) {
+            pGlobalApiLatencyTracker->record(functionId, getTimestamp() - startTimestamp);
+        }
+    }
+
+    static uint64_t getTimestamp() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+  protected:
+    uint64_t startTimestamp = 0;
+    cl_function_id functionId = CL_FUNCTION_COUNT;
+    bool enabled = false;
+};
+
+} // namespace HostSideTracing
@@ -10,6 +10,7 @@
 #include "shared/source/utilities/cpuintrinsics.h"
 
 #include "opencl/source/tracing/tracing_handle.h"
+#include "opencl/source/tracing/tracing_latency.h"
 
 #include <atomic>
 #include <thread>
@@ -30,6 +31,7 @@ namespace HostSideTracing {
 inline thread_local bool tracingInProgress = false;
 
 #define TRACING_ENTER(name, ...)                                                                                                                   \
+    HostSideTracing::ApiLatencyScope latencyScope_##name(HostSideTracing::name##Tracer::functionId);                                               \
     bool isHostSideTracingEnabled_##name = false;                                                                                                  \
     bool currentlyTracedCall = false;                                                                                                              \
     HostSideTracing::name##Tracer tracer_##name;                                                                                                   \
@@ -92,6 +94,8 @@ class AtomicBackoff {
 
 class ClBuildProgramTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clBuildProgram;
+
     ClBuildProgramTracer() {}
 
     void enter(cl_program *program,
@@ -163,6 +167,8 @@ class ClBuildProgramTracer {
 
 class ClCloneKernelTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clCloneKernel;
+
     ClCloneKernelTracer() {}
 
     void enter(cl_kernel *sourceKernel,
@@ -226,6 +232,8 @@ class ClCloneKernelTracer {
 
 class ClCompileProgramTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clCompileProgram;
+
     ClCompileProgramTracer() {}
 
     void enter(cl_program *program,
@@ -303,6 +311,8 @@ class ClCompileProgramTracer {
 
 class ClCreateBufferTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clCreateBuffer;
+
     ClCreateBufferTracer() {}
 
     void enter(cl_context *context,
@@ -372,6 +382,8 @@ class ClCreateBufferTracer {
 
 class ClCreateCommandQueueTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clCreateCommandQueue;
+
     ClCreateCommandQueueTracer() {}
 
     void enter(cl_context *context,
@@ -439,6 +451,8 @@ class ClCreateCommandQueueTracer {
 
 class ClCreateCommandQueueWithPropertiesTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clCreateCommandQueueWithProperties;
+
     ClCreateCommandQueueWithPropertiesTracer() {}
 
     void enter(cl_context *context,
@@ -506,6 +520,8 @@ class ClCreateCommandQueueWithPropertiesTracer {
 
 class ClCreateContextTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clCreateContext;
+
     ClCreateContextTracer() {}
 
     void enter(const cl_context_properties **properties,
@@ -577,6 +593,8 @@ class ClCreateContextTracer {
 
 class ClCreateContextFromTypeTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clCreateContextFromType;
+
     ClCreateContextFromTypeTracer() {}
 
     void enter(const cl_context_properties **properties,
@@ -646,6 +664,8 @@ class ClCreateContextFromTypeTracer {
 
 class ClCreateImageTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clCreateImage;
+
     ClCreateImageTracer() {}
 
     void enter(cl_context *context,
@@ -717,6 +737,8 @@ class ClCreateImageTracer {
 
 class ClCreateImage2DTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clCreateImage2D;
+
     ClCreateImage2DTracer() {}
 
     void enter(cl_context *context,
@@ -792,6 +814,8 @@ class ClCreateImage2DTracer {
 
 class ClCreateImage3DTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clCreateImage3D;
+
     ClCreateImage3DTracer() {}
 
     void enter(cl_context *context,
@@ -871,6 +895,8 @@ class ClCreateImage3DTracer {
 
 class ClCreateKernelTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clCreateKernel;
+
     ClCreateKernelTracer() {}
 
     void enter(cl_program *program,
@@ -936,6 +962,8 @@ class ClCreateKernelTracer {
 
 class ClCreateKernelsInProgramTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clCreateKernelsInProgram;
+
     ClCreateKernelsInProgramTracer() {}
 
     void enter(cl_program *program,
@@ -1003,6 +1031,8 @@ class ClCreateKernelsInProgramTracer {
 
 class ClCreateSubDevicesTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clCreateSubDevices;
+
     ClCreateSubDevicesTracer() {}
 
     void enter(cl_device_id *inDevice,
@@ -1072,6 +1102,8 @@ class ClCreateSubDevicesTracer {
 
 class ClCreatePipeTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clCreatePipe;
+
     ClCreatePipeTracer() {}
 
     void enter(cl_context *context,
@@ -1143,6 +1175,8 @@ class ClCreatePipeTracer {
 
 class ClCreateProgramWithBinaryTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clCreateProgramWithBinary;
+
     ClCreateProgramWithBinaryTracer() {}
 
     void enter(cl_context *context,
@@ -1216,6 +1250,8 @@ class ClCreateProgramWithBinaryTracer {
 
 class ClCreateProgramWithBuiltInKernelsTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clCreateProgramWithBuiltInKernels;
+
     ClCreateProgramWithBuiltInKernelsTracer() {}
 
     void enter(cl_context *context,
@@ -1285,6 +1321,8 @@ class ClCreateProgramWithBuiltInKernelsTracer {
 
 class ClCreateProgramWithIlTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clCreateProgramWithIL;
+
     ClCreateProgramWithIlTracer() {}
 
     void enter(cl_context *context,
@@ -1352,6 +1390,8 @@ class ClCreateProgramWithIlTracer {
 
 class ClCreateProgramWithSourceTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clCreateProgramWithSource;
+
     ClCreateProgramWithSourceTracer() {}
 
     void enter(cl_context *context,
@@ -1421,6 +1461,8 @@ class ClCreateProgramWithSourceTracer {
 
 class ClCreateSamplerTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clCreateSampler;
+
     ClCreateSamplerTracer() {}
 
     void enter(cl_context *context,
@@ -1490,6 +1532,8 @@ class ClCreateSamplerTracer {
 
 class ClCreateSamplerWithPropertiesTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clCreateSamplerWithProperties;
+
     ClCreateSamplerWithPropertiesTracer() {}
 
     void enter(cl_context *context,
@@ -1555,6 +1599,8 @@ class ClCreateSamplerWithPropertiesTracer {
 
 class ClCreateSubBufferTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clCreateSubBuffer;
+
     ClCreateSubBufferTracer() {}
 
     void enter(cl_mem *buffer,
@@ -1624,6 +1670,8 @@ class ClCreateSubBufferTracer {
 
 class ClCreateUserEventTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clCreateUserEvent;
+
     ClCreateUserEventTracer() {}
 
     void enter(cl_context *context,
@@ -1687,6 +1735,8 @@ class ClCreateUserEventTracer {
 
 class ClEnqueueBarrierTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clEnqueueBarrier;
+
     ClEnqueueBarrierTracer() {}
 
     void enter(cl_command_queue *commandQueue) {
@@ -1748,6 +1798,8 @@ class ClEnqueueBarrierTracer {
 
 class ClEnqueueBarrierWithWaitListTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clEnqueueBarrierWithWaitList;
+
     ClEnqueueBarrierWithWaitListTracer() {}
 
     void enter(cl_command_queue *commandQueue,
@@ -1815,6 +1867,8 @@ class ClEnqueueBarrierWithWaitListTracer {
 
 class ClEnqueueCopyBufferTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clEnqueueCopyBuffer;
+
     ClEnqueueCopyBufferTracer() {}
 
     void enter(cl_command_queue *commandQueue,
@@ -1892,6 +1946,8 @@ class ClEnqueueCopyBufferTracer {
 
 class ClEnqueueCopyBufferRectTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clEnqueueCopyBufferRect;
+
     ClEnqueueCopyBufferRectTracer() {}
 
     void enter(cl_command_queue *commandQueue,
@@ -1977,6 +2033,8 @@ class ClEnqueueCopyBufferRectTracer {
 
 class ClEnqueueCopyBufferToImageTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clEnqueueCopyBufferToImage;
+
     ClEnqueueCopyBufferToImageTracer() {}
 
     void enter(cl_command_queue *commandQueue,
@@ -2054,6 +2112,8 @@ class ClEnqueueCopyBufferToImageTracer {
 
 class ClEnqueueCopyImageTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clEnqueueCopyImage;
+
     ClEnqueueCopyImageTracer() {}
 
     void enter(cl_command_queue *commandQueue,
@@ -2131,6 +2191,8 @@ class ClEnqueueCopyImageTracer {
 
 class ClEnqueueCopyImageToBufferTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clEnqueueCopyImageToBuffer;
+
     ClEnqueueCopyImageToBufferTracer() {}
 
     void enter(cl_command_queue *commandQueue,
@@ -2208,6 +2270,8 @@ class ClEnqueueCopyImageToBufferTracer {
 
 class ClEnqueueFillBufferTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clEnqueueFillBuffer;
+
     ClEnqueueFillBufferTracer() {}
 
     void enter(cl_command_queue *commandQueue,
@@ -2285,6 +2349,8 @@ class ClEnqueueFillBufferTracer {
 
 class ClEnqueueFillImageTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clEnqueueFillImage;
+
     ClEnqueueFillImageTracer() {}
 
     void enter(cl_command_queue *commandQueue,
@@ -2360,6 +2426,8 @@ class ClEnqueueFillImageTracer {
 
 class ClEnqueueMapBufferTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clEnqueueMapBuffer;
+
     ClEnqueueMapBufferTracer() {}
 
     void enter(cl_command_queue *commandQueue,
@@ -2439,6 +2507,8 @@ class ClEnqueueMapBufferTracer {
 
 class ClEnqueueMapImageTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clEnqueueMapImage;
+
     ClEnqueueMapImageTracer() {}
 
     void enter(cl_command_queue *commandQueue,
@@ -2522,6 +2592,8 @@ class ClEnqueueMapImageTracer {
 
 class ClEnqueueMarkerTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clEnqueueMarker;
+
     ClEnqueueMarkerTracer() {}
 
     void enter(cl_command_queue *commandQueue,
@@ -2585,6 +2657,8 @@ class ClEnqueueMarkerTracer {
 
 class ClEnqueueMarkerWithWaitListTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clEnqueueMarkerWithWaitList;
+
     ClEnqueueMarkerWithWaitListTracer() {}
 
     void enter(cl_command_queue *commandQueue,
@@ -2652,6 +2726,8 @@ class ClEnqueueMarkerWithWaitListTracer {
 
 class ClEnqueueMigrateMemObjectsTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clEnqueueMigrateMemObjects;
+
     ClEnqueueMigrateMemObjectsTracer() {}
 
     void enter(cl_command_queue *commandQueue,
@@ -2725,6 +2801,8 @@ class ClEnqueueMigrateMemObjectsTracer {
 
 class ClEnqueueNdRangeKernelTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clEnqueueNDRangeKernel;
+
     ClEnqueueNdRangeKernelTracer() {}
 
     void enter(cl_command_queue *commandQueue,
@@ -2802,6 +2880,8 @@ class ClEnqueueNdRangeKernelTracer {
 
 class ClEnqueueNativeKernelTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clEnqueueNativeKernel;
+
     ClEnqueueNativeKernelTracer() {}
 
     void enter(cl_command_queue *commandQueue,
@@ -2881,6 +2961,8 @@ class ClEnqueueNativeKernelTracer {
 
 class ClEnqueueReadBufferTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clEnqueueReadBuffer;
+
     ClEnqueueReadBufferTracer() {}
 
     void enter(cl_command_queue *commandQueue,
@@ -2958,6 +3040,8 @@ class ClEnqueueReadBufferTracer {
 
 class ClEnqueueReadBufferRectTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clEnqueueReadBufferRect;
+
     ClEnqueueReadBufferRectTracer() {}
 
     void enter(cl_command_queue *commandQueue,
@@ -3045,6 +3129,8 @@ class ClEnqueueReadBufferRectTracer {
 
 class ClEnqueueReadImageTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clEnqueueReadImage;
+
     ClEnqueueReadImageTracer() {}
 
     void enter(cl_command_queue *commandQueue,
@@ -3126,6 +3212,8 @@ class ClEnqueueReadImageTracer {
 
 class ClEnqueueSvmFreeTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clEnqueueSVMFree;
+
     ClEnqueueSvmFreeTracer() {}
 
     void enter(cl_command_queue *commandQueue,
@@ -3201,6 +3289,8 @@ class ClEnqueueSvmFreeTracer {
 
 class ClEnqueueSvmMapTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clEnqueueSVMMap;
+
     ClEnqueueSvmMapTracer() {}
 
     void enter(cl_command_queue *commandQueue,
@@ -3276,6 +3366,8 @@ class ClEnqueueSvmMapTracer {
 
 class ClEnqueueSvmMemFillTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clEnqueueSVMMemFill;
+
     ClEnqueueSvmMemFillTracer() {}
 
     void enter(cl_command_queue *commandQueue,
@@ -3351,6 +3443,8 @@ class ClEnqueueSvmMemFillTracer {
 
 class ClEnqueueSvmMemcpyTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clEnqueueSVMMemcpy;
+
     ClEnqueueSvmMemcpyTracer() {}
 
     void enter(cl_command_queue *commandQueue,
@@ -3426,6 +3520,8 @@ class ClEnqueueSvmMemcpyTracer {
 
 class ClEnqueueSvmMigrateMemTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clEnqueueSVMMigrateMem;
+
     ClEnqueueSvmMigrateMemTracer() {}
 
     void enter(cl_command_queue *commandQueue,
@@ -3501,6 +3597,8 @@ class ClEnqueueSvmMigrateMemTracer {
 
 class ClEnqueueSvmUnmapTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clEnqueueSVMUnmap;
+
     ClEnqueueSvmUnmapTracer() {}
 
     void enter(cl_command_queue *commandQueue,
@@ -3570,6 +3668,8 @@ class ClEnqueueSvmUnmapTracer {
 
 class ClEnqueueTaskTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clEnqueueTask;
+
     ClEnqueueTaskTracer() {}
 
     void enter(cl_command_queue *commandQueue,
@@ -3639,6 +3739,8 @@ class ClEnqueueTaskTracer {
 
 class ClEnqueueUnmapMemObjectTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clEnqueueUnmapMemObject;
+
     ClEnqueueUnmapMemObjectTracer() {}
 
     void enter(cl_command_queue *commandQueue,
@@ -3710,6 +3812,8 @@ class ClEnqueueUnmapMemObjectTracer {
 
 class ClEnqueueWaitForEventsTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clEnqueueWaitForEvents;
+
     ClEnqueueWaitForEventsTracer() {}
 
     void enter(cl_command_queue *commandQueue,
@@ -3775,6 +3879,8 @@ class ClEnqueueWaitForEventsTracer {
 
 class ClEnqueueWriteBufferTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clEnqueueWriteBuffer;
+
     ClEnqueueWriteBufferTracer() {}
 
     void enter(cl_command_queue *commandQueue,
@@ -3852,6 +3958,8 @@ class ClEnqueueWriteBufferTracer {
 
 class ClEnqueueWriteBufferRectTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clEnqueueWriteBufferRect;
+
     ClEnqueueWriteBufferRectTracer() {}
 
     void enter(cl_command_queue *commandQueue,
@@ -3939,6 +4047,8 @@ class ClEnqueueWriteBufferRectTracer {
 
 class ClEnqueueWriteImageTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clEnqueueWriteImage;
+
     ClEnqueueWriteImageTracer() {}
 
     void enter(cl_command_queue *commandQueue,
@@ -4020,6 +4130,8 @@ class ClEnqueueWriteImageTracer {
 
 class ClFinishTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clFinish;
+
     ClFinishTracer() {}
 
     void enter(cl_command_queue *commandQueue) {
@@ -4081,6 +4193,8 @@ class ClFinishTracer {
 
 class ClFlushTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clFlush;
+
     ClFlushTracer() {}
 
     void enter(cl_command_queue *commandQueue) {
@@ -4142,6 +4256,8 @@ class ClFlushTracer {
 
 class ClGetCommandQueueInfoTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clGetCommandQueueInfo;
+
     ClGetCommandQueueInfoTracer() {}
 
     void enter(cl_command_queue *commandQueue,
@@ -4211,6 +4327,8 @@ class ClGetCommandQueueInfoTracer {
 
 class ClGetContextInfoTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clGetContextInfo;
+
     ClGetContextInfoTracer() {}
 
     void enter(cl_context *context,
@@ -4280,6 +4398,8 @@ class ClGetContextInfoTracer {
 
 class ClGetDeviceAndHostTimerTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clGetDeviceAndHostTimer;
+
     ClGetDeviceAndHostTimerTracer() {}
 
     void enter(cl_device_id *device,
@@ -4345,6 +4465,8 @@ class ClGetDeviceAndHostTimerTracer {
 
 class ClGetDeviceIDsTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clGetDeviceIDs;
+
     ClGetDeviceIDsTracer() {}
 
     void enter(cl_platform_id *platform,
@@ -4414,6 +4536,8 @@ class ClGetDeviceIDsTracer {
 
 class ClGetDeviceInfoTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clGetDeviceInfo;
+
     ClGetDeviceInfoTracer() {}
 
     void enter(cl_device_id *device,
@@ -4483,6 +4607,8 @@ class ClGetDeviceInfoTracer {
 
 class ClGetEventInfoTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clGetEventInfo;
+
     ClGetEventInfoTracer() {}
 
     void enter(cl_event *event,
@@ -4552,6 +4678,8 @@ class ClGetEventInfoTracer {
 
 class ClGetEventProfilingInfoTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clGetEventProfilingInfo;
+
     ClGetEventProfilingInfoTracer() {}
 
     void enter(cl_event *event,
@@ -4621,6 +4749,8 @@ class ClGetEventProfilingInfoTracer {
 
 class ClGetExtensionFunctionAddressTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clGetExtensionFunctionAddress;
+
     ClGetExtensionFunctionAddressTracer() {}
 
     void enter(const char **funcName) {
@@ -4682,6 +4812,8 @@ class ClGetExtensionFunctionAddressTracer {
 
 class ClGetExtensionFunctionAddressForPlatformTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clGetExtensionFunctionAddressForPlatform;
+
     ClGetExtensionFunctionAddressForPlatformTracer() {}
 
     void enter(cl_platform_id *platform,
@@ -4745,6 +4877,8 @@ class ClGetExtensionFunctionAddressForPlatformTracer {
 
 class ClGetHostTimerTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clGetHostTimer;
+
     ClGetHostTimerTracer() {}
 
     void enter(cl_device_id *device,
@@ -4808,6 +4942,8 @@ class ClGetHostTimerTracer {
 
 class ClGetImageInfoTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clGetImageInfo;
+
     ClGetImageInfoTracer() {}
 
     void enter(cl_mem *image,
@@ -4877,6 +5013,8 @@ class ClGetImageInfoTracer {
 
 class ClGetKernelArgInfoTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clGetKernelArgInfo;
+
     ClGetKernelArgInfoTracer() {}
 
     void enter(cl_kernel *kernel,
@@ -4948,6 +5086,8 @@ class ClGetKernelArgInfoTracer {
 
 class ClGetKernelInfoTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clGetKernelInfo;
+
     ClGetKernelInfoTracer() {}
 
     void enter(cl_kernel *kernel,
@@ -5017,6 +5157,8 @@ class ClGetKernelInfoTracer {
 
 class ClGetKernelSubGroupInfoTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clGetKernelSubGroupInfo;
+
     ClGetKernelSubGroupInfoTracer() {}
 
     void enter(cl_kernel *kernel,
@@ -5092,6 +5234,8 @@ class ClGetKernelSubGroupInfoTracer {
 
 class ClGetKernelWorkGroupInfoTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clGetKernelWorkGroupInfo;
+
     ClGetKernelWorkGroupInfoTracer() {}
 
     void enter(cl_kernel *kernel,
@@ -5163,6 +5307,8 @@ class ClGetKernelWorkGroupInfoTracer {
 
 class ClGetMemObjectInfoTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clGetMemObjectInfo;
+
     ClGetMemObjectInfoTracer() {}
 
     void enter(cl_mem *memobj,
@@ -5232,6 +5378,8 @@ class ClGetMemObjectInfoTracer {
 
 class ClGetPipeInfoTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clGetPipeInfo;
+
     ClGetPipeInfoTracer() {}
 
     void enter(cl_mem *pipe,
@@ -5301,6 +5449,8 @@ class ClGetPipeInfoTracer {
 
 class ClGetPlatformIDsTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clGetPlatformIDs;
+
     ClGetPlatformIDsTracer() {}
 
     void enter(cl_uint *numEntries,
@@ -5366,6 +5516,8 @@ class ClGetPlatformIDsTracer {
 
 class ClGetPlatformInfoTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clGetPlatformInfo;
+
     ClGetPlatformInfoTracer() {}
 
     void enter(cl_platform_id *platform,
@@ -5435,6 +5587,8 @@ class ClGetPlatformInfoTracer {
 
 class ClGetProgramBuildInfoTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clGetProgramBuildInfo;
+
     ClGetProgramBuildInfoTracer() {}
 
     void enter(cl_program *program,
@@ -5506,6 +5660,8 @@ class ClGetProgramBuildInfoTracer {
 
 class ClGetProgramInfoTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clGetProgramInfo;
+
     ClGetProgramInfoTracer() {}
 
     void enter(cl_program *program,
@@ -5575,6 +5731,8 @@ class ClGetProgramInfoTracer {
 
 class ClGetSamplerInfoTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clGetSamplerInfo;
+
     ClGetSamplerInfoTracer() {}
 
     void enter(cl_sampler *sampler,
@@ -5644,6 +5802,8 @@ class ClGetSamplerInfoTracer {
 
 class ClGetSupportedImageFormatsTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clGetSupportedImageFormats;
+
     ClGetSupportedImageFormatsTracer() {}
 
     void enter(cl_context *context,
@@ -5715,6 +5875,8 @@ class ClGetSupportedImageFormatsTracer {
 
 class ClLinkProgramTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clLinkProgram;
+
     ClLinkProgramTracer() {}
 
     void enter(cl_context *context,
@@ -5792,6 +5954,8 @@ class ClLinkProgramTracer {
 
 class ClReleaseCommandQueueTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clReleaseCommandQueue;
+
     ClReleaseCommandQueueTracer() {}
 
     void enter(cl_command_queue *commandQueue) {
@@ -5853,6 +6017,8 @@ class ClReleaseCommandQueueTracer {
 
 class ClReleaseContextTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clReleaseContext;
+
     ClReleaseContextTracer() {}
 
     void enter(cl_context *context) {
@@ -5914,6 +6080,8 @@ class ClReleaseContextTracer {
 
 class ClReleaseDeviceTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clReleaseDevice;
+
     ClReleaseDeviceTracer() {}
 
     void enter(cl_device_id *device) {
@@ -5975,6 +6143,8 @@ class ClReleaseDeviceTracer {
 
 class ClReleaseEventTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clReleaseEvent;
+
     ClReleaseEventTracer() {}
 
     void enter(cl_event *event) {
@@ -6036,6 +6206,8 @@ class ClReleaseEventTracer {
 
 class ClReleaseKernelTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clReleaseKernel;
+
     ClReleaseKernelTracer() {}
 
     void enter(cl_kernel *kernel) {
@@ -6097,6 +6269,8 @@ class ClReleaseKernelTracer {
 
 class ClReleaseMemObjectTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clReleaseMemObject;
+
     ClReleaseMemObjectTracer() {}
 
     void enter(cl_mem *memobj) {
@@ -6158,6 +6332,8 @@ class ClReleaseMemObjectTracer {
 
 class ClReleaseProgramTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clReleaseProgram;
+
     ClReleaseProgramTracer() {}
 
     void enter(cl_program *program) {
@@ -6219,6 +6395,8 @@ class ClReleaseProgramTracer {
 
 class ClReleaseSamplerTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clReleaseSampler;
+
     ClReleaseSamplerTracer() {}
 
     void enter(cl_sampler *sampler) {
@@ -6280,6 +6458,8 @@ class ClReleaseSamplerTracer {
 
 class ClRetainCommandQueueTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clRetainCommandQueue;
+
     ClRetainCommandQueueTracer() {}
 
     void enter(cl_command_queue *commandQueue) {
@@ -6341,6 +6521,8 @@ class ClRetainCommandQueueTracer {
 
 class ClRetainContextTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clRetainContext;
+
     ClRetainContextTracer() {}
 
     void enter(cl_context *context) {
@@ -6402,6 +6584,8 @@ class ClRetainContextTracer {
 
 class ClRetainDeviceTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clRetainDevice;
+
     ClRetainDeviceTracer() {}
 
     void enter(cl_device_id *device) {
@@ -6463,6 +6647,8 @@ class ClRetainDeviceTracer {
 
 class ClRetainEventTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clRetainEvent;
+
     ClRetainEventTracer() {}
 
     void enter(cl_event *event) {
@@ -6524,6 +6710,8 @@ class ClRetainEventTracer {
 
 class ClRetainKernelTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clRetainKernel;
+
     ClRetainKernelTracer() {}
 
     void enter(cl_kernel *kernel) {
@@ -6585,6 +6773,8 @@ class ClRetainKernelTracer {
 
 class ClRetainMemObjectTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clRetainMemObject;
+
     ClRetainMemObjectTracer() {}
 
     void enter(cl_mem *memobj) {
@@ -6646,6 +6836,8 @@ class ClRetainMemObjectTracer {
 
 class ClRetainProgramTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clRetainProgram;
+
     ClRetainProgramTracer() {}
 
     void enter(cl_program *program) {
@@ -6707,6 +6899,8 @@ class ClRetainProgramTracer {
 
 class ClRetainSamplerTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clRetainSampler;
+
     ClRetainSamplerTracer() {}
 
     void enter(cl_sampler *sampler) {
@@ -6768,6 +6962,8 @@ class ClRetainSamplerTracer {
 
 class ClSvmAllocTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clSVMAlloc;
+
     ClSvmAllocTracer() {}
 
     void enter(cl_context *context,
@@ -6835,6 +7031,8 @@ class ClSvmAllocTracer {
 
 class ClSvmFreeTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clSVMFree;
+
     ClSvmFreeTracer() {}
 
     void enter(cl_context *context,
@@ -6898,6 +7096,8 @@ class ClSvmFreeTracer {
 
 class ClSetCommandQueuePropertyTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clSetCommandQueueProperty;
+
     ClSetCommandQueuePropertyTracer() {}
 
     void enter(cl_command_queue *commandQueue,
@@ -6965,6 +7165,8 @@ class ClSetCommandQueuePropertyTracer {
 
 class ClSetDefaultDeviceCommandQueueTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clSetDefaultDeviceCommandQueue;
+
     ClSetDefaultDeviceCommandQueueTracer() {}
 
     void enter(cl_context *context,
@@ -7030,6 +7232,8 @@ class ClSetDefaultDeviceCommandQueueTracer {
 
 class ClSetEventCallbackTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clSetEventCallback;
+
     ClSetEventCallbackTracer() {}
 
     void enter(cl_event *event,
@@ -7097,6 +7301,8 @@ class ClSetEventCallbackTracer {
 
 class ClSetKernelArgTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clSetKernelArg;
+
     ClSetKernelArgTracer() {}
 
     void enter(cl_kernel *kernel,
@@ -7164,6 +7370,8 @@ class ClSetKernelArgTracer {
 
 class ClSetKernelArgSvmPointerTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clSetKernelArgSVMPointer;
+
     ClSetKernelArgSvmPointerTracer() {}
 
     void enter(cl_kernel *kernel,
@@ -7229,6 +7437,8 @@ class ClSetKernelArgSvmPointerTracer {
 
 class ClSetKernelExecInfoTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clSetKernelExecInfo;
+
     ClSetKernelExecInfoTracer() {}
 
     void enter(cl_kernel *kernel,
@@ -7296,6 +7506,8 @@ class ClSetKernelExecInfoTracer {
 
 class ClSetMemObjectDestructorCallbackTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clSetMemObjectDestructorCallback;
+
     ClSetMemObjectDestructorCallbackTracer() {}
 
     void enter(cl_mem *memobj,
@@ -7361,6 +7573,8 @@ class ClSetMemObjectDestructorCallbackTracer {
 
 class ClSetUserEventStatusTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clSetUserEventStatus;
+
     ClSetUserEventStatusTracer() {}
 
     void enter(cl_event *event,
@@ -7424,6 +7638,8 @@ class ClSetUserEventStatusTracer {
 
 class ClUnloadCompilerTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clUnloadCompiler;
+
     ClUnloadCompilerTracer() {}
 
     void enter() {
@@ -7482,6 +7698,8 @@ class ClUnloadCompilerTracer {
 
 class ClUnloadPlatformCompilerTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clUnloadPlatformCompiler;
+
     ClUnloadPlatformCompilerTracer() {}
 
     void enter(cl_platform_id *platform) {
@@ -7543,6 +7761,8 @@ class ClUnloadPlatformCompilerTracer {
 
 class ClWaitForEventsTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clWaitForEvents;
+
     ClWaitForEventsTracer() {}
 
     void enter(cl_uint *numEvents,
@@ -7606,6 +7826,8 @@ class ClWaitForEventsTracer {
 
 class ClCreateFromGlBufferTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clCreateFromGLBuffer;
+
     ClCreateFromGlBufferTracer() {}
 
     void enter(cl_context *context,
@@ -7673,6 +7895,8 @@ class ClCreateFromGlBufferTracer {
 
 class ClCreateFromGlRenderbufferTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clCreateFromGLRenderbuffer;
+
     ClCreateFromGlRenderbufferTracer() {}
 
     void enter(cl_context *context,
@@ -7740,6 +7964,8 @@ class ClCreateFromGlRenderbufferTracer {
 
 class ClCreateFromGlTextureTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clCreateFromGLTexture;
+
     ClCreateFromGlTextureTracer() {}
 
     void enter(cl_context *context,
@@ -7811,6 +8037,8 @@ class ClCreateFromGlTextureTracer {
 
 class ClCreateFromGlTexture2DTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clCreateFromGLTexture2D;
+
     ClCreateFromGlTexture2DTracer() {}
 
     void enter(cl_context *context,
@@ -7882,6 +8110,8 @@ class ClCreateFromGlTexture2DTracer {
 
 class ClCreateFromGlTexture3DTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clCreateFromGLTexture3D;
+
     ClCreateFromGlTexture3DTracer() {}
 
     void enter(cl_context *context,
@@ -7953,6 +8183,8 @@ class ClCreateFromGlTexture3DTracer {
 
 class ClEnqueueAcquireGlObjectsTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clEnqueueAcquireGLObjects;
+
     ClEnqueueAcquireGlObjectsTracer() {}
 
     void enter(cl_command_queue *commandQueue,
@@ -8024,6 +8256,8 @@ class ClEnqueueAcquireGlObjectsTracer {
 
 class ClEnqueueReleaseGlObjectsTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clEnqueueReleaseGLObjects;
+
     ClEnqueueReleaseGlObjectsTracer() {}
 
     void enter(cl_command_queue *commandQueue,
@@ -8095,6 +8329,8 @@ class ClEnqueueReleaseGlObjectsTracer {
 
 class ClGetGlObjectInfoTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clGetGLObjectInfo;
+
     ClGetGlObjectInfoTracer() {}
 
     void enter(cl_mem *memobj,
@@ -8160,6 +8396,8 @@ class ClGetGlObjectInfoTracer {
 
 class ClGetGlTextureInfoTracer {
   public:
+    static constexpr cl_function_id functionId = CL_FUNCTION_clGetGLTextureInfo;
+
     ClGetGlTextureInfoTracer() {}
 
     void enter(cl_mem *memobj,
@@ -5,7 +5,10 @@
  *
  */
 
+#include "shared/test/common/helpers/variable_backup.h"
+
 #include "opencl/source/tracing/tracing_api.h"
+#include "opencl/source/tracing/tracing_latency.h"
 #include "opencl/source/tracing/tracing_notify.h"
 #include "opencl/test/unit_test/api/cl_api_tests.h"
 #include "opencl/test/unit_test/fixtures/platform_fixture.h"
@@ -1205,4 +1208,114 @@ TEST_F(IntelClCreateSubDevicesTracingTest, givenCreateSubDevicesCallTracingEnabl
     EXPECT_EQ(1u, exitCount);
 }
 
+TEST(LatencyHistogramTest, givenValuesWhenGettingBucketIndexThenSmallValuesAreExactAndLargeValuesHaveBoundedRelativeError) {
+    using HostSideTracing::LatencyHistogram;
+    for (uint64_t value = 0; value < LatencyHistogram::subBucketCount; value++) {
+        EXPECT_EQ(value, LatencyHistogram::getBucketIndex(value));
+        EXPECT_EQ(value, LatencyHistogram::getBucketUpperBound(LatencyHistogram::getBucketIndex(value)));
+    }
+
+    uint32_t previousIndex = 0;
+    for (uint64_t value = LatencyHistogram::subBucketCount; value < (1ull << 20); value += 7) {
+        auto index = LatencyHistogram::getBucketIndex(value);
+        auto upperBound = LatencyHistogram::getBucketUpperBound(index);
+        EXPECT_GE(index, previousIndex);
+        EXPECT_LE(value, upperBound);
+        EXPECT_LE(upperBound - value, value / LatencyHistogram::subBucketCount);
+        previousIndex = index;
+    }
+
+    EXPECT_EQ(LatencyHistogram::bucketCount - 1, LatencyHistogram::getBucketIndex(std::numeric_limits<uint64_t>::max()));
+}
+
+TEST(ApiLatencyTrackerTest, givenLatenciesRecordedFromMultipleThreadsWhenGettingSnapshotThenCountsAndPercentilesAreAggregated) {
+    HostSideTracing::ApiLatencyTracker tracker;
+
+    for (uint64_t latency = 1; latency <= 500; latency++) {
+        tracker.record(CL_FUNCTION_clSetKernelArg, latency);
+    }
+    std::thread otherThread([&]() {
+        for (uint64_t latency = 501; latency <= 1000; latency++) {
+            tracker.record(CL_FUNCTION_clSetKernelArg, latency);
+        }
+    });
+    otherThread.join();
+
+    auto snapshot = tracker.getSnapshot(CL_FUNCTION_clSetKernelArg);
+    EXPECT_EQ(1000u, snapshot.callCount);
+    EXPECT_EQ(500500u, snapshot.totalLatency);
+    EXPECT_EQ(1000u, snapshot.maxLatency);
+    EXPECT_GE(snapshot.p50Latency, 500u);
+    EXPECT_LE(snapshot.p50Latency, 500u + 500u / HostSideTracing::LatencyHistogram::subBucketCount);
+    EXPECT_GE(snapshot.p99Latency, 990u);
+    EXPECT_LE(snapshot.p99Latency, 1000u);
+    EXPECT_GE(snapshot.p999Latency, 999u);
+    EXPECT_LE(snapshot.p999Latency, 1000u);
+
+    EXPECT_EQ(0u, tracker.getSnapshot(CL_FUNCTION_clFinish).callCount);
+    EXPECT_STREQ("clSetKernelArg", HostSideTracing::ApiLatencyTracker::getFunctionName(CL_FUNCTION_clSetKernelArg));
+    EXPECT_STREQ("clWaitForEvents", HostSideTracing::ApiLatencyTracker::getFunctionName(CL_FUNCTION_clWaitForEvents));
+}
+
+TEST(ApiLatencyTrackerTest, givenRecordedLatenciesWhenPrintingSnapshotsThenOnlyCalledApisArePrinted) {
+    HostSideTracing::ApiLatencyTracker tracker;
+    tracker.record(CL_FUNCTION_clFinish, 100);
+
+    testing::internal::CaptureStdout();
+    tracker.printSnapshots(stdout);
+    auto output = testing::internal::GetCapturedStdout();
+
+    EXPECT_NE(std::string::npos, output.find("clFinish"));
+    EXPECT_EQ(std::string::npos, output.find("clEnqueueNDRangeKernel"));
+}
+
+TEST(ApiLatencyTrackerTest, givenPrintOclApiLatencyHistogramsDisabledWhenDestroyingTrackerWithRecordedLatenciesThenNothingIsPrinted) {
+    auto tracker = std::make_unique<HostSideTracing::ApiLatencyTracker>();
+    tracker->record(CL_FUNCTION_clFinish, 100);
+
+    testing::internal::CaptureStdout();
+    tracker.reset();
+    EXPECT_TRUE(testing::internal::GetCapturedStdout().empty());
+}
+
+TEST(ApiLatencyTrackerTest, givenThreadWhichExitedWhenGettingSnapshotThenItsLatenciesAreMergedAndItsRegistrationIsFreed) {
+    struct MockApiLatencyTracker : HostSideTracing::ApiLatencyTracker {
+        using HostSideTracing::ApiLatencyTracker::state;
+    };
+    MockApiLatencyTracker tracker;
+    tracker.record(CL_FUNCTION_clFlush, 10);
+
+    for (uint64_t latency : {20u, 30u}) {
+        std::thread otherThread([&]() {
+            tracker.record(CL_FUNCTION_clFlush, latency);
+        });
+        otherThread.join();
+    }
+    EXPECT_EQ(1u, tracker.state->threadLatencies.size());
+
+    auto snapshot = tracker.getSnapshot(CL_FUNCTION_clFlush);
+    EXPECT_EQ(3u, snapshot.callCount);
+    EXPECT_EQ(60u, snapshot.totalLatency);
+    EXPECT_EQ(30u, snapshot.maxLatency);
+}
+
+TEST(ApiLatencyTrackerTest, givenPrintOclApiLatencyHistogramsWhenCallingApiThenLatencyIsRecordedOnlyWhenEnabled) {
+    DebugManagerStateRestore restorer;
+    auto tracker = std::make_unique<HostSideTracing::ApiLatencyTracker>();
+    VariableBackup<HostSideTracing::ApiLatencyTracker *> trackerBackup(&HostSideTracing::pGlobalApiLatencyTracker, tracker.get());
+
+    clFinish(nullptr);
+    EXPECT_EQ(0u, tracker->getSnapshot(CL_FUNCTION_clFinish).callCount);
+
+    DebugManager.flags.PrintOclApiLatencyHistograms.set(true);
+    clFinish(nullptr);
+    clFinish(nullptr);
+    EXPECT_EQ(2u, tracker->getSnapshot(CL_FUNCTION_clFinish).callCount);
+
+    DebugManager.flags.PrintOclApiLatencyHistograms.set(false);
+    testing::internal::CaptureStdout();
+    tracker.reset();
+    EXPECT_NE(std::string::npos, testing::internal::GetCapturedStdout().find("clFinish"));
+}
+
 } // namespace ULT
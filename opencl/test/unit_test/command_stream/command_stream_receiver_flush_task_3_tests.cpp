@@ -1551,6 +1551,40 @@ HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInBatchingModeWhenPipeCont
     EXPECT_NE(itorPipeControl, itorBatchBufferStartSecond);
 }
 
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInBatchingModeWhenThreeTasksAreMergedThenAggregationStatsReportSavedCommands) {
+    CommandQueueHw<FamilyType> commandQueue(nullptr, pClDevice, 0, false);
+    auto &commandStream = commandQueue.getCS(4096u);
+
+    auto mockCsr = new MockCsrHw2<FamilyType>(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    pDevice->resetCommandStreamReceiver(mockCsr);
+    mockCsr->useNewResourceImplicitFlush = false;
+    mockCsr->useGpuIdleImplicitFlush = false;
+    mockCsr->overrideDispatchPolicy(DispatchMode::BatchedDispatch);
+
+    auto mockedSubmissionsAggregator = new MockSubmissionsAggregator();
+    mockCsr->overrideSubmissionAggregator(mockedSubmissionsAggregator);
+
+    DispatchFlags dispatchFlags = DispatchFlagsHelper::createDefaultDispatchFlags();
+    dispatchFlags.preemptionMode = PreemptionHelper::getDefaultPreemptionMode(pDevice->getHardwareInfo());
+    dispatchFlags.guardCommandBufferWithPipeControl = true;
+    dispatchFlags.outOfOrderExecutionAllowed = true;
+
+    auto taskLevelPriorToSubmission = mockCsr->peekTaskLevel();
+    for (uint32_t i = 0; i < 3; i++) {
+        mockCsr->flushTask(commandStream, 0, &dsh, &ioh, &ssh, taskLevelPriorToSubmission, dispatchFlags, *pDevice);
+    }
+
+    mockCsr->flushBatchedSubmissions();
+
+    auto &aggregationStats = mockedSubmissionsAggregator->peekAggregationStats();
+    auto pipeControlSize = MemorySynchronizationCommands<FamilyType>::getSizeForBarrierWithPostSyncOperation(pDevice->getRootDeviceEnvironment(), false);
+    EXPECT_EQ(2u, aggregationStats.commandBuffersMerged);
+    EXPECT_EQ(2u, aggregationStats.pipeControlsErased);
+    EXPECT_EQ(aggregationStats.pipeControlsErased * pipeControlSize + aggregationStats.batchBufferStartsElided * sizeof(typename FamilyType::MI_BATCH_BUFFER_START),
+              aggregationStats.commandBytesSaved);
+    EXPECT_NE(0u, aggregationStats.residencyEntriesCoalesced);
+}
+
 HWTEST_F(CommandStreamReceiverFlushTaskTests,
          givenCsrInBatchingModeWhenThreeTasksArePassedWithTheSameLevelThenThereIsNoPipeControlBetweenThemAfterFlush) {
     CommandQueueHw<FamilyType> commandQueue(nullptr, pClDevice, 0, false);
@@ -104,6 +104,47 @@ TEST(SubmissionsAggregator, givenTwoCommandBuffersWhenMergeResourcesIsCalledThen
     EXPECT_EQ(21u, totalUsedSize);
 }
 
+TEST(SubmissionsAggregator, givenTwoCommandBuffersWithSharedResourcesWhenAggregatedThenStatsReportMergedBufferAndCoalescedResidency) {
+    MockSubmissionAggregator submissionsAggregator;
+
+    std::unique_ptr<Device> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    CommandBuffer *cmdBuffer = new CommandBuffer(*device);
+    CommandBuffer *cmdBuffer2 = new CommandBuffer(*device);
+
+    MockGraphicsAllocation alloc1(nullptr, 1);
+    MockGraphicsAllocation alloc2(nullptr, 2);
+    MockGraphicsAllocation alloc3(nullptr, 3);
+
+    cmdBuffer->surfaces.push_back(&alloc1);
+    cmdBuffer->surfaces.push_back(&alloc2);
+    cmdBuffer->surfaces.push_back(&alloc1);
+
+    cmdBuffer2->surfaces.push_back(&alloc1);
+    cmdBuffer2->surfaces.push_back(&alloc2);
+    cmdBuffer2->surfaces.push_back(&alloc3);
+
+    submissionsAggregator.recordCommandBuffer(cmdBuffer);
+    submissionsAggregator.recordCommandBuffer(cmdBuffer2);
+
+    size_t totalUsedSize = 0;
+    size_t totalMemoryBudget = -1;
+    ResourcePackage resourcePackage;
+    submissionsAggregator.aggregateCommandBuffers(resourcePackage, totalUsedSize, totalMemoryBudget, 0u);
+
+    EXPECT_EQ(3u, resourcePackage.size());
+    auto &aggregationStats = submissionsAggregator.peekAggregationStats();
+    EXPECT_EQ(1u, aggregationStats.commandBuffersMerged);
+    EXPECT_EQ(3u, aggregationStats.residencyEntriesCoalesced);
+
+    submissionsAggregator.peekCommandBuffersList().removeFrontOne();
+    submissionsAggregator.peekCommandBuffersList().removeFrontOne();
+    resourcePackage.clear();
+    submissionsAggregator.aggregateCommandBuffers(resourcePackage, totalUsedSize, totalMemoryBudget, 0u);
+
+    EXPECT_EQ(0u, aggregationStats.commandBuffersMerged);
+    EXPECT_EQ(0u, aggregationStats.residencyEntriesCoalesced);
+}
+
 TEST(SubmissionsAggregator, givenSubmissionAggregatorWhenThreeCommandBuffersAreSubmittedThenTheyAreAggregated) {
     MockSubmissionAggregator submissionsAggregator;
 
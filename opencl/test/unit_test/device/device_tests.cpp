@@ -10,6 +10,7 @@
 #include "shared/source/helpers/bit_helpers.h"
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/indirect_heap/indirect_heap.h"
+#include "shared/source/kernel/local_ids_cache.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/os_inc_base.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
@@ -128,6 +129,15 @@ TEST_F(DeviceTest, WhenRetainingThenReferenceIsOneAndApiIsUsed) {
     ASSERT_EQ(1, pClDevice->getReference());
 }
 
+TEST_F(DeviceTest, givenSameLocalIdsLayoutWhenGettingLocalIdsCacheThenCacheIsSharedAndDifferentLayoutGetsSeparateCache) {
+    auto localIdsCache = pClDevice->getLocalIdsCache({0, 1, 2}, 16u, 32u, false);
+    ASSERT_NE(nullptr, localIdsCache);
+    EXPECT_EQ(localIdsCache, pClDevice->getLocalIdsCache({0, 1, 2}, 16u, 32u, false));
+    EXPECT_NE(localIdsCache, pClDevice->getLocalIdsCache({0, 1, 2}, 32u, 32u, false));
+    EXPECT_NE(localIdsCache, pClDevice->getLocalIdsCache({1, 0, 2}, 16u, 32u, false));
+    EXPECT_NE(localIdsCache, pClDevice->getLocalIdsCache({0, 1, 2}, 16u, 32u, true));
+}
+
 TEST_F(DeviceTest, givenNoPciBusInfoThenIsPciBusInfoValidReturnsFalse) {
     PhysicalDevicePciBusInfo invalidPciBusInfoList[] = {
         PhysicalDevicePciBusInfo(0, 1, 2, PhysicalDevicePciBusInfo::invalidValue),
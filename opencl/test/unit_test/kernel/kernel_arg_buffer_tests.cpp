@@ -55,6 +55,56 @@ TEST_F(KernelArgBufferTest, GivenValidBufferWhenSettingKernelArgThenBufferAddres
     delete buffer;
 }
 
+TEST_F(KernelArgBufferTest, GivenSameBufferWhenSettingKernelArgAgainThenArgumentIsNotPatchedAgain) {
+    MockBuffer buffer;
+    cl_mem val = &buffer;
+
+    EXPECT_EQ(CL_SUCCESS, this->pKernel->setArg(0, sizeof(cl_mem *), &val));
+
+    auto pKernelArg = reinterpret_cast<void **>(this->pKernel->getCrossThreadData() + this->pKernelInfo->argAsPtr(0).stateless);
+    EXPECT_EQ(buffer.getCpuAddress(), *pKernelArg);
+    EXPECT_EQ(buffer.getUniqueId(), this->pKernel->getKernelArgInfo(0).memObjUniqueId);
+
+    *pKernelArg = nullptr;
+    EXPECT_EQ(CL_SUCCESS, this->pKernel->setArg(0, sizeof(cl_mem *), &val));
+    EXPECT_EQ(nullptr, *pKernelArg);
+    EXPECT_EQ(&buffer, this->pKernel->getKernelArg(0));
+
+    MockBuffer otherBuffer;
+    cl_mem otherVal = &otherBuffer;
+    EXPECT_EQ(CL_SUCCESS, this->pKernel->setArg(0, sizeof(cl_mem *), &otherVal));
+    EXPECT_EQ(otherBuffer.getCpuAddress(), *pKernelArg);
+}
+
+TEST_F(KernelArgBufferTest, GivenDifferentBufferAtSameAddressWhenSettingKernelArgThenArgumentIsPatched) {
+    MockBuffer buffer;
+    cl_mem val = &buffer;
+
+    EXPECT_EQ(CL_SUCCESS, this->pKernel->setArg(0, sizeof(cl_mem *), &val));
+
+    auto pKernelArg = reinterpret_cast<void **>(this->pKernel->getCrossThreadData() + this->pKernelInfo->argAsPtr(0).stateless);
+    *pKernelArg = nullptr;
+    buffer.uniqueId++;
+
+    EXPECT_EQ(CL_SUCCESS, this->pKernel->setArg(0, sizeof(cl_mem *), &val));
+    EXPECT_EQ(buffer.getCpuAddress(), *pKernelArg);
+    EXPECT_EQ(buffer.getUniqueId(), this->pKernel->getKernelArgInfo(0).memObjUniqueId);
+}
+
+TEST_F(KernelArgBufferTest, GivenBuiltInKernelWhenSettingSameBufferAgainThenArgumentIsPatchedAgain) {
+    MockBuffer buffer;
+    cl_mem val = &buffer;
+    this->pKernel->isBuiltIn = true;
+
+    EXPECT_EQ(CL_SUCCESS, this->pKernel->setArg(0, sizeof(cl_mem *), &val));
+
+    auto pKernelArg = reinterpret_cast<void **>(this->pKernel->getCrossThreadData() + this->pKernelInfo->argAsPtr(0).stateless);
+    *pKernelArg = nullptr;
+
+    EXPECT_EQ(CL_SUCCESS, this->pKernel->setArg(0, sizeof(cl_mem *), &val));
+    EXPECT_EQ(buffer.getCpuAddress(), *pKernelArg);
+}
+
 struct MultiDeviceKernelArgBufferTest : public ::testing::Test {
 
     void SetUp() override {
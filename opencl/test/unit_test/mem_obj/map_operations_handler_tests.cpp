@@ -82,27 +82,27 @@ TEST_F(MapOperationsHandlerTests, givenMappedPtrsWhenDoubleRemovedThenDoNothing)
 TEST_F(MapOperationsHandlerTests, givenMapInfoWhenAddedThenSetReadOnlyFlag) {
     mapFlags = CL_MAP_READ;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
-    EXPECT_TRUE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_TRUE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_WRITE;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_WRITE_INVALIDATE_REGION;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_READ | CL_MAP_WRITE;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_READ | CL_MAP_WRITE_INVALIDATE_REGION;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 }
 
@@ -112,7 +112,7 @@ TEST_F(MapOperationsHandlerTests, givenNonReadOnlyOverlappingPtrWhenAddingThenRe
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
 
     EXPECT_EQ(1u, mockHandler.size());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     EXPECT_TRUE(mockHandler.isOverlapping(mappedPtrs[0]));
     EXPECT_FALSE(mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get()));
     EXPECT_EQ(1u, mockHandler.size());
@@ -124,11 +124,11 @@ TEST_F(MapOperationsHandlerTests, givenReadOnlyOverlappingPtrWhenAddingThenRetur
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
 
     EXPECT_EQ(1u, mockHandler.size());
-    EXPECT_TRUE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_TRUE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     EXPECT_FALSE(mockHandler.isOverlapping(mappedPtrs[0]));
     EXPECT_TRUE(mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get()));
     EXPECT_EQ(2u, mockHandler.size());
-    EXPECT_TRUE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_TRUE(mockHandler.mappedPointers.rbegin()->second.readOnly);
 }
 
 const std::tuple<void *, size_t, void *, size_t, bool> overlappingCombinations[] = {
@@ -169,8 +169,60 @@ INSTANTIATE_TEST_CASE_P(MapOperationsHandlerOverlapTests,
                         MapOperationsHandlerOverlapTests,
                         ::testing::ValuesIn(overlappingCombinations));
 
+TEST_F(MapOperationsHandlerTests, givenManyAdjacentWriteMappingsWhenAddingThenOnlyOverlappingMappingsAreRejected) {
+    constexpr size_t mappingsCount = 512;
+    constexpr size_t mappingLength = 0x100;
+    mapFlags = CL_MAP_WRITE;
+    auto basePtr = reinterpret_cast<uint8_t *>(0x10000);
+
+    for (size_t i = 0; i < mappingsCount; i += 2) {
+        EXPECT_TRUE(mockHandler.add(basePtr + i * mappingLength, mappingLength - 1, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get()));
+    }
+    for (size_t i = 1; i < mappingsCount; i += 2) {
+        EXPECT_TRUE(mockHandler.add(basePtr + i * mappingLength, mappingLength - 1, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get()));
+    }
+    EXPECT_EQ(mappingsCount, mockHandler.size());
+
+    EXPECT_FALSE(mockHandler.add(basePtr + 10 * mappingLength + 1, 1, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get()));
+    EXPECT_FALSE(mockHandler.add(basePtr - 1, 1, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get()));
+    EXPECT_TRUE(mockHandler.add(basePtr + mappingsCount * mappingLength, 1, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get()));
+
+    for (size_t i = 0; i < mappingsCount; i++) {
+        MapInfo receivedMapInfo;
+        EXPECT_TRUE(mockHandler.findInfoForHostPtr(basePtr + i * mappingLength + 1, mappingLength - 2, receivedMapInfo));
+        EXPECT_EQ(basePtr + i * mappingLength, receivedMapInfo.ptr);
+        mockHandler.remove(basePtr + i * mappingLength);
+    }
+    EXPECT_EQ(1u, mockHandler.size());
+}
+
+TEST_F(MapOperationsHandlerTests, givenLongMappingFollowedByShortMappingsWhenLookingForHostPtrOrOverlapThenLongMappingIsFound) {
+    auto basePtr = reinterpret_cast<uint8_t *>(0x10000);
+    EXPECT_TRUE(mockHandler.add(basePtr, 0x10000, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get()));
+    for (size_t i = 1; i < 16; i++) {
+        EXPECT_TRUE(mockHandler.add(basePtr + i * 0x1000, 0x10, mapFlags, mappedPtrs[1].size, mappedPtrs[1].offset, 0, allocations[1].get()));
+    }
+
+    MapInfo receivedMapInfo;
+    EXPECT_TRUE(mockHandler.findInfoForHostPtr(basePtr + 0xf800, 0x800, receivedMapInfo));
+    EXPECT_EQ(basePtr, receivedMapInfo.ptr);
+    EXPECT_FALSE(mockHandler.findInfoForHostPtr(basePtr + 0xf800, 0x801, receivedMapInfo));
+
+    MapInfo requestedInfo(basePtr + 0xf900, 0x10, {{0, 0, 0}}, {{0, 0, 0}}, 0);
+    EXPECT_TRUE(mockHandler.isOverlapping(requestedInfo));
+}
+
 struct MapOperationsStorageWhitebox : MapOperationsStorage {
-    using MapOperationsStorage::handlers;
+    using MapOperationsStorage::getShard;
+    using MapOperationsStorage::shards;
+
+    size_t getHandlersCount() {
+        size_t handlersCount = 0;
+        for (auto &shard : shards) {
+            handlersCount += shard.handlers.size();
+        }
+        return handlersCount;
+    }
 };
 
 TEST(MapOperationsStorageTest, givenMapOperationsStorageWhenGetHandlerIsUsedThenCreateHandler) {
@@ -178,16 +230,16 @@ TEST(MapOperationsStorageTest, givenMapOperationsStorageWhenGetHandlerIsUsedThen
     MockBuffer buffer2{};
 
     MapOperationsStorageWhitebox storage{};
-    EXPECT_EQ(0u, storage.handlers.size());
+    EXPECT_EQ(0u, storage.getHandlersCount());
 
     storage.getHandler(&buffer1);
-    EXPECT_EQ(1u, storage.handlers.size());
+    EXPECT_EQ(1u, storage.getHandlersCount());
 
     storage.getHandler(&buffer2);
-    EXPECT_EQ(2u, storage.handlers.size());
+    EXPECT_EQ(2u, storage.getHandlersCount());
 
     storage.getHandler(&buffer1);
-    EXPECT_EQ(2u, storage.handlers.size());
+    EXPECT_EQ(2u, storage.getHandlersCount());
 }
 
 TEST(MapOperationsStorageTest, givenMapOperationsStorageWhenGetHandlerIfExistsIsUsedThenDoNotCreateHandler) {
@@ -195,17 +247,17 @@ TEST(MapOperationsStorageTest, givenMapOperationsStorageWhenGetHandlerIfExistsIs
     MockBuffer buffer2{};
 
     MapOperationsStorageWhitebox storage{};
-    EXPECT_EQ(0u, storage.handlers.size());
+    EXPECT_EQ(0u, storage.getHandlersCount());
     EXPECT_EQ(nullptr, storage.getHandlerIfExists(&buffer1));
     EXPECT_EQ(nullptr, storage.getHandlerIfExists(&buffer2));
 
     storage.getHandler(&buffer1);
-    EXPECT_EQ(1u, storage.handlers.size());
+    EXPECT_EQ(1u, storage.getHandlersCount());
     EXPECT_NE(nullptr, storage.getHandlerIfExists(&buffer1));
     EXPECT_EQ(nullptr, storage.getHandlerIfExists(&buffer2));
 
     storage.getHandler(&buffer2);
-    EXPECT_EQ(2u, storage.handlers.size());
+    EXPECT_EQ(2u, storage.getHandlersCount());
     EXPECT_NE(nullptr, storage.getHandlerIfExists(&buffer1));
     EXPECT_NE(nullptr, storage.getHandlerIfExists(&buffer2));
     EXPECT_NE(storage.getHandlerIfExists(&buffer1), storage.getHandlerIfExists(&buffer2));
@@ -216,8 +268,29 @@ TEST(MapOperationsStorageTest, givenMapOperationsStorageWhenRemoveHandlerIsUsedT
     MapOperationsStorageWhitebox storage{};
 
     storage.getHandler(&buffer);
-    ASSERT_EQ(1u, storage.handlers.size());
+    ASSERT_EQ(1u, storage.getHandlersCount());
 
     storage.removeHandler(&buffer);
-    EXPECT_EQ(0u, storage.handlers.size());
+    EXPECT_EQ(0u, storage.getHandlersCount());
+}
+
+TEST(MapOperationsStorageTest, givenMemObjectsInDifferentShardsWhenGettingInfoForHostPtrThenMappingFromAnyShardIsFound) {
+    MapOperationsStorageWhitebox storage{};
+    auto memObj0 = reinterpret_cast<cl_mem>(0x1000);
+    auto memObj1 = reinterpret_cast<cl_mem>(0x1040);
+    EXPECT_NE(&storage.getShard(memObj0), &storage.getShard(memObj1));
+
+    MemObjSizeArray size = {{1, 1, 1}};
+    MemObjOffsetArray offset = {{0, 0, 0}};
+    cl_map_flags mapFlags = CL_MAP_WRITE;
+    EXPECT_TRUE(storage.getHandler(memObj0).add(reinterpret_cast<void *>(0x10000), 0x100, mapFlags, size, offset, 0, nullptr));
+    EXPECT_TRUE(storage.getHandler(memObj1).add(reinterpret_cast<void *>(0x20000), 0x100, mapFlags, size, offset, 0, nullptr));
+    EXPECT_EQ(2u, storage.getHandlersCount());
+
+    MapInfo outInfo;
+    EXPECT_TRUE(storage.getInfoForHostPtr(reinterpret_cast<void *>(0x10010), 0x10, outInfo));
+    EXPECT_EQ(reinterpret_cast<void *>(0x10000), outInfo.ptr);
+    EXPECT_TRUE(storage.getInfoForHostPtr(reinterpret_cast<void *>(0x20010), 0x10, outInfo));
+    EXPECT_EQ(reinterpret_cast<void *>(0x20000), outInfo.ptr);
+    EXPECT_FALSE(storage.getInfoForHostPtr(reinterpret_cast<void *>(0x30010), 0x10, outInfo));
 }
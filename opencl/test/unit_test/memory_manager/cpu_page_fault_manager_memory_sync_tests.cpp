@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/test/common/fixtures/cpu_page_fault_manager_tests_fixture.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
@@ -24,6 +25,7 @@ struct CommandQueueMock : public MockCommandQueue {
                            cl_uint numEventsInWaitList, const cl_event *eventWaitList,
                            cl_event *event, bool externalAppCall) override {
         transferToGpuCalled++;
+        passedUnmapPtr = svmPtr;
         return CL_SUCCESS;
     }
     cl_int enqueueSVMMap(cl_bool blockingMap, cl_map_flags mapFlags,
@@ -32,6 +34,8 @@ struct CommandQueueMock : public MockCommandQueue {
                          cl_event *event, bool externalAppCall) override {
         transferToCpuCalled++;
         passedMapFlags = mapFlags;
+        passedMapPtr = svmPtr;
+        passedMapSize = size;
         return CL_SUCCESS;
     }
     cl_int finish() override {
@@ -43,6 +47,9 @@ struct CommandQueueMock : public MockCommandQueue {
     int transferToGpuCalled = 0;
     int finishCalled = 0;
     uint64_t passedMapFlags = 0;
+    void *passedMapPtr = nullptr;
+    size_t passedMapSize = 0;
+    void *passedUnmapPtr = nullptr;
 };
 
 TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocWhenSynchronizeMemoryThenEnqueueProperCalls) {
@@ -106,6 +113,74 @@ TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocWhenGpuTransferIsInvokedThen
     cmdQ->device = nullptr;
 }
 
+TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocWhenRangeIsTransferredToCpuThenOffsetRangeIsMappedAndItsMapOperationIsNotKept) {
+    MockExecutionEnvironment executionEnvironment;
+    REQUIRE_SVM_OR_SKIP(executionEnvironment.rootDeviceEnvironments[0]->getHardwareInfo());
+
+    auto memoryManager = std::make_unique<MockMemoryManager>(executionEnvironment);
+    auto svmAllocsManager = std::make_unique<SVMAllocsManager>(memoryManager.get(), false);
+    auto device = std::unique_ptr<MockClDevice>(new MockClDevice{MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr)});
+    auto rootDeviceIndex = device->getRootDeviceIndex();
+    RootDeviceIndicesContainer rootDeviceIndices = {rootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{rootDeviceIndex, device->getDeviceBitfield()}};
+    void *alloc = svmAllocsManager->createSVMAlloc(256, {}, rootDeviceIndices, deviceBitfields);
+    auto cmdQ = std::make_unique<CommandQueueMock>();
+    cmdQ->device = device.get();
+    pageFaultManager->insertAllocation(alloc, 256, svmAllocsManager.get(), cmdQ.get(), {});
+
+    auto rangePtr = ptrOffset(alloc, 64);
+    // map operation as registered by enqueueSVMMap of the range
+    svmAllocsManager->insertSvmMapOperation(rangePtr, 128, alloc, 64, false);
+
+    pageFaultManager->baseCpuRangeTransfer(alloc, 64, 128, cmdQ.get());
+    EXPECT_EQ(1, cmdQ->transferToCpuCalled);
+    EXPECT_EQ(0, cmdQ->transferToGpuCalled);
+    EXPECT_EQ(0, cmdQ->finishCalled);
+    EXPECT_EQ(static_cast<uint64_t>(CL_MAP_WRITE), cmdQ->passedMapFlags);
+    EXPECT_EQ(rangePtr, cmdQ->passedMapPtr);
+    EXPECT_EQ(128u, cmdQ->passedMapSize);
+    EXPECT_EQ(nullptr, svmAllocsManager->getSvmMapOperation(rangePtr));
+
+    svmAllocsManager->freeSVMAlloc(alloc);
+    cmdQ->device = nullptr;
+}
+
+TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocWhenRangeIsTransferredToGpuThenMapOperationOfRangeIsInsertedAndRangeIsUnmapped) {
+    MockExecutionEnvironment executionEnvironment;
+    REQUIRE_SVM_OR_SKIP(executionEnvironment.rootDeviceEnvironments[0]->getHardwareInfo());
+
+    auto memoryManager = std::make_unique<MockMemoryManager>(executionEnvironment);
+    auto svmAllocsManager = std::make_unique<SVMAllocsManager>(memoryManager.get(), false);
+    auto device = std::unique_ptr<MockClDevice>(new MockClDevice{MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr)});
+    auto rootDeviceIndex = device->getRootDeviceIndex();
+    RootDeviceIndicesContainer rootDeviceIndices = {rootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{rootDeviceIndex, device->getDeviceBitfield()}};
+    void *alloc = svmAllocsManager->createSVMAlloc(256, {}, rootDeviceIndices, deviceBitfields);
+    auto cmdQ = std::make_unique<CommandQueueMock>();
+    cmdQ->device = device.get();
+    pageFaultManager->insertAllocation(alloc, 256, svmAllocsManager.get(), cmdQ.get(), {});
+
+    auto rangePtr = ptrOffset(alloc, 64);
+    pageFaultManager->baseGpuRangeTransfer(alloc, 64, 128, cmdQ.get());
+    EXPECT_EQ(0, cmdQ->transferToCpuCalled);
+    EXPECT_EQ(1, cmdQ->transferToGpuCalled);
+    EXPECT_EQ(1, cmdQ->finishCalled);
+    EXPECT_EQ(rangePtr, cmdQ->passedUnmapPtr);
+
+    auto mapOperation = svmAllocsManager->getSvmMapOperation(rangePtr);
+    ASSERT_NE(nullptr, mapOperation);
+    EXPECT_EQ(rangePtr, mapOperation->regionSvmPtr);
+    EXPECT_EQ(128u, mapOperation->regionSize);
+    EXPECT_EQ(alloc, mapOperation->baseSvmPtr);
+    EXPECT_EQ(64u, mapOperation->offset);
+    EXPECT_FALSE(mapOperation->readOnlyMap);
+    EXPECT_EQ(nullptr, svmAllocsManager->getSvmMapOperation(alloc));
+
+    svmAllocsManager->removeSvmMapOperation(rangePtr);
+    svmAllocsManager->freeSVMAlloc(alloc);
+    cmdQ->device = nullptr;
+}
+
 TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocWhenAllowCPUMemoryEvictionIsCalledThenSelectCorrectCsrWithOsContextForEviction) {
     MockExecutionEnvironment executionEnvironment;
     REQUIRE_SVM_OR_SKIP(executionEnvironment.rootDeviceEnvironments[0]->getHardwareInfo());
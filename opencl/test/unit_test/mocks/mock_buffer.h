@@ -46,6 +46,7 @@ class MockBuffer : public MockBufferStorage, public Buffer {
     using MemObj::memObjectType;
     using MemObj::memoryStorage;
     using MemObj::sizeInPoolAllocator;
+    using MemObj::uniqueId;
     using MockBufferStorage::device;
 
     void setAllocationType(uint32_t rootDeviceIndex, bool compressed);
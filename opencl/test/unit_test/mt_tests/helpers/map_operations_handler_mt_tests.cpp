@@ -21,7 +21,7 @@ struct MockMapOperationsHandler : public MapOperationsHandler {
 };
 
 struct MockMapOperationsStorage : public MapOperationsStorage {
-    using MapOperationsStorage::handlers;
+    using MapOperationsStorage::shards;
 };
 
 struct MapOperationsHandlerMtTests : public ::testing::Test {
@@ -1011,7 +1011,7 @@ HWTEST_F(ProfilingWithPerfCountersTests, GivenCommandQueueWithProfilingPerfCount
 
 template <typename TagType>
 struct FixedGpuAddressTagAllocator : MockTagAllocator<TagType> {
-    using TagAllocator<TagType>::usedTags;
+    using NodeType = typename MockTagAllocator<TagType>::NodeType;
     using TagAllocator<TagType>::deferredTags;
 
     struct MockTagNode : TagNode<TagType> {
@@ -1024,6 +1024,24 @@ struct FixedGpuAddressTagAllocator : MockTagAllocator<TagType> {
         auto tag = reinterpret_cast<MockTagNode *>(this->freeTags.peekHead());
         tag->setGpuAddress(gpuAddress);
     }
+
+    TagNodeBase *getTag() override {
+        auto node = MockTagAllocator<TagType>::getTag();
+        usedTags.pushFrontOne(*static_cast<NodeType *>(node));
+        return node;
+    }
+
+    void returnTagToFreePool(TagNodeBase *node) override {
+        usedTags.removeOne(*static_cast<NodeType *>(node)).release();
+        MockTagAllocator<TagType>::returnTagToFreePool(node);
+    }
+
+    void returnTagToDeferredPool(TagNodeBase *node) override {
+        usedTags.removeOne(*static_cast<NodeType *>(node)).release();
+        MockTagAllocator<TagType>::returnTagToDeferredPool(node);
+    }
+
+    IDList<NodeType> usedTags;
 };
 
 HWCMDTEST_F(IGFX_GEN8_CORE, ProfilingWithPerfCountersTests, GivenCommandQueueWithProfilingPerfCountersWhenWalkerIsDispatchedThenRegisterStoresArePresentInCS) {
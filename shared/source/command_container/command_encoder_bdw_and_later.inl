@@ -192,6 +192,7 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
             ptr = NEO::ImplicitArgsHelper::patchImplicitArgs(ptr, *pImplicitArgs, kernelDescriptor, {}, gfxCoreHelper);
         }
 
+        args.outCrossThreadDataPtr = ptr;
         memcpy_s(ptr, sizeCrossThreadData,
                  args.dispatchInterface->getCrossThreadData(), sizeCrossThreadData);
 
@@ -226,6 +226,7 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
             ptr = NEO::ImplicitArgsHelper::patchImplicitArgs(ptr, *pImplicitArgs, kernelDescriptor, std::make_pair(localIdsGenerationByRuntime, requiredWorkgroupOrder), gfxCoreHelper);
         }
 
+        args.outCrossThreadDataPtr = ptr;
         if (sizeCrossThreadData > 0) {
             memcpy_s(ptr, sizeCrossThreadData,
                      crossThreadData, sizeCrossThreadData);
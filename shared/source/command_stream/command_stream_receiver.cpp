@@ -99,6 +99,12 @@ CommandStreamReceiver::CommandStreamReceiver(ExecutionEnvironment &executionEnvi
 }
 
 CommandStreamReceiver::~CommandStreamReceiver() {
+    PRINT_DEBUG_STRING(DebugManager.flags.PrintWaitPhaseStatistics.get() && waitPolicy.getNumWaits() > 0, stdout,
+                       "CSR %p waits: %llu, spin time: %llu us, yield time: %llu us\n", this,
+                       static_cast<unsigned long long>(waitPolicy.getNumWaits()),
+                       static_cast<unsigned long long>(waitPolicy.getPhaseTimeUs(WaitUtils::WaitPhase::spin)),
+                       static_cast<unsigned long long>(waitPolicy.getPhaseTimeUs(WaitUtils::WaitPhase::yield)));
+
     if (userPauseConfirmation) {
         {
             std::unique_lock<SpinLock> lock{debugPauseStateLock};
@@ -461,6 +467,7 @@ bool CommandStreamReceiver::checkGpuHangDetected(TimeType currentTime, TimeType
 WaitStatus CommandStreamReceiver::baseWaitFunction(volatile TagAddressType *pollAddress, const WaitParams &params, TaskCountType taskCountToWait) {
     std::chrono::high_resolution_clock::time_point waitStartTime, lastHangCheckTime, currentTime;
     int64_t timeDiff = 0;
+    int64_t elapsedTimeUs = 0;
 
     TaskCountType latestSentTaskCount = this->latestFlushedTaskCount;
     if (latestSentTaskCount < taskCountToWait) {
@@ -469,6 +476,9 @@ WaitStatus CommandStreamReceiver::baseWaitFunction(volatile TagAddressType *poll
         }
     }
     volatile TagAddressType *partitionAddress = pollAddress;
+    const bool adaptiveWaitEnabled = WaitUtils::AdaptiveWaitPolicy::isEnabled();
+    const bool recordWait = adaptiveWaitEnabled || DebugManager.flags.PrintWaitPhaseStatistics.get();
+    const int64_t spinTimeUs = adaptiveWaitEnabled ? static_cast<int64_t>(waitPolicy.getSpinTimeUs()) : 0;
 
     waitStartTime = std::chrono::high_resolution_clock::now();
     lastHangCheckTime = waitStartTime;
@@ -476,8 +486,12 @@ WaitStatus CommandStreamReceiver::baseWaitFunction(volatile TagAddressType *poll
         while (*partitionAddress < taskCountToWait && timeDiff <= params.waitTimeout) {
             this->downloadTagAllocation(taskCountToWait);
 
-            if (!params.indefinitelyPoll && WaitUtils::waitFunction(partitionAddress, taskCountToWait)) {
-                break;
+            if (!params.indefinitelyPoll) {
+                bool ready = elapsedTimeUs < spinTimeUs ? WaitUtils::spinFunction(partitionAddress, taskCountToWait)
+                                                        : WaitUtils::waitFunction(partitionAddress, taskCountToWait);
+                if (ready) {
+                    break;
+                }
             }
 
             currentTime = std::chrono::high_resolution_clock::now();
@@ -485,8 +499,9 @@ WaitStatus CommandStreamReceiver::baseWaitFunction(volatile TagAddressType *poll
                 return WaitStatus::GpuHang;
             }
 
+            elapsedTimeUs = std::chrono::duration_cast<std::chrono::microseconds>(currentTime - waitStartTime).count();
             if (params.enableTimeout) {
-                timeDiff = std::chrono::duration_cast<std::chrono::microseconds>(currentTime - waitStartTime).count();
+                timeDiff = elapsedTimeUs;
             }
         }
 
@@ -501,6 +516,11 @@ WaitStatus CommandStreamReceiver::baseWaitFunction(volatile TagAddressType *poll
         partitionAddress = ptrOffset(partitionAddress, this->immWritePostSyncWriteOffset);
     }
 
+    if (recordWait) {
+        elapsedTimeUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - waitStartTime).count();
+        waitPolicy.recordWait(static_cast<uint64_t>(elapsedTimeUs), static_cast<uint64_t>(spinTimeUs));
+    }
+
     return WaitStatus::Ready;
 }
 
@@ -975,6 +995,10 @@ bool CommandStreamReceiver::checkImplicitFlushForGpuIdle() {
         if (this->taskCount == *getTagAddress()) {
             return true;
         }
+        // batched command buffers are pending but everything already submitted has completed, gpu would stay idle until next flush
+        if (useGpuIdleImplicitFlushWithPendingSubmissions && *getTagAddress() >= this->latestFlushedTaskCount) {
+            return true;
+        }
     }
     return false;
 }
@@ -15,6 +15,7 @@
 #include "shared/source/helpers/completion_stamp.h"
 #include "shared/source/helpers/options.h"
 #include "shared/source/utilities/spinlock.h"
+#include "shared/source/utilities/wait_util.h"
 
 #include <atomic>
 #include <cstddef>
@@ -519,6 +520,7 @@ class CommandStreamReceiver {
     PreemptionMode lastPreemptionMode = PreemptionMode::Initial;
 
     std::chrono::microseconds gpuHangCheckPeriod{500'000};
+    WaitUtils::AdaptiveWaitPolicy waitPolicy;
     uint32_t lastSentL3Config = 0;
     uint32_t latestSentStatelessMocsConfig = 0;
     uint64_t lastSentSliceCount = QueueSliceCount::defaultSliceCount;
@@ -563,6 +565,7 @@ class CommandStreamReceiver {
     bool useNewResourceImplicitFlush = false;
     bool newResources = false;
     bool useGpuIdleImplicitFlush = false;
+    bool useGpuIdleImplicitFlushWithPendingSubmissions = false;
     bool lastSentUseGlobalAtomics = false;
     bool useNotifyEnableForPostSync = false;
     bool dcFlushSupport = false;
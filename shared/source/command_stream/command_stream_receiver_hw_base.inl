@@ -789,6 +789,8 @@ inline bool CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
                 flatBatchBufferHelper->registerCommandChunk(primaryCmdBuffer->batchBuffer, sizeof(MI_BATCH_BUFFER_START));
             }
 
+            auto &aggregationStats = this->submissionAggregator->peekAggregationStats();
+
             while (nextCommandBuffer && nextCommandBuffer->inspectionId == primaryCmdBuffer->inspectionId) {
 
                 // noop pipe control
@@ -797,6 +799,8 @@ inline bool CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
                         flatBatchBufferHelper->removePipeControlData(pipeControlLocationSize, currentPipeControlForNooping, peekRootDeviceEnvironment());
                     }
                     memset(currentPipeControlForNooping, 0, pipeControlLocationSize);
+                    aggregationStats.pipeControlsErased++;
+                    aggregationStats.commandBytesSaved += pipeControlLocationSize;
                 }
                 // obtain next candidate for nooping
                 currentPipeControlForNooping = nextCommandBuffer->pipeControlThatMayBeErasedLocation;
@@ -812,6 +816,8 @@ inline bool CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
                 // if we point to exact same command buffer, then batch buffer start is not needed at all
                 if (cpuAddressForCurrentCommandBufferEndingSection == cpuAddressForCommandBufferDestination) {
                     memset(currentBBendLocation, 0u, ptrDiff(cpuAddressForCurrentCommandBufferEndingSection, currentBBendLocation));
+                    aggregationStats.batchBufferStartsElided++;
+                    aggregationStats.commandBytesSaved += sizeof(MI_BATCH_BUFFER_START);
                 } else {
                     addBatchBufferStart((MI_BATCH_BUFFER_START *)currentBBendLocation, offsetedCommandBuffer, false);
                 }
@@ -859,6 +865,11 @@ inline bool CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
             // after flush task level is closed
             this->taskLevel++;
 
+            PRINT_DEBUG_STRING(DebugManager.flags.PrintSubmissionAggregationStats.get(), stdout,
+                               "Aggregated submission up to task count %u: merged command buffers: %u, erased pipe controls: %u, elided batch buffer starts: %u, command bytes saved: %zu, coalesced residency entries: %u\n",
+                               lastTaskCount, aggregationStats.commandBuffersMerged, aggregationStats.pipeControlsErased,
+                               aggregationStats.batchBufferStartsElided, aggregationStats.commandBytesSaved, aggregationStats.residencyEntriesCoalesced);
+
             flushStampUpdateHelper.updateAll(flushStamp->peekStamp());
 
             if (!isUpdateTagFromWaitEnabled()) {
@@ -1537,6 +1548,7 @@ void CommandStreamReceiverHw<GfxFamily>::postInitFlagsSetup() {
     if (overrideGpuIdleImplicitFlush != -1) {
         useGpuIdleImplicitFlush = overrideGpuIdleImplicitFlush == 0 ? false : true;
     }
+    useGpuIdleImplicitFlushWithPendingSubmissions = DebugManager.flags.PerformImplicitFlushForIdleGpuWithPendingSubmissions.get() == 1;
 }
 
 template <typename GfxFamily>
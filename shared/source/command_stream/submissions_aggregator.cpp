@@ -17,6 +17,7 @@ void NEO::SubmissionAggregator::recordCommandBuffer(CommandBuffer *commandBuffer
 void NEO::SubmissionAggregator::aggregateCommandBuffers(ResourcePackage &resourcePackage, size_t &totalUsedSize, size_t totalMemoryBudget, uint32_t osContextId) {
     auto primaryCommandBuffer = this->cmdBuffers.peekHead();
     auto currentInspection = this->inspectionId;
+    this->aggregationStats = {};
 
     if (!primaryCommandBuffer) {
         return;
@@ -32,6 +33,8 @@ void NEO::SubmissionAggregator::aggregateCommandBuffers(ResourcePackage &resourc
             graphicsAllocation->setInspectionId(currentInspection, osContextId);
             resourcePackage.push_back(graphicsAllocation);
             totalUsedSize += graphicsAllocation->getUnderlyingBufferSize();
+        } else {
+            this->aggregationStats.residencyEntriesCoalesced++;
         }
     }
 
@@ -57,15 +60,19 @@ void NEO::SubmissionAggregator::aggregateCommandBuffers(ResourcePackage &resourc
 
     while (nextCommandBuffer) {
         size_t nextCommandBufferNewResourcesSize = 0;
+        uint32_t nextCommandBufferCoalescedResources = 0;
         // evaluate if buffer fits
         for (auto &graphicsAllocation : nextCommandBuffer->surfaces) {
             if (graphicsAllocation == primaryBatchGraphicsAllocation) {
+                nextCommandBufferCoalescedResources++;
                 continue;
             }
             if (graphicsAllocation->getInspectionId(osContextId) < currentInspection) {
                 graphicsAllocation->setInspectionId(currentInspection, osContextId);
                 newResources.push_back(graphicsAllocation);
                 nextCommandBufferNewResourcesSize += graphicsAllocation->getUnderlyingBufferSize();
+            } else {
+                nextCommandBufferCoalescedResources++;
             }
         }
 
@@ -82,6 +89,8 @@ void NEO::SubmissionAggregator::aggregateCommandBuffers(ResourcePackage &resourc
             nextCommandBuffer = nextCommandBuffer->next;
             totalUsedSize += nextCommandBufferNewResourcesSize;
             currentNode->inspectionId = currentInspection;
+            this->aggregationStats.commandBuffersMerged++;
+            this->aggregationStats.residencyEntriesCoalesced += nextCommandBufferCoalescedResources;
 
             for (auto &newResource : newResources) {
                 resourcePackage.push_back(newResource);
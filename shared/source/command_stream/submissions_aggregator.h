@@ -78,14 +78,25 @@ struct CommandBufferList : public IDList<CommandBuffer, false, true, false> {};
 
 using ResourcePackage = StackVec<GraphicsAllocation *, 128>;
 
+// what was saved by merging command buffers into single submission, reset on each aggregation
+struct SubmissionAggregationStats {
+    uint32_t commandBuffersMerged = 0;
+    uint32_t pipeControlsErased = 0;
+    uint32_t batchBufferStartsElided = 0;
+    size_t commandBytesSaved = 0;
+    uint32_t residencyEntriesCoalesced = 0;
+};
+
 class SubmissionAggregator {
   public:
     void recordCommandBuffer(CommandBuffer *commandBuffer);
     void aggregateCommandBuffers(ResourcePackage &resourcePackage, size_t &totalUsedSize, size_t totalMemoryBudget, uint32_t osContextId);
     CommandBufferList &peekCmdBufferList() { return cmdBuffers; }
+    SubmissionAggregationStats &peekAggregationStats() { return aggregationStats; }
 
   protected:
     CommandBufferList cmdBuffers;
+    SubmissionAggregationStats aggregationStats;
     uint32_t inspectionId = 1;
 };
 } // namespace NEO
@@ -8,7 +8,6 @@
 #include "shared/source/compiler_interface/compiler_cache.h"
 #include "shared/source/compiler_interface/os_compiler_cache_helper.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
-#include "shared/source/helpers/file_io.h"
 #include "shared/source/helpers/path.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/os_interface/linux/sys_calls.h"
@@ -48,6 +47,7 @@ bool compareByLastAccessTime(const ElementsStruct &a, ElementsStruct &b) {
 }
 
 bool CompilerCache::evictCache(uint64_t &bytesEvicted) {
+    bytesEvicted = 0;
     struct dirent **files = 0;
 
     int filesCount = NEO::SysCalls::scandir(config.cacheDir.c_str(), &files, filterFunction, NULL);
@@ -76,12 +76,13 @@ bool CompilerCache::evictCache(uint64_t &bytesEvicted) {
 
     size_t evictionLimit = config.cacheSize / 3;
 
-    size_t evictionSizeCount = 0;
     for (size_t i = 0; i < vec.size(); ++i) {
-        NEO::SysCalls::unlink(vec[i].path);
-        evictionSizeCount += vec[i].statEl.st_size;
+        if (NEO::SysCalls::unlink(vec[i].path) != 0) {
+            continue;
+        }
+        bytesEvicted += vec[i].statEl.st_size;
 
-        if (evictionSizeCount > evictionLimit) {
+        if (bytesEvicted > evictionLimit) {
             return true;
         }
     }
@@ -236,6 +237,7 @@ bool CompilerCache::cacheBinary(const std::string &kernelFileHash, const char *p
             unlockFileAndClose(std::get<int>(fd));
             return false;
         }
+        directorySize -= std::min(directorySize, static_cast<size_t>(bytesEvicted));
     }
 
     std::string tmpFileName = "cl_cache.XXXXXX";
@@ -263,7 +265,33 @@ bool CompilerCache::cacheBinary(const std::string &kernelFileHash, const char *p
 
 std::unique_ptr<char[]> CompilerCache::loadCachedBinary(const std::string &kernelFileHash, size_t &cachedBinarySize) {
     std::string filePath = joinPath(config.cacheDir, kernelFileHash + config.cacheFileExtension);
+    cachedBinarySize = 0u;
+
+    int fd = NEO::SysCalls::open(filePath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    std::unique_ptr<char[]> cachedBinary;
+    struct stat statbuf = {};
+    if ((NEO::SysCalls::fstat(fd, &statbuf) == 0) && (statbuf.st_size > 0)) {
+        auto binarySize = static_cast<size_t>(statbuf.st_size);
+        cachedBinary = std::make_unique<char[]>(binarySize);
+        if (NEO::SysCalls::pread(fd, cachedBinary.get(), binarySize, 0) == static_cast<ssize_t>(binarySize)) {
+            cachedBinarySize = binarySize;
+
+            // evictCache relies on access time, which relatime/noatime mounts don't refresh on read.
+            // Setting both times to now needs only write access, any other value needs file ownership.
+            struct timespec accessTimes[2] = {{0, UTIME_NOW}, {0, UTIME_NOW}};
+            if (NEO::SysCalls::futimens(fd, accessTimes) != 0) {
+                NEO::printDebugString(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Refreshing access time failed! errno: %d\n", NEO::SysCalls::getProcessId(), errno);
+            }
+        } else {
+            cachedBinary.reset();
+        }
+    }
 
-    return loadDataFromFile(filePath.c_str(), cachedBinarySize);
+    NEO::SysCalls::close(fd);
+    return cachedBinary;
 }
 } // namespace NEO
@@ -296,6 +296,7 @@ DECLARE_DEBUG_VARIABLE(bool, PrintBOCreateDestroyResult, false, "tracks the resu
 DECLARE_DEBUG_VARIABLE(bool, PrintBOBindingResult, false, "tracks the result of binding and unbinding of BOs")
 DECLARE_DEBUG_VARIABLE(bool, PrintBOPrefetchingResult, false, "tracks the result of prefetching BOs")
 DECLARE_DEBUG_VARIABLE(bool, PrintTagAllocationAddress, false, "Print tag allocation address for each engine")
+DECLARE_DEBUG_VARIABLE(bool, PrintSubmissionAggregationStats, false, "Print number of merged command buffers and commands, bytes and residency entries saved on each batched submission flush")
 DECLARE_DEBUG_VARIABLE(bool, ProvideVerboseImplicitFlush, false, "provides verbose messages about implicit flush mechanism")
 DECLARE_DEBUG_VARIABLE(bool, PrintBlitDispatchDetails, false, "Print blit dispatch details")
 DECLARE_DEBUG_VARIABLE(bool, PrintIoctlTimes, false, "Print ioctl times")
@@ -304,6 +305,13 @@ DECLARE_DEBUG_VARIABLE(bool, PrintUmdSharedMigration, false, "Print log message
 DECLARE_DEBUG_VARIABLE(bool, PrintImageBlitBlockCopyCmdDetails, false, "Prints XY_BLOCK_COPY_BLT command details")
 DECLARE_DEBUG_VARIABLE(bool, PrintCompletionFenceUsage, false, "Prints all usages of DRM completion fences")
 DECLARE_DEBUG_VARIABLE(bool, PrintKernelDispatchParameters, false, "Prints kernel parameters used in tg dispatch size heuristic on encode dispatch kernel")
+DECLARE_DEBUG_VARIABLE(bool, PrintLocalIdsCacheStatistics, false, "Prints local ids cache hit and miss counters when cache is destroyed")
+DECLARE_DEBUG_VARIABLE(bool, PrintWaitPhaseStatistics, false, "Prints number of waits and time spent spinning and yielding in task count waits when CSR is destroyed")
+DECLARE_DEBUG_VARIABLE(bool, PrintGemCloseWorkerStatistics, false, "Prints number of closed buffer objects, max queue depth and close latency when gem close worker is destroyed")
+DECLARE_DEBUG_VARIABLE(int32_t, L0TraceRecorderRecordsPerThread, -1, "-1: default (disabled), >0: with ZET_ENABLE_API_TRACING_EXP=1 record L0 API calls into per-thread ring buffers of given number of records (rounded up to power of 2)")
+DECLARE_DEBUG_VARIABLE(std::string, L0TraceRecorderOutputFile, std::string("ze_api_trace.bin"), "Binary file the L0 trace recorder drains recorded API calls to")
+DECLARE_DEBUG_VARIABLE(bool, PrintOclApiLatencyHistograms, false, "Collect per-thread latency histograms of OpenCL API calls and print calls count, avg, p50, p99, p999 and max latency per API at exit")
+DECLARE_DEBUG_VARIABLE(bool, PrintImmediateCmdListCoalescingStatistics, false, "Print number of flushes and histogram of appends per flush when immediate command list with append coalescing is destroyed")
 DECLARE_DEBUG_VARIABLE(bool, LogGdiCalls, false, "Log GDI calls")
 DECLARE_DEBUG_VARIABLE(bool, LogGdiCallsToFile, false, "Log GDI calls to file")
 DECLARE_DEBUG_VARIABLE(bool, PrintGmmCompressionParams, false, "Print Gmm compression resource params")
@@ -328,6 +336,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, MinHwThreadsUnoccupied, 0, "If not zero then max
 DECLARE_DEBUG_VARIABLE(int32_t, PerformImplicitFlushEveryEnqueueCount, -1, "If greater than 0, driver performs implicit flush every N submissions.")
 DECLARE_DEBUG_VARIABLE(int32_t, PerformImplicitFlushForNewResource, -1, "-1: platform specific, 0: force disable, 1: force enable")
 DECLARE_DEBUG_VARIABLE(int32_t, PerformImplicitFlushForIdleGpu, -1, "-1: platform specific, 0: force disable, 1: force enable")
+DECLARE_DEBUG_VARIABLE(int32_t, PerformImplicitFlushForIdleGpuWithPendingSubmissions, -1, "-1: default (disabled), 0: disabled, 1: enabled. When idle gpu implicit flush is enabled, flush batched submissions also when gpu completed all already flushed work")
 DECLARE_DEBUG_VARIABLE(int32_t, EventWaitOnHost, -1, "Wait for events on host instead of program semaphores for them, works for append kernel launch with immediate command list, -1: default, 0: disable, 1: enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableCacheFlushAfterWalkerForAllQueues, -1, "Enable cache flush after walker even if queue doesn't require it")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideUseKmdWaitFunction, -1, "-1: default (L0: disabled), 0: disabled, 1: enabled. It uses only busy loop to wait or busy loop with KMD wait function, when KMD fallback is enabled")
@@ -345,6 +354,8 @@ DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsSize, -1, "-1: default, >=0: Size to app
 DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsMask, 0, "0: default, >0: bitmask: indicates bcs engines for split")
 DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsMaskH2D, 0, "0: default, >0: bitmask: indicates bcs engines for H2D split")
 DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsMaskD2H, 0, "0: default, >0: bitmask: indicates bcs engines for D2H split")
+DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsLoadAware, -1, "-1: default (disabled), 0: disabled, 1: enabled. Size BCS split chunks by bytes still in flight on each copy engine and skip engines that are busier than others")
+DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsMinChunkSize, -1, "-1: default (1MB), >0: minimal chunk size in KB for load aware BCS split, limits number of engines used for small copies")
 DECLARE_DEBUG_VARIABLE(int32_t, ReuseKernelBinaries, -1, "-1: default, 0:disabled, 1: enabled. If enabled, driver reuses kernel binaries.")
 DECLARE_DEBUG_VARIABLE(int32_t, SetAmountOfReusableAllocations, -1, "-1: default, 0:disabled, > 1: enabled. If enabled, driver will fill reusable allocation lists with given amount of command buffers and heaps at initialization of immediate command list.")
 DECLARE_DEBUG_VARIABLE(int32_t, SetAmountOfReusableAllocationsPerCmdQueue, -1, "-1: default, 0:disabled, > 1: enabled. If enabled, driver will fill reusable allocation lists with given amount of command buffers for each initialized opencl command queue.")
@@ -352,6 +363,12 @@ DECLARE_DEBUG_VARIABLE(int32_t, UseHighAlignmentForHeapExtended, -1, "-1: defaul
 DECLARE_DEBUG_VARIABLE(int32_t, DispatchCmdlistCmdBufferPrimary, -1, "-1: default, 0: dispatch command buffers as seconadry, 1: dispatch command buffers as primary and chain")
 DECLARE_DEBUG_VARIABLE(int32_t, UseImmediateFlushTask, -1, "-1: default, 0: use regular flush task, 1: use immediate flush task")
 DECLARE_DEBUG_VARIABLE(int32_t, SkipDcFlushOnBarrierWithoutEvents, -1, "-1: default (enabled), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, ModuleInitializationWorkers, -1, "-1: default (up to 8 threads, at least 64 kernels per thread), 0 or 1: initialize kernels of a module serially, >1: max number of threads initializing kernels of a module")
+DECLARE_DEBUG_VARIABLE(int32_t, ImmediateCmdListAppendCoalescing, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, non-blocking appends to asynchronous immediate command lists are gathered and submitted in one flush")
+DECLARE_DEBUG_VARIABLE(int32_t, ImmediateCmdListCoalescingMaxBytes, -1, "-1: default (16KB), >0: coalesced appends are flushed when their commands reach given size in bytes")
+DECLARE_DEBUG_VARIABLE(int32_t, ImmediateCmdListCoalescingTimeoutUs, -1, "-1: default (100us), >=0: coalesced appends older than given number of microseconds are flushed by next append or by idle flusher thread")
+DECLARE_DEBUG_VARIABLE(int32_t, TagAllocatorThreadCacheSize, -1, "-1: default (16), 0: disabled, >0: number of returned timestamp/profiling tags kept by returning thread before they are handed back to shared free pool in bulk")
+DECLARE_DEBUG_VARIABLE(int32_t, SysmanTelemetrySnapshotMaxAgeUs, -1, "-1: default (disabled), >=0: Linux sysman reads of sysfs values and PMT telemetry are served from snapshot refreshed in batch on cached file descriptors when older than given time in microseconds")
 
 /*DIRECT SUBMISSION FLAGS*/
 DECLARE_DEBUG_VARIABLE(int32_t, EnableDirectSubmission, -1, "-1: default (disabled), 0: disable, 1:enable. Enables direct submission of command buffers bypassing KMD")
@@ -380,15 +397,19 @@ DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionPCIBarrier, -1, "Use PCI barrier
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionInsertExtraMiMemFenceCommands, -1, "-1: default, 0 - disable, 1 - enable. If enabled, add extra MI_MEM_FENCE instructions with acquire bit set")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionInsertSfenceInstructionPriorToSubmission, -1, "-1: default, 0 - disable, 1 - Insert _mm_sfence before unlocking semaphore only, 2 - insert before and after semaphore")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionMaxRingBuffers, -1, "-1: default, >0: max ring buffer count, During switch ring buffer, if there is no available ring, wait for completion instead of allocating new one if DirectSubmissionMaxRingBuffers is reached")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionInitialRingBuffers, -1, "-1: default (2), >0: number of ring buffers allocated when direct submission is initialized, limited by DirectSubmissionMaxRingBuffers")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionAdaptiveRingBufferPreallocation, -1, "-1: default (disabled), 0: disable, 1: enable. If enabled and no ring buffer is free during switch, ring buffer count is doubled at once instead of allocating single ring buffer")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionDisablePrefetcher, -1, "-1: default, 0 - disable, 1 - enable. If enabled, disable prefetcher is being dispatched")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionRelaxedOrdering, -1, "-1: default, 0 - disable, 1 - enable. If enabled, tasks sent to direct submission ring may be dispatched out of order")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionRelaxedOrderingForBcs, -1, "-1: default, 0 - disable, 1 - enable. If set, enable RelaxedOrdering feature for BCS engine")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionRelaxedOrderingQueueSizeLimit, -1, "-1: default, >0: Max gpu queue size. If limit is reached, scheduler wont consume new work")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionRelaxedOrderingMinNumberOfClients, -1, "-1: default, >0: Enables RelaxedOrdering mode only if specified number of clients is assigned to given CSR.")
 DECLARE_DEBUG_VARIABLE(bool, DirectSubmissionPrintBuffers, false, "Print address of submitted command buffers")
+DECLARE_DEBUG_VARIABLE(bool, DirectSubmissionPrintTelemetry, false, "Print direct submission counters (dispatches, bytes, semaphore updates, ring switches, ring allocations, busy ring wraps) when direct submission is destroyed")
 
 /*FEATURE FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, USMEvictAfterMigration, false, "Evict USM allocation after implicit migration to GPU")
+DECLARE_DEBUG_VARIABLE(int32_t, SharedAllocationMigrationChunkSize, -1, "-1: default (0), 0: shared allocation is migrated as a whole, >0: size in KB of chunks of shared allocation migrated independently on CPU page fault, aligned up to page size")
 DECLARE_DEBUG_VARIABLE(bool, EnableNV12, true, "Enables NV12 extension")
 DECLARE_DEBUG_VARIABLE(bool, EnablePackedYuv, true, "Enables cl_packed_yuv extension")
 DECLARE_DEBUG_VARIABLE(bool, EnableDeferredDeleter, true, "Enables async deleter")
@@ -444,10 +465,14 @@ DECLARE_DEBUG_VARIABLE(int32_t, EnablePassInlineData, -1, "-1: default, 0: Do no
 DECLARE_DEBUG_VARIABLE(int32_t, ForceFineGrainedSVMSupport, -1, "-1: default, 0: Do not report Fine Grained SVM capabilities 1: Report SVM Fine Grained capabilities if device supports SVM")
 DECLARE_DEBUG_VARIABLE(int32_t, ForcePipeSupport, -1, "-1: default, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, UseAsyncDrmExec, -1, "-1: default, 0: Disabled 1: Enabled. If enabled, pass EXEC_OBJECT_ASYNC to exec ioctl.")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableDrmExecObjectsReuse, -1, "-1: default (enabled), 0: Disabled 1: Enabled. If enabled, exec objects of buffer objects repeated at the same position across submissions are not refilled.")
 DECLARE_DEBUG_VARIABLE(int32_t, UseBindlessMode, -1, "Use precompiled builtins in bindless mode, -1: api dependent, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideSlmSize, -1, "Force different slm size than default in kB")
 DECLARE_DEBUG_VARIABLE(int32_t, UseCyclesPerSecondTimer, 0, "0: default behavior, 0: disabled: Report L0 timer in nanosecond units, 1: enabled: Report L0 timer in cycles per second")
 DECLARE_DEBUG_VARIABLE(int32_t, WaitLoopCount, -1, "-1: use default, >=0: number of iterations in wait loop")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableAdaptiveWaitSpin, -1, "-1: default (disabled), 0: disabled, 1: enabled. Poll task count without yielding for the time most of previous waits on given CSR took to complete")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableHostWaitMultiplexer, -1, "-1: default (disabled), 0: disabled, 1: enabled. Host waits on events park on per device condition variables and single poller thread checks completion of all waits")
+DECLARE_DEBUG_VARIABLE(int32_t, HostWaitMultiplexerPollIntervalUs, -1, "-1: default (20), >=0: time in microseconds host wait multiplexer poller sleeps between poll rounds, doubled up to 1ms while no waiter is woken, 0 means yield only")
 DECLARE_DEBUG_VARIABLE(int32_t, GTPinAllocateBufferInSharedMemory, -1, "Force GTPin to allocate buffer in shared memory")
 DECLARE_DEBUG_VARIABLE(int32_t, AlignLocalMemoryVaTo2MB, -1, "Allow 2MB pages for allocations with size>=2MB. On Linux it means aligned VA, on Windows it means aligned size. -1: default, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableUserFenceForCompletionWait, -1, "-1: default (disabled), 0: disable, 1: enable : Use Wait User Fence instead Gem Wait")
@@ -490,12 +515,14 @@ DECLARE_DEBUG_VARIABLE(int32_t, ProgramWalkerPartitionSelfCleanup, -1, "-1: defa
 DECLARE_DEBUG_VARIABLE(int32_t, ProgramStallCommandForSelfCleanup, -1, "-1: default (disabled), 0: Do not add extra PIPE_CONTROL for each self cleanup x-tile sync, 1: Add extra PIPE_CONTROL for each self cleanup x-tile sync")
 DECLARE_DEBUG_VARIABLE(int32_t, WparidRegisterProgramming, -1, "-1: default (enabled), 0: do not program wparid register, 1: programming wparid register")
 DECLARE_DEBUG_VARIABLE(int32_t, UsePipeControlAfterPartitionedWalker, -1, "-1: default (enabled), 0: do not add PipeControl, 1: add PipeControl")
+DECLARE_DEBUG_VARIABLE(int32_t, LocalIdsCacheSize, -1, "-1: default (32), >0: number of entries in local ids cache shared by kernels with the same local ids layout")
 
 /*EXPERIMENTAL TOGGLES*/
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalSetWalkerPartitionCount, 0, "Experimental implementation: Set number of COMPUTE_WALKERs for a given Partition Type, 0 - do not set the feature.")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalSetWalkerPartitionType, -1, "Experimental implementation: Set COMPUTE_WALKER Partition Type. Valid values for types from 1 to 3")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalEnableCustomLocalMemoryAlignment, 0, "Align local memory allocations to a given value. Works only with allocations at least as big as the value.  0: no effect, 2097152: 2 megabytes, 1073741824: 1 gigabyte")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalEnableDeviceAllocationCache, -1, "Experimentally enable allocation cache.")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalEnableHostAllocationCache, -1, "Experimentally enable host allocation cache.")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalH2DCpuCopyThreshold, -1, "Override default threshold (in bytes) for H2D CPU copy.")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalD2HCpuCopyThreshold, -1, "Override default threshold (in bytes) for D2H CPU copy.")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalCopyThroughLock, -1, "Experimentally copy memory through locked ptr. -1: default 0: disable 1: enable ")
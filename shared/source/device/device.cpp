@@ -27,6 +27,8 @@
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/os_interface/os_time.h"
 #include "shared/source/program/sync_buffer_handler.h"
+#include "shared/source/utilities/deferred_submission_flusher.h"
+#include "shared/source/utilities/host_wait_multiplexer.h"
 #include "shared/source/utilities/software_tags_manager.h"
 
 namespace NEO {
@@ -47,6 +49,8 @@ Device::Device(ExecutionEnvironment *executionEnvironment, const uint32_t rootDe
 }
 
 Device::~Device() {
+    hostWaitMultiplexer.reset();
+    deferredSubmissionFlusher.reset();
     finalizeRayTracing();
 
     DEBUG_BREAK_IF(nullptr == executionEnvironment->memoryManager.get());
@@ -572,6 +576,34 @@ void Device::allocateSyncBufferHandler() {
     }
 }
 
+HostWaitMultiplexer *Device::getHostWaitMultiplexer() {
+    if (isSubDevice()) {
+        return getRootDevice()->getHostWaitMultiplexer();
+    }
+    std::call_once(hostWaitMultiplexerCreated, [this]() {
+        auto pollInterval = HostWaitMultiplexer::defaultPollInterval;
+        if (DebugManager.flags.HostWaitMultiplexerPollIntervalUs.get() != -1) {
+            pollInterval = std::chrono::microseconds(DebugManager.flags.HostWaitMultiplexerPollIntervalUs.get());
+        }
+        hostWaitMultiplexer = std::make_unique<HostWaitMultiplexer>(pollInterval);
+    });
+    return hostWaitMultiplexer.get();
+}
+
+DeferredSubmissionFlusher *Device::getDeferredSubmissionFlusher() {
+    if (isSubDevice()) {
+        return getRootDevice()->getDeferredSubmissionFlusher();
+    }
+    std::call_once(deferredSubmissionFlusherCreated, [this]() {
+        auto idleFlushInterval = DeferredSubmissionFlusher::defaultIdleFlushInterval;
+        if (DebugManager.flags.ImmediateCmdListCoalescingTimeoutUs.get() != -1) {
+            idleFlushInterval = std::chrono::microseconds(DebugManager.flags.ImmediateCmdListCoalescingTimeoutUs.get());
+        }
+        deferredSubmissionFlusher = std::make_unique<DeferredSubmissionFlusher>(idleFlushInterval);
+    });
+    return deferredSubmissionFlusher.get();
+}
+
 uint64_t Device::getGlobalMemorySize(uint32_t deviceBitfield) const {
     auto globalMemorySize = getMemoryManager()->isLocalMemorySupported(this->getRootDeviceIndex())
                                 ? getMemoryManager()->getLocalMemorySize(this->getRootDeviceIndex(), deviceBitfield)
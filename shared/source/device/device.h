@@ -17,6 +17,7 @@
 #include "shared/source/utilities/reference_tracked_object.h"
 
 #include <array>
+#include <mutex>
 
 namespace NEO {
 class BindlessHeapsHelper;
@@ -26,6 +27,8 @@ class ExecutionEnvironment;
 class Debugger;
 class GmmClientContext;
 class GmmHelper;
+class DeferredSubmissionFlusher;
+class HostWaitMultiplexer;
 class SyncBufferHandler;
 enum class EngineGroupType : uint32_t;
 class DebuggerL0;
@@ -125,6 +128,8 @@ class Device : public ReferenceTrackedObject<Device> {
     MOCKABLE_VIRTUAL CompilerInterface *getCompilerInterface() const;
     BuiltIns *getBuiltIns() const;
     void allocateSyncBufferHandler();
+    HostWaitMultiplexer *getHostWaitMultiplexer();
+    DeferredSubmissionFlusher *getDeferredSubmissionFlusher();
 
     uint32_t getRootDeviceIndex() const {
         return this->rootDeviceIndex;
@@ -208,6 +213,10 @@ class Device : public ReferenceTrackedObject<Device> {
     DeviceInfo deviceInfo = {};
 
     std::unique_ptr<PerformanceCounters> performanceCounters;
+    std::unique_ptr<HostWaitMultiplexer> hostWaitMultiplexer;
+    std::once_flag hostWaitMultiplexerCreated;
+    std::unique_ptr<DeferredSubmissionFlusher> deferredSubmissionFlusher;
+    std::once_flag deferredSubmissionFlusherCreated;
     std::vector<std::unique_ptr<CommandStreamReceiver>> commandStreamReceivers;
     EnginesT allEngines;
     EngineGroupsT regularEngineGroups;
@@ -155,12 +155,16 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
     context.isParsingIdent = true;
 
     while (context.pos < context.end) {
-        reserveBasedOnEstimates(outTokens, text.begin(), text.end(), context.pos);
         switch (context.pos[0]) {
-        case ' ':
-            context.lineIndent += context.isParsingIdent ? 1 : 0;
-            ++context.pos;
+        case ' ': {
+            auto spacesEnd = context.pos + 1;
+            while ((spacesEnd < context.end) && (' ' == spacesEnd[0])) {
+                ++spacesEnd;
+            }
+            context.lineIndent += context.isParsingIdent ? static_cast<uint32_t>(spacesEnd - context.pos) : 0U;
+            context.pos = spacesEnd;
             break;
+        }
         case '\t':
             if (context.isParsingIdent) {
                 context.lineIndent += 4U;
@@ -190,6 +194,7 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
         }
         case '\n': {
             reserveBasedOnEstimates(outLines, text.begin(), text.end(), context.pos);
+            reserveBasedOnEstimates(outTokens, text.begin(), text.end(), context.pos);
             if (false == tokenizeEndLine(text, outLines, outTokens, outErrReason, outWarning, context)) {
                 return false;
             }
@@ -349,10 +354,28 @@ bool isEmptyVector(const Token &token, size_t lineId, std::string &outError) {
     return true;
 }
 
+size_t getNodesCountUpperBound(const LinesCache &lines) {
+    size_t numNodes = 1U; // root
+    for (const auto &line : lines) {
+        if (isUnused(line.lineType)) {
+            continue;
+        }
+        ++numNodes;
+        if (Line::LineType::ListEntry == line.lineType) {
+            ++numNodes; // value of list entry can get split into key-value node by finalizeNode
+        }
+        if (line.traits.hasInlineDataMarkers) {
+            numNodes += line.last - line.first;
+        }
+    }
+    return numNodes;
+}
+
 bool buildTree(const LinesCache &lines, const TokensCache &tokens, NodesCache &outNodes, std::string &outErrReason, std::string &outWarning) {
     StackVec<NodeId, 64> nesting;
     size_t lineId = 0U;
     size_t lastUsedLine = 0u;
+    outNodes.reserve(outNodes.size() + getNodesCountUpperBound(lines));
     outNodes.push_back(Node());
     outNodes.rbegin()->id = 0U;
     outNodes.rbegin()->firstChildId = 1U;
@@ -368,20 +391,17 @@ bool buildTree(const LinesCache &lines, const TokensCache &tokens, NodesCache &o
             if (lineId > 0u && false == isEmptyVector(tokens[lines[lastUsedLine].first], lastUsedLine, outErrReason)) {
                 return false;
             }
-            reserveBasedOnEstimates(outNodes, static_cast<size_t>(0U), lines.size(), lineId);
             auto &prev = *outNodes.rbegin();
             auto &parent = outNodes[*nesting.rbegin()];
             auto &curr = addNode(outNodes, prev, parent);
             curr.indent = currLineIndent;
         } else if (currLineIndent > outNodes.rbegin()->indent) {
-            reserveBasedOnEstimates(outNodes, static_cast<size_t>(0U), lines.size(), lineId);
             auto &parent = *outNodes.rbegin();
             auto &curr = addNode(outNodes, parent);
             curr.indent = currLineIndent;
             nesting.push_back(parent.id);
         } else {
             while (currLineIndent < outNodes[*nesting.rbegin()].indent) {
-                reserveBasedOnEstimates(outNodes, static_cast<size_t>(0U), lines.size(), lineId);
                 finalizeNode(*nesting.rbegin(), tokens, outNodes, outErrReason, outWarning);
                 UNRECOVERABLE_IF(nesting.empty());
                 nesting.pop_back();
@@ -391,7 +411,6 @@ bool buildTree(const LinesCache &lines, const TokensCache &tokens, NodesCache &o
                 outErrReason = constructYamlError(lineId, tokens[lines[lineId].first].pos, tokens[lines[lineId].first].pos + 1, "Invalid indentation");
                 return false;
             } else {
-                reserveBasedOnEstimates(outNodes, static_cast<size_t>(0U), lines.size(), lineId);
                 auto &prev = outNodes[*nesting.rbegin()];
                 auto &parent = outNodes[prev.parentId];
                 auto &curr = addNode(outNodes, prev, parent);
@@ -415,8 +434,6 @@ bool buildTree(const LinesCache &lines, const TokensCache &tokens, NodesCache &o
                 for (auto currTokenId = collectionBeg + 1; currTokenId < collectionEnd; currTokenId += 2) {
                     auto tokenType = tokens[currTokenId].traits.type;
                     UNRECOVERABLE_IF(tokenType != Token::Type::LiteralNumber && tokenType != Token::Type::LiteralString);
-                    reserveBasedOnEstimates(outNodes, static_cast<size_t>(0U), lines.size(), lineId);
-
                     auto &parentNode = outNodes[parentNodeId];
                     if (previousSiblingId == std::numeric_limits<size_t>::max()) {
                         addNode(outNodes, parentNode);
@@ -445,7 +462,6 @@ bool buildTree(const LinesCache &lines, const TokensCache &tokens, NodesCache &o
         lastUsedLine = lineId;
         ++lineId;
     }
-    outNodes.reserve(outNodes.size() + nesting.size());
     while (false == nesting.empty()) {
         finalizeNode(*nesting.rbegin(), tokens, outNodes, outErrReason, outWarning);
         nesting.pop_back();
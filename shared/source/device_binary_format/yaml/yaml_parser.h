@@ -326,6 +326,8 @@ constexpr bool isUnused(Line::LineType lineType) {
     }
 }
 
+size_t getNodesCountUpperBound(const LinesCache &lines);
+
 bool buildTree(const LinesCache &lines, const TokensCache &tokens, NodesCache &outNodes, std::string &outErrReason, std::string &outWarning);
 
 inline const Node *findChildByKey(const Node &parent, const NodesCache &allNodes, const TokensCache &allTokens, const ConstStringRef key) {
@@ -40,6 +40,17 @@ struct TagData {
     uint64_t tagValue = 0ull;
 };
 
+struct DirectSubmissionTelemetry {
+    uint64_t dispatches = 0u;
+    uint64_t dispatchedBytes = 0u;
+    uint64_t semaphoreUpdates = 0u;
+    uint64_t prefetchMitigationBytes = 0u;
+    uint64_t ringSwitches = 0u;
+    uint64_t ringBufferAllocations = 0u;
+    uint64_t ringBufferAllocationTimeNs = 0u;
+    uint64_t ringBufferBusyWraps = 0u;
+};
+
 enum class DirectSubmissionSfenceMode : int32_t {
     Disabled = 0,
     BeforeSemaphoreOnly = 1,
@@ -96,6 +107,10 @@ class DirectSubmissionHw {
 
     virtual void flushMonitorFence(){};
 
+    const DirectSubmissionTelemetry &getTelemetry() const {
+        return telemetry;
+    }
+
   protected:
     static constexpr size_t prefetchSize = 8 * MemoryConstants::cacheLineSize;
     static constexpr size_t prefetchNoops = prefetchSize / sizeof(uint32_t);
@@ -114,6 +129,8 @@ class DirectSubmissionHw {
     virtual uint64_t switchRingBuffers();
     virtual void handleSwitchRingBuffers() = 0;
     GraphicsAllocation *switchRingBuffersAllocations();
+    GraphicsAllocation *allocateRingBuffer();
+    uint32_t getRingBufferGrowCount() const;
     virtual uint64_t updateTagValue(bool requireMonitorFence) = 0;
     virtual bool dispatchMonitorFenceRequired(bool requireMonitorFence);
     virtual void getTagAddressValue(TagData &tagData) = 0;
@@ -193,6 +210,7 @@ class DirectSubmissionHw {
 
     LinearStream ringCommandStream;
     std::unique_ptr<DirectSubmissionDiagnosticsCollector> diagnostic;
+    DirectSubmissionTelemetry telemetry;
 
     uint64_t semaphoreGpuVa = 0u;
     uint64_t gpuVaForMiFlush = 0u;
@@ -227,6 +245,7 @@ class DirectSubmissionHw {
     uint32_t dispatchErrorCode = 0;
 
     bool ringStart = false;
+    bool adaptiveRingBufferPreallocation = false;
     bool disableCpuCacheFlush = true;
     bool disableCacheFlush = false;
     bool disableMonitorFence = false;
@@ -35,6 +35,7 @@
 #include "create_direct_submission_hw.inl"
 
 #include <algorithm>
+#include <chrono>
 #include <cstring>
 
 namespace NEO {
@@ -59,6 +60,15 @@ DirectSubmissionHw<GfxFamily, Dispatcher>::DirectSubmissionHw(const DirectSubmis
         this->maxRingBufferCount = DebugManager.flags.DirectSubmissionMaxRingBuffers.get();
     }
 
+    if (DebugManager.flags.DirectSubmissionInitialRingBuffers.get() != -1) {
+        auto initialRingBufferCount = std::min(static_cast<uint32_t>(DebugManager.flags.DirectSubmissionInitialRingBuffers.get()), this->maxRingBufferCount);
+        this->ringBuffers.resize(std::max(initialRingBufferCount, RingBufferUse::initialRingBufferCount));
+    }
+
+    if (DebugManager.flags.DirectSubmissionAdaptiveRingBufferPreallocation.get() != -1) {
+        this->adaptiveRingBufferPreallocation = !!DebugManager.flags.DirectSubmissionAdaptiveRingBufferPreallocation.get();
+    }
+
     if (DebugManager.flags.DirectSubmissionDisableCacheFlush.get() != -1) {
         disableCacheFlush = !!DebugManager.flags.DirectSubmissionDisableCacheFlush.get();
     }
@@ -308,12 +318,19 @@ void DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchRelaxedOrderingScheduler
 }
 
 template <typename GfxFamily, typename Dispatcher>
-DirectSubmissionHw<GfxFamily, Dispatcher>::~DirectSubmissionHw() = default;
+DirectSubmissionHw<GfxFamily, Dispatcher>::~DirectSubmissionHw() {
+    PRINT_DEBUG_STRING(DebugManager.flags.DirectSubmissionPrintTelemetry.get(), stdout,
+                       "Direct submission telemetry, engine %u: dispatches %llu, dispatched bytes %llu, semaphore updates %llu, prefetch mitigation bytes %llu, "
+                       "ring switches %llu, ring buffer allocations %llu (%llu ns), busy ring buffer wraps %llu\n",
+                       static_cast<uint32_t>(osContext.getEngineType()),
+                       static_cast<unsigned long long>(telemetry.dispatches), static_cast<unsigned long long>(telemetry.dispatchedBytes),
+                       static_cast<unsigned long long>(telemetry.semaphoreUpdates), static_cast<unsigned long long>(telemetry.prefetchMitigationBytes),
+                       static_cast<unsigned long long>(telemetry.ringSwitches), static_cast<unsigned long long>(telemetry.ringBufferAllocations),
+                       static_cast<unsigned long long>(telemetry.ringBufferAllocationTimeNs), static_cast<unsigned long long>(telemetry.ringBufferBusyWraps));
+}
 
 template <typename GfxFamily, typename Dispatcher>
-bool DirectSubmissionHw<GfxFamily, Dispatcher>::allocateResources() {
-    DirectSubmissionAllocations allocations;
-
+GraphicsAllocation *DirectSubmissionHw<GfxFamily, Dispatcher>::allocateRingBuffer() {
     bool isMultiOsContextCapable = osContext.getNumSupportedDevices() > 1u;
     constexpr size_t minimumRequiredSize = 256 * MemoryConstants::kiloByte;
     constexpr size_t additionalAllocationSize = MemoryConstants::pageSize;
@@ -322,13 +339,21 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::allocateResources() {
                                                                  true, allocationSize,
                                                                  AllocationType::RING_BUFFER,
                                                                  isMultiOsContextCapable, false, osContext.getDeviceBitfield()};
+    return memoryManager->allocateGraphicsMemoryWithProperties(commandStreamAllocationProperties);
+}
+
+template <typename GfxFamily, typename Dispatcher>
+bool DirectSubmissionHw<GfxFamily, Dispatcher>::allocateResources() {
+    DirectSubmissionAllocations allocations;
+
+    bool isMultiOsContextCapable = osContext.getNumSupportedDevices() > 1u;
 
-    for (uint32_t ringBufferIndex = 0; ringBufferIndex < RingBufferUse::initialRingBufferCount; ringBufferIndex++) {
-        auto ringBuffer = memoryManager->allocateGraphicsMemoryWithProperties(commandStreamAllocationProperties);
+    for (uint32_t ringBufferIndex = 0; ringBufferIndex < this->ringBuffers.size(); ringBufferIndex++) {
+        auto ringBuffer = allocateRingBuffer();
         this->ringBuffers[ringBufferIndex].ringBuffer = ringBuffer;
         UNRECOVERABLE_IF(ringBuffer == nullptr);
         allocations.push_back(ringBuffer);
-        memset(ringBuffer->getUnderlyingBuffer(), 0, allocationSize);
+        memset(ringBuffer->getUnderlyingBuffer(), 0, ringBuffer->getUnderlyingBufferSize());
     }
 
     const AllocationProperties semaphoreAllocationProperties{rootDeviceIndex,
@@ -421,6 +446,7 @@ inline void DirectSubmissionHw<GfxFamily, Dispatcher>::unblockGpu() {
     }
 
     semaphoreData->queueWorkCount = currentQueueWorkCount;
+    telemetry.semaphoreUpdates++;
 
     if (sfenceMode == DirectSubmissionSfenceMode::BeforeAndAfterSemaphore) {
         CpuIntrinsics::sfence();
@@ -602,6 +628,7 @@ inline void DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchSemaphoreSection(
     }
 
     dispatchPrefetchMitigation();
+    telemetry.prefetchMitigationBytes += getSizePrefetchMitigation();
     dispatchDisablePrefetcher(false);
 }
 
@@ -982,6 +1009,8 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchCommandBuffer(BatchBuffe
     cpuCachelineFlush(semaphorePtr, MemoryConstants::cacheLineSize);
     currentQueueWorkCount++;
     DirectSubmissionDiagnostics::diagnosticModeOneSubmit(diagnostic.get());
+    telemetry.dispatches++;
+    telemetry.dispatchedBytes += dispatchSize;
 
     uint64_t flushValue = updateTagValue(batchBuffer.hasStallingCmds);
     flushStamp.setStamp(flushValue);
@@ -1037,6 +1066,7 @@ void DirectSubmissionHw<GfxFamily, Dispatcher>::switchRingBuffersNeeded(size_t s
 template <typename GfxFamily, typename Dispatcher>
 inline uint64_t DirectSubmissionHw<GfxFamily, Dispatcher>::switchRingBuffers() {
     GraphicsAllocation *nextRingBuffer = switchRingBuffersAllocations();
+    telemetry.ringSwitches++;
     void *flushPtr = ringCommandStream.getSpace(0);
     uint64_t currentBufferGpuVa = ringCommandStream.getCurrentGpuAddressPosition();
 
@@ -1069,26 +1099,41 @@ inline GraphicsAllocation *DirectSubmissionHw<GfxFamily, Dispatcher>::switchRing
         if (this->ringBuffers.size() == this->maxRingBufferCount) {
             this->currentRingBuffer = (this->currentRingBuffer + 1) % this->ringBuffers.size();
             nextAllocation = this->ringBuffers[this->currentRingBuffer].ringBuffer;
+            telemetry.ringBufferBusyWraps++;
         } else {
-            bool isMultiOsContextCapable = osContext.getNumSupportedDevices() > 1u;
-            constexpr size_t minimumRequiredSize = 256 * MemoryConstants::kiloByte;
-            constexpr size_t additionalAllocationSize = MemoryConstants::pageSize;
-            const auto allocationSize = alignUp(minimumRequiredSize + additionalAllocationSize, MemoryConstants::pageSize64k);
-            const AllocationProperties commandStreamAllocationProperties{rootDeviceIndex,
-                                                                         true, allocationSize,
-                                                                         AllocationType::RING_BUFFER,
-                                                                         isMultiOsContextCapable, false, osContext.getDeviceBitfield()};
-            nextAllocation = memoryManager->allocateGraphicsMemoryWithProperties(commandStreamAllocationProperties);
+            auto allocationStart = std::chrono::steady_clock::now();
+            auto ringBufferGrowCount = getRingBufferGrowCount();
+
+            DirectSubmissionAllocations newRingBuffers;
             this->currentRingBuffer = static_cast<uint32_t>(this->ringBuffers.size());
-            this->ringBuffers.emplace_back(0ull, nextAllocation);
-            auto ret = memoryOperationHandler->makeResidentWithinOsContext(&this->osContext, ArrayRef<GraphicsAllocation *>(&nextAllocation, 1u), false) == MemoryOperationsStatus::SUCCESS;
+            for (uint32_t i = 0; i < ringBufferGrowCount; i++) {
+                auto ringBuffer = allocateRingBuffer();
+                this->ringBuffers.emplace_back(0ull, ringBuffer);
+                newRingBuffers.push_back(ringBuffer);
+            }
+            nextAllocation = newRingBuffers[0];
+            auto ret = memoryOperationHandler->makeResidentWithinOsContext(&this->osContext, ArrayRef<GraphicsAllocation *>(newRingBuffers.begin(), newRingBuffers.size()), false) == MemoryOperationsStatus::SUCCESS;
             UNRECOVERABLE_IF(!ret);
+
+            telemetry.ringBufferAllocations += ringBufferGrowCount;
+            telemetry.ringBufferAllocationTimeNs += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - allocationStart).count());
         }
     }
     UNRECOVERABLE_IF(this->currentRingBuffer == this->previousRingBuffer);
     return nextAllocation;
 }
 
+template <typename GfxFamily, typename Dispatcher>
+uint32_t DirectSubmissionHw<GfxFamily, Dispatcher>::getRingBufferGrowCount() const {
+    if (!this->adaptiveRingBufferPreallocation) {
+        return 1u;
+    }
+    // every ring is still in flight, so submissions outpace the GPU - double the ring count
+    // in one step so following switches within the burst do not hit allocation path again
+    auto currentRingBufferCount = static_cast<uint32_t>(this->ringBuffers.size());
+    return std::max(1u, std::min(currentRingBufferCount, this->maxRingBufferCount - currentRingBufferCount));
+}
+
 template <typename GfxFamily, typename Dispatcher>
 bool DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchMonitorFenceRequired(bool requireMonitorFence) {
     return !this->disableMonitorFence;
@@ -161,7 +161,8 @@ bool DrmDirectSubmission<GfxFamily, Dispatcher>::submit(uint64_t gpuAddress, siz
                                           0,
                                           &execObject,
                                           completionFenceGpuAddress,
-                                          completionValue);
+                                          completionValue,
+                                          false);
             if (errorCode != 0) {
                 this->dispatchErrorCode = errorCode;
                 ret = false;
@@ -25,6 +25,7 @@
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/os_interface/product_helper.h"
 #include "shared/source/utilities/wait_util.h"
+#include "shared/source/utilities/worker_pool.h"
 
 namespace NEO {
 ExecutionEnvironment::ExecutionEnvironment() {
@@ -120,6 +121,18 @@ DirectSubmissionController *ExecutionEnvironment::initializeDirectSubmissionCont
     return directSubmissionController.get();
 }
 
+WorkerPool *ExecutionEnvironment::getWorkerPool() {
+    std::lock_guard<std::mutex> lockForInit(initializeWorkerPoolMutex);
+    if (this->workerPool == nullptr) {
+        auto numWorkers = WorkerPool::getDefaultNumWorkers();
+        if (DebugManager.flags.ModuleInitializationWorkers.get() != -1) {
+            numWorkers = static_cast<size_t>(std::max(DebugManager.flags.ModuleInitializationWorkers.get(), 1)) - 1;
+        }
+        this->workerPool = std::make_unique<WorkerPool>(numWorkers);
+    }
+    return workerPool.get();
+}
+
 void ExecutionEnvironment::prepareRootDeviceEnvironments(uint32_t numRootDevices) {
     if (rootDeviceEnvironments.size() < numRootDevices) {
         rootDeviceEnvironments.resize(numRootDevices);
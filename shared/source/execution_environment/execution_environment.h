@@ -17,6 +17,7 @@ namespace NEO {
 class DirectSubmissionController;
 class GfxCoreHelper;
 class MemoryManager;
+class WorkerPool;
 struct OsEnvironment;
 struct RootDeviceEnvironment;
 
@@ -61,9 +62,11 @@ class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment>
     bool isFP64EmulationEnabled() const { return fp64EmulationEnabled; }
 
     DirectSubmissionController *initializeDirectSubmissionController();
+    WorkerPool *getWorkerPool();
 
     std::unique_ptr<MemoryManager> memoryManager;
     std::unique_ptr<DirectSubmissionController> directSubmissionController;
+    std::unique_ptr<WorkerPool> workerPool;
     std::unique_ptr<OsEnvironment> osEnvironment;
     std::vector<std::unique_ptr<RootDeviceEnvironment>> rootDeviceEnvironments;
     void releaseRootDeviceEnvironmentResources(RootDeviceEnvironment *rootDeviceEnvironment);
@@ -85,5 +88,6 @@ class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment>
     DebuggingMode debuggingEnabledMode = DebuggingMode::Disabled;
     std::unordered_map<uint32_t, uint32_t> rootDeviceNumCcsMap;
     std::mutex initializeDirectSubmissionControllerMutex;
+    std::mutex initializeWorkerPoolMutex;
 };
 } // namespace NEO
@@ -18,6 +18,7 @@ namespace NEO {
 
 struct uint16x8_t;
 struct uint16x16_t;
+struct uint16x32_t;
 
 // This is the initial value of SIMD for local ID
 // computation.  It correlates to the SIMD lane.
@@ -40,6 +41,12 @@ LocalIDHelper::LocalIDHelper() {
         LocalIDHelper::generateSimd16 = generateLocalIDsSimd<uint16x16_t, 16>;
         LocalIDHelper::generateSimd32 = generateLocalIDsSimd<uint16x16_t, 32>;
     }
+#if COMPILER_SUPPORTS_AVX512BW
+    bool supportsAVX512BW = CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX512Bw);
+    if (supportsAVX512BW) {
+        LocalIDHelper::generateSimd32 = generateLocalIDsSimd<uint16x32_t, 32>;
+    }
+#endif
 }
 
 LocalIDHelper LocalIDHelper::initializer;
@@ -0,0 +1,17 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#if __AVX512BW__
+#include "shared/source/helpers/local_id_gen.inl"
+#include "shared/source/helpers/uint16_avx512.h"
+
+#include <array>
+
+namespace NEO {
+template void generateLocalIDsSimd<uint16x32_t, 32>(void *b, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t threadsPerWorkGroup, const std::array<uint8_t, 3> &dimensionsOrder, bool chooseMaxRowSize);
+} // namespace NEO
+#endif
@@ -7,31 +7,75 @@
 
 #include "shared/source/kernel/local_ids_cache.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/local_id_gen.h"
 #include "shared/source/helpers/simd_helper.h"
 
+#include <algorithm>
 #include <cstring>
 
 namespace NEO {
 
 LocalIdsCache::LocalIdsCache(size_t cacheSize, std::array<uint8_t, 3> wgDimOrder, uint8_t simdSize, uint8_t grfSize, bool usesOnlyImages)
-    : wgDimOrder(wgDimOrder), localIdsSizePerThread(getPerThreadSizeLocalIDs(static_cast<uint32_t>(simdSize), static_cast<uint32_t>(grfSize))),
-      grfSize(grfSize), simdSize(simdSize), usesOnlyImages(usesOnlyImages) {
+    : cache(cacheSize), sets((cacheSize + waysPerSet - 1) / waysPerSet), wgDimOrder(wgDimOrder), numSets((cacheSize + waysPerSet - 1) / waysPerSet),
+      localIdsSizePerThread(getPerThreadSizeLocalIDs(static_cast<uint32_t>(simdSize), static_cast<uint32_t>(grfSize))),
+      grfSize(grfSize), simdSize(simdSize), usesOnlyImages(usesOnlyImages), collectStatistics(DebugManager.flags.PrintLocalIdsCacheStatistics.get()) {
     UNRECOVERABLE_IF(cacheSize == 0)
-    cache.resize(cacheSize);
 }
 
 LocalIdsCache::~LocalIdsCache() {
+    PRINT_DEBUG_STRING(DebugManager.flags.PrintLocalIdsCacheStatistics.get(), stdout,
+                       "LocalIdsCache simd: %u, grfSize: %u, entries: %zu, hits: %llu, misses: %llu\n",
+                       static_cast<uint32_t>(simdSize), static_cast<uint32_t>(grfSize), cache.size(),
+                       static_cast<unsigned long long>(getHitCount()), static_cast<unsigned long long>(getMissCount()));
     for (auto &cacheEntry : cache) {
-        alignedFree(cacheEntry.localIdsData);
+        alignedFree(cacheEntry.localIdsData.load());
     }
+    for (auto localIdsData : retiredLocalIdsData) {
+        alignedFree(localIdsData);
+    }
+}
+
+uint64_t LocalIdsCache::getLayoutKey(std::array<uint8_t, 3> wgDimOrder, uint8_t simdSize, uint8_t grfSize, bool usesOnlyImages) {
+    return static_cast<uint64_t>(wgDimOrder[0]) |
+           static_cast<uint64_t>(wgDimOrder[1]) << 8 |
+           static_cast<uint64_t>(wgDimOrder[2]) << 16 |
+           static_cast<uint64_t>(simdSize) << 24 |
+           static_cast<uint64_t>(grfSize) << 32 |
+           static_cast<uint64_t>(usesOnlyImages) << 40;
+}
+
+size_t LocalIdsCache::getSharedCacheSize() {
+    if (DebugManager.flags.LocalIdsCacheSize.get() > 0) {
+        return static_cast<size_t>(DebugManager.flags.LocalIdsCacheSize.get());
+    }
+    return defaultSharedCacheSize;
+}
+
+uint64_t LocalIdsCache::getGroupSizeKey(const Vec3<uint16_t> &group) {
+    // valid bit distinguishes any group size from an empty entry
+    return static_cast<uint64_t>(group[0]) |
+           static_cast<uint64_t>(group[1]) << 16 |
+           static_cast<uint64_t>(group[2]) << 32 |
+           1ULL << 48;
 }
 
-std::unique_lock<std::mutex> LocalIdsCache::lock() {
-    return std::unique_lock<std::mutex>(setLocalIdsMutex);
+size_t LocalIdsCache::getSetIndex(const Vec3<uint16_t> &group) const {
+    const auto hash = (static_cast<size_t>(group[0]) * 31U + group[1]) * 31U + group[2];
+    return hash % numSets;
+}
+
+LocalIdsCache::LocalIdsCacheEntry *LocalIdsCache::findEntryInSet(uint64_t groupSizeKey, size_t setIndex) {
+    const auto setEnd = std::min((setIndex + 1) * waysPerSet, cache.size());
+    for (auto entryIndex = setIndex * waysPerSet; entryIndex < setEnd; entryIndex++) {
+        if (cache[entryIndex].groupSizeKey.load(std::memory_order_relaxed) == groupSizeKey) {
+            return &cache[entryIndex];
+        }
+    }
+    return nullptr;
 }
 
 size_t LocalIdsCache::getLocalIdsSizeForGroup(const Vec3<uint16_t> &group, const GfxCoreHelper &gfxCoreHelper) const {
@@ -47,39 +91,92 @@ size_t LocalIdsCache::getLocalIdsSizePerThread() const {
     return localIdsSizePerThread;
 }
 
-void LocalIdsCache::setLocalIdsForEntry(LocalIdsCacheEntry &entry, void *destination) {
-    entry.accessCounter++;
-    std::memcpy(destination, entry.localIdsData, entry.localIdsSize);
+bool LocalIdsCache::trySetLocalIdsFromSet(uint64_t groupSizeKey, size_t setIndex, void *destination) {
+    auto &set = sets[setIndex];
+    const auto sequence = set.sequence.load(std::memory_order_acquire);
+    if (sequence & 1U) {
+        return false;
+    }
+    auto cacheEntry = findEntryInSet(groupSizeKey, setIndex);
+    if (cacheEntry == nullptr) {
+        return false;
+    }
+    const auto localIdsData = cacheEntry->localIdsData.load(std::memory_order_relaxed);
+    const auto localIdsSize = cacheEntry->localIdsSize.load(std::memory_order_relaxed);
+
+    // data and size must belong to the looked up group before copying, data is validated again after copying
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (set.sequence.load(std::memory_order_relaxed) != sequence) {
+        return false;
+    }
+    std::memcpy(destination, localIdsData, localIdsSize);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (set.sequence.load(std::memory_order_relaxed) != sequence) {
+        return false;
+    }
+
+    if (false == cacheEntry->referenced.load(std::memory_order_relaxed)) {
+        cacheEntry->referenced.store(true, std::memory_order_relaxed);
+    }
+    return true;
 }
 
-void LocalIdsCache::setLocalIdsForGroup(const Vec3<uint16_t> &group, void *destination, const GfxCoreHelper &gfxCoreHelper) {
-    auto setLocalIdsLock = lock();
-    LocalIdsCacheEntry *leastAccessedEntry = &cache[0];
-    for (auto &cacheEntry : cache) {
-        if (cacheEntry.groupSize == group) {
-            return setLocalIdsForEntry(cacheEntry, destination);
+LocalIdsCache::LocalIdsCacheEntry &LocalIdsCache::selectEntryToEvict(size_t setIndex) {
+    auto &set = sets[setIndex];
+    const auto setBegin = setIndex * waysPerSet;
+    const auto numEntriesInSet = std::min(setBegin + waysPerSet, cache.size()) - setBegin;
+    while (true) {
+        auto &cacheEntry = cache[setBegin + set.clockHand];
+        set.clockHand = (set.clockHand + 1) % numEntriesInSet;
+        if (false == cacheEntry.referenced.exchange(false, std::memory_order_relaxed)) {
+            return cacheEntry;
         }
+    }
+}
 
-        if (cacheEntry.accessCounter < leastAccessedEntry->accessCounter) {
-            leastAccessedEntry = &cacheEntry;
-        }
+void LocalIdsCache::setLocalIdsForGroup(const Vec3<uint16_t> &group, void *destination, const GfxCoreHelper &gfxCoreHelper) {
+    const auto groupSizeKey = getGroupSizeKey(group);
+    const auto setIndex = getSetIndex(group);
+    if (trySetLocalIdsFromSet(groupSizeKey, setIndex, destination)) {
+        countAccess(hitCount);
+        return;
     }
 
-    commitNewEntry(*leastAccessedEntry, group, gfxCoreHelper);
-    setLocalIdsForEntry(*leastAccessedEntry, destination);
+    std::lock_guard<std::mutex> lock(commitMutex);
+    auto cacheEntry = findEntryInSet(groupSizeKey, setIndex);
+    if (cacheEntry == nullptr) {
+        countAccess(missCount);
+        auto &set = sets[setIndex];
+        cacheEntry = &selectEntryToEvict(setIndex);
+
+        set.sequence.fetch_add(1U, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        commitNewEntry(*cacheEntry, group, gfxCoreHelper);
+        set.sequence.fetch_add(1U, std::memory_order_release);
+    } else {
+        countAccess(hitCount);
+        cacheEntry->referenced.store(true, std::memory_order_relaxed);
+    }
+    std::memcpy(destination, cacheEntry->localIdsData.load(std::memory_order_relaxed), cacheEntry->localIdsSize.load(std::memory_order_relaxed));
 }
 
 void LocalIdsCache::commitNewEntry(LocalIdsCacheEntry &entry, const Vec3<uint16_t> &group, const GfxCoreHelper &gfxCoreHelper) {
-    entry.localIdsSize = getLocalIdsSizeForGroup(group, gfxCoreHelper);
-    entry.groupSize = group;
-    entry.accessCounter = 0U;
-    if (entry.localIdsSize > entry.localIdsSizeAllocated) {
-        alignedFree(entry.localIdsData);
-        entry.localIdsData = static_cast<uint8_t *>(alignedMalloc(entry.localIdsSize, 32));
-        entry.localIdsSizeAllocated = entry.localIdsSize;
+    const auto localIdsSize = getLocalIdsSizeForGroup(group, gfxCoreHelper);
+    auto localIdsData = entry.localIdsData.load(std::memory_order_relaxed);
+    if (localIdsSize > entry.localIdsSizeAllocated) {
+        // lock-free readers may still copy from current buffer, buffers grow geometrically to bound number of retired ones
+        if (localIdsData) {
+            retiredLocalIdsData.push_back(localIdsData);
+        }
+        entry.localIdsSizeAllocated = std::max(localIdsSize, 2 * entry.localIdsSizeAllocated);
+        localIdsData = static_cast<uint8_t *>(alignedMalloc(entry.localIdsSizeAllocated, 32));
     }
-    NEO::generateLocalIDs(entry.localIdsData, static_cast<uint16_t>(simdSize),
+    NEO::generateLocalIDs(localIdsData, static_cast<uint16_t>(simdSize),
                           {group[0], group[1], group[2]}, wgDimOrder, usesOnlyImages, grfSize, gfxCoreHelper);
+    entry.localIdsData.store(localIdsData, std::memory_order_relaxed);
+    entry.localIdsSize.store(localIdsSize, std::memory_order_relaxed);
+    entry.groupSizeKey.store(getGroupSizeKey(group), std::memory_order_relaxed);
+    entry.referenced.store(false, std::memory_order_relaxed);
 }
 
 } // namespace NEO
\ No newline at end of file
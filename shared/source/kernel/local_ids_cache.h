@@ -6,23 +6,35 @@
  */
 
 #include "shared/source/helpers/vec.h"
-#include "shared/source/utilities/stackvec.h"
 
 #include <array>
+#include <atomic>
 #include <mutex>
+#include <vector>
 
 namespace NEO {
 class GfxCoreHelper;
 class LocalIdsCache {
   public:
     struct LocalIdsCacheEntry {
-        Vec3<uint16_t> groupSize = {0, 0, 0};
-        uint8_t *localIdsData = nullptr;
-        size_t localIdsSize = 0U;
+        std::atomic<uint64_t> groupSizeKey{0U};
+        std::atomic<uint8_t *> localIdsData{nullptr};
+        std::atomic<size_t> localIdsSize{0U};
         size_t localIdsSizeAllocated = 0U;
-        size_t accessCounter = 0;
+        std::atomic<bool> referenced{false};
     };
 
+    // Hits are lock-free: set is read under its sequence counter, which is odd while a miss commits new entry into the set.
+    // Misses are serialized and evict with CLOCK, buffers of evicted entries are retired instead of freed while readers may use them.
+    struct LocalIdsCacheSet {
+        std::atomic<uint32_t> sequence{0U};
+        size_t clockHand = 0U;
+    };
+
+    // Entries are grouped into sets of waysPerSet, a group size is looked up only within the set selected by its hash.
+    static constexpr size_t waysPerSet = 4U;
+    static constexpr size_t defaultSharedCacheSize = 32U;
+
     LocalIdsCache() = delete;
     LocalIdsCache(LocalIdsCache &) = delete;
     LocalIdsCache &operator=(const LocalIdsCache &other) = delete;
@@ -30,21 +42,40 @@ class LocalIdsCache {
     LocalIdsCache(size_t cacheSize, std::array<uint8_t, 3> wgDimOrder, uint8_t simdSize, uint8_t grfSize, bool usesOnlyImages = false);
     ~LocalIdsCache();
 
+    static uint64_t getLayoutKey(std::array<uint8_t, 3> wgDimOrder, uint8_t simdSize, uint8_t grfSize, bool usesOnlyImages);
+    static uint64_t getGroupSizeKey(const Vec3<uint16_t> &group);
+    static size_t getSharedCacheSize();
+
     void setLocalIdsForGroup(const Vec3<uint16_t> &group, void *destination, const GfxCoreHelper &gfxCoreHelper);
     size_t getLocalIdsSizeForGroup(const Vec3<uint16_t> &group, const GfxCoreHelper &gfxCoreHelper) const;
     size_t getLocalIdsSizePerThread() const;
+    uint64_t getHitCount() const { return hitCount.load(std::memory_order_relaxed); }
+    uint64_t getMissCount() const { return missCount.load(std::memory_order_relaxed); }
 
   protected:
-    void setLocalIdsForEntry(LocalIdsCacheEntry &entry, void *destination);
+    size_t getSetIndex(const Vec3<uint16_t> &group) const;
+    LocalIdsCacheEntry *findEntryInSet(uint64_t groupSizeKey, size_t setIndex);
+    bool trySetLocalIdsFromSet(uint64_t groupSizeKey, size_t setIndex, void *destination);
+    LocalIdsCacheEntry &selectEntryToEvict(size_t setIndex);
     void commitNewEntry(LocalIdsCacheEntry &entry, const Vec3<uint16_t> &group, const GfxCoreHelper &gfxCoreHelper);
-    std::unique_lock<std::mutex> lock();
+    void countAccess(std::atomic<uint64_t> &counter) {
+        if (collectStatistics) {
+            counter.fetch_add(1U, std::memory_order_relaxed);
+        }
+    }
 
-    StackVec<LocalIdsCacheEntry, 4> cache;
-    std::mutex setLocalIdsMutex;
+    std::vector<LocalIdsCacheEntry> cache;
+    std::vector<LocalIdsCacheSet> sets;
+    std::vector<uint8_t *> retiredLocalIdsData;
+    std::mutex commitMutex;
+    std::atomic<uint64_t> hitCount{0U};
+    std::atomic<uint64_t> missCount{0U};
     const std::array<uint8_t, 3> wgDimOrder;
+    const size_t numSets;
     const uint32_t localIdsSizePerThread;
     const uint8_t grfSize;
     const uint8_t simdSize;
     const bool usesOnlyImages;
+    const bool collectStatistics;
 };
-} // namespace NEO
\ No newline at end of file
+} // namespace NEO
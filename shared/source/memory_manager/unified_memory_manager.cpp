@@ -32,6 +32,23 @@ uint32_t SVMAllocsManager::UnifiedMemoryProperties::getRootDeviceIndex() const {
     return *rootDeviceIndices.begin();
 }
 
+struct SvmAllocationLastHit {
+    uint64_t trackerGeneration = 0u;
+    const char *baseAddress = nullptr;
+    size_t size = 0u;
+    SvmAllocationData *allocationData = nullptr;
+};
+
+// trackers (svmAllocs, svmDeferFreeAllocs, peer allocations, other managers) use separate slots selected by tracker id,
+// so lookups alternating between trackers don't evict each other's last hit
+constexpr size_t numSvmAllocationLastHitSlots = 8u;
+static std::atomic<uint64_t> svmAllocationTrackerIdCounter = 0u;
+static std::atomic<uint64_t> svmAllocationTrackerGenerationCounter = 1u;
+static thread_local SvmAllocationLastHit svmAllocationLastHits[numSvmAllocationLastHitSlots];
+
+SVMAllocsManager::MapBasedAllocationTracker::MapBasedAllocationTracker() : lastHitSlot(static_cast<size_t>(svmAllocationTrackerIdCounter++ % numSvmAllocationLastHitSlots)),
+                                                                           generation(svmAllocationTrackerGenerationCounter++) {}
+
 void SVMAllocsManager::MapBasedAllocationTracker::insert(const SvmAllocationData &allocationsPair) {
     allocations.insert(std::make_pair(reinterpret_cast<void *>(allocationsPair.gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()), allocationsPair));
 }
@@ -39,43 +56,157 @@ void SVMAllocsManager::MapBasedAllocationTracker::insert(const SvmAllocationData
 void SVMAllocsManager::MapBasedAllocationTracker::remove(const SvmAllocationData &allocationsPair) {
     SvmAllocationContainer::iterator iter;
     iter = allocations.find(reinterpret_cast<void *>(allocationsPair.gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()));
-    allocations.erase(iter);
+    this->erase(iter);
+}
+
+SVMAllocsManager::MapBasedAllocationTracker::SvmAllocationContainer::iterator SVMAllocsManager::MapBasedAllocationTracker::erase(SvmAllocationContainer::iterator iter) {
+    invalidateLastHits();
+    return allocations.erase(iter);
+}
+
+void SVMAllocsManager::MapBasedAllocationTracker::invalidateLastHits() {
+    // generations are unique across trackers, so a stale last hit never matches any live tracker
+    generation.store(svmAllocationTrackerGenerationCounter++, std::memory_order_release);
 }
 
-void SVMAllocsManager::SvmAllocationCache::insert(size_t size, void *ptr) {
-    std::lock_guard<std::mutex> lock(this->mtx);
-    allocations.emplace(std::lower_bound(allocations.begin(), allocations.end(), size), size, ptr);
+SvmAllocationData *SVMAllocsManager::MapBasedAllocationTracker::getFromLastHit(const void *ptr) const {
+    const auto &lastHit = svmAllocationLastHits[lastHitSlot];
+    if (lastHit.trackerGeneration != generation.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+    auto charPtr = reinterpret_cast<const char *>(ptr);
+    if (charPtr >= lastHit.baseAddress && charPtr < lastHit.baseAddress + lastHit.size) {
+        return lastHit.allocationData;
+    }
+    return nullptr;
+}
+
+size_t SVMAllocsManager::SvmAllocationCache::getSizeClassIndex(size_t size) {
+    if (size <= (1ull << minSizeClassShift)) {
+        return 0u;
+    }
+    const auto powerOfTwoShift = static_cast<size_t>(Math::log2(static_cast<uint64_t>(size - 1)));
+    const auto subClassIndex = ((size - 1) >> (powerOfTwoShift - subClassesPerPowerOfTwoShift)) & ((1u << subClassesPerPowerOfTwoShift) - 1);
+    const auto sizeClassIndex = ((powerOfTwoShift - minSizeClassShift) << subClassesPerPowerOfTwoShift) + subClassIndex + 1;
+    return std::min(sizeClassIndex, numSizeClasses - 1);
+}
+
+bool SVMAllocsManager::SvmAllocationCache::reserveCachedSize(uint32_t rootDeviceIndex, size_t size, size_t maxCacheSize) {
+    if (rootDeviceIndex >= this->cachedSizePerRootDevice.size()) {
+        return false;
+    }
+    auto &cachedSize = this->cachedSizePerRootDevice[rootDeviceIndex];
+    auto currentSize = cachedSize.load();
+    do {
+        if (currentSize + size > maxCacheSize) {
+            return false;
+        }
+    } while (!cachedSize.compare_exchange_weak(currentSize, currentSize + size));
+    this->totalSize += size;
+    return true;
+}
+
+void SVMAllocsManager::SvmAllocationCache::releaseCachedSize(uint32_t rootDeviceIndex, size_t size) {
+    this->cachedSizePerRootDevice[rootDeviceIndex] -= size;
+    this->totalSize -= size;
+}
+
+bool SVMAllocsManager::SvmAllocationCache::insert(size_t size, void *ptr, uint32_t rootDeviceIndex, size_t maxCacheSize) {
+    if (false == reserveCachedSize(rootDeviceIndex, size, maxCacheSize)) {
+        return false;
+    }
+    const auto sizeClassIndex = getSizeClassIndex(size);
+    auto &sizeClass = this->sizeClasses[sizeClassIndex];
+    std::lock_guard<std::mutex> lock(sizeClass.mtx);
+    sizeClass.allocations.emplace(std::lower_bound(sizeClass.allocations.begin(), sizeClass.allocations.end(), size), size, ptr, rootDeviceIndex);
+    this->nonEmptySizeClassesMask |= (1ull << sizeClassIndex);
+    return true;
+}
+
+static bool isCachedAllocationCompatible(const SvmAllocationData &svmAllocData, const SVMAllocsManager::UnifiedMemoryProperties &unifiedMemoryProperties) {
+    if (svmAllocData.allocationFlagsProperty.allFlags != unifiedMemoryProperties.allocationFlags.allFlags ||
+        svmAllocData.allocationFlagsProperty.allAllocFlags != unifiedMemoryProperties.allocationFlags.allAllocFlags) {
+        return false;
+    }
+    if (unifiedMemoryProperties.memoryType != InternalMemoryType::HOST_UNIFIED_MEMORY) {
+        return svmAllocData.device == unifiedMemoryProperties.device;
+    }
+    size_t numGpuAllocations = 0u;
+    for (auto allocation : svmAllocData.gpuAllocations.getGraphicsAllocations()) {
+        numGpuAllocations += (allocation != nullptr) ? 1u : 0u;
+    }
+    if (numGpuAllocations != unifiedMemoryProperties.rootDeviceIndices.size()) {
+        return false;
+    }
+    for (auto rootDeviceIndex : unifiedMemoryProperties.rootDeviceIndices) {
+        if (svmAllocData.gpuAllocations.getGraphicsAllocation(rootDeviceIndex) == nullptr) {
+            return false;
+        }
+    }
+    return true;
 }
 
 void *SVMAllocsManager::SvmAllocationCache::get(size_t size, const UnifiedMemoryProperties &unifiedMemoryProperties, SVMAllocsManager *svmAllocsManager) {
-    std::lock_guard<std::mutex> lock(this->mtx);
-    for (auto allocationIter = std::lower_bound(allocations.begin(), allocations.end(), size);
-         allocationIter != allocations.end();
-         ++allocationIter) {
-        void *allocationPtr = allocationIter->allocation;
-        SvmAllocationData *svmAllocData = svmAllocsManager->getSVMAlloc(allocationPtr);
-        UNRECOVERABLE_IF(!svmAllocData);
-        if (svmAllocData->device == unifiedMemoryProperties.device &&
-            svmAllocData->allocationFlagsProperty.allFlags == unifiedMemoryProperties.allocationFlags.allFlags &&
-            svmAllocData->allocationFlagsProperty.allAllocFlags == unifiedMemoryProperties.allocationFlags.allAllocFlags) {
-            allocations.erase(allocationIter);
-            return allocationPtr;
+    for (auto sizeClassIndex = getSizeClassIndex(size); sizeClassIndex < numSizeClasses; ++sizeClassIndex) {
+        const auto remainingSizeClassesMask = this->nonEmptySizeClassesMask.load() >> sizeClassIndex;
+        if (remainingSizeClassesMask == 0u) {
+            return nullptr;
+        }
+        sizeClassIndex += Math::ffs(remainingSizeClassesMask);
+
+        auto &sizeClass = this->sizeClasses[sizeClassIndex];
+        std::lock_guard<std::mutex> lock(sizeClass.mtx);
+        for (auto allocationIter = std::lower_bound(sizeClass.allocations.begin(), sizeClass.allocations.end(), size);
+             allocationIter != sizeClass.allocations.end();
+             ++allocationIter) {
+            void *allocationPtr = allocationIter->allocation;
+            SvmAllocationData *svmAllocData = svmAllocsManager->getSVMAlloc(allocationPtr);
+            UNRECOVERABLE_IF(!svmAllocData);
+            if (isCachedAllocationCompatible(*svmAllocData, unifiedMemoryProperties)) {
+                releaseCachedSize(allocationIter->rootDeviceIndex, allocationIter->allocationSize);
+                sizeClass.allocations.erase(allocationIter);
+                if (sizeClass.allocations.empty()) {
+                    this->nonEmptySizeClassesMask &= ~(1ull << sizeClassIndex);
+                }
+                return allocationPtr;
+            }
         }
     }
     return nullptr;
 }
 
 void SVMAllocsManager::SvmAllocationCache::trim(SVMAllocsManager *svmAllocsManager) {
-    std::lock_guard<std::mutex> lock(this->mtx);
-    for (auto &cachedAllocationInfo : this->allocations) {
-        SvmAllocationData *svmData = svmAllocsManager->getSVMAlloc(cachedAllocationInfo.allocation);
-        DEBUG_BREAK_IF(nullptr == svmData);
-        svmAllocsManager->freeSVMAllocImpl(cachedAllocationInfo.allocation, FreePolicyType::POLICY_NONE, svmData);
+    for (auto sizeClassIndex = 0u; sizeClassIndex < numSizeClasses; ++sizeClassIndex) {
+        auto &sizeClass = this->sizeClasses[sizeClassIndex];
+        std::lock_guard<std::mutex> lock(sizeClass.mtx);
+        for (auto &cachedAllocationInfo : sizeClass.allocations) {
+            SvmAllocationData *svmData = svmAllocsManager->getSVMAlloc(cachedAllocationInfo.allocation);
+            DEBUG_BREAK_IF(nullptr == svmData);
+            releaseCachedSize(cachedAllocationInfo.rootDeviceIndex, cachedAllocationInfo.allocationSize);
+            svmAllocsManager->freeSVMAllocImpl(cachedAllocationInfo.allocation, FreePolicyType::POLICY_NONE, svmData);
+        }
+        sizeClass.allocations.clear();
+        this->nonEmptySizeClassesMask &= ~(1ull << sizeClassIndex);
+    }
+}
+
+size_t SVMAllocsManager::SvmAllocationCache::getNumAllocations() {
+    size_t numAllocations = 0u;
+    for (auto &sizeClass : this->sizeClasses) {
+        std::lock_guard<std::mutex> lock(sizeClass.mtx);
+        numAllocations += sizeClass.allocations.size();
     }
-    this->allocations.clear();
+    return numAllocations;
 }
 
 SvmAllocationData *SVMAllocsManager::MapBasedAllocationTracker::get(const void *ptr) {
+    if (auto svmAllocData = getFromLastHit(ptr)) {
+        return svmAllocData;
+    }
+    return getFromMap(ptr);
+}
+
+SvmAllocationData *SVMAllocsManager::MapBasedAllocationTracker::getFromMap(const void *ptr) {
     if (allocations.size() == 0) {
         return nullptr;
     }
@@ -90,6 +221,7 @@ SvmAllocationData *SVMAllocsManager::MapBasedAllocationTracker::get(const void *
     if (isAligned<MemoryConstants::pageSize>(ptr)) {
         iter = allocations.find(ptr);
         if (iter != end) {
+            svmAllocationLastHits[lastHitSlot] = {generation.load(std::memory_order_acquire), reinterpret_cast<const char *>(iter->first), iter->second.size, &iter->second};
             return &iter->second;
         }
     }
@@ -107,6 +239,7 @@ SvmAllocationData *SVMAllocsManager::MapBasedAllocationTracker::get(const void *
         svmAllocData = &iter->second;
         char *charPtr = reinterpret_cast<char *>(svmAllocData->gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress());
         if (ptr < (charPtr + svmAllocData->size)) {
+            svmAllocationLastHits[lastHitSlot] = {generation.load(std::memory_order_acquire), reinterpret_cast<const char *>(iter->first), svmAllocData->size, svmAllocData};
             return svmAllocData;
         }
     }
@@ -164,14 +297,19 @@ void SVMAllocsManager::makeInternalAllocationsResident(CommandStreamReceiver &co
     }
 }
 
+static size_t getNumRootDevices(MemoryManager *memoryManager) {
+    return memoryManager ? memoryManager->peekExecutionEnvironment().rootDeviceEnvironments.size() : 0u;
+}
+
 SVMAllocsManager::SVMAllocsManager(MemoryManager *memoryManager, bool multiOsContextSupport)
-    : memoryManager(memoryManager), multiOsContextSupport(multiOsContextSupport) {
+    : memoryManager(memoryManager), multiOsContextSupport(multiOsContextSupport),
+      usmDeviceAllocationsCache(getNumRootDevices(memoryManager)), usmHostAllocationsCache(getNumRootDevices(memoryManager)) {
     this->usmDeviceAllocationsCacheEnabled = NEO::ApiSpecificConfig::isDeviceAllocationCacheEnabled();
     if (DebugManager.flags.ExperimentalEnableDeviceAllocationCache.get() != -1) {
         this->usmDeviceAllocationsCacheEnabled = !!DebugManager.flags.ExperimentalEnableDeviceAllocationCache.get();
     }
-    if (this->usmDeviceAllocationsCacheEnabled) {
-        this->initUsmDeviceAllocationsCache();
+    if (DebugManager.flags.ExperimentalEnableHostAllocationCache.get() != -1) {
+        this->usmHostAllocationsCacheEnabled = !!DebugManager.flags.ExperimentalEnableHostAllocationCache.get();
     }
 }
 
@@ -225,7 +363,18 @@ void *SVMAllocsManager::createHostUnifiedMemoryAllocation(size_t size,
     SvmAllocationData allocData(maxRootDeviceIndex);
     void *externalHostPointer = reinterpret_cast<void *>(memoryProperties.allocationFlags.hostptr);
 
+    if (this->usmHostAllocationsCacheEnabled && externalHostPointer == nullptr) {
+        void *allocationFromCache = this->usmHostAllocationsCache.get(size, memoryProperties, this);
+        if (allocationFromCache) {
+            return allocationFromCache;
+        }
+    }
+
     void *usmPtr = memoryManager->createMultiGraphicsAllocationInSystemMemoryPool(rootDeviceIndicesVector, unifiedMemoryProperties, allocData.gpuAllocations, externalHostPointer);
+    if (!usmPtr && this->usmHostAllocationsCacheEnabled) {
+        this->trimUSMHostAllocCache();
+        usmPtr = memoryManager->createMultiGraphicsAllocationInSystemMemoryPool(rootDeviceIndicesVector, unifiedMemoryProperties, allocData.gpuAllocations, externalHostPointer);
+    }
     if (!usmPtr) {
         return nullptr;
     }
@@ -418,8 +567,11 @@ void SVMAllocsManager::setUnifiedAllocationProperties(GraphicsAllocation *alloca
 }
 
 SvmAllocationData *SVMAllocsManager::getSVMAlloc(const void *ptr) {
+    if (auto svmAllocData = svmAllocs.getFromLastHit(ptr)) {
+        return svmAllocData;
+    }
     std::shared_lock<std::shared_mutex> lock(mtx);
-    return svmAllocs.get(ptr);
+    return svmAllocs.getFromMap(ptr);
 }
 
 SvmAllocationData *SVMAllocsManager::getSVMDeferFreeAlloc(const void *ptr) {
@@ -443,9 +595,7 @@ bool SVMAllocsManager::freeSVMAlloc(void *ptr, bool blocking) {
     }
     SvmAllocationData *svmData = getSVMAlloc(ptr);
     if (svmData) {
-        if (InternalMemoryType::DEVICE_UNIFIED_MEMORY == svmData->memoryType &&
-            this->usmDeviceAllocationsCacheEnabled) {
-            this->usmDeviceAllocationsCache.insert(svmData->size, ptr);
+        if (this->insertIntoUsmAllocationsCache(ptr, svmData)) {
             return true;
         }
         if (blocking) {
@@ -466,9 +616,7 @@ bool SVMAllocsManager::freeSVMAllocDefer(void *ptr) {
 
     SvmAllocationData *svmData = getSVMAlloc(ptr);
     if (svmData) {
-        if (InternalMemoryType::DEVICE_UNIFIED_MEMORY == svmData->memoryType &&
-            this->usmDeviceAllocationsCacheEnabled) {
-            this->usmDeviceAllocationsCache.insert(svmData->size, ptr);
+        if (this->insertIntoUsmAllocationsCache(ptr, svmData)) {
             return true;
         }
         this->freeSVMAllocImpl(ptr, FreePolicyType::POLICY_DEFER, svmData);
@@ -532,7 +680,7 @@ void SVMAllocsManager::freeSVMAllocDeferImpl() {
         }
     }
     for (uint32_t i = 0; i < freedPtr.size(); ++i) {
-        svmDeferFreeAllocs.allocations.erase(freedPtr[i]);
+        svmDeferFreeAllocs.erase(svmDeferFreeAllocs.allocations.find(freedPtr[i]));
     }
 }
 
@@ -540,6 +688,27 @@ void SVMAllocsManager::trimUSMDeviceAllocCache() {
     this->usmDeviceAllocationsCache.trim(this);
 }
 
+void SVMAllocsManager::trimUSMHostAllocCache() {
+    this->usmHostAllocationsCache.trim(this);
+}
+
+bool SVMAllocsManager::insertIntoUsmAllocationsCache(void *ptr, SvmAllocationData *svmData) {
+    if (InternalMemoryType::DEVICE_UNIFIED_MEMORY == svmData->memoryType &&
+        this->usmDeviceAllocationsCacheEnabled) {
+        auto device = svmData->device;
+        auto maxCacheSize = static_cast<size_t>(device->getGlobalMemorySize(static_cast<uint32_t>(device->getDeviceBitfield().to_ulong())) * SvmAllocationCache::maxPercentOfMemoryToCache);
+        return this->usmDeviceAllocationsCache.insert(svmData->size, ptr, device->getRootDeviceIndex(), maxCacheSize);
+    }
+    if (InternalMemoryType::HOST_UNIFIED_MEMORY == svmData->memoryType &&
+        this->usmHostAllocationsCacheEnabled &&
+        svmData->allocationFlagsProperty.hostptr == 0u) {
+        auto rootDeviceIndex = svmData->gpuAllocations.getDefaultGraphicsAllocation()->getRootDeviceIndex();
+        auto maxCacheSize = static_cast<size_t>(memoryManager->getSystemSharedMemory(rootDeviceIndex) * SvmAllocationCache::maxPercentOfMemoryToCache);
+        return this->usmHostAllocationsCache.insert(svmData->size, ptr, rootDeviceIndex, maxCacheSize);
+    }
+    return false;
+}
+
 void *SVMAllocsManager::createZeroCopySvmAllocation(size_t size, const SvmAllocationProperties &svmProperties,
                                                     const RootDeviceIndicesContainer &rootDeviceIndices,
                                                     const std::map<uint32_t, DeviceBitfield> &subdeviceBitfields) {
@@ -657,10 +826,6 @@ void SVMAllocsManager::freeZeroCopySvmAllocation(SvmAllocationData *svmData) {
     }
 }
 
-void SVMAllocsManager::initUsmDeviceAllocationsCache() {
-    this->usmDeviceAllocationsCache.allocations.reserve(128u);
-}
-
 void SVMAllocsManager::freeSvmAllocationWithDeviceStorage(SvmAllocationData *svmData) {
     auto graphicsAllocations = svmData->gpuAllocations.getGraphicsAllocations();
     GraphicsAllocation *cpuAllocation = svmData->cpuAllocation;
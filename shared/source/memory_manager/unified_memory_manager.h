@@ -14,6 +14,7 @@
 
 #include "memory_properties_flags.h"
 
+#include <array>
 #include <atomic>
 #include <cstdint>
 #include <map>
@@ -87,12 +88,22 @@ class SVMAllocsManager {
 
       public:
         using SvmAllocationContainer = std::map<const void *, SvmAllocationData>;
+        MapBasedAllocationTracker();
         void insert(const SvmAllocationData &);
         void remove(const SvmAllocationData &);
+        SvmAllocationContainer::iterator erase(SvmAllocationContainer::iterator iter);
         SvmAllocationData *get(const void *);
+        SvmAllocationData *getFromLastHit(const void *) const;
+        SvmAllocationData *getFromMap(const void *);
         size_t getNumAllocs() const { return allocations.size(); };
 
         SvmAllocationContainer allocations;
+
+      protected:
+        void invalidateLastHits();
+
+        const size_t lastHitSlot;
+        std::atomic<uint64_t> generation;
     };
 
     struct MapOperationsTracker {
@@ -138,7 +149,8 @@ class SVMAllocsManager {
     struct SvmCacheAllocationInfo {
         size_t allocationSize;
         void *allocation;
-        SvmCacheAllocationInfo(size_t allocationSize, void *allocation) : allocationSize(allocationSize), allocation(allocation) {}
+        uint32_t rootDeviceIndex;
+        SvmCacheAllocationInfo(size_t allocationSize, void *allocation, uint32_t rootDeviceIndex) : allocationSize(allocationSize), allocation(allocation), rootDeviceIndex(rootDeviceIndex) {}
         bool operator<(SvmCacheAllocationInfo const &other) const {
             return allocationSize < other.allocationSize;
         }
@@ -148,11 +160,34 @@ class SVMAllocsManager {
     };
 
     struct SvmAllocationCache {
-        void insert(size_t size, void *);
+        static constexpr size_t minSizeClassShift = 16u;
+        static constexpr size_t subClassesPerPowerOfTwoShift = 2u;
+        static constexpr size_t numSizeClasses = 64u;
+        static constexpr double maxPercentOfMemoryToCache = 0.02;
+
+        struct SizeClass {
+            std::vector<SvmCacheAllocationInfo> allocations;
+            std::mutex mtx;
+        };
+
+        explicit SvmAllocationCache(size_t numRootDevices) : cachedSizePerRootDevice(numRootDevices) {}
+
+        static size_t getSizeClassIndex(size_t size);
+        bool insert(size_t size, void *, uint32_t rootDeviceIndex, size_t maxCacheSize);
         void *get(size_t size, const UnifiedMemoryProperties &unifiedMemoryProperties, SVMAllocsManager *svmAllocsManager);
         void trim(SVMAllocsManager *svmAllocsManager);
-        std::vector<SvmCacheAllocationInfo> allocations;
-        std::mutex mtx;
+        size_t getNumAllocations();
+        size_t getCachedSize() const { return totalSize.load(); }
+        size_t getCachedSize(uint32_t rootDeviceIndex) const { return cachedSizePerRootDevice[rootDeviceIndex].load(); }
+
+        std::array<SizeClass, numSizeClasses> sizeClasses;
+        std::atomic<uint64_t> nonEmptySizeClassesMask = 0u;
+        std::atomic<size_t> totalSize = 0u;
+
+        // maxCacheSize passed to insert is budget of single root device, so cached size is checked against it per root device
+        bool reserveCachedSize(uint32_t rootDeviceIndex, size_t size, size_t maxCacheSize);
+        void releaseCachedSize(uint32_t rootDeviceIndex, size_t size);
+        std::vector<std::atomic<size_t>> cachedSizePerRootDevice;
     };
 
     enum class FreePolicyType : uint32_t {
@@ -186,6 +221,7 @@ class SVMAllocsManager {
     MOCKABLE_VIRTUAL void freeSVMAllocImpl(void *ptr, FreePolicyType policy, SvmAllocationData *svmData);
     bool freeSVMAlloc(void *ptr) { return freeSVMAlloc(ptr, false); }
     void trimUSMDeviceAllocCache();
+    void trimUSMHostAllocCache();
     void insertSVMAlloc(const SvmAllocationData &svmData);
     void removeSVMAlloc(const SvmAllocationData &svmData);
     size_t getNumAllocs() const { return svmAllocs.getNumAllocs(); }
@@ -222,7 +258,7 @@ class SVMAllocsManager {
 
     void freeZeroCopySvmAllocation(SvmAllocationData *svmData);
 
-    void initUsmDeviceAllocationsCache();
+    bool insertIntoUsmAllocationsCache(void *ptr, SvmAllocationData *svmData);
     void freeSVMData(SvmAllocationData *svmData);
 
     MapBasedAllocationTracker svmAllocs;
@@ -233,6 +269,8 @@ class SVMAllocsManager {
     std::mutex mtxForIndirectAccess;
     bool multiOsContextSupport;
     SvmAllocationCache usmDeviceAllocationsCache;
+    SvmAllocationCache usmHostAllocationsCache;
     bool usmDeviceAllocationsCacheEnabled = false;
+    bool usmHostAllocationsCacheEnabled = false;
 };
 } // namespace NEO
@@ -27,6 +27,10 @@
 
 namespace NEO {
 
+namespace {
+std::atomic<uint64_t> execObjectStampCounter{0};
+} // namespace
+
 BufferObjectHandleWrapper BufferObjectHandleWrapper::acquireSharedOwnership() {
     if (controlBlock == nullptr) {
         controlBlock = new ControlBlock{1, 0};
@@ -100,6 +104,11 @@ BufferObject::BufferObject(uint32_t rootDeviceIndex, Drm *drm, uint64_t patIndex
         bindInfo.resize(1);
         bindInfo[0].fill(false);
     }
+    refreshExecObjectStamp();
+}
+
+void BufferObject::refreshExecObjectStamp() {
+    this->execObjectStamp = ++execObjectStampCounter;
 }
 
 uint32_t BufferObject::getRefCount() const {
@@ -110,6 +119,7 @@ void BufferObject::setAddress(uint64_t address) {
     auto gmmHelper = drm->getRootDeviceEnvironment().getGmmHelper();
 
     this->gpuAddress = gmmHelper->canonize(address);
+    refreshExecObjectStamp();
 }
 
 bool BufferObject::close() {
@@ -179,9 +189,12 @@ void BufferObject::fillExecObject(ExecObject &execObject, OsContext *osContext,
 }
 
 int BufferObject::exec(uint32_t used, size_t startOffset, unsigned int flags, bool requiresCoherency, OsContext *osContext, uint32_t vmHandleId, uint32_t drmContextId,
-                       BufferObject *const residency[], size_t residencyCount, ExecObject *execObjectsStorage, uint64_t completionGpuAddress, TaskCountType completionValue) {
-    for (size_t i = 0; i < residencyCount; i++) {
-        residency[i]->fillExecObject(execObjectsStorage[i], osContext, vmHandleId, drmContextId);
+                       BufferObject *const residency[], size_t residencyCount, ExecObject *execObjectsStorage, uint64_t completionGpuAddress, TaskCountType completionValue,
+                       bool residencyExecObjectsFilled) {
+    if (!residencyExecObjectsFilled) {
+        for (size_t i = 0; i < residencyCount; i++) {
+            residency[i]->fillExecObject(execObjectsStorage[i], osContext, vmHandleId, drmContextId);
+        }
     }
     this->fillExecObject(execObjectsStorage[residencyCount], osContext, vmHandleId, drmContextId);
     auto ioctlHelper = drm->getIoctlHelper();
@@ -265,6 +278,7 @@ int BufferObject::bind(OsContext *osContext, uint32_t vmHandleId) {
         }
         if (!retVal) {
             this->bindInfo[contextId][vmHandleId] = true;
+            refreshExecObjectStamp();
         }
     }
     return retVal;
@@ -280,6 +294,7 @@ int BufferObject::unbind(OsContext *osContext, uint32_t vmHandleId) {
         }
         if (!retVal) {
             this->bindInfo[contextId][vmHandleId] = false;
+            refreshExecObjectStamp();
         }
     }
     return retVal;
@@ -321,7 +336,7 @@ int BufferObject::pin(BufferObject *const boToPin[], size_t numberOfBos, OsConte
         retVal = bindBOsWithinContext(boToPin, numberOfBos, osContext, vmHandleId);
     } else {
         StackVec<ExecObject, maxFragmentsCount + 1> execObject(numberOfBos + 1);
-        retVal = this->exec(4u, 0u, 0u, false, osContext, vmHandleId, drmContextId, boToPin, numberOfBos, &execObject[0], 0, 0);
+        retVal = this->exec(4u, 0u, 0u, false, osContext, vmHandleId, drmContextId, boToPin, numberOfBos, &execObject[0], 0, 0, false);
     }
 
     return retVal;
@@ -339,7 +354,7 @@ int BufferObject::validateHostPtr(BufferObject *const boToPin[], size_t numberOf
         }
     } else {
         StackVec<ExecObject, maxFragmentsCount + 1> execObject(numberOfBos + 1);
-        retVal = this->exec(4u, 0u, 0u, false, osContext, vmHandleId, drmContextId, boToPin, numberOfBos, &execObject[0], 0, 0);
+        retVal = this->exec(4u, 0u, 0u, false, osContext, vmHandleId, drmContextId, boToPin, numberOfBos, &execObject[0], 0, 0, false);
     }
 
     return retVal;
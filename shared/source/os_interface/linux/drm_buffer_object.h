@@ -17,6 +17,7 @@
 
 #include <array>
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <mutex>
 #include <stdint.h>
@@ -99,7 +100,12 @@ class BufferObject {
     MOCKABLE_VIRTUAL int validateHostPtr(BufferObject *const boToPin[], size_t numberOfBos, OsContext *osContext, uint32_t vmHandleId, uint32_t drmContextId);
 
     MOCKABLE_VIRTUAL int exec(uint32_t used, size_t startOffset, unsigned int flags, bool requiresCoherency, OsContext *osContext, uint32_t vmHandleId, uint32_t drmContextId,
-                              BufferObject *const residency[], size_t residencyCount, ExecObject *execObjectsStorage, uint64_t completionGpuAddress, TaskCountType completionValue);
+                              BufferObject *const residency[], size_t residencyCount, ExecObject *execObjectsStorage, uint64_t completionGpuAddress, TaskCountType completionValue,
+                              bool residencyExecObjectsFilled);
+    MOCKABLE_VIRTUAL void fillExecObject(ExecObject &execObject, OsContext *osContext, uint32_t vmHandleId, uint32_t drmContextId);
+
+    // Changes whenever state used by fillExecObject changes, unique across all buffer objects
+    uint64_t peekExecObjectStamp() const { return execObjectStamp; }
 
     int bind(OsContext *osContext, uint32_t vmHandleId);
     int unbind(OsContext *osContext, uint32_t vmHandleId);
@@ -150,6 +156,7 @@ class BufferObject {
     const StackVec<uint32_t, 2> &getBindExtHandles() const { return bindExtHandles; }
     void markForCapture() {
         allowCapture = true;
+        refreshExecObjectStamp();
     }
     bool isMarkedForCapture() {
         return allowCapture;
@@ -213,6 +220,10 @@ class BufferObject {
 
     bool isChunked = false;
 
+    // intrusive link used by DrmGemCloseWorker, so queueing a buffer object for close does not allocate
+    BufferObject *closeWorkerNext = nullptr;
+    std::chrono::steady_clock::time_point closeWorkerPushTime;
+
   protected:
     MOCKABLE_VIRTUAL MemoryOperationsStatus evictUnusedAllocations(bool waitForCompletion, bool isLockNeeded);
 
@@ -231,12 +242,13 @@ class BufferObject {
     bool requiresImmediateBinding = false;
     bool requiresExplicitResidency = false;
 
-    MOCKABLE_VIRTUAL void fillExecObject(ExecObject &execObject, OsContext *osContext, uint32_t vmHandleId, uint32_t drmContextId);
+    void refreshExecObjectStamp();
     void printBOBindingResult(OsContext *osContext, uint32_t vmHandleId, bool bind, int retVal);
 
     void *lockedAddress; // CPU side virtual address
 
     uint64_t unmapSize = 0;
+    uint64_t execObjectStamp = 0;
     uint64_t patIndex = CommonConstants::unsupportedPatIndex;
 
     CacheRegion cacheRegion = CacheRegion::Default;
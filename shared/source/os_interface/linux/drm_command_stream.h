@@ -73,9 +73,17 @@ class DrmCommandStreamReceiver : public DeviceCommandStreamReceiver<GfxFamily> {
     MOCKABLE_VIRTUAL int exec(const BatchBuffer &batchBuffer, uint32_t vmHandleId, uint32_t drmContextId, uint32_t index);
     MOCKABLE_VIRTUAL void readBackAllocation(void *source);
     bool isUserFenceWaitActive();
+    void fillResidencyExecObjects(uint32_t vmHandleId, uint32_t drmContextId);
+
+    struct ExecObjectSource {
+        uint64_t boStamp = 0;
+        uint32_t vmHandleId = 0;
+        uint32_t drmContextId = 0;
+    };
 
     std::vector<BufferObject *> residency;
     std::vector<ExecObject> execObjectsStorage;
+    std::vector<ExecObjectSource> execObjectsSources;
     Drm *drm;
     gemCloseWorkerMode gemCloseWorkerOperationMode;
 
@@ -84,5 +92,6 @@ class DrmCommandStreamReceiver : public DeviceCommandStreamReceiver<GfxFamily> {
 
     bool useUserFenceWait = true;
     bool useContextForUserFenceWait = false;
+    bool reuseExecObjects = true;
 };
 } // namespace NEO
@@ -41,6 +41,7 @@ DrmCommandStreamReceiver<GfxFamily>::DrmCommandStreamReceiver(ExecutionEnvironme
     this->drm = rootDeviceEnvironment->osInterface->getDriverModel()->as<Drm>();
     residency.reserve(512);
     execObjectsStorage.reserve(512);
+    execObjectsSources.reserve(512);
 
     if (this->drm->isVmBindAvailable()) {
         gemCloseWorkerOperationMode = gemCloseWorkerMode::gemCloseWorkerInactive;
@@ -77,6 +78,9 @@ DrmCommandStreamReceiver<GfxFamily>::DrmCommandStreamReceiver(ExecutionEnvironme
         useNotifyEnableForPostSync = !!(overrideUseNotifyEnableForPostSync);
     }
     kmdWaitTimeout = DebugManager.flags.SetKmdWaitTimeout.get();
+    if (DebugManager.flags.EnableDrmExecObjectsReuse.get() != -1) {
+        reuseExecObjects = !!DebugManager.flags.EnableDrmExecObjectsReuse.get();
+    }
 }
 
 template <typename GfxFamily>
@@ -233,6 +237,11 @@ int DrmCommandStreamReceiver<GfxFamily>::exec(const BatchBuffer &batchBuffer, ui
     auto requiredSize = this->residency.size() + 1;
     if (requiredSize > this->execObjectsStorage.size()) {
         this->execObjectsStorage.resize(requiredSize);
+        this->execObjectsSources.resize(requiredSize);
+    }
+
+    if (this->reuseExecObjects) {
+        fillResidencyExecObjects(vmHandleId, drmContextId);
     }
 
     uint64_t completionGpuAddress = 0;
@@ -251,13 +260,30 @@ int DrmCommandStreamReceiver<GfxFamily>::exec(const BatchBuffer &batchBuffer, ui
                        this->residency.data(), this->residency.size(),
                        this->execObjectsStorage.data(),
                        completionGpuAddress,
-                       completionValue);
+                       completionValue,
+                       this->reuseExecObjects);
 
+    // slot following residency was overwritten with command buffer exec object
+    this->execObjectsSources[this->residency.size()] = {};
     this->residency.clear();
 
     return ret;
 }
 
+template <typename GfxFamily>
+void DrmCommandStreamReceiver<GfxFamily>::fillResidencyExecObjects(uint32_t vmHandleId, uint32_t drmContextId) {
+    // Working set usually repeats between submissions, so only slots whose buffer object,
+    // its exec object state, vm or context differ from previous submission are refilled
+    for (size_t i = 0; i < this->residency.size(); i++) {
+        auto bo = this->residency[i];
+        auto &source = this->execObjectsSources[i];
+        if (source.boStamp != bo->peekExecObjectStamp() || source.vmHandleId != vmHandleId || source.drmContextId != drmContextId) {
+            bo->fillExecObject(this->execObjectsStorage[i], this->osContext, vmHandleId, drmContextId);
+            source = {bo->peekExecObjectStamp(), vmHandleId, drmContextId};
+        }
+    }
+}
+
 template <typename GfxFamily>
 SubmissionStatus DrmCommandStreamReceiver<GfxFamily>::processResidency(const ResidencyContainer &inputAllocationsForResidency, uint32_t handleId) {
     if (drm->isVmBindAvailable()) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2022 Intel Corporation
+ * Copyright (C) 2018-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #include "shared/source/os_interface/linux/drm_gem_close_worker.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
 #include "shared/source/os_interface/linux/drm_command_stream.h"
@@ -15,10 +16,16 @@
 
 #include <atomic>
 #include <iostream>
-#include <queue>
 
 namespace NEO {
 
+template <typename T>
+static void updateMax(std::atomic<T> &maxValue, T value) {
+    auto currentMax = maxValue.load(std::memory_order_relaxed);
+    while (currentMax < value && !maxValue.compare_exchange_weak(currentMax, value, std::memory_order_relaxed)) {
+    }
+}
+
 DrmGemCloseWorker::DrmGemCloseWorker(DrmMemoryManager &memoryManager) : memoryManager(memoryManager) {
     thread = Thread::create(worker, reinterpret_cast<void *>(this));
 }
@@ -37,14 +44,30 @@ void DrmGemCloseWorker::closeThread() {
 DrmGemCloseWorker::~DrmGemCloseWorker() {
     active = false;
     closeThread();
+
+    PRINT_DEBUG_STRING(DebugManager.flags.PrintGemCloseWorkerStatistics.get(), stdout,
+                       "Gem close worker closed: %llu, max queue depth: %u, total latency: %llu us, max latency: %llu us\n",
+                       static_cast<unsigned long long>(getNumClosed()), getMaxQueueDepth(),
+                       static_cast<unsigned long long>(getTotalCloseLatencyUs()), static_cast<unsigned long long>(getMaxCloseLatencyUs()));
 }
 
 void DrmGemCloseWorker::push(BufferObject *bo) {
-    std::unique_lock<std::mutex> lock(closeWorkerMutex);
-    workCount++;
-    queue.push(bo);
-    lock.unlock();
-    condition.notify_one();
+    bo->closeWorkerPushTime = std::chrono::steady_clock::now();
+    updateMax(maxQueueDepth, ++workCount);
+
+    auto previousHead = pendingBufferObjects.load(std::memory_order_relaxed);
+    do {
+        bo->closeWorkerNext = previousHead;
+    } while (!pendingBufferObjects.compare_exchange_weak(previousHead, bo, std::memory_order_release, std::memory_order_relaxed));
+
+    // worker sleeps only on an empty list, so only the push which made the list non-empty has to wake it up;
+    // taking the mutex orders this push with worker checking the list before it waits
+    if (previousHead == nullptr) {
+        {
+            std::lock_guard<std::mutex> lock(closeWorkerMutex);
+        }
+        condition.notify_one();
+    }
 }
 
 void DrmGemCloseWorker::close(bool blocking) {
@@ -62,43 +85,56 @@ bool DrmGemCloseWorker::isEmpty() {
 inline void DrmGemCloseWorker::close(BufferObject *bo) {
     bo->wait(-1);
     memoryManager.unreference(bo, false);
-    workCount--;
 }
 
-inline void DrmGemCloseWorker::processQueue(std::queue<BufferObject *> &inputQueue) {
-    BufferObject *workItem = nullptr;
-    while (!inputQueue.empty()) {
-        workItem = inputQueue.front();
-        inputQueue.pop();
-        close(workItem);
+BufferObject *DrmGemCloseWorker::takeBufferObjects() {
+    auto bo = pendingBufferObjects.exchange(nullptr, std::memory_order_acquire);
+
+    // list is built in LIFO order, reverse it to close buffer objects in submission order
+    BufferObject *reversedBufferObjects = nullptr;
+    while (bo) {
+        auto nextBo = bo->closeWorkerNext;
+        bo->closeWorkerNext = reversedBufferObjects;
+        reversedBufferObjects = bo;
+        bo = nextBo;
+    }
+    return reversedBufferObjects;
+}
+
+inline void DrmGemCloseWorker::processQueue(BufferObject *bufferObjects) {
+    while (bufferObjects) {
+        // link and push time have to be read before close, which may release the buffer object
+        auto nextBo = bufferObjects->closeWorkerNext;
+        auto pushTime = bufferObjects->closeWorkerPushTime;
+        bufferObjects->closeWorkerNext = nullptr;
+        close(bufferObjects);
+
+        auto latencyUs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - pushTime).count());
+        totalCloseLatencyUs += latencyUs;
+        updateMax(maxCloseLatencyUs, latencyUs);
+        numClosed++;
+        workCount--;
+
+        bufferObjects = nextBo;
     }
 }
 
 void *DrmGemCloseWorker::worker(void *arg) {
     DrmGemCloseWorker *self = reinterpret_cast<DrmGemCloseWorker *>(arg);
-    std::queue<BufferObject *> localQueue;
-    std::unique_lock<std::mutex> lock(self->closeWorkerMutex);
-    lock.unlock();
 
     while (self->active) {
-        lock.lock();
-
-        while (self->queue.empty() && self->active) {
-            self->condition.wait(lock);
-        }
-
-        if (!self->queue.empty()) {
-            localQueue.swap(self->queue);
+        {
+            std::unique_lock<std::mutex> lock(self->closeWorkerMutex);
+            while (self->pendingBufferObjects.load() == nullptr && self->active) {
+                self->condition.wait(lock);
+            }
         }
 
-        lock.unlock();
-        self->processQueue(localQueue);
+        self->processQueue(self->takeBufferObjects());
     }
 
-    lock.lock();
-    self->processQueue(self->queue);
+    self->processQueue(self->takeBufferObjects());
 
-    lock.unlock();
     self->workerDone.store(true);
     return nullptr;
 }
@@ -7,11 +7,12 @@
 
 #pragma once
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstdint>
 #include <map>
+#include <memory>
 #include <mutex>
-#include <queue>
 #include <set>
 
 namespace NEO {
@@ -37,17 +38,30 @@ class DrmGemCloseWorker {
 
     bool isEmpty();
 
+    uint32_t getQueueDepth() const { return workCount.load(); }
+    uint32_t getMaxQueueDepth() const { return maxQueueDepth.load(); }
+    uint64_t getNumClosed() const { return numClosed.load(); }
+    uint64_t getTotalCloseLatencyUs() const { return totalCloseLatencyUs.load(); }
+    uint64_t getMaxCloseLatencyUs() const { return maxCloseLatencyUs.load(); }
+
   protected:
-    void close(BufferObject *workItem);
+    void close(BufferObject *bo);
     void closeThread();
-    void processQueue(std::queue<BufferObject *> &inputQueue);
+    BufferObject *takeBufferObjects();
+    void processQueue(BufferObject *bufferObjects);
     static void *worker(void *arg);
     std::atomic<bool> active{true};
 
     std::unique_ptr<Thread> thread;
 
-    std::queue<BufferObject *> queue;
+    // producers push onto a lock-free list linked through BufferObject::closeWorkerNext,
+    // the worker takes the whole list at once
+    std::atomic<BufferObject *> pendingBufferObjects{nullptr};
     std::atomic<uint32_t> workCount{0};
+    std::atomic<uint32_t> maxQueueDepth{0};
+    std::atomic<uint64_t> numClosed{0};
+    std::atomic<uint64_t> totalCloseLatencyUs{0};
+    std::atomic<uint64_t> maxCloseLatencyUs{0};
 
     DrmMemoryManager &memoryManager;
 
@@ -50,10 +50,17 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerDefault::isResident(Device *dev
 }
 
 MemoryOperationsStatus DrmMemoryOperationsHandlerDefault::mergeWithResidencyContainer(OsContext *osContext, ResidencyContainer &residencyContainer) {
-    for (auto gfxAllocation = this->residency.begin(); gfxAllocation != this->residency.end(); gfxAllocation++) {
-        auto ret = std::find(residencyContainer.begin(), residencyContainer.end(), *gfxAllocation);
-        if (ret == residencyContainer.end()) {
-            residencyContainer.push_back(*gfxAllocation);
+    if (this->residency.empty()) {
+        return MemoryOperationsStatus::SUCCESS;
+    }
+
+    // sorted snapshot keeps merge at O((n + m) log n) instead of searching whole container for each resident allocation
+    std::vector<GraphicsAllocation *> sortedContainer(residencyContainer.begin(), residencyContainer.end());
+    std::sort(sortedContainer.begin(), sortedContainer.end());
+
+    for (auto gfxAllocation : this->residency) {
+        if (!std::binary_search(sortedContainer.begin(), sortedContainer.end(), gfxAllocation)) {
+            residencyContainer.push_back(gfxAllocation);
         }
     }
     return MemoryOperationsStatus::SUCCESS;
@@ -28,6 +28,7 @@ int access(const char *pathname, int mode);
 int readlink(const char *path, char *buf, size_t bufsize);
 int poll(struct pollfd *pollFd, unsigned long int numberOfFds, int timeout);
 int fstat(int fd, struct stat *buf);
+int futimens(int fd, const struct timespec times[2]);
 ssize_t pread(int fd, void *buf, size_t count, off_t offset);
 ssize_t pwrite(int fd, const void *buf, size_t count, off_t offset);
 void *mmap(void *addr, size_t size, int prot, int flags, int fd, off_t off) noexcept;
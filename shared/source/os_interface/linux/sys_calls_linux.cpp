@@ -106,6 +106,10 @@ int fstat(int fd, struct stat *buf) {
     return ::fstat(fd, buf);
 }
 
+int futimens(int fd, const struct timespec times[2]) {
+    return ::futimens(fd, times);
+}
+
 ssize_t pread(int fd, void *buf, size_t count, off_t offset) {
     return ::pread(fd, buf, count, offset);
 }
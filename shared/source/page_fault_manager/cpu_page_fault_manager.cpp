@@ -8,6 +8,8 @@
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/memory_properties_helpers.h"
 #include "shared/source/helpers/options.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
@@ -16,12 +18,23 @@
 #include <algorithm>
 
 namespace NEO {
+PageFaultManager::PageFaultManager() {
+    if (DebugManager.flags.SharedAllocationMigrationChunkSize.get() > 0) {
+        this->migrationChunkSize = alignUp(static_cast<size_t>(DebugManager.flags.SharedAllocationMigrationChunkSize.get()) * MemoryConstants::kiloByte, MemoryConstants::pageSize);
+    }
+}
+
 void PageFaultManager::insertAllocation(void *ptr, size_t size, SVMAllocsManager *unifiedMemoryManager, void *cmdQ, const MemoryProperties &memoryProperties) {
     auto initialPlacement = MemoryPropertiesHelper::getUSMInitialPlacement(memoryProperties);
     const auto domain = (initialPlacement == GraphicsAllocation::UsmInitialPlacement::CPU) ? AllocationDomain::Cpu : AllocationDomain::None;
 
+    PageFaultData pageFaultData{size, unifiedMemoryManager, cmdQ, domain};
+    if (this->migrationChunkSize != 0u && size > this->migrationChunkSize) {
+        pageFaultData.cpuChunks.assign(Math::divideAndRoundUp(size, this->migrationChunkSize), domain == AllocationDomain::Cpu);
+    }
+
     std::unique_lock<SpinLock> lock{mtx};
-    this->memoryData.insert(std::make_pair(ptr, PageFaultData{size, unifiedMemoryManager, cmdQ, domain}));
+    this->memoryData.insert(std::make_pair(ptr, std::move(pageFaultData)));
     if (initialPlacement != GraphicsAllocation::UsmInitialPlacement::CPU) {
         this->protectCPUMemoryAccess(ptr, size);
     }
@@ -36,6 +49,9 @@ void PageFaultManager::removeAllocation(void *ptr) {
         if (pageFaultData.domain == AllocationDomain::Gpu) {
             allowCPUMemoryAccess(ptr, pageFaultData.size);
         } else {
+            if (!pageFaultData.cpuChunks.empty()) {
+                allowCPUMemoryAccess(ptr, pageFaultData.size);
+            }
             auto &cpuAllocs = pageFaultData.unifiedMemoryManager->nonGpuDomainAllocs;
             if (auto it = std::find(cpuAllocs.begin(), cpuAllocs.end(), ptr); it != cpuAllocs.end()) {
                 cpuAllocs.erase(it);
@@ -80,32 +96,134 @@ inline void PageFaultManager::migrateStorageToGpuDomain(void *ptr, PageFaultData
         if (this->checkFaultHandlerFromPageFaultManager() == false) {
             this->registerFaultHandler();
         }
+        size_t transferredSize = pageFaultData.size;
         start = std::chrono::steady_clock::now();
-        this->transferToGpu(ptr, pageFaultData.cmdQ);
+        if (pageFaultData.cpuChunks.empty()) {
+            this->transferToGpu(ptr, pageFaultData.cmdQ);
+        } else {
+            transferredSize = this->migrateChunksToGpuDomain(ptr, pageFaultData);
+        }
         end = std::chrono::steady_clock::now();
         long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
 
         if (DebugManager.flags.PrintUmdSharedMigration.get()) {
-            printf("UMD transferred shared allocation 0x%llx (%zu B) from CPU to GPU (%f us)\n", reinterpret_cast<unsigned long long int>(ptr), pageFaultData.size, elapsedTime / 1e3);
+            printf("UMD transferred shared allocation 0x%llx (%zu B) from CPU to GPU (%f us)\n", reinterpret_cast<unsigned long long int>(ptr), transferredSize, elapsedTime / 1e3);
         }
 
-        this->protectCPUMemoryAccess(ptr, pageFaultData.size);
+        if (pageFaultData.cpuChunks.empty()) {
+            this->protectCPUMemoryAccess(ptr, pageFaultData.size);
+        }
     }
     pageFaultData.domain = AllocationDomain::Gpu;
 }
 
+size_t PageFaultManager::migrateChunksToGpuDomain(void *allocPtr, PageFaultData &pageFaultData) {
+    size_t transferredSize = 0u;
+    auto &cpuChunks = pageFaultData.cpuChunks;
+    for (size_t chunk = 0u; chunk < cpuChunks.size();) {
+        if (!cpuChunks[chunk]) {
+            chunk++;
+            continue;
+        }
+        auto firstChunk = chunk;
+        while (chunk < cpuChunks.size() && cpuChunks[chunk]) {
+            cpuChunks[chunk++] = false;
+        }
+        auto rangeOffset = firstChunk * this->migrationChunkSize;
+        auto rangeSize = std::min(chunk * this->migrationChunkSize, pageFaultData.size) - rangeOffset;
+
+        this->transferRangeToGpu(allocPtr, rangeOffset, rangeSize, pageFaultData.cmdQ);
+        this->protectCPUMemoryAccess(ptrOffset(allocPtr, rangeOffset), rangeSize);
+        transferredSize += rangeSize;
+    }
+    return transferredSize;
+}
+
 bool PageFaultManager::verifyPageFault(void *ptr) {
     std::unique_lock<SpinLock> lock{mtx};
-    for (auto &alloc : this->memoryData) {
-        auto allocPtr = alloc.first;
-        auto &pageFaultData = alloc.second;
-        if (ptr >= allocPtr && ptr < ptrOffset(allocPtr, pageFaultData.size)) {
-            this->setAubWritable(true, allocPtr, pageFaultData.unifiedMemoryManager);
-            gpuDomainHandler(this, allocPtr, pageFaultData);
-            return true;
+    auto alloc = this->memoryData.upper_bound(ptr);
+    if (alloc == this->memoryData.begin()) {
+        return false;
+    }
+    alloc--;
+
+    auto allocPtr = alloc->first;
+    auto &pageFaultData = alloc->second;
+    if (ptr >= ptrOffset(allocPtr, pageFaultData.size)) {
+        return false;
+    }
+
+    this->setAubWritable(true, allocPtr, pageFaultData.unifiedMemoryManager);
+    if (this->isChunkMigrationAllowed(pageFaultData)) {
+        this->migrateChunkToCpuDomain(allocPtr, ptr, pageFaultData);
+    } else {
+        this->migrateRemainingChunksToCpuDomain(allocPtr, pageFaultData);
+        gpuDomainHandler(this, allocPtr, pageFaultData);
+        std::fill(pageFaultData.cpuChunks.begin(), pageFaultData.cpuChunks.end(), pageFaultData.domain == AllocationDomain::Cpu);
+    }
+    return true;
+}
+
+bool PageFaultManager::isChunkMigrationAllowed(const PageFaultData &pageFaultData) const {
+    // allocation without storage in any domain is unprotected as a whole, custom handlers decide about whole allocation
+    return !pageFaultData.cpuChunks.empty() &&
+           pageFaultData.domain != AllocationDomain::None &&
+           (this->gpuDomainHandler == &PageFaultManager::transferAndUnprotectMemory || this->gpuDomainHandler == &PageFaultManager::unprotectAndTransferMemory);
+}
+
+void PageFaultManager::migrateChunkToCpuDomain(void *allocPtr, void *faultPtr, PageFaultData &pageFaultData) {
+    auto chunk = ptrDiff(faultPtr, allocPtr) / this->migrationChunkSize;
+    if (pageFaultData.cpuChunks[chunk]) {
+        return;
+    }
+
+    auto chunkOffset = chunk * this->migrationChunkSize;
+    auto chunkSize = std::min(this->migrationChunkSize, pageFaultData.size - chunkOffset);
+    auto chunkPtr = ptrOffset(allocPtr, chunkOffset);
+    bool unprotectBeforeTransfer = (this->gpuDomainHandler == &PageFaultManager::unprotectAndTransferMemory);
+
+    if (unprotectBeforeTransfer) {
+        this->allowCPUMemoryAccess(chunkPtr, chunkSize);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    this->transferRangeToCpu(allocPtr, chunkOffset, chunkSize, pageFaultData.cmdQ);
+    auto end = std::chrono::steady_clock::now();
+    long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+    if (DebugManager.flags.PrintUmdSharedMigration.get()) {
+        printf("UMD transferred shared allocation 0x%llx range 0x%llx (%zu B) from GPU to CPU (%f us)\n", reinterpret_cast<unsigned long long int>(allocPtr), reinterpret_cast<unsigned long long int>(chunkPtr), chunkSize, elapsedTime / 1e3);
+    }
+
+    if (!unprotectBeforeTransfer) {
+        this->allowCPUMemoryAccess(chunkPtr, chunkSize);
+    }
+    pageFaultData.cpuChunks[chunk] = true;
+
+    if (pageFaultData.domain == AllocationDomain::Gpu) {
+        pageFaultData.unifiedMemoryManager->nonGpuDomainAllocs.push_back(allocPtr);
+        pageFaultData.domain = AllocationDomain::Cpu;
+        if (!unprotectBeforeTransfer) {
+            this->setCpuAllocEvictable(true, allocPtr, pageFaultData.unifiedMemoryManager);
+            this->allowCPUMemoryEviction(allocPtr, pageFaultData);
+        }
+    }
+}
+
+void PageFaultManager::migrateRemainingChunksToCpuDomain(void *allocPtr, PageFaultData &pageFaultData) {
+    if (pageFaultData.domain != AllocationDomain::Cpu) {
+        return;
+    }
+    auto &cpuChunks = pageFaultData.cpuChunks;
+    for (size_t chunk = 0u; chunk < cpuChunks.size(); chunk++) {
+        if (!cpuChunks[chunk]) {
+            auto chunkOffset = chunk * this->migrationChunkSize;
+            auto chunkSize = std::min(this->migrationChunkSize, pageFaultData.size - chunkOffset);
+            this->transferRangeToCpu(allocPtr, chunkOffset, chunkSize, pageFaultData.cmdQ);
+            this->allowCPUMemoryAccess(ptrOffset(allocPtr, chunkOffset), chunkSize);
+            cpuChunks[chunk] = true;
         }
     }
-    return false;
 }
 
 void PageFaultManager::setGpuDomainHandler(gpuDomainHandlerFunc gpuHandlerFuncPtr) {
@@ -10,8 +10,9 @@
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/utilities/spinlock.h"
 
+#include <map>
 #include <memory>
-#include <unordered_map>
+#include <vector>
 
 namespace NEO {
 struct MemoryProperties;
@@ -25,6 +26,7 @@ class PageFaultManager : public NonCopyableOrMovableClass {
   public:
     static std::unique_ptr<PageFaultManager> create();
 
+    PageFaultManager();
     virtual ~PageFaultManager() = default;
 
     MOCKABLE_VIRTUAL void moveAllocationToGpuDomain(void *ptr);
@@ -43,6 +45,7 @@ class PageFaultManager : public NonCopyableOrMovableClass {
         SVMAllocsManager *unifiedMemoryManager;
         void *cmdQ;
         AllocationDomain domain;
+        std::vector<bool> cpuChunks; // CPU residency of each chunk, empty if allocation is migrated as a whole
     };
 
     typedef void (*gpuDomainHandlerFunc)(PageFaultManager *pageFaultHandler, void *alloc, PageFaultData &pageFaultData);
@@ -52,6 +55,7 @@ class PageFaultManager : public NonCopyableOrMovableClass {
     virtual void allowCPUMemoryAccess(void *ptr, size_t size) = 0;
     virtual void protectCPUMemoryAccess(void *ptr, size_t size) = 0;
     MOCKABLE_VIRTUAL void transferToCpu(void *ptr, size_t size, void *cmdQ);
+    MOCKABLE_VIRTUAL void transferRangeToCpu(void *ptr, size_t offset, size_t size, void *cmdQ);
 
   protected:
     virtual bool checkFaultHandlerFromPageFaultManager() = 0;
@@ -61,6 +65,7 @@ class PageFaultManager : public NonCopyableOrMovableClass {
 
     MOCKABLE_VIRTUAL bool verifyPageFault(void *ptr);
     MOCKABLE_VIRTUAL void transferToGpu(void *ptr, void *cmdQ);
+    MOCKABLE_VIRTUAL void transferRangeToGpu(void *ptr, size_t offset, size_t size, void *cmdQ);
     MOCKABLE_VIRTUAL void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager);
     MOCKABLE_VIRTUAL void setCpuAllocEvictable(bool evictable, void *ptr, SVMAllocsManager *unifiedMemoryManager);
     MOCKABLE_VIRTUAL void allowCPUMemoryEviction(void *ptr, PageFaultData &pageFaultData);
@@ -70,10 +75,16 @@ class PageFaultManager : public NonCopyableOrMovableClass {
     void selectGpuDomainHandler();
     inline void migrateStorageToGpuDomain(void *ptr, PageFaultData &pageFaultData);
     inline void migrateStorageToCpuDomain(void *ptr, PageFaultData &pageFaultData);
+    bool isChunkMigrationAllowed(const PageFaultData &pageFaultData) const;
+    void migrateChunkToCpuDomain(void *allocPtr, void *faultPtr, PageFaultData &pageFaultData);
+    void migrateRemainingChunksToCpuDomain(void *allocPtr, PageFaultData &pageFaultData);
+    size_t migrateChunksToGpuDomain(void *allocPtr, PageFaultData &pageFaultData);
 
     decltype(&transferAndUnprotectMemory) gpuDomainHandler = &transferAndUnprotectMemory;
 
-    std::unordered_map<void *, PageFaultData> memoryData;
+    // ordered by address, fault lookup finds owning allocation with single upper_bound
+    std::map<void *, PageFaultData> memoryData;
+    size_t migrationChunkSize = 0u;
     SpinLock mtx;
 };
 } // namespace NEO
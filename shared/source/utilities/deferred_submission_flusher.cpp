@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/deferred_submission_flusher.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/os_interface/os_thread.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+bool DeferredSubmissionFlusher::isEnabled() {
+    return DebugManager.flags.ImmediateCmdListAppendCoalescing.get() == 1;
+}
+
+DeferredSubmissionFlusher::DeferredSubmissionFlusher(std::chrono::microseconds idleFlushInterval) : idleFlushInterval(idleFlushInterval) {}
+
+DeferredSubmissionFlusher::~DeferredSubmissionFlusher() {
+    {
+        std::lock_guard<std::mutex> lock(clientsMutex);
+        keepRunning = false;
+    }
+    flusherCondition.notify_one();
+    if (flusherThread) {
+        flusherThread->join();
+        flusherThread.reset();
+    }
+}
+
+void DeferredSubmissionFlusher::startFlusherThread() {
+    flusherThread = Thread::create(flushIdleSubmissions, reinterpret_cast<void *>(this));
+}
+
+void DeferredSubmissionFlusher::registerClient(DeferredSubmissionClient *client) {
+    std::lock_guard<std::mutex> lock(clientsMutex);
+    if (!flusherThread) {
+        startFlusherThread();
+    }
+    clients.push_back(client);
+}
+
+void DeferredSubmissionFlusher::unregisterClient(DeferredSubmissionClient *client) {
+    std::lock_guard<std::mutex> lock(clientsMutex);
+    auto it = std::find(clients.begin(), clients.end(), client);
+    if (it != clients.end()) {
+        clients.erase(it);
+    }
+}
+
+void DeferredSubmissionFlusher::notifyDeferredSubmission() {
+    {
+        std::lock_guard<std::mutex> lock(clientsMutex);
+        if (submissionsDeferred) {
+            return;
+        }
+        submissionsDeferred = true;
+    }
+    flusherCondition.notify_one();
+}
+
+void DeferredSubmissionFlusher::flushClientsOf(const CommandStreamReceiver *csr) {
+    // cleared only by flusher thread once no client defers work, polling host waits stay lock free otherwise
+    if (!submissionsDeferred.load(std::memory_order_acquire)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(clientsMutex);
+    flushClients(false, csr);
+}
+
+bool DeferredSubmissionFlusher::flushClients(bool onlyStale, const CommandStreamReceiver *csr) {
+    bool stillDeferred = false;
+    for (auto client : clients) {
+        if (csr == nullptr || client->getDeferredSubmissionCsr() == csr) {
+            stillDeferred |= client->flushDeferredSubmission(onlyStale);
+        }
+    }
+    return stillDeferred;
+}
+
+void *DeferredSubmissionFlusher::flushIdleSubmissions(void *arg) {
+    auto flusher = reinterpret_cast<DeferredSubmissionFlusher *>(arg);
+    std::unique_lock<std::mutex> lock(flusher->clientsMutex);
+    while (true) {
+        flusher->flusherCondition.wait(lock, [flusher]() { return flusher->submissionsDeferred.load() || !flusher->keepRunning; });
+        if (flusher->keepRunning) {
+            flusher->flusherCondition.wait_for(lock, flusher->idleFlushInterval, [flusher]() { return !flusher->keepRunning; });
+        }
+        if (!flusher->keepRunning) {
+            break;
+        }
+        flusher->numIdleFlushRounds.fetch_add(1, std::memory_order_relaxed);
+        flusher->submissionsDeferred = flusher->flushClients(true, nullptr);
+    }
+    return nullptr;
+}
+
+} // namespace NEO
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class CommandStreamReceiver;
+class Thread;
+
+class DeferredSubmissionClient {
+  public:
+    virtual ~DeferredSubmissionClient() = default;
+
+    // Submits deferred work, when onlyStale is set only work older than client's own timeout.
+    // Must not block on client's locks. Returns true if some work is still deferred.
+    virtual bool flushDeferredSubmission(bool onlyStale) = 0;
+    virtual const CommandStreamReceiver *getDeferredSubmissionCsr() const = 0;
+};
+
+// Submits work that clients (e.g. coalescing immediate command lists) keep deferred between
+// appends. Idle flusher thread is started on first registration, sleeps while no client reported
+// deferred work and flushes stale work every idleFlushInterval otherwise. Host synchronization
+// points flush clients submitting to the CSR they wait on, so host never waits on work that was not submitted.
+class DeferredSubmissionFlusher : NonCopyableOrMovableClass {
+  public:
+    static constexpr std::chrono::microseconds defaultIdleFlushInterval{100};
+
+    static bool isEnabled();
+
+    DeferredSubmissionFlusher(std::chrono::microseconds idleFlushInterval);
+    virtual ~DeferredSubmissionFlusher();
+
+    void registerClient(DeferredSubmissionClient *client);
+    void unregisterClient(DeferredSubmissionClient *client);
+    void notifyDeferredSubmission();
+    void flushClientsOf(const CommandStreamReceiver *csr);
+
+    uint64_t getNumIdleFlushRounds() const { return numIdleFlushRounds.load(std::memory_order_relaxed); }
+    size_t getNumClients() {
+        std::lock_guard<std::mutex> lock(clientsMutex);
+        return clients.size();
+    }
+
+  protected:
+    static void *flushIdleSubmissions(void *arg);
+    MOCKABLE_VIRTUAL void startFlusherThread();
+    bool flushClients(bool onlyStale, const CommandStreamReceiver *csr);
+
+    std::vector<DeferredSubmissionClient *> clients;
+    std::mutex clientsMutex;
+    std::condition_variable flusherCondition;
+    std::unique_ptr<Thread> flusherThread;
+    std::chrono::microseconds idleFlushInterval;
+    std::atomic<bool> submissionsDeferred{false};
+    bool keepRunning = true;
+
+    std::atomic<uint64_t> numIdleFlushRounds{0};
+};
+
+} // namespace NEO
@@ -18,6 +18,16 @@ bool operator<(const HeapChunk &hc1, const HeapChunk &hc2) {
     return hc1.ptr < hc2.ptr;
 }
 
+void FreedHeapChunks::insert(uint64_t ptr, size_t size) {
+    chunksByAddress.emplace(ptr, size);
+    chunksBySize.emplace(size, ptr);
+}
+
+FreedHeapChunks::ChunksByAddress::iterator FreedHeapChunks::erase(ChunksByAddress::iterator chunk) {
+    chunksBySize.erase(std::make_pair(chunk->second, chunk->first));
+    return chunksByAddress.erase(chunk);
+}
+
 uint64_t HeapAllocator::allocateWithCustomAlignment(size_t &sizeToAllocate, size_t alignment) {
     if (alignment < this->allocationAlignment) {
         alignment = this->allocationAlignment;
@@ -32,7 +42,7 @@ uint64_t HeapAllocator::allocateWithCustomAlignment(size_t &sizeToAllocate, size
         return 0llu;
     }
 
-    std::vector<HeapChunk> &freedChunks = (sizeToAllocate > sizeThreshold) ? freedChunksBig : freedChunksSmall;
+    FreedHeapChunks &freedChunks = (sizeToAllocate > sizeThreshold) ? freedChunksBig : freedChunksSmall;
     uint32_t defragmentCount = 0;
 
     for (;;) {
@@ -109,85 +119,82 @@ double HeapAllocator::getUsage() const {
     return static_cast<double>(size - availableSize) / size;
 }
 
-uint64_t HeapAllocator::getFromFreedChunks(size_t size, std::vector<HeapChunk> &freedChunks, size_t &sizeOfFreedChunk, size_t requiredAlignment) {
-    size_t elements = freedChunks.size();
-    size_t bestFitIndex = -1;
-    size_t bestFitSize = 0;
+uint64_t HeapAllocator::getFromFreedChunks(size_t size, FreedHeapChunks &freedChunks, size_t &sizeOfFreedChunk, size_t requiredAlignment) {
     sizeOfFreedChunk = 0;
 
-    for (size_t i = 0; i < elements; i++) {
-        const bool chunkAligned = isAligned(freedChunks[i].ptr, requiredAlignment);
-        if (!chunkAligned) {
+    for (auto bestFit = freedChunks.chunksBySize.lower_bound(std::make_pair(size, 0llu)); bestFit != freedChunks.chunksBySize.end(); ++bestFit) {
+        const size_t bestFitSize = bestFit->first;
+        const uint64_t bestFitPtr = bestFit->second;
+        if (!isAligned(bestFitPtr, requiredAlignment)) {
             continue;
         }
 
-        if (freedChunks[i].size == size) {
-            auto ptr = freedChunks[i].ptr;
-            freedChunks.erase(freedChunks.begin() + i);
-            return ptr;
-        }
-
-        if (freedChunks[i].size > size) {
-            if (freedChunks[i].size < bestFitSize || bestFitSize == 0) {
-                bestFitIndex = i;
-                bestFitSize = freedChunks[i].size;
+        if (bestFitSize < (size << 1)) {
+            if (bestFitSize != size) {
+                sizeOfFreedChunk = bestFitSize;
             }
+            freedChunks.erase(freedChunks.chunksByAddress.find(bestFitPtr));
+            return bestFitPtr;
         }
-    }
 
-    if (bestFitSize != 0) {
-        if (bestFitSize < (size << 1)) {
-            auto ptr = freedChunks[bestFitIndex].ptr;
-            sizeOfFreedChunk = freedChunks[bestFitIndex].size;
-            freedChunks.erase(freedChunks.begin() + bestFitIndex);
-            return ptr;
-        } else {
-            size_t sizeDelta = freedChunks[bestFitIndex].size - size;
+        size_t sizeDelta = bestFitSize - size;
+        auto ptr = bestFitPtr + sizeDelta;
+        if (!isAligned(ptr, requiredAlignment)) {
+            continue;
+        }
 
-            DEBUG_BREAK_IF(!(size <= sizeThreshold || (size > sizeThreshold && sizeDelta > sizeThreshold)));
+        DEBUG_BREAK_IF(!(size <= sizeThreshold || (size > sizeThreshold && sizeDelta > sizeThreshold)));
 
-            auto ptr = freedChunks[bestFitIndex].ptr + sizeDelta;
-            freedChunks[bestFitIndex].size = sizeDelta;
+        freedChunks.erase(freedChunks.chunksByAddress.find(bestFitPtr));
+        freedChunks.insert(bestFitPtr, sizeDelta);
+        return ptr;
+    }
+    return 0llu;
+}
 
-            if (!isAligned(ptr, requiredAlignment)) {
-                return 0llu;
-            }
-            return ptr;
+void HeapAllocator::storeInFreedChunks(uint64_t ptr, size_t size, FreedHeapChunks &freedChunks) {
+    uint64_t chunkStart = ptr;
+    uint64_t chunkEnd = ptr + size;
+
+    auto nextChunk = freedChunks.chunksByAddress.upper_bound(chunkStart);
+    if (nextChunk != freedChunks.chunksByAddress.begin()) {
+        auto previousChunk = std::prev(nextChunk);
+        const uint64_t previousChunkEnd = previousChunk->first + previousChunk->second;
+        if (previousChunkEnd >= chunkStart) {
+            chunkStart = previousChunk->first;
+            chunkEnd = std::max(chunkEnd, previousChunkEnd);
+            freedChunks.erase(previousChunk);
         }
     }
-    return 0llu;
+    while (nextChunk != freedChunks.chunksByAddress.end() && nextChunk->first <= chunkEnd) {
+        chunkEnd = std::max(chunkEnd, nextChunk->first + nextChunk->second);
+        nextChunk = freedChunks.erase(nextChunk);
+    }
+
+    freedChunks.insert(chunkStart, static_cast<size_t>(chunkEnd - chunkStart));
 }
 
-void HeapAllocator::defragment() {
+void HeapAllocator::mergeLastFreedSmall() {
+    auto chunk = freedChunksSmall.chunksByAddress.find(pRightBound);
+    if (chunk != freedChunksSmall.chunksByAddress.end()) {
+        pRightBound += chunk->second;
+        freedChunksSmall.erase(chunk);
+    }
+}
 
-    if (freedChunksSmall.size() > 1) {
-        std::sort(freedChunksSmall.rbegin(), freedChunksSmall.rend());
-        size_t maxSize = freedChunksSmall.size();
-        for (size_t i = maxSize - 1; i > 0; --i) {
-            auto ptr = freedChunksSmall[i].ptr;
-            size_t chunkSize = freedChunksSmall[i].size;
-
-            if (freedChunksSmall[i - 1].ptr == ptr + chunkSize) {
-                freedChunksSmall[i - 1].ptr = ptr;
-                freedChunksSmall[i - 1].size += chunkSize;
-                freedChunksSmall.erase(freedChunksSmall.begin() + i);
-            }
-        }
+void HeapAllocator::mergeLastFreedBig() {
+    if (freedChunksBig.empty()) {
+        return;
     }
-    mergeLastFreedSmall();
-    if (freedChunksBig.size() > 1) {
-        std::sort(freedChunksBig.begin(), freedChunksBig.end());
-
-        size_t maxSize = freedChunksBig.size();
-        for (size_t i = maxSize - 1; i > 0; --i) {
-            auto ptr = freedChunksBig[i].ptr;
-            size_t chunkSize = freedChunksBig[i].size;
-            if ((freedChunksBig[i - 1].ptr + freedChunksBig[i - 1].size) == ptr) {
-                freedChunksBig[i - 1].size += chunkSize;
-                freedChunksBig.erase(freedChunksBig.begin() + i);
-            }
-        }
+    auto chunk = std::prev(freedChunksBig.chunksByAddress.end());
+    if (chunk->first + chunk->second == pLeftBound) {
+        pLeftBound = chunk->first;
+        freedChunksBig.erase(chunk);
     }
+}
+
+void HeapAllocator::defragment() {
+    mergeLastFreedSmall();
     mergeLastFreedBig();
     DBG_LOG(LogAllocationMemoryPool, __FUNCTION__, "Allocator usage == ", this->getUsage());
 }
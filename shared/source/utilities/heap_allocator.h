@@ -10,8 +10,9 @@
 #include "shared/source/helpers/constants.h"
 
 #include <cstdint>
+#include <map>
 #include <mutex>
-#include <vector>
+#include <set>
 
 namespace NEO {
 
@@ -23,6 +24,19 @@ struct HeapChunk {
 
 bool operator<(const HeapChunk &hc1, const HeapChunk &hc2);
 
+struct FreedHeapChunks {
+    using ChunksByAddress = std::map<uint64_t, size_t>;
+    using ChunksBySize = std::set<std::pair<size_t, uint64_t>>;
+
+    void insert(uint64_t ptr, size_t size);
+    ChunksByAddress::iterator erase(ChunksByAddress::iterator chunk);
+    size_t size() const { return chunksByAddress.size(); }
+    bool empty() const { return chunksByAddress.empty(); }
+
+    ChunksByAddress chunksByAddress;
+    ChunksBySize chunksBySize;
+};
+
 class HeapAllocator {
   public:
     HeapAllocator(uint64_t address, uint64_t size) : HeapAllocator(address, size, MemoryConstants::pageSize) {
@@ -34,8 +48,6 @@ class HeapAllocator {
     HeapAllocator(uint64_t address, uint64_t size, size_t allocationAlignment, size_t threshold) : size(size), availableSize(size), allocationAlignment(allocationAlignment), sizeThreshold(threshold) {
         pLeftBound = address;
         pRightBound = address + size;
-        freedChunksBig.reserve(10);
-        freedChunksSmall.reserve(50);
     }
 
     MOCKABLE_VIRTUAL ~HeapAllocator() = default;
@@ -66,61 +78,14 @@ class HeapAllocator {
     size_t allocationAlignment;
     const size_t sizeThreshold;
 
-    std::vector<HeapChunk> freedChunksSmall;
-    std::vector<HeapChunk> freedChunksBig;
+    FreedHeapChunks freedChunksSmall;
+    FreedHeapChunks freedChunksBig;
     std::mutex mtx;
 
-    uint64_t getFromFreedChunks(size_t size, std::vector<HeapChunk> &freedChunks, size_t &sizeOfFreedChunk, size_t requiredAlignment);
-
-    void storeInFreedChunks(uint64_t ptr, size_t size, std::vector<HeapChunk> &freedChunks) {
-        for (auto &freedChunk : freedChunks) {
-            if (freedChunk.ptr == ptr + size) {
-                freedChunk.ptr = ptr;
-                freedChunk.size += size;
-                return;
-            }
-            if (freedChunk.ptr + freedChunk.size == ptr) {
-                freedChunk.size += size;
-                return;
-            }
-            if ((freedChunk.ptr + freedChunk.size) == (ptr + size)) {
-                if (ptr < freedChunk.ptr) {
-                    freedChunk.ptr = ptr;
-                    freedChunk.size = size;
-                    return;
-                }
-            }
-        }
-
-        freedChunks.emplace_back(ptr, size);
-    }
-
-    void mergeLastFreedSmall() {
-        size_t maxSizeOfSmallChunks = freedChunksSmall.size();
-
-        if (maxSizeOfSmallChunks > 0) {
-            auto ptr = freedChunksSmall[maxSizeOfSmallChunks - 1].ptr;
-            size_t chunkSize = freedChunksSmall[maxSizeOfSmallChunks - 1].size;
-            if (ptr == pRightBound) {
-                pRightBound = ptr + chunkSize;
-                freedChunksSmall.pop_back();
-            }
-        }
-    }
-
-    void mergeLastFreedBig() {
-        size_t maxSizeOfBigChunks = freedChunksBig.size();
-
-        if (maxSizeOfBigChunks > 0) {
-            auto ptr = freedChunksBig[maxSizeOfBigChunks - 1].ptr;
-            size_t chunkSize = freedChunksBig[maxSizeOfBigChunks - 1].size;
-            if (ptr == pLeftBound - chunkSize) {
-                pLeftBound = ptr;
-                freedChunksBig.pop_back();
-            }
-        }
-    }
-
+    uint64_t getFromFreedChunks(size_t size, FreedHeapChunks &freedChunks, size_t &sizeOfFreedChunk, size_t requiredAlignment);
+    void storeInFreedChunks(uint64_t ptr, size_t size, FreedHeapChunks &freedChunks);
+    void mergeLastFreedSmall();
+    void mergeLastFreedBig();
     void defragment();
 };
 } // namespace NEO
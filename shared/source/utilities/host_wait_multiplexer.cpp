@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/host_wait_multiplexer.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/os_interface/os_thread.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace NEO {
+
+bool HostWaitMultiplexer::isEnabled() {
+    return DebugManager.flags.EnableHostWaitMultiplexer.get() == 1;
+}
+
+HostWaitMultiplexer::HostWaitMultiplexer(std::chrono::microseconds pollInterval) : pollInterval(pollInterval) {}
+
+HostWaitMultiplexer::~HostWaitMultiplexer() {
+    {
+        std::lock_guard<std::mutex> lock(waitersMutex);
+        keepPolling = false;
+    }
+    pollerCondition.notify_one();
+    if (pollerThread) {
+        pollerThread->join();
+        pollerThread.reset();
+    }
+}
+
+void HostWaitMultiplexer::startPollerThread() {
+    pollerThread = Thread::create(pollCompletions, reinterpret_cast<void *>(this));
+}
+
+bool HostWaitMultiplexer::wait(const CompletionCheck &check, std::chrono::microseconds timeout) {
+    if (check()) {
+        return true;
+    }
+
+    Waiter waiter;
+    waiter.check = &check;
+
+    std::unique_lock<std::mutex> lock(waitersMutex);
+    if (!pollerThread) {
+        startPollerThread();
+    }
+    waiters.push_back(&waiter);
+    if (waiters.size() == 1) {
+        pollerCondition.notify_one();
+    }
+
+    waiter.condition.wait_for(lock, timeout, [&waiter]() { return waiter.completed; });
+    // check may still be evaluated by poller, it must not outlive this call
+    waiter.leaving = true;
+    waiter.condition.wait(lock, [&waiter]() { return !waiter.checkInProgress; });
+
+    waiters.erase(std::find(waiters.begin(), waiters.end(), &waiter));
+    return waiter.completed;
+}
+
+bool HostWaitMultiplexer::pollOnce(uint32_t &wakeups) {
+    wakeups = 0;
+    std::unique_lock<std::mutex> lock(waitersMutex);
+    pollerCondition.wait(lock, [this]() { return !waiters.empty() || !keepPolling; });
+    if (!keepPolling) {
+        return false;
+    }
+
+    numPollRounds.fetch_add(1, std::memory_order_relaxed);
+    polledWaiters.clear();
+    for (auto waiter : waiters) {
+        if (!waiter->completed) {
+            waiter->checkInProgress = true;
+            polledWaiters.push_back(waiter);
+        }
+    }
+    lock.unlock();
+
+    // waiters with check in progress stay registered until their check result is published below
+    polledResults.resize(polledWaiters.size());
+    for (size_t i = 0; i < polledWaiters.size(); i++) {
+        polledResults[i] = (*polledWaiters[i]->check)();
+    }
+
+    lock.lock();
+    for (size_t i = 0; i < polledWaiters.size(); i++) {
+        auto waiter = polledWaiters[i];
+        waiter->checkInProgress = false;
+        if (polledResults[i]) {
+            waiter->completed = true;
+            wakeups++;
+        }
+        if (waiter->completed || waiter->leaving) {
+            waiter->condition.notify_one();
+        }
+    }
+    numWakeups.fetch_add(wakeups, std::memory_order_relaxed);
+    return true;
+}
+
+std::chrono::microseconds HostWaitMultiplexer::getNextPollInterval(std::chrono::microseconds currentInterval, uint32_t wakeups) const {
+    if (wakeups > 0 || pollInterval.count() == 0) {
+        return pollInterval;
+    }
+    return std::min(std::max(currentInterval * 2, pollInterval), std::max(maxPollInterval, pollInterval));
+}
+
+void *HostWaitMultiplexer::pollCompletions(void *arg) {
+    auto multiplexer = reinterpret_cast<HostWaitMultiplexer *>(arg);
+    auto currentInterval = multiplexer->pollInterval;
+    uint32_t wakeups = 0;
+    while (multiplexer->pollOnce(wakeups)) {
+        currentInterval = multiplexer->getNextPollInterval(currentInterval, wakeups);
+        if (currentInterval.count() > 0) {
+            std::this_thread::sleep_for(currentInterval);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    return nullptr;
+}
+
+} // namespace NEO
@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class Thread;
+
+// Shared completion poller for host waits on a device. Instead of every waiting thread
+// spinning on its own completion address, waiters register a completion check and sleep
+// on their own condition variable. Single poller thread evaluates all registered checks
+// and wakes only waiters whose check succeeded. Checks run outside of the waiters lock, so
+// slow checks do not delay registration of new waiters. Poller thread is started on first wait
+// and sleeps while there are no waiters. Rounds without wakeups back off from pollInterval
+// up to maxPollInterval.
+class HostWaitMultiplexer : NonCopyableOrMovableClass {
+  public:
+    using CompletionCheck = std::function<bool()>;
+
+    static constexpr std::chrono::microseconds defaultParkTime{500'000};
+    static constexpr std::chrono::microseconds defaultPollInterval{20};
+    static constexpr std::chrono::microseconds maxPollInterval{1'000};
+
+    static bool isEnabled();
+
+    HostWaitMultiplexer(std::chrono::microseconds pollInterval);
+    virtual ~HostWaitMultiplexer();
+
+    // Blocks until check returns true or timeout expires. Check is evaluated by poller thread
+    // while waiter is registered, never after wait returned. Returns result of last check.
+    bool wait(const CompletionCheck &check, std::chrono::microseconds timeout);
+
+    uint64_t getNumPollRounds() const { return numPollRounds.load(std::memory_order_relaxed); }
+    uint64_t getNumWakeups() const { return numWakeups.load(std::memory_order_relaxed); }
+    size_t getNumWaiters() {
+        std::lock_guard<std::mutex> lock(waitersMutex);
+        return waiters.size();
+    }
+
+  protected:
+    struct Waiter {
+        const CompletionCheck *check = nullptr;
+        std::condition_variable condition;
+        bool completed = false;
+        bool checkInProgress = false;
+        bool leaving = false;
+    };
+
+    static void *pollCompletions(void *arg);
+    MOCKABLE_VIRTUAL void startPollerThread();
+    bool pollOnce(uint32_t &wakeups);
+    std::chrono::microseconds getNextPollInterval(std::chrono::microseconds currentInterval, uint32_t wakeups) const;
+
+    std::vector<Waiter *> waiters;
+    std::vector<Waiter *> polledWaiters;
+    std::vector<uint8_t> polledResults;
+    std::mutex waitersMutex;
+    std::condition_variable pollerCondition;
+    std::unique_ptr<Thread> pollerThread;
+    std::chrono::microseconds pollInterval;
+    bool keepPolling = true;
+
+    std::atomic<uint64_t> numPollRounds{0};
+    std::atomic<uint64_t> numWakeups{0};
+};
+
+} // namespace NEO
@@ -22,6 +22,10 @@ void cpuidLinuxWrapper(int cpuInfo[4], int functionId) {
 void cpuidexLinuxWrapper(int *cpuInfo, int functionId, int subfunctionId) {
 }
 
+uint64_t xgetbvLinuxWrapper(uint32_t index) {
+    return 0;
+}
+
 void getCpuFlagsLinux(std::string &cpuFlags) {
     std::ifstream cpuinfo(std::string(Os::sysFsProcPathPrefix) + "/cpuinfo");
     std::string line;
@@ -35,6 +39,7 @@ void getCpuFlagsLinux(std::string &cpuFlags) {
 
 void (*CpuInfo::cpuidexFunc)(int *, int, int) = cpuidexLinuxWrapper;
 void (*CpuInfo::cpuidFunc)(int[4], int) = cpuidLinuxWrapper;
+uint64_t (*CpuInfo::xgetbvFunc)(uint32_t) = xgetbvLinuxWrapper;
 void (*CpuInfo::getCpuFlagsFunc)(std::string &) = getCpuFlagsLinux;
 
 const CpuInfo CpuInfo::instance;
@@ -52,4 +57,8 @@ void CpuInfo::cpuidex(
     cpuidexFunc(reinterpret_cast<int *>(cpuInfo), functionId, subfunctionId);
 }
 
+uint64_t CpuInfo::xgetbv(uint32_t index) const {
+    return xgetbvFunc(index);
+}
+
 } // namespace NEO
@@ -22,6 +22,15 @@ void cpuidexLinuxWrapper(int *cpuInfo, int functionId, int subfunctionId) {
     __cpuid_count(functionId, subfunctionId, cpuInfo[0], cpuInfo[1], cpuInfo[2], cpuInfo[3]);
 }
 
+uint64_t xgetbvLinuxWrapper(uint32_t index) {
+    uint32_t eax = 0;
+    uint32_t edx = 0;
+    __asm__ volatile("xgetbv"
+                     : "=a"(eax), "=d"(edx)
+                     : "c"(index));
+    return (static_cast<uint64_t>(edx) << 32) | eax;
+}
+
 void getCpuFlagsLinux(std::string &cpuFlags) {
     std::ifstream cpuinfo(std::string(Os::sysFsProcPathPrefix) + "/cpuinfo");
     std::string line;
@@ -35,6 +44,7 @@ void getCpuFlagsLinux(std::string &cpuFlags) {
 
 void (*CpuInfo::cpuidexFunc)(int *, int, int) = cpuidexLinuxWrapper;
 void (*CpuInfo::cpuidFunc)(int[4], int) = cpuidLinuxWrapper;
+uint64_t (*CpuInfo::xgetbvFunc)(uint32_t) = xgetbvLinuxWrapper;
 void (*CpuInfo::getCpuFlagsFunc)(std::string &) = getCpuFlagsLinux;
 
 const CpuInfo CpuInfo::instance;
@@ -52,4 +62,8 @@ void CpuInfo::cpuidex(
     cpuidexFunc(reinterpret_cast<int *>(cpuInfo), functionId, subfunctionId);
 }
 
+uint64_t CpuInfo::xgetbv(uint32_t index) const {
+    return xgetbvFunc(index);
+}
+
 } // namespace NEO
@@ -7,16 +7,220 @@
 
 #include "shared/source/utilities/tag_allocator.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/memory_manager/multi_graphics_allocation.h"
 
+#include <unordered_map>
+
 namespace NEO {
 
+namespace {
+// allocators are looked up by id, so thread caches of already destroyed allocators are never dereferenced
+std::mutex liveAllocatorsMutex;
+std::unordered_map<uint64_t, TagAllocatorBase *> liveAllocators;
+std::atomic<uint64_t> allocatorIdCounter{0};
+} // namespace
+
+void TagNodeFreeStack::pushChain(TagNodeBase &first, TagNodeBase &last) {
+    if (lockedNodesPresent.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> lock(lockedNodesMutex);
+        last.nextFreeNode.store(lockedHead, std::memory_order_relaxed);
+        lockedHead = &first;
+        return;
+    }
+    pushChainLockFree(first, last);
+}
+
+TagNodeBase *TagNodeFreeStack::pop() {
+    auto node = popLockFree();
+    if (node == nullptr && lockedNodesPresent.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> lock(lockedNodesMutex);
+        node = lockedHead;
+        if (node) {
+            lockedHead = node->nextFreeNode.load(std::memory_order_relaxed);
+            node->nextFreeNode.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+    return node;
+}
+
+void TagNodeFreeStack::pushChainLockFree(TagNodeBase &first, TagNodeBase &last) {
+    DEBUG_BREAK_IF(!canBeLockFree(first));
+    auto currentHead = head.load(std::memory_order_relaxed);
+    uint64_t newHead = 0;
+    do {
+        last.nextFreeNode.store(getNode(currentHead), std::memory_order_relaxed);
+        newHead = getNextHead(currentHead, &first);
+    } while (!head.compare_exchange_weak(currentHead, newHead, std::memory_order_release, std::memory_order_relaxed));
+}
+
+TagNodeBase *TagNodeFreeStack::popLockFree() {
+    auto currentHead = head.load(std::memory_order_acquire);
+    while (true) {
+        auto node = getNode(currentHead);
+        if (node == nullptr) {
+            return nullptr;
+        }
+        auto newHead = getNextHead(currentHead, node->nextFreeNode.load(std::memory_order_relaxed));
+        if (head.compare_exchange_weak(currentHead, newHead, std::memory_order_acquire, std::memory_order_acquire)) {
+            node->nextFreeNode.store(nullptr, std::memory_order_relaxed);
+            return node;
+        }
+    }
+}
+
+TagNodeBase *TagNodeFreeStack::peekHead() const {
+    auto node = getNode(head.load(std::memory_order_acquire));
+    if (node == nullptr && lockedNodesPresent.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> lock(lockedNodesMutex);
+        node = lockedHead;
+    }
+    return node;
+}
+
+bool TagNodeFreeStack::peekContains(const TagNodeBase &node) const {
+    auto listContains = [&node](TagNodeBase *listHead) {
+        for (auto currentNode = listHead; currentNode != nullptr; currentNode = currentNode->nextFreeNode.load(std::memory_order_relaxed)) {
+            if (currentNode == &node) {
+                return true;
+            }
+        }
+        return false;
+    };
+    if (listContains(getNode(head.load(std::memory_order_acquire)))) {
+        return true;
+    }
+    std::lock_guard<std::mutex> lock(lockedNodesMutex);
+    return listContains(lockedHead);
+}
+
+namespace {
+// Trivially destructible, so it stays valid after thread caches of exiting thread were destroyed.
+// Main thread destroys its thread locals before global teardown, which may still return tags.
+thread_local bool threadTagCachesDestroyed = false;
+} // namespace
+
+class ThreadTagCaches {
+  public:
+    ~ThreadTagCaches() {
+        threadTagCachesDestroyed = true;
+        std::lock_guard<std::mutex> lock(liveAllocatorsMutex);
+        for (auto &[allocatorId, cache] : caches) {
+            auto allocator = liveAllocators.find(allocatorId);
+            if (allocator != liveAllocators.end() && cache->count > 0) {
+                allocator->second->returnThreadTagCache(*cache);
+            }
+        }
+        caches.clear();
+        lastCache = nullptr;
+    }
+
+    TagAllocatorBase::ThreadTagCache *get(uint64_t allocatorId) {
+        if (lastAllocatorId == allocatorId) {
+            return lastCache;
+        }
+        for (auto &[cacheAllocatorId, cache] : caches) {
+            if (cacheAllocatorId == allocatorId) {
+                return setLast(allocatorId, cache.get());
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(liveAllocatorsMutex);
+            caches.erase(std::remove_if(caches.begin(), caches.end(), [](auto &entry) { return liveAllocators.find(entry.first) == liveAllocators.end(); }),
+                         caches.end());
+        }
+        caches.emplace_back(allocatorId, std::make_unique<TagAllocatorBase::ThreadTagCache>());
+        return setLast(allocatorId, caches.back().second.get());
+    }
+
+  protected:
+    TagAllocatorBase::ThreadTagCache *setLast(uint64_t allocatorId, TagAllocatorBase::ThreadTagCache *cache) {
+        lastAllocatorId = allocatorId;
+        lastCache = cache;
+        return cache;
+    }
+
+    std::vector<std::pair<uint64_t, std::unique_ptr<TagAllocatorBase::ThreadTagCache>>> caches;
+    TagAllocatorBase::ThreadTagCache *lastCache = nullptr;
+    uint64_t lastAllocatorId = 0;
+};
+
+namespace {
+thread_local ThreadTagCaches threadTagCaches;
+} // namespace
+
 TagAllocatorBase::TagAllocatorBase(const RootDeviceIndicesContainer &rootDeviceIndices, MemoryManager *memMngr, size_t tagCount, size_t tagAlignment, size_t tagSize, bool doNotReleaseNodes, DeviceBitfield deviceBitfield)
     : deviceBitfield(deviceBitfield), rootDeviceIndices(rootDeviceIndices), memoryManager(memMngr), tagCount(tagCount), tagSize(tagSize), doNotReleaseNodes(doNotReleaseNodes) {
 
     this->tagSize = alignUp(tagSize, tagAlignment);
     maxRootDeviceIndex = *std::max_element(std::begin(rootDeviceIndices), std::end(rootDeviceIndices));
+
+    if (DebugManager.flags.TagAllocatorThreadCacheSize.get() != -1) {
+        this->threadCacheSize = static_cast<uint32_t>(DebugManager.flags.TagAllocatorThreadCacheSize.get());
+    }
+
+    this->allocatorId = ++allocatorIdCounter;
+    std::lock_guard<std::mutex> lock(liveAllocatorsMutex);
+    liveAllocators[this->allocatorId] = this;
+}
+
+void TagAllocatorBase::unregisterAllocator() {
+    std::lock_guard<std::mutex> lock(liveAllocatorsMutex);
+    liveAllocators.erase(this->allocatorId);
+}
+
+TagAllocatorBase::ThreadTagCache *TagAllocatorBase::getThreadTagCache() {
+    if (threadTagCachesDestroyed) {
+        return nullptr;
+    }
+    return threadTagCaches.get(this->allocatorId);
+}
+
+TagNodeBase *TagAllocatorBase::takeFreeTag() {
+    if (this->threadCacheSize > 0) {
+        auto cache = getThreadTagCache();
+        if (cache && cache->head) {
+            auto node = cache->head;
+            cache->head = node->nextFreeNode.load(std::memory_order_relaxed);
+            cache->count--;
+            if (cache->head == nullptr) {
+                cache->tail = nullptr;
+            }
+            node->nextFreeNode.store(nullptr, std::memory_order_relaxed);
+            return node;
+        }
+    }
+    return freeTags.pop();
+}
+
+void TagAllocatorBase::putFreeTag(TagNodeBase &node) {
+    // returned nodes are kept by returning thread and handed back to shared pool in bulk
+    auto cache = this->threadCacheSize > 0 ? getThreadTagCache() : nullptr;
+    if (cache == nullptr) {
+        freeTags.push(node);
+        return;
+    }
+
+    node.nextFreeNode.store(cache->head, std::memory_order_relaxed);
+    cache->head = &node;
+    if (cache->tail == nullptr) {
+        cache->tail = &node;
+    }
+    cache->count++;
+
+    if (cache->count >= this->threadCacheSize) {
+        returnThreadTagCache(*cache);
+    }
+}
+
+void TagAllocatorBase::returnThreadTagCache(ThreadTagCache &cache) {
+    if (cache.head) {
+        freeTags.pushChain(*cache.head, *cache.tail);
+    }
+    cache = {};
 }
 
 void TagAllocatorBase::cleanUpResources() {
@@ -31,6 +31,8 @@ class TagNode;
 
 class TagAllocatorBase;
 
+class TagNodeFreeStack;
+
 class TagNodeBase : public NonCopyableOrMovableClass {
   public:
     virtual ~TagNodeBase() = default;
@@ -86,16 +88,20 @@ class TagNodeBase : public NonCopyableOrMovableClass {
     TagNodeBase() = default;
 
     TagAllocatorBase *allocator = nullptr;
+    std::atomic<TagNodeBase *> nextFreeNode{nullptr};
 
     MultiGraphicsAllocation *gfxAllocation = nullptr;
     uint64_t gpuAddress = 0;
     std::atomic<uint32_t> refCount{0};
     uint32_t packetsUsed = 1;
+    std::atomic<bool> inUse{false};
     bool doNotReleaseNodes = false;
     bool profilingCapable = true;
 
     template <typename TagType>
     friend class TagAllocator;
+    friend class TagAllocatorBase;
+    friend class TagNodeFreeStack;
 };
 
 template <typename TagType>
@@ -136,6 +142,44 @@ class TagNode : public TagNodeBase, public IDNode<TagNode<TagType>> {
     MetricsLibraryApi::QueryHandle_1_0 &getQueryHandleRef() const override;
 };
 
+// Lock-free LIFO of free tag nodes. Node memory lives as long as the allocator, so a popping thread
+// may read next pointer of a node concurrently taken by other thread - the version kept in upper bits
+// of head makes CAS fail in such case (ABA).
+// Once nodes not addressable with nodePointerBits (tagged or 57-bit pointers) were added, pushes go to mutex protected list.
+class TagNodeFreeStack : NonCopyableOrMovableClass {
+  public:
+    void push(TagNodeBase &node) { pushChain(node, node); }
+    void pushChain(TagNodeBase &first, TagNodeBase &last);
+    TagNodeBase *pop();
+
+    static bool canBeLockFree(const TagNodeBase &node) { return (static_cast<uint64_t>(reinterpret_cast<uintptr_t>(&node)) & ~nodePointerMask) == 0; }
+    void enableLockedNodes() { lockedNodesPresent.store(true, std::memory_order_release); }
+
+    TagNodeBase *peekHead() const;
+    bool peekIsEmpty() const { return peekHead() == nullptr; }
+    bool peekContains(const TagNodeBase &node) const;
+
+  protected:
+    static constexpr uint32_t nodePointerBits = 48;
+    static constexpr uint64_t nodePointerMask = (1ull << nodePointerBits) - 1;
+
+    void pushChainLockFree(TagNodeBase &first, TagNodeBase &last);
+    TagNodeBase *popLockFree();
+
+    static TagNodeBase *getNode(uint64_t head) { return reinterpret_cast<TagNodeBase *>(static_cast<uintptr_t>(head & nodePointerMask)); }
+    static uint64_t getNextHead(uint64_t head, TagNodeBase *node) {
+        return (((head >> nodePointerBits) + 1) << nodePointerBits) | static_cast<uint64_t>(reinterpret_cast<uintptr_t>(node));
+    }
+
+    std::atomic<uint64_t> head{0};
+
+    std::atomic<bool> lockedNodesPresent{false};
+    mutable std::mutex lockedNodesMutex;
+    TagNodeBase *lockedHead = nullptr;
+};
+
+class ThreadTagCaches;
+
 class TagAllocatorBase {
   public:
     virtual ~TagAllocatorBase() { cleanUpResources(); };
@@ -151,6 +195,18 @@ class TagAllocatorBase {
                      size_t tagAlignment, size_t tagSize, bool doNotReleaseNodes,
                      DeviceBitfield deviceBitfield);
 
+    struct ThreadTagCache {
+        TagNodeBase *head = nullptr;
+        TagNodeBase *tail = nullptr;
+        uint32_t count = 0;
+    };
+
+    ThreadTagCache *getThreadTagCache();
+    TagNodeBase *takeFreeTag();
+    void putFreeTag(TagNodeBase &node);
+    void returnThreadTagCache(ThreadTagCache &cache);
+    void unregisterAllocator();
+
     virtual void returnTagToFreePool(TagNodeBase *node) = 0;
 
     virtual void returnTagToDeferredPool(TagNodeBase *node) = 0;
@@ -166,9 +222,14 @@ class TagAllocatorBase {
     MemoryManager *memoryManager;
     size_t tagCount;
     size_t tagSize;
+    uint64_t allocatorId = 0;
+    uint32_t threadCacheSize = 16;
     bool doNotReleaseNodes = false;
 
+    TagNodeFreeStack freeTags;
     std::mutex allocatorMutex;
+
+    friend class ThreadTagCaches;
 };
 
 template <typename TagType>
@@ -180,6 +241,8 @@ class TagAllocator : public TagAllocatorBase {
                  size_t tagAlignment, size_t tagSize, bool doNotReleaseNodes,
                  DeviceBitfield deviceBitfield);
 
+    ~TagAllocator() override;
+
     TagNodeBase *getTag() override;
 
     void returnTag(TagNodeBase *node) override;
@@ -195,8 +258,6 @@ class TagAllocator : public TagAllocatorBase {
 
     void populateFreeTags();
 
-    IDList<NodeType> freeTags;
-    IDList<NodeType> usedTags;
     IDList<NodeType> deferredTags;
 
     std::vector<std::unique_ptr<NodeType[]>> tagPoolMemory;
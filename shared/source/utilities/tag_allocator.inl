@@ -20,18 +20,27 @@ TagAllocator<TagType>::TagAllocator(const RootDeviceIndicesContainer &rootDevice
     populateFreeTags();
 }
 
+template <typename TagType>
+TagAllocator<TagType>::~TagAllocator() {
+    unregisterAllocator();
+}
+
 template <typename TagType>
 TagNodeBase *TagAllocator<TagType>::getTag() {
-    if (freeTags.peekIsEmpty()) {
+    auto node = static_cast<NodeType *>(takeFreeTag());
+    if (!node) {
         releaseDeferredTags();
+        node = static_cast<NodeType *>(freeTags.pop());
     }
-    auto node = freeTags.removeFrontOne().release();
     if (!node) {
         std::unique_lock<std::mutex> lock(allocatorMutex);
-        populateFreeTags();
-        node = freeTags.removeFrontOne().release();
+        node = static_cast<NodeType *>(freeTags.pop());
+        if (!node) {
+            populateFreeTags();
+            node = static_cast<NodeType *>(freeTags.pop());
+        }
     }
-    usedTags.pushFrontOne(*node);
+    DEBUG_BREAK_IF(node->inUse.exchange(true, std::memory_order_relaxed));
     node->incRefCount();
     node->initialize();
 
@@ -44,28 +53,25 @@ TagNodeBase *TagAllocator<TagType>::getTag() {
 
 template <typename TagType>
 void TagAllocator<TagType>::returnTagToFreePool(TagNodeBase *node) {
-    auto nodeT = static_cast<NodeType *>(node);
-    [[maybe_unused]] auto usedNode = usedTags.removeOne(*nodeT).release();
-    DEBUG_BREAK_IF(usedNode == nullptr);
+    DEBUG_BREAK_IF(!node->inUse.exchange(false, std::memory_order_relaxed));
 
     if (DebugManager.flags.PrintTimestampPacketUsage.get() == 1) {
-        printf("\nPID: %u, TSP returned to pool: 0x%" PRIX64, SysCalls::getProcessId(), nodeT->getGpuAddress());
+        printf("\nPID: %u, TSP returned to pool: 0x%" PRIX64, SysCalls::getProcessId(), node->getGpuAddress());
     }
 
-    freeTags.pushFrontOne(*nodeT);
+    putFreeTag(*node);
 }
 
 template <typename TagType>
 void TagAllocator<TagType>::returnTagToDeferredPool(TagNodeBase *node) {
-    auto nodeT = static_cast<NodeType *>(node);
-    auto usedNode = usedTags.removeOne(*nodeT).release();
-    DEBUG_BREAK_IF(!usedNode);
-    deferredTags.pushFrontOne(*usedNode);
+    DEBUG_BREAK_IF(!node->inUse.exchange(false, std::memory_order_relaxed));
+    deferredTags.pushFrontOne(*static_cast<NodeType *>(node));
 }
 
 template <typename TagType>
 void TagAllocator<TagType>::releaseDeferredTags() {
-    IDList<NodeType, false> pendingFreeTags;
+    NodeType *pendingFreeTagsHead = nullptr;
+    NodeType *pendingFreeTagsTail = nullptr;
     IDList<NodeType, false> pendingDeferredTags;
     auto currentNode = deferredTags.detachNodes();
 
@@ -75,15 +81,21 @@ void TagAllocator<TagType>::releaseDeferredTags() {
             if (DebugManager.flags.PrintTimestampPacketUsage.get() == 1) {
                 printf("\nPID: %u, TSP returned to pool: 0x%" PRIX64, SysCalls::getProcessId(), currentNode->getGpuAddress());
             }
-            pendingFreeTags.pushFrontOne(*currentNode);
+            currentNode->next = nullptr;
+            currentNode->prev = nullptr;
+            currentNode->nextFreeNode.store(pendingFreeTagsHead, std::memory_order_relaxed);
+            pendingFreeTagsHead = currentNode;
+            if (pendingFreeTagsTail == nullptr) {
+                pendingFreeTagsTail = currentNode;
+            }
         } else {
             pendingDeferredTags.pushFrontOne(*currentNode);
         }
         currentNode = nextNode;
     }
 
-    if (!pendingFreeTags.peekIsEmpty()) {
-        freeTags.splice(*pendingFreeTags.detachNodes());
+    if (pendingFreeTagsHead) {
+        freeTags.pushChain(*pendingFreeTagsHead, *pendingFreeTagsTail);
     }
     if (!pendingDeferredTags.peekIsEmpty()) {
         deferredTags.splice(*pendingDeferredTags.detachNodes());
@@ -119,6 +131,9 @@ void TagAllocator<TagType>::populateFreeTags() {
     auto nodesMemory = std::make_unique<NodeType[]>(tagCount);
 
     for (size_t i = 0; i < tagCount; ++i) {
+        if (i + 1 < tagCount) {
+            nodesMemory[i].nextFreeNode.store(&nodesMemory[i + 1], std::memory_order_relaxed);
+        }
         auto tagOffset = i * tagSize;
 
         nodesMemory[i].allocator = this;
@@ -126,11 +141,14 @@ void TagAllocator<TagType>::populateFreeTags() {
         nodesMemory[i].tagForCpuAccess = reinterpret_cast<TagType *>(ptrOffset(baseCpuAddress, tagOffset));
         nodesMemory[i].gpuAddress = baseGpuAddress + tagOffset;
         nodesMemory[i].setDoNotReleaseNodes(doNotReleaseNodes);
-
-        freeTags.pushTailOne(nodesMemory[i]);
     }
 
+    auto nodes = nodesMemory.get();
     tagPoolMemory.push_back(std::move(nodesMemory));
+    if (!TagNodeFreeStack::canBeLockFree(nodes[tagCount - 1])) {
+        freeTags.enableLockedNodes();
+    }
+    freeTags.pushChain(nodes[0], nodes[tagCount - 1]);
 }
 
 template <typename TagType>
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021 Intel Corporation
+ * Copyright (C) 2021-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,9 @@
 #include "shared/source/utilities/wait_util.h"
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/basic_math.h"
+
+#include <algorithm>
 
 namespace NEO {
 
@@ -22,6 +25,54 @@ void init() {
     }
 }
 
+uint32_t AdaptiveWaitPolicy::getBucketIndex(uint64_t waitTimeUs) {
+    if (waitTimeUs < 2u) {
+        return 0u;
+    }
+    return std::min(Math::log2(waitTimeUs), numHistogramBuckets - 1);
+}
+
+bool AdaptiveWaitPolicy::isEnabled() {
+    return DebugManager.flags.EnableAdaptiveWaitSpin.get() == 1;
+}
+
+void AdaptiveWaitPolicy::recordWait(uint64_t waitTimeUs, uint64_t spinTimeUs) {
+    histogram[getBucketIndex(waitTimeUs)]++;
+
+    const auto timeSpinning = std::min(waitTimeUs, spinTimeUs);
+    phaseTimesUs[static_cast<uint32_t>(WaitPhase::spin)] += timeSpinning;
+    phaseTimesUs[static_cast<uint32_t>(WaitPhase::yield)] += waitTimeUs - timeSpinning;
+
+    if (++numWaits % decayInterval == 0) {
+        for (auto &bucket : histogram) {
+            auto bucketValue = bucket.load();
+            while (!bucket.compare_exchange_weak(bucketValue, bucketValue / 2)) {
+            }
+        }
+    }
+}
+
+uint64_t AdaptiveWaitPolicy::getSpinTimeUs() const {
+    uint64_t numSamples = 0u;
+    for (auto &bucket : histogram) {
+        numSamples += bucket.load();
+    }
+    if (numSamples < minSamplesToSpin) {
+        return 0u;
+    }
+
+    const auto samplesToCover = (numSamples * spinPercentile + 99) / 100;
+    uint64_t coveredSamples = 0u;
+    for (uint32_t bucketIndex = 0; bucketIndex < numHistogramBuckets; bucketIndex++) {
+        coveredSamples += histogram[bucketIndex].load();
+        if (coveredSamples >= samplesToCover) {
+            const uint64_t bucketUpperBoundUs = 1ull << (bucketIndex + 1);
+            return bucketUpperBoundUs <= maxSpinTimeUs ? bucketUpperBoundUs : 0u;
+        }
+    }
+    return 0u;
+}
+
 } // namespace WaitUtils
 
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2022 Intel Corporation
+ * Copyright (C) 2021-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,8 @@
 #include "shared/source/command_stream/task_count_helper.h"
 #include "shared/source/utilities/cpuintrinsics.h"
 
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <functional>
 #include <thread>
@@ -20,16 +22,25 @@ namespace WaitUtils {
 constexpr uint32_t defaultWaitCount = 1u;
 extern uint32_t waitCount;
 
-template <typename T>
-inline bool waitFunctionWithPredicate(volatile T const *pollAddress, T expectedValue, std::function<bool(T, T)> predicate) {
+template <typename T, typename Predicate>
+inline bool pollFunctionWithPredicate(volatile T const *pollAddress, T expectedValue, Predicate predicate) {
     for (uint32_t i = 0; i < waitCount; i++) {
         CpuIntrinsics::pause();
     }
     if (pollAddress != nullptr) {
-        if (predicate(*pollAddress, expectedValue)) {
+        const T currentValue = *pollAddress;
+        if (predicate(currentValue, expectedValue)) {
             return true;
         }
     }
+    return false;
+}
+
+template <typename T, typename Predicate>
+inline bool waitFunctionWithPredicate(volatile T const *pollAddress, T expectedValue, Predicate predicate) {
+    if (pollFunctionWithPredicate<T>(pollAddress, expectedValue, predicate)) {
+        return true;
+    }
     std::this_thread::yield();
     return false;
 }
@@ -38,6 +49,40 @@ inline bool waitFunction(volatile TagAddressType *pollAddress, TaskCountType exp
     return waitFunctionWithPredicate<TaskCountType>(pollAddress, expectedValue, std::greater_equal<TaskCountType>());
 }
 
+inline bool spinFunction(volatile TagAddressType *pollAddress, TaskCountType expectedValue) {
+    return pollFunctionWithPredicate<TaskCountType>(pollAddress, expectedValue, std::greater_equal<TaskCountType>());
+}
+
+enum class WaitPhase : uint32_t {
+    spin = 0,
+    yield,
+    count
+};
+
+// Tracks a decaying log2 histogram of completed wait times. Waits are expected to finish within
+// the returned spin time, so the caller polls without yielding for that long and yields afterwards.
+class AdaptiveWaitPolicy {
+  public:
+    static constexpr uint32_t numHistogramBuckets = 16u;
+    static constexpr uint32_t minSamplesToSpin = 8u;
+    static constexpr uint32_t decayInterval = 256u;
+    static constexpr uint32_t spinPercentile = 90u;
+    static constexpr uint64_t maxSpinTimeUs = 64u;
+
+    static uint32_t getBucketIndex(uint64_t waitTimeUs);
+    static bool isEnabled();
+
+    void recordWait(uint64_t waitTimeUs, uint64_t spinTimeUs);
+    uint64_t getSpinTimeUs() const;
+    uint64_t getPhaseTimeUs(WaitPhase phase) const { return phaseTimesUs[static_cast<uint32_t>(phase)].load(); }
+    uint64_t getNumWaits() const { return numWaits.load(); }
+
+  protected:
+    std::array<std::atomic<uint32_t>, numHistogramBuckets> histogram = {};
+    std::array<std::atomic<uint64_t>, static_cast<uint32_t>(WaitPhase::count)> phaseTimesUs = {};
+    std::atomic<uint64_t> numWaits{0u};
+};
+
 void init();
 } // namespace WaitUtils
 
@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/worker_pool.h"
+
+#include "shared/source/os_interface/os_thread.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace NEO {
+
+size_t WorkerPool::getDefaultNumWorkers() {
+    // calling thread is one of threads running a batch
+    const auto numThreads = std::min(defaultMaxThreads, static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 1u)));
+    return numThreads - 1;
+}
+
+WorkerPool::WorkerPool(size_t numWorkers) : numWorkers(numWorkers) {}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        keepRunning = false;
+    }
+    batchesAvailable.notify_all();
+    for (auto &worker : workers) {
+        worker->join();
+    }
+    workers.clear();
+}
+
+void WorkerPool::startWorkers() {
+    for (size_t i = 0; i < numWorkers; i++) {
+        workers.push_back(Thread::create(processBatches, reinterpret_cast<void *>(this)));
+    }
+}
+
+bool WorkerPool::runNextTask(Batch &batch) {
+    const auto taskIndex = batch.nextTask.fetch_add(1u);
+    if (taskIndex >= batch.numTasks) {
+        return false;
+    }
+    (*batch.task)(taskIndex);
+    return true;
+}
+
+void WorkerPool::runTasks(size_t numTasks, const std::function<void(size_t)> &task) {
+    Batch batch;
+    batch.task = &task;
+    batch.numTasks = numTasks;
+
+    const bool useWorkers = (numWorkers > 0) && (numTasks > 1);
+    if (useWorkers) {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            if (workers.empty()) {
+                startWorkers();
+            }
+            batches.push_back(&batch);
+        }
+        batchesAvailable.notify_all();
+    }
+
+    while (runNextTask(batch)) {
+    }
+
+    if (useWorkers) {
+        // batch lives on this stack, wait until no worker can touch it
+        std::unique_lock<std::mutex> lock(mtx);
+        auto queuedBatch = std::find(batches.begin(), batches.end(), &batch);
+        if (queuedBatch != batches.end()) {
+            batches.erase(queuedBatch);
+        }
+        workerLeftBatch.wait(lock, [&batch]() { return batch.numActiveWorkers == 0; });
+    }
+}
+
+void *WorkerPool::processBatches(void *arg) {
+    auto pool = reinterpret_cast<WorkerPool *>(arg);
+    std::unique_lock<std::mutex> lock(pool->mtx);
+    while (true) {
+        pool->batchesAvailable.wait(lock, [pool]() { return !pool->batches.empty() || !pool->keepRunning; });
+        if (!pool->keepRunning) {
+            break;
+        }
+        auto batch = pool->batches.front();
+        if (batch->nextTask.load() >= batch->numTasks) {
+            pool->batches.pop_front();
+            continue;
+        }
+        batch->numActiveWorkers++;
+        lock.unlock();
+
+        while (runNextTask(*batch)) {
+        }
+
+        lock.lock();
+        if (--batch->numActiveWorkers == 0) {
+            pool->workerLeftBatch.notify_all();
+        }
+    }
+    return nullptr;
+}
+
+} // namespace NEO
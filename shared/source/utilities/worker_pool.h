@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class Thread;
+
+// Fixed number of worker threads, started on first use and shared by all callers.
+// Calling thread of runTasks takes tasks as well, so a batch completes even when all workers are busy with other batches.
+class WorkerPool : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t defaultMaxThreads = 8u;
+
+    static size_t getDefaultNumWorkers();
+
+    WorkerPool(size_t numWorkers);
+    virtual ~WorkerPool();
+
+    // Runs task(0) ... task(numTasks - 1) and returns when all of them completed.
+    void runTasks(size_t numTasks, const std::function<void(size_t)> &task);
+    size_t getNumWorkers() const { return numWorkers; }
+    size_t getNumStartedWorkers() {
+        std::lock_guard<std::mutex> lock(mtx);
+        return workers.size();
+    }
+
+  protected:
+    struct Batch {
+        const std::function<void(size_t)> *task = nullptr;
+        size_t numTasks = 0u;
+        std::atomic<size_t> nextTask{0u};
+        size_t numActiveWorkers = 0u;
+    };
+
+    static void *processBatches(void *arg);
+    static bool runNextTask(Batch &batch);
+    MOCKABLE_VIRTUAL void startWorkers();
+
+    std::deque<Batch *> batches;
+    std::vector<std::unique_ptr<Thread>> workers;
+    std::mutex mtx;
+    std::condition_variable batchesAvailable;
+    std::condition_variable workerLeftBatch;
+    const size_t numWorkers;
+    bool keepRunning = true;
+};
+
+} // namespace NEO
@@ -17,11 +17,15 @@ void CpuInfo::detect() const {
 
     cpuid(cpuInfo, 0u);
     auto numFunctionIds = cpuInfo[0];
+    bool osXSaveEnabled = false;
     if (numFunctionIds >= 1u) {
         cpuid(cpuInfo, 1u);
         {
             features |= cpuInfo[3] & BIT(19) ? featureClflush : featureNone;
         }
+        {
+            osXSaveEnabled = (cpuInfo[2] & BIT(27)) != 0;
+        }
     }
 
     if (numFunctionIds >= 7u) {
@@ -30,6 +34,13 @@ void CpuInfo::detect() const {
             auto mask = BIT(5) | BIT(3) | BIT(8);
             features |= (cpuInfo[1] & mask) == mask ? featureAvX2 : featureNone;
         }
+        {
+            // OS has to preserve SSE, AVX, opmask and both halves of ZMM registers
+            auto mask = BIT(16) | BIT(30);
+            auto xcr0Mask = BIT(1) | BIT(2) | BIT(5) | BIT(6) | BIT(7);
+            bool avx512StateEnabled = osXSaveEnabled && (xgetbv(0u) & xcr0Mask) == xcr0Mask;
+            features |= avx512StateEnabled && (cpuInfo[1] & mask) == mask ? featureAvX512Bw : featureNone;
+        }
     }
 
     cpuid(cpuInfo, 0x80000000);
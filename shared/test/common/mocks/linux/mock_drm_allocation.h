@@ -45,13 +45,14 @@ class MockBufferObject : public BufferObject {
     MockBufferObject(uint32_t rootDeviceIndex, Drm *drm) : BufferObject(rootDeviceIndex, drm, CommonConstants::unsupportedPatIndex, 0, 0, 1) {
     }
     int exec(uint32_t used, size_t startOffset, unsigned int flags, bool requiresCoherency, OsContext *osContext, uint32_t vmHandleId, uint32_t drmContextId,
-             BufferObject *const residency[], size_t residencyCount, ExecObject *execObjectsStorage, uint64_t completionGpuAddress, TaskCountType completionValue) override {
+             BufferObject *const residency[], size_t residencyCount, ExecObject *execObjectsStorage, uint64_t completionGpuAddress, TaskCountType completionValue,
+             bool residencyExecObjectsFilled) override {
         if (execReturnValue) {
             return *execReturnValue;
         }
         passedExecParams.push_back({completionGpuAddress, completionValue});
         return BufferObject::exec(used, startOffset, flags, requiresCoherency, osContext, vmHandleId, drmContextId,
-                                  residency, residencyCount, execObjectsStorage, completionGpuAddress, completionValue);
+                                  residency, residencyCount, execObjectsStorage, completionGpuAddress, completionValue, residencyExecObjectsFilled);
     }
 };
 
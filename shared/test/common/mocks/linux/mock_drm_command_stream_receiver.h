@@ -20,8 +20,10 @@ class TestedDrmCommandStreamReceiver : public DrmCommandStreamReceiver<GfxFamily
     using BaseClass = DrmCommandStreamReceiver<GfxFamily>;
     using BaseClass::drm;
     using BaseClass::exec;
+    using BaseClass::execObjectsSources;
     using BaseClass::execObjectsStorage;
     using BaseClass::residency;
+    using BaseClass::reuseExecObjects;
     using BaseClass::useContextForUserFenceWait;
     using BaseClass::useUserFenceWait;
     using CommandStreamReceiver::activePartitions;
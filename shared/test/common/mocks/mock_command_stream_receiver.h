@@ -54,6 +54,7 @@ class MockCommandStreamReceiver : public CommandStreamReceiver {
     using CommandStreamReceiver::timestampPacketAllocator;
     using CommandStreamReceiver::timeStampPostSyncWriteOffset;
     using CommandStreamReceiver::useGpuIdleImplicitFlush;
+    using CommandStreamReceiver::useGpuIdleImplicitFlushWithPendingSubmissions;
     using CommandStreamReceiver::useNewResourceImplicitFlush;
 
     MockCommandStreamReceiver(ExecutionEnvironment &executionEnvironment, uint32_t rootDeviceIndex, const DeviceBitfield deviceBitfield)
@@ -282,6 +283,7 @@ class MockCsrHw2 : public CommandStreamReceiverHw<GfxFamily> {
     using CommandStreamReceiver::timestampPacketWriteEnabled;
     using CommandStreamReceiver::timeStampPostSyncWriteOffset;
     using CommandStreamReceiver::useGpuIdleImplicitFlush;
+    using CommandStreamReceiver::useGpuIdleImplicitFlushWithPendingSubmissions;
     using CommandStreamReceiver::useNewResourceImplicitFlush;
 
     MockCsrHw2(ExecutionEnvironment &executionEnvironment, uint32_t rootDeviceIndex, const DeviceBitfield deviceBitfield)
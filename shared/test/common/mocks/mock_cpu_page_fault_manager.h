@@ -18,6 +18,7 @@ class MockPageFaultManager : public PageFaultManager {
   public:
     using PageFaultManager::gpuDomainHandler;
     using PageFaultManager::memoryData;
+    using PageFaultManager::migrationChunkSize;
     using PageFaultManager::PageFaultData;
     using PageFaultManager::PageFaultManager;
     using PageFaultManager::selectGpuDomainHandler;
@@ -51,6 +52,16 @@ class MockPageFaultManager : public PageFaultManager {
         transferToGpuCalled++;
         transferToGpuAddress = ptr;
     }
+    void transferRangeToCpu(void *ptr, size_t offset, size_t size, void *cmdQ) override {
+        transferRangeToCpuCalled++;
+        transferRangeToCpuOffset = offset;
+        transferRangeToCpuSize = size;
+    }
+    void transferRangeToGpu(void *ptr, size_t offset, size_t size, void *cmdQ) override {
+        transferRangeToGpuCalled++;
+        transferRangeToGpuOffset = offset;
+        transferRangeToGpuSize = size;
+    }
     void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager) override {
         isAubWritable = writable;
     }
@@ -70,6 +81,12 @@ class MockPageFaultManager : public PageFaultManager {
     void baseGpuTransfer(void *ptr, void *cmdQ) {
         PageFaultManager::transferToGpu(ptr, cmdQ);
     }
+    void baseCpuRangeTransfer(void *ptr, size_t offset, size_t size, void *cmdQ) {
+        PageFaultManager::transferRangeToCpu(ptr, offset, size, cmdQ);
+    }
+    void baseGpuRangeTransfer(void *ptr, size_t offset, size_t size, void *cmdQ) {
+        PageFaultManager::transferRangeToGpu(ptr, offset, size, cmdQ);
+    }
     void baseCpuAllocEvictable(bool evictable, void *ptr, SVMAllocsManager *unifiedMemoryManager) {
         PageFaultManager::setCpuAllocEvictable(evictable, ptr, unifiedMemoryManager);
     }
@@ -102,6 +119,8 @@ class MockPageFaultManager : public PageFaultManager {
     int protectMemoryCalled = 0;
     int transferToCpuCalled = 0;
     int transferToGpuCalled = 0;
+    int transferRangeToCpuCalled = 0;
+    int transferRangeToGpuCalled = 0;
     int moveAllocationToGpuDomainCalled = 0;
     int setCpuAllocEvictableCalled = 0;
     int allowCPUMemoryEvictionCalled = 0;
@@ -111,6 +130,10 @@ class MockPageFaultManager : public PageFaultManager {
     void *allowedMemoryAccessAddress = nullptr;
     void *protectedMemoryAccessAddress = nullptr;
     size_t transferToCpuSize = 0;
+    size_t transferRangeToCpuOffset = 0;
+    size_t transferRangeToCpuSize = 0;
+    size_t transferRangeToGpuOffset = 0;
+    size_t transferRangeToGpuSize = 0;
     size_t accessAllowedSize = 0;
     size_t protectedSize = 0;
     bool isAubWritable = true;
@@ -23,6 +23,8 @@ struct MockSVMAllocsManager : public SVMAllocsManager {
     using SVMAllocsManager::svmMapOperations;
     using SVMAllocsManager::usmDeviceAllocationsCache;
     using SVMAllocsManager::usmDeviceAllocationsCacheEnabled;
+    using SVMAllocsManager::usmHostAllocationsCache;
+    using SVMAllocsManager::usmHostAllocationsCacheEnabled;
 
     void prefetchMemory(Device &device, CommandStreamReceiver &commandStreamReceiver, SvmAllocationData &svmData) override {
         SVMAllocsManager::prefetchMemory(device, commandStreamReceiver, svmData);
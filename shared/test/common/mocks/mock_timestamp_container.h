@@ -16,7 +16,6 @@ class MockTagAllocator : public TagAllocator<TagType> {
   public:
     using BaseClass = TagAllocator<TagType>;
     using BaseClass::freeTags;
-    using BaseClass::usedTags;
     using NodeType = typename BaseClass::NodeType;
 
     MockTagAllocator(uint32_t rootDeviceIndex, MemoryManager *memoryManager, size_t tagCount,
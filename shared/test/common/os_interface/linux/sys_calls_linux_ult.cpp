@@ -62,6 +62,7 @@ int flockCalled = 0;
 int opendirCalled = 0;
 int readdirCalled = 0;
 int closedirCalled = 0;
+int futimensCalled = 0;
 
 std::vector<void *> mmapVector(64);
 std::vector<void *> mmapCapturedExtendedPointers(64);
@@ -85,6 +86,7 @@ ssize_t (*sysCallsRead)(int fd, void *buf, size_t count) = nullptr;
 ssize_t (*sysCallsWrite)(int fd, void *buf, size_t count) = nullptr;
 int (*sysCallsPipe)(int pipeFd[2]) = nullptr;
 int (*sysCallsFstat)(int fd, struct stat *buf) = nullptr;
+int (*sysCallsFutimens)(int fd, const struct timespec times[2]) = nullptr;
 char *(*sysCallsRealpath)(const char *path, char *buf) = nullptr;
 int (*sysCallsRename)(const char *currName, const char *dstName);
 int (*sysCallsScandir)(const char *dirp,
@@ -274,6 +276,14 @@ int fstat(int fd, struct stat *buf) {
     return fstatFuncRetVal;
 }
 
+int futimens(int fd, const struct timespec times[2]) {
+    futimensCalled++;
+    if (sysCallsFutimens != nullptr) {
+        return sysCallsFutimens(fd, times);
+    }
+    return 0;
+}
+
 ssize_t pread(int fd, void *buf, size_t count, off_t offset) {
     if (sysCallsPread != nullptr) {
         return sysCallsPread(fd, buf, count, offset);
@@ -31,6 +31,7 @@ extern ssize_t (*sysCallsRead)(int fd, void *buf, size_t count);
 extern ssize_t (*sysCallsWrite)(int fd, void *buf, size_t count);
 extern int (*sysCallsPipe)(int pipeFd[2]);
 extern int (*sysCallsFstat)(int fd, struct stat *buf);
+extern int (*sysCallsFutimens)(int fd, const struct timespec times[2]);
 extern char *(*sysCallsRealpath)(const char *path, char *buf);
 extern ssize_t (*sysCallsPwrite)(int fd, const void *buf, size_t count, off_t offset);
 extern int (*sysCallsRename)(const char *currName, const char *dstName);
@@ -68,6 +69,7 @@ extern int mkstempCalled;
 extern int renameCalled;
 extern int pathFileExistsCalled;
 extern int flockCalled;
+extern int futimensCalled;
 
 extern std::vector<void *> mmapVector;
 extern std::vector<void *> mmapCapturedExtendedPointers;
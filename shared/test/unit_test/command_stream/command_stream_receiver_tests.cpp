@@ -421,6 +421,40 @@ HWTEST_F(CommandStreamReceiverTest, givenNoGpuHangWhenWaititingForCompletionWith
     EXPECT_EQ(WaitStatus::Ready, waitStatus);
 }
 
+HWTEST_F(CommandStreamReceiverTest, givenAdaptiveWaitSpinEnabledAndCompletedWaitForCompletionWithTimeoutWhenWaitIsReadyThenWaitIsRecordedInWaitPolicy) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableAdaptiveWaitSpin.set(1);
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    csr.callBaseWaitForCompletionWithTimeout = true;
+    csr.activePartitions = 1;
+
+    volatile TagAddressType tasksCount[16] = {};
+    tasksCount[0] = 1;
+    csr.tagAddress = tasksCount;
+    const auto numWaits = csr.waitPolicy.getNumWaits();
+
+    const auto waitStatus = csr.waitForCompletionWithTimeout(false, std::numeric_limits<std::int64_t>::max(), 1);
+    EXPECT_EQ(WaitStatus::Ready, waitStatus);
+    EXPECT_EQ(numWaits + 1, csr.waitPolicy.getNumWaits());
+}
+
+HWTEST_F(CommandStreamReceiverTest, givenAdaptiveWaitSpinDisabledAndCompletedWaitForCompletionWithTimeoutWhenWaitIsReadyThenWaitIsNotRecordedInWaitPolicy) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableAdaptiveWaitSpin.set(0);
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    csr.callBaseWaitForCompletionWithTimeout = true;
+    csr.activePartitions = 1;
+
+    volatile TagAddressType tasksCount[16] = {};
+    tasksCount[0] = 1;
+    csr.tagAddress = tasksCount;
+    const auto numWaits = csr.waitPolicy.getNumWaits();
+
+    const auto waitStatus = csr.waitForCompletionWithTimeout(false, std::numeric_limits<std::int64_t>::max(), 1);
+    EXPECT_EQ(WaitStatus::Ready, waitStatus);
+    EXPECT_EQ(numWaits, csr.waitPolicy.getNumWaits());
+}
+
 HWTEST_F(CommandStreamReceiverTest, givenFailingFlushSubmissionsAndGpuHangWhenWaititingForCompletionWithTimeoutThenGpuHangIsReturned) {
     auto driverModelMock = std::make_unique<MockDriverModel>();
     driverModelMock->isGpuHangDetectedToReturn = true;
@@ -1683,6 +1717,28 @@ TEST(CommandStreamReceiverSimpleTest, givenGpuNotIdleImplicitFlushCheckEnabledWh
     csr.mockTagAddress[0] = 2u;
 }
 
+TEST(CommandStreamReceiverSimpleTest, givenGpuIdleImplicitFlushWithPendingSubmissionsEnabledWhenAllFlushedWorkIsCompletedThenReturnTrue) {
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+    DeviceBitfield deviceBitfield(1);
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+
+    csr.useGpuIdleImplicitFlush = true;
+    csr.useGpuIdleImplicitFlushWithPendingSubmissions = true;
+    csr.taskCount = 4u;
+    csr.latestFlushedTaskCount = 2u;
+
+    csr.mockTagAddress[0] = 1u;
+    EXPECT_FALSE(csr.checkImplicitFlushForGpuIdle());
+
+    csr.mockTagAddress[0] = 2u;
+    EXPECT_TRUE(csr.checkImplicitFlushForGpuIdle());
+
+    csr.useGpuIdleImplicitFlush = false;
+    EXPECT_FALSE(csr.checkImplicitFlushForGpuIdle());
+}
+
 namespace CpuIntrinsicsTests {
 extern std::atomic<uint32_t> pauseCounter;
 extern volatile TagAddressType *pauseAddress;
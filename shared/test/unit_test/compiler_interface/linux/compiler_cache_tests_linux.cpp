@@ -127,6 +127,21 @@ TEST(CompilerCacheTests, GivenCompilerCacheWithOneMegabyteWhenEvictCacheIsCalled
 
     EXPECT_NE(unlinkLocalFiles[0].find("file3"), unlinkLocalFiles[0].npos);
     EXPECT_NE(unlinkLocalFiles[1].find("file4"), unlinkLocalFiles[1].npos);
+    EXPECT_EQ(2u * ((MemoryConstants::megaByte / 6) + 10), bytesEvicted);
+}
+
+TEST(CompilerCacheTests, GivenCompilerCacheWhenUnlinkFailsDuringEvictionThenFileIsNotCountedAsEvicted) {
+    VariableBackup<decltype(NEO::SysCalls::sysCallsScandir)> scandirBackup(&NEO::SysCalls::sysCallsScandir, EvictCachePass::mockScandir);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsStat)> statBackup(&NEO::SysCalls::sysCallsStat, EvictCachePass::mockStat);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsUnlink)> unlinkBackup(&NEO::SysCalls::sysCallsUnlink, [](const std::string &pathname) -> int {
+        return (pathname.find("file3") != pathname.npos) ? -1 : 0;
+    });
+
+    CompilerCacheMockLinux cache({true, ".cl_cache", "/home/cl_cache/", MemoryConstants::megaByte - 2u});
+
+    uint64_t bytesEvicted{0u};
+    EXPECT_TRUE(cache.evictCache(bytesEvicted));
+    EXPECT_EQ(2u * ((MemoryConstants::megaByte / 6) + 10), bytesEvicted);
 }
 
 TEST(CompilerCacheTests, GivenCompilerCacheWithWhenScandirFailThenEvictCacheFail) {
@@ -598,6 +613,142 @@ TEST(CompilerCacheTests, GivenCompilerCacheWhenAllFunctionsSuccedThenCacheBinary
     EXPECT_TRUE(cache.cacheBinary("config.file", "1", 1));
 }
 
+class CompilerCacheLinuxEvictingOnCacheBinary : public CompilerCacheLinuxReturnTrueOnCacheBinary {
+  public:
+    using CompilerCacheLinuxReturnTrueOnCacheBinary::CompilerCacheLinuxReturnTrueOnCacheBinary;
+
+    bool evictCache(uint64_t &bytesEvicted) override {
+        evictCacheCalled++;
+        bytesEvicted = MemoryConstants::megaByte / 2;
+        return true;
+    }
+
+    uint32_t evictCacheCalled = 0u;
+};
+
+namespace CacheBinaryAfterEviction {
+size_t writtenDirectorySize = 0u;
+
+decltype(NEO::SysCalls::sysCallsPwrite) mockPwrite = [](int fd, const void *buf, size_t count, off_t offset) -> ssize_t {
+    if (count == sizeof(writtenDirectorySize)) {
+        memcpy_s(&writtenDirectorySize, sizeof(writtenDirectorySize), buf, count);
+    }
+    return count;
+};
+} // namespace CacheBinaryAfterEviction
+
+TEST(CompilerCacheTests, GivenCompilerCacheWhenEvictionIsNeededOnCacheBinaryThenEvictedBytesAreSubtractedFromDirectorySize) {
+    VariableBackup<decltype(NEO::SysCalls::sysCallsStat)> statBackup(&NEO::SysCalls::sysCallsStat, [](const std::string &filePath, struct stat *statbuf) -> int { return -1; });
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPwrite)> pwriteBackup(&NEO::SysCalls::sysCallsPwrite, CacheBinaryAfterEviction::mockPwrite);
+    VariableBackup<size_t> writtenSizeBackup(&CacheBinaryAfterEviction::writtenDirectorySize, 0u);
+
+    CompilerCacheLinuxEvictingOnCacheBinary cache({true, ".cl_cache", "/home/cl_cache/", MemoryConstants::megaByte});
+
+    EXPECT_TRUE(cache.cacheBinary("file", "12", 2));
+    EXPECT_EQ(1u, cache.evictCacheCalled);
+    EXPECT_EQ(MemoryConstants::megaByte / 2 + 2, CacheBinaryAfterEviction::writtenDirectorySize);
+}
+
+namespace LoadCachedBinary {
+constexpr char cachedData[] = "cached binary";
+
+decltype(NEO::SysCalls::sysCallsOpen) mockOpen = [](const char *pathname, int flags) -> int {
+    return NEO::SysCalls::fakeFileDescriptor;
+};
+
+decltype(NEO::SysCalls::sysCallsFstat) mockFstat = [](int fd, struct stat *buf) -> int {
+    buf->st_size = sizeof(cachedData);
+    return 0;
+};
+
+decltype(NEO::SysCalls::sysCallsPread) mockPread = [](int fd, void *buf, size_t count, off_t offset) -> ssize_t {
+    memcpy_s(buf, count, cachedData, sizeof(cachedData));
+    return sizeof(cachedData);
+};
+
+struct timespec capturedAccessTimes[2] = {};
+
+decltype(NEO::SysCalls::sysCallsFutimens) mockFutimens = [](int fd, const struct timespec times[2]) -> int {
+    capturedAccessTimes[0] = times[0];
+    capturedAccessTimes[1] = times[1];
+    return 0;
+};
+} // namespace LoadCachedBinary
+
+TEST(CompilerCacheTests, GivenCachedFileWhenLoadingCachedBinaryThenDataIsReadAndAccessTimeIsRefreshed) {
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> openBackup(&NEO::SysCalls::sysCallsOpen, LoadCachedBinary::mockOpen);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsFstat)> fstatBackup(&NEO::SysCalls::sysCallsFstat, LoadCachedBinary::mockFstat);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPread)> preadBackup(&NEO::SysCalls::sysCallsPread, LoadCachedBinary::mockPread);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsFutimens)> futimensBackup(&NEO::SysCalls::sysCallsFutimens, LoadCachedBinary::mockFutimens);
+    VariableBackup<int> futimensCalledBackup(&NEO::SysCalls::futimensCalled, 0);
+    VariableBackup<uint32_t> closeCalledBackup(&NEO::SysCalls::closeFuncCalled, 0u);
+
+    CompilerCache cache({true, ".cl_cache", "/home/cl_cache/", MemoryConstants::megaByte});
+
+    size_t size = 0u;
+    auto binary = cache.loadCachedBinary("file", size);
+    ASSERT_NE(nullptr, binary);
+    EXPECT_EQ(sizeof(LoadCachedBinary::cachedData), size);
+    EXPECT_EQ(0, memcmp(LoadCachedBinary::cachedData, binary.get(), size));
+
+    EXPECT_EQ(1, NEO::SysCalls::futimensCalled);
+    EXPECT_EQ(UTIME_NOW, LoadCachedBinary::capturedAccessTimes[0].tv_nsec);
+    EXPECT_EQ(UTIME_NOW, LoadCachedBinary::capturedAccessTimes[1].tv_nsec);
+    EXPECT_EQ(1u, NEO::SysCalls::closeFuncCalled);
+}
+
+TEST(CompilerCacheTests, GivenAccessTimeRefreshFailingWhenLoadingCachedBinaryThenBinaryIsReturnedAndFailureIsPrinted) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.PrintDebugMessages.set(1);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> openBackup(&NEO::SysCalls::sysCallsOpen, LoadCachedBinary::mockOpen);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsFstat)> fstatBackup(&NEO::SysCalls::sysCallsFstat, LoadCachedBinary::mockFstat);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPread)> preadBackup(&NEO::SysCalls::sysCallsPread, LoadCachedBinary::mockPread);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsFutimens)> futimensBackup(&NEO::SysCalls::sysCallsFutimens, [](int fd, const struct timespec times[2]) -> int { errno = EACCES; return -1; });
+    VariableBackup<uint32_t> closeCalledBackup(&NEO::SysCalls::closeFuncCalled, 0u);
+
+    CompilerCache cache({true, ".cl_cache", "/home/cl_cache/", MemoryConstants::megaByte});
+
+    size_t size = 0u;
+    ::testing::internal::CaptureStderr();
+    auto binary = cache.loadCachedBinary("file", size);
+    auto capturedStderr = ::testing::internal::GetCapturedStderr();
+
+    ASSERT_NE(nullptr, binary);
+    EXPECT_EQ(sizeof(LoadCachedBinary::cachedData), size);
+    EXPECT_NE(std::string::npos, capturedStderr.find("[Cache failure]: Refreshing access time failed! errno: " + std::to_string(EACCES)));
+    EXPECT_EQ(1u, NEO::SysCalls::closeFuncCalled);
+}
+
+TEST(CompilerCacheTests, GivenCachedFileWhenReadIsIncompleteThenNullIsReturnedAndAccessTimeIsNotRefreshed) {
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> openBackup(&NEO::SysCalls::sysCallsOpen, LoadCachedBinary::mockOpen);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsFstat)> fstatBackup(&NEO::SysCalls::sysCallsFstat, LoadCachedBinary::mockFstat);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPread)> preadBackup(&NEO::SysCalls::sysCallsPread, [](int fd, void *buf, size_t count, off_t offset) -> ssize_t { return 1; });
+    VariableBackup<int> futimensCalledBackup(&NEO::SysCalls::futimensCalled, 0);
+    VariableBackup<uint32_t> closeCalledBackup(&NEO::SysCalls::closeFuncCalled, 0u);
+
+    CompilerCache cache({true, ".cl_cache", "/home/cl_cache/", MemoryConstants::megaByte});
+
+    size_t size = 0u;
+    auto binary = cache.loadCachedBinary("file", size);
+    EXPECT_EQ(nullptr, binary);
+    EXPECT_EQ(0u, size);
+    EXPECT_EQ(0, NEO::SysCalls::futimensCalled);
+    EXPECT_EQ(1u, NEO::SysCalls::closeFuncCalled);
+}
+
+TEST(CompilerCacheTests, GivenMissingCachedFileWhenLoadingCachedBinaryThenNullIsReturned) {
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> openBackup(&NEO::SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int { errno = ENOENT; return -1; });
+    VariableBackup<uint32_t> closeCalledBackup(&NEO::SysCalls::closeFuncCalled, 0u);
+
+    CompilerCache cache({true, ".cl_cache", "/home/cl_cache/", MemoryConstants::megaByte});
+
+    size_t size = 1u;
+    auto binary = cache.loadCachedBinary("file", size);
+    EXPECT_EQ(nullptr, binary);
+    EXPECT_EQ(0u, size);
+    EXPECT_EQ(0u, NEO::SysCalls::closeFuncCalled);
+}
+
 namespace NonExistingPathIsSet {
 bool pathExistsMock(const std::string &path) {
     return false;
@@ -1054,3 +1054,14 @@ HWCMDTEST_F(IGFX_XE_HP_CORE, DeviceTests, givenXeHPAndLaterProductWhenRequestedV
 TEST_F(DeviceTests, whenCheckingPreferredPlatformNameThenNullIsReturned) {
     EXPECT_EQ(nullptr, defaultHwInfo->capabilityTable.preferredPlatformName);
 }
+
+TEST(Device, givenSubDevicesWhenGettingHostWaitMultiplexerThenRootDeviceMultiplexerIsSharedAndCreatedOnce) {
+    UltDeviceFactory deviceFactory{1, 2};
+    auto rootDevice = deviceFactory.rootDevices[0];
+
+    auto hostWaitMultiplexer = rootDevice->getHostWaitMultiplexer();
+    EXPECT_NE(nullptr, hostWaitMultiplexer);
+    EXPECT_EQ(hostWaitMultiplexer, rootDevice->getHostWaitMultiplexer());
+    EXPECT_EQ(hostWaitMultiplexer, deviceFactory.subDevices[0]->getHostWaitMultiplexer());
+    EXPECT_EQ(hostWaitMultiplexer, deviceFactory.subDevices[1]->getHostWaitMultiplexer());
+}
@@ -3020,3 +3020,79 @@ TEST(ReserveBasedOnEstimates, WhenContainerFullThenGrowBasedOnPos) {
     EXPECT_TRUE(reservedAdditionalMem);
     EXPECT_EQ(280U, container.capacity());
 }
+
+namespace {
+std::string generateZeInfoLikeText(size_t numKernels) {
+    std::string text = "version : '1.0'\nkernels:\n";
+    for (size_t i = 0; i < numKernels; ++i) {
+        text += "  - name : kernel_" + std::to_string(i) + "\n";
+        text += "    execution_env:\n";
+        text += "      grf_count : 128\n";
+        text += "      simd_size : 32\n";
+        text += "      required_work_group_size : [8, 4, 1]\n";
+        text += "    payload_arguments:\n";
+        text += "      - arg_type : global_id_offset # comment\n";
+        text += "        offset : -4\n";
+        text += "        size : 12\n";
+    }
+    return text;
+}
+} // namespace
+
+TEST(YamlTokenize, GivenIndentedLinesThenIndentIsCountedOnlyAtLineBeginning) {
+    ConstStringRef yaml = "a:\n    b   :   c\n";
+
+    LinesCache lines;
+    TokensCache tokens;
+    std::string errors;
+    std::string warnings;
+    bool success = NEO::Yaml::tokenize(yaml, lines, tokens, errors, warnings);
+    EXPECT_TRUE(success);
+    ASSERT_EQ(2U, lines.size());
+    EXPECT_EQ(0U, lines[0].indent);
+    EXPECT_EQ(4U, lines[1].indent);
+    EXPECT_EQ("b", tokens[lines[1].first].cstrref());
+    EXPECT_EQ("c", tokens[lines[1].first + 2].cstrref());
+}
+
+TEST(YamlBuildTree, GivenListEntriesAndInlineCollectionsThenNodesCountUpperBoundIsNotExceeded) {
+    auto text = generateZeInfoLikeText(100);
+    LinesCache lines;
+    TokensCache tokens;
+    std::string errors;
+    std::string warnings;
+    bool success = NEO::Yaml::tokenize(text, lines, tokens, errors, warnings);
+    ASSERT_TRUE(success);
+
+    auto maxNumNodes = getNodesCountUpperBound(lines);
+    NodesCache nodes;
+    success = NEO::Yaml::buildTree(lines, tokens, nodes, errors, warnings);
+    EXPECT_TRUE(success);
+    EXPECT_TRUE(errors.empty()) << errors;
+    EXPECT_LE(nodes.size(), maxNumNodes);
+    EXPECT_GE(nodes.capacity(), maxNumNodes);
+    EXPECT_LT(maxNumNodes, 3 * nodes.size());
+}
+
+TEST(YamlParser, GivenManyKernelsThenAllKernelsAreParsed) {
+    constexpr size_t numKernels = 1000;
+    auto text = generateZeInfoLikeText(numKernels);
+    YamlParser parser;
+    std::string errors;
+    std::string warnings;
+    bool success = parser.parse(text, errors, warnings);
+    ASSERT_TRUE(success);
+
+    auto kernelsNd = parser.getChild(*parser.getRoot(), "kernels");
+    ASSERT_NE(nullptr, kernelsNd);
+    EXPECT_EQ(numKernels, kernelsNd->numChildren);
+
+    size_t kernelId = 0U;
+    for (const auto &kernelNd : parser.createChildrenRange(*kernelsNd)) {
+        auto nameNd = parser.getChild(kernelNd, "name");
+        ASSERT_NE(nullptr, nameNd);
+        EXPECT_EQ("kernel_" + std::to_string(kernelId), parser.readValue(*nameNd).str());
+        ++kernelId;
+    }
+    EXPECT_EQ(numKernels, kernelId);
+}
@@ -351,6 +351,96 @@ HWTEST_F(DirectSubmissionTest, givenDirectSubmissionCurrentRingBuffersInUseWhenS
     pDevice->getRootDeviceEnvironmentRef().memoryOperationsInterface.release();
 }
 
+HWTEST_F(DirectSubmissionTest, givenAdaptiveRingBufferPreallocationWhenAllRingBuffersAreInUseDuringSwitchThenRingBufferCountIsDoubledAtOnce) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DirectSubmissionAdaptiveRingBufferPreallocation.set(1);
+
+    auto mockMemoryOperations = std::make_unique<MockMemoryOperations>();
+    pDevice->getRootDeviceEnvironmentRef().memoryOperationsInterface.reset(mockMemoryOperations.get());
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+    directSubmission.isCompletedReturn = false;
+
+    EXPECT_TRUE(directSubmission.initialize(false, false));
+    EXPECT_EQ(2u, directSubmission.ringBuffers.size());
+
+    auto nextRing = directSubmission.switchRingBuffersAllocations();
+    EXPECT_EQ(4u, directSubmission.ringBuffers.size());
+    EXPECT_EQ(directSubmission.ringBuffers[2].ringBuffer, nextRing);
+    EXPECT_EQ(2u, directSubmission.currentRingBuffer);
+    EXPECT_NE(nullptr, directSubmission.ringBuffers[3].ringBuffer);
+    EXPECT_EQ(2u, directSubmission.getTelemetry().ringBufferAllocations);
+
+    directSubmission.isCompletedReturn = true;
+    nextRing = directSubmission.switchRingBuffersAllocations();
+    EXPECT_EQ(4u, directSubmission.ringBuffers.size());
+    EXPECT_EQ(directSubmission.ringBuffers[0].ringBuffer, nextRing);
+
+    directSubmission.isCompletedReturn = false;
+    nextRing = directSubmission.switchRingBuffersAllocations();
+    EXPECT_EQ(8u, directSubmission.ringBuffers.size());
+    EXPECT_EQ(directSubmission.ringBuffers[4].ringBuffer, nextRing);
+    EXPECT_EQ(6u, directSubmission.getTelemetry().ringBufferAllocations);
+    EXPECT_EQ(0u, directSubmission.getTelemetry().ringBufferBusyWraps);
+
+    pDevice->getRootDeviceEnvironmentRef().memoryOperationsInterface.release();
+}
+
+HWTEST_F(DirectSubmissionTest, givenAdaptiveRingBufferPreallocationAndMaxRingBuffersWhenAllRingBuffersAreInUseThenGrowthIsLimitedAndBusyWrapsAreCounted) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DirectSubmissionAdaptiveRingBufferPreallocation.set(1);
+    DebugManager.flags.DirectSubmissionMaxRingBuffers.set(3);
+
+    auto mockMemoryOperations = std::make_unique<MockMemoryOperations>();
+    pDevice->getRootDeviceEnvironmentRef().memoryOperationsInterface.reset(mockMemoryOperations.get());
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+    directSubmission.isCompletedReturn = false;
+
+    EXPECT_TRUE(directSubmission.initialize(false, false));
+
+    directSubmission.switchRingBuffersAllocations();
+    EXPECT_EQ(3u, directSubmission.ringBuffers.size());
+    EXPECT_EQ(1u, directSubmission.getTelemetry().ringBufferAllocations);
+    EXPECT_EQ(0u, directSubmission.getTelemetry().ringBufferBusyWraps);
+
+    auto nextRing = directSubmission.switchRingBuffersAllocations();
+    EXPECT_EQ(3u, directSubmission.ringBuffers.size());
+    EXPECT_EQ(directSubmission.ringBuffers[0].ringBuffer, nextRing);
+    EXPECT_EQ(1u, directSubmission.getTelemetry().ringBufferAllocations);
+    EXPECT_EQ(1u, directSubmission.getTelemetry().ringBufferBusyWraps);
+
+    pDevice->getRootDeviceEnvironmentRef().memoryOperationsInterface.release();
+}
+
+HWTEST_F(DirectSubmissionTest, givenInitialRingBuffersDebugFlagWhenInitializingThenRequestedRingBuffersAreAllocatedAndResident) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DirectSubmissionInitialRingBuffers.set(4);
+
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+    EXPECT_EQ(4u, directSubmission.ringBuffers.size());
+
+    EXPECT_TRUE(directSubmission.initialize(false, false));
+    for (auto &ringBufferUse : directSubmission.ringBuffers) {
+        EXPECT_NE(nullptr, ringBufferUse.ringBuffer);
+    }
+    EXPECT_LE(4u, directSubmission.makeResourcesResidentVectorSize);
+    EXPECT_EQ(0u, directSubmission.getTelemetry().ringBufferAllocations);
+}
+
+HWTEST_F(DirectSubmissionTest, givenPrintTelemetryDebugFlagWhenDirectSubmissionIsDestroyedThenTelemetryIsPrinted) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DirectSubmissionPrintTelemetry.set(true);
+
+    testing::internal::CaptureStdout();
+    {
+        MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+        EXPECT_TRUE(directSubmission.initialize(false, false));
+        directSubmission.switchRingBuffersAllocations();
+    }
+    std::string output = testing::internal::GetCapturedStdout();
+    EXPECT_NE(std::string::npos, output.find("Direct submission telemetry"));
+    EXPECT_NE(std::string::npos, output.find("ring buffer allocations 0"));
+}
+
 HWTEST_F(DirectSubmissionTest, givenDirectSubmissionAllocateFailWhenRingIsStartedThenExpectRingNotStarted) {
     MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
     EXPECT_TRUE(directSubmission.disableCpuCacheFlush);
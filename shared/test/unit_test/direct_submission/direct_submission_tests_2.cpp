@@ -267,6 +267,32 @@ HWCMDTEST_F(IGFX_XE_HP_CORE, DirectSubmissionDispatchBufferTest,
     EXPECT_TRUE(foundFenceUpdate);
 }
 
+HWTEST_F(DirectSubmissionDispatchBufferTest, givenRingWithoutSpaceWhenDispatchingCommandBufferThenTelemetryCountsDispatchSemaphoreUpdateAndRingSwitch) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DirectSubmissionFlatRingBuffer.set(0);
+
+    FlushStampTracker flushStamp(true);
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+
+    EXPECT_TRUE(directSubmission.initialize(true, false));
+    auto telemetryBefore = directSubmission.getTelemetry();
+    EXPECT_EQ(0u, telemetryBefore.dispatches);
+    EXPECT_EQ(0u, telemetryBefore.ringSwitches);
+
+    directSubmission.ringCommandStream.getSpace(directSubmission.ringCommandStream.getAvailableSpace() -
+                                                directSubmission.getSizeSwitchRingBufferSection());
+    EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+
+    auto &telemetry = directSubmission.getTelemetry();
+    EXPECT_EQ(1u, telemetry.dispatches);
+    EXPECT_EQ(directSubmission.getSizeDispatch(false, false, directSubmission.dispatchMonitorFenceRequired(false)), telemetry.dispatchedBytes);
+    EXPECT_EQ(telemetryBefore.semaphoreUpdates + 1, telemetry.semaphoreUpdates);
+    EXPECT_EQ(telemetryBefore.prefetchMitigationBytes + directSubmission.getSizePrefetchMitigation(), telemetry.prefetchMitigationBytes);
+    EXPECT_EQ(1u, telemetry.ringSwitches);
+    EXPECT_EQ(0u, telemetry.ringBufferAllocations);
+    EXPECT_EQ(0u, telemetry.ringBufferBusyWraps);
+}
+
 HWTEST_F(DirectSubmissionDispatchBufferTest, givenCopyCommandBufferIntoRingWhenDispatchCommandBufferThenCopyTaskStream) {
     using MI_BATCH_BUFFER_START = typename FamilyType::MI_BATCH_BUFFER_START;
     using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
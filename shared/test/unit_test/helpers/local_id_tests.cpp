@@ -10,6 +10,7 @@
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/local_id_gen.h"
 #include "shared/source/helpers/ptr_math.h"
+#include "shared/source/utilities/cpu_info.h"
 #include "shared/test/common/helpers/default_hw_info.h"
 #include "shared/test/common/helpers/unit_test_helper.h"
 #include "shared/test/common/test_macros/hw_test.h"
@@ -504,6 +505,86 @@ TEST_P(LocalIdsLayoutForImagesTest, givenLocalWorkgroupSizeCompatibleWithLayoutF
     validateGRF();
 }
 
+using LocalIdsGoldenTest = ::testing::TestWithParam<std::tuple<uint16_t, uint32_t>>;
+
+TEST_P(LocalIdsGoldenTest, givenWorkgroupSizesAndDimensionsOrdersWhenGeneratingLocalIdsWithSelectedCpuPathThenResultMatchesScalarReference) {
+    const uint16_t simd = std::get<0>(GetParam());
+    const uint32_t grfSize = std::get<1>(GetParam());
+    const bool useFullRowSize = grfSize != 32;
+    const uint32_t rowWidth = (simd == 32 || useFullRowSize) ? 32 : 16;
+
+    const std::array<std::array<uint16_t, 3>, 8> localWorkSizes = {{{{1, 1, 1}}, {{7, 3, 5}}, {{16, 16, 4}}, {{32, 8, 4}}, {{1024, 1, 1}}, {{3, 1, 300}}, {{5, 200, 1}}, {{9, 9, 9}}}};
+    const std::array<std::array<uint8_t, 3>, 6> dimensionsOrders = {{{{0, 1, 2}}, {{0, 2, 1}}, {{1, 0, 2}}, {{1, 2, 0}}, {{2, 0, 1}}, {{2, 1, 0}}}};
+
+    for (auto &localWorkSize : localWorkSizes) {
+        const uint32_t numWorkItems = localWorkSize[0] * localWorkSize[1] * localWorkSize[2];
+        const auto threadsPerWorkGroup = static_cast<uint16_t>(getThreadsPerWG(simd, numWorkItems));
+        const auto size = threadsPerWorkGroup * 3u * rowWidth * sizeof(uint16_t);
+        auto alignedMemory = allocateAlignedMemory(size, 32);
+        auto buffer = reinterpret_cast<uint16_t *>(alignedMemory.get());
+
+        for (auto &dimensionsOrder : dimensionsOrders) {
+            memset(buffer, 0xff, size);
+            if (simd == 32) {
+                LocalIDHelper::generateSimd32(buffer, localWorkSize, threadsPerWorkGroup, dimensionsOrder, useFullRowSize);
+            } else if (simd == 16) {
+                LocalIDHelper::generateSimd16(buffer, localWorkSize, threadsPerWorkGroup, dimensionsOrder, useFullRowSize);
+            } else {
+                LocalIDHelper::generateSimd8(buffer, localWorkSize, threadsPerWorkGroup, dimensionsOrder, useFullRowSize);
+            }
+
+            const uint32_t lwsInner = localWorkSize[dimensionsOrder[0]];
+            const uint32_t lwsMiddle = localWorkSize[dimensionsOrder[1]];
+            for (uint32_t workItem = 0; workItem < numWorkItems; workItem++) {
+                const std::array<uint32_t, 3> expectedIds = {{workItem % lwsInner, (workItem / lwsInner) % lwsMiddle, workItem / (lwsInner * lwsMiddle)}};
+                const auto threadBuffer = buffer + (workItem / simd) * 3 * rowWidth;
+                const auto lane = workItem % simd;
+                for (uint32_t channel = 0; channel < 3; channel++) {
+                    ASSERT_EQ(expectedIds[channel], threadBuffer[dimensionsOrder[channel] * rowWidth + lane])
+                        << "lws " << localWorkSize[0] << "x" << localWorkSize[1] << "x" << localWorkSize[2]
+                        << " dimensionsOrder " << static_cast<uint32_t>(dimensionsOrder[0]) << static_cast<uint32_t>(dimensionsOrder[1]) << static_cast<uint32_t>(dimensionsOrder[2])
+                        << " workItem " << workItem << " channel " << channel;
+                }
+            }
+        }
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(AllSimdAndGrfSizes, LocalIdsGoldenTest, ::testing::Combine(::testing::Values<uint16_t>(8, 16, 32), ::testing::Values<uint32_t>(32, 64)));
+
+#if COMPILER_SUPPORTS_AVX512BW
+namespace NEO {
+struct uint16x8_t;
+struct uint16x32_t;
+} // namespace NEO
+
+TEST(LocalIdsAvx512Test, givenCpuSupportingAvx512BwWhenGeneratingSimd32LocalIdsWithAvx512PathThenResultMatchesSsePath) {
+    if (!CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX512Bw)) {
+        GTEST_SKIP();
+    }
+
+    const std::array<std::array<uint16_t, 3>, 5> localWorkSizes = {{{{1, 1, 1}}, {{7, 3, 5}}, {{16, 16, 4}}, {{1024, 1, 1}}, {{5, 200, 1}}}};
+    const std::array<std::array<uint8_t, 3>, 3> dimensionsOrders = {{{{0, 1, 2}}, {{1, 2, 0}}, {{2, 1, 0}}}};
+
+    for (auto &localWorkSize : localWorkSizes) {
+        const auto threadsPerWorkGroup = static_cast<uint16_t>(getThreadsPerWG(32, localWorkSize[0] * localWorkSize[1] * localWorkSize[2]));
+        const auto size = threadsPerWorkGroup * 3u * 32u * sizeof(uint16_t);
+        auto avx512Memory = allocateAlignedMemory(size, 64);
+        auto sseMemory = allocateAlignedMemory(size, 64);
+
+        for (auto &dimensionsOrder : dimensionsOrders) {
+            for (bool chooseMaxRowSize : {false, true}) {
+                memset(avx512Memory.get(), 0xff, size);
+                memset(sseMemory.get(), 0xff, size);
+                generateLocalIDsSimd<uint16x32_t, 32>(avx512Memory.get(), localWorkSize, threadsPerWorkGroup, dimensionsOrder, chooseMaxRowSize);
+                generateLocalIDsSimd<uint16x8_t, 32>(sseMemory.get(), localWorkSize, threadsPerWorkGroup, dimensionsOrder, chooseMaxRowSize);
+                EXPECT_EQ(0, memcmp(avx512Memory.get(), sseMemory.get(), size));
+            }
+        }
+    }
+}
+#endif
+
 #define SIMDParams ::testing::Values(8, 16, 32)
 #if HEAVY_DUTY_TESTING
 #define LWSXParams ::testing::Values(1, 7, 8, 9, 15, 16, 17, 31, 32, 33, 64, 128, 256)
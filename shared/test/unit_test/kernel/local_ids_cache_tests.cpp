@@ -9,17 +9,25 @@
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/helpers/local_id_gen.h"
 #include "shared/source/helpers/per_thread_data.h"
 #include "shared/source/kernel/local_ids_cache.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/default_hw_info.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 #include "shared/test/common/test_macros/test.h"
 
+#include <thread>
+
 class MockLocalIdsCache : public NEO::LocalIdsCache {
   public:
     using Base = NEO::LocalIdsCache;
     using Base::Base;
     using Base::cache;
+    using Base::getSetIndex;
+    using Base::numSets;
+    using Base::retiredLocalIdsData;
+    using Base::sets;
     MockLocalIdsCache(size_t cacheSize) : MockLocalIdsCache(cacheSize, 32u){};
     MockLocalIdsCache(size_t cacheSize, uint8_t simd) : Base(cacheSize, {0, 1, 2}, simd, 32, false){};
 };
@@ -35,45 +43,85 @@ struct LocalIdsCacheFixture {
 };
 
 using LocalIdsCacheTests = Test<LocalIdsCacheFixture>;
-TEST_F(LocalIdsCacheTests, GivenCacheMissWhenGetLocalIdsForGroupThenNewEntryIsCommitedIntoLeastUsedEntry) {
-    localIdsCache->cache.resize(2);
-    localIdsCache->cache[0].accessCounter = 2U;
+TEST_F(LocalIdsCacheTests, GivenReferencedEntryWhenCacheMissThenNewEntryIsCommitedIntoNotReferencedEntry) {
+    localIdsCache = std::make_unique<MockLocalIdsCache>(2);
+    localIdsCache->cache[0].groupSizeKey = NEO::LocalIdsCache::getGroupSizeKey({4, 1, 1});
+    localIdsCache->cache[0].referenced = true;
     auto gfxCoreHelper = NEO::GfxCoreHelper::create(NEO::defaultHwInfo->platform.eRenderCoreFamily);
     localIdsCache->setLocalIdsForGroup(groupSize, perThreadData.data(), *gfxCoreHelper.get());
 
-    EXPECT_EQ(groupSize, localIdsCache->cache[1].groupSize);
+    EXPECT_FALSE(localIdsCache->cache[0].referenced);
+    EXPECT_EQ(NEO::LocalIdsCache::getGroupSizeKey(groupSize), localIdsCache->cache[1].groupSizeKey);
     EXPECT_NE(nullptr, localIdsCache->cache[1].localIdsData);
     EXPECT_EQ(1536U, localIdsCache->cache[1].localIdsSize);
     EXPECT_EQ(1536U, localIdsCache->cache[1].localIdsSizeAllocated);
-    EXPECT_EQ(1U, localIdsCache->cache[1].accessCounter);
+    EXPECT_EQ(2U, localIdsCache->sets[0].sequence);
 }
 
-TEST_F(LocalIdsCacheTests, GivenEntryInCacheWhenGetLocalIdsForGroupThenEntryFromCacheIsUsed) {
-    localIdsCache->cache[0].groupSize = groupSize;
+TEST_F(LocalIdsCacheTests, GivenEntryInCacheWhenGetLocalIdsForGroupThenEntryFromCacheIsUsedAndMarkedAsReferenced) {
+    localIdsCache->cache[0].groupSizeKey = NEO::LocalIdsCache::getGroupSizeKey(groupSize);
     localIdsCache->cache[0].localIdsData = static_cast<uint8_t *>(alignedMalloc(512, 32));
     localIdsCache->cache[0].localIdsSize = 512U;
     localIdsCache->cache[0].localIdsSizeAllocated = 512U;
-    localIdsCache->cache[0].accessCounter = 1U;
+    memset(localIdsCache->cache[0].localIdsData, 0xA5, 512U);
     auto gfxCoreHelper = NEO::GfxCoreHelper::create(NEO::defaultHwInfo->platform.eRenderCoreFamily);
     localIdsCache->setLocalIdsForGroup(groupSize, perThreadData.data(), *gfxCoreHelper.get());
-    EXPECT_EQ(2U, localIdsCache->cache[0].accessCounter);
+    EXPECT_TRUE(localIdsCache->cache[0].referenced);
+    EXPECT_EQ(0U, localIdsCache->sets[0].sequence);
+    EXPECT_EQ(0xA5, perThreadData[511]);
+    EXPECT_EQ(0, perThreadData[512]);
 }
 
 TEST_F(LocalIdsCacheTests, GivenEntryWithBiggerBufferAllocatedWhenGetLocalIdsForGroupThenBufferIsReused) {
-    localIdsCache->cache[0].groupSize = {4, 1, 1};
+    localIdsCache->cache[0].groupSizeKey = NEO::LocalIdsCache::getGroupSizeKey({4, 1, 1});
     localIdsCache->cache[0].localIdsData = static_cast<uint8_t *>(alignedMalloc(512, 32));
     localIdsCache->cache[0].localIdsSize = 512U;
     localIdsCache->cache[0].localIdsSizeAllocated = 512U;
-    localIdsCache->cache[0].accessCounter = 2U;
-    const auto localIdsData = localIdsCache->cache[0].localIdsData;
+    localIdsCache->cache[0].referenced = true;
+    const auto localIdsData = localIdsCache->cache[0].localIdsData.load();
 
     groupSize = {2, 1, 1};
     auto gfxCoreHelper = NEO::GfxCoreHelper::create(NEO::defaultHwInfo->platform.eRenderCoreFamily);
     localIdsCache->setLocalIdsForGroup(groupSize, perThreadData.data(), *gfxCoreHelper.get());
-    EXPECT_EQ(1U, localIdsCache->cache[0].accessCounter);
+    EXPECT_FALSE(localIdsCache->cache[0].referenced);
     EXPECT_EQ(192U, localIdsCache->cache[0].localIdsSize);
     EXPECT_EQ(512U, localIdsCache->cache[0].localIdsSizeAllocated);
     EXPECT_EQ(localIdsData, localIdsCache->cache[0].localIdsData);
+    EXPECT_TRUE(localIdsCache->retiredLocalIdsData.empty());
+}
+
+TEST_F(LocalIdsCacheTests, GivenEntryWithSmallerBufferAllocatedWhenGetLocalIdsForGroupThenOldBufferIsRetiredAndBufferGrowsGeometrically) {
+    localIdsCache->cache[0].groupSizeKey = NEO::LocalIdsCache::getGroupSizeKey({4, 1, 1});
+    localIdsCache->cache[0].localIdsData = static_cast<uint8_t *>(alignedMalloc(1024, 32));
+    localIdsCache->cache[0].localIdsSize = 1024U;
+    localIdsCache->cache[0].localIdsSizeAllocated = 1024U;
+    const auto localIdsData = localIdsCache->cache[0].localIdsData.load();
+
+    auto gfxCoreHelper = NEO::GfxCoreHelper::create(NEO::defaultHwInfo->platform.eRenderCoreFamily);
+    localIdsCache->setLocalIdsForGroup(groupSize, perThreadData.data(), *gfxCoreHelper.get());
+    EXPECT_EQ(1536U, localIdsCache->cache[0].localIdsSize);
+    EXPECT_EQ(2048U, localIdsCache->cache[0].localIdsSizeAllocated);
+    EXPECT_NE(localIdsData, localIdsCache->cache[0].localIdsData);
+    ASSERT_EQ(1U, localIdsCache->retiredLocalIdsData.size());
+    EXPECT_EQ(localIdsData, localIdsCache->retiredLocalIdsData[0]);
+}
+
+TEST_F(LocalIdsCacheTests, GivenFullSetWithReferencedEntryWhenCacheMissesRepeatThenNewEntriesDoNotEvictEachOtherAndReferencedEntryIsKept) {
+    localIdsCache = std::make_unique<MockLocalIdsCache>(NEO::LocalIdsCache::waysPerSet);
+    auto gfxCoreHelper = NEO::GfxCoreHelper::create(NEO::defaultHwInfo->platform.eRenderCoreFamily);
+    const std::array<Vec3<uint16_t>, 4> groupSizes = {{{8, 1, 1}, {16, 1, 1}, {32, 1, 1}, {64, 1, 1}}};
+    for (auto &group : groupSizes) {
+        localIdsCache->setLocalIdsForGroup(group, perThreadData.data(), *gfxCoreHelper.get());
+    }
+    localIdsCache->setLocalIdsForGroup(groupSizes[0], perThreadData.data(), *gfxCoreHelper.get());
+
+    localIdsCache->setLocalIdsForGroup({4, 1, 1}, perThreadData.data(), *gfxCoreHelper.get());
+    EXPECT_EQ(NEO::LocalIdsCache::getGroupSizeKey({4, 1, 1}), localIdsCache->cache[1].groupSizeKey);
+
+    localIdsCache->setLocalIdsForGroup({2, 1, 1}, perThreadData.data(), *gfxCoreHelper.get());
+    EXPECT_EQ(NEO::LocalIdsCache::getGroupSizeKey({4, 1, 1}), localIdsCache->cache[1].groupSizeKey);
+    EXPECT_EQ(NEO::LocalIdsCache::getGroupSizeKey({2, 1, 1}), localIdsCache->cache[2].groupSizeKey);
+    EXPECT_EQ(NEO::LocalIdsCache::getGroupSizeKey(groupSizes[0]), localIdsCache->cache[0].groupSizeKey);
 }
 
 TEST_F(LocalIdsCacheTests, GivenValidLocalIdsCacheWhenGettingLocalIdsSizePerThreadThenCorrectValueIsReturned) {
@@ -94,4 +142,114 @@ TEST(LocalIdsCacheTest, givenSimd1WhenGettingLocalIdsSizeForGroupThenCorrectValu
     auto localIdsSizePerThread = localIdsCache->getLocalIdsSizeForGroup(groupSize, *gfxCoreHelper.get());
     auto expectedLocalIdsSizePerThread = groupSize[0] * groupSize[1] * groupSize[2] * localIdsCache->getLocalIdsSizePerThread();
     EXPECT_EQ(expectedLocalIdsSizePerThread, localIdsSizePerThread);
-}
\ No newline at end of file
+}
+
+TEST_F(LocalIdsCacheTests, GivenCacheMissAndThenCacheHitWhenGetLocalIdsForGroupThenHitAndMissCountersAreUpdated) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.PrintLocalIdsCacheStatistics.set(true);
+    localIdsCache = std::make_unique<MockLocalIdsCache>(1);
+    auto gfxCoreHelper = NEO::GfxCoreHelper::create(NEO::defaultHwInfo->platform.eRenderCoreFamily);
+    EXPECT_EQ(0U, localIdsCache->getHitCount());
+    EXPECT_EQ(0U, localIdsCache->getMissCount());
+
+    localIdsCache->setLocalIdsForGroup(groupSize, perThreadData.data(), *gfxCoreHelper.get());
+    EXPECT_EQ(0U, localIdsCache->getHitCount());
+    EXPECT_EQ(1U, localIdsCache->getMissCount());
+
+    localIdsCache->setLocalIdsForGroup(groupSize, perThreadData.data(), *gfxCoreHelper.get());
+    EXPECT_EQ(1U, localIdsCache->getHitCount());
+    EXPECT_EQ(1U, localIdsCache->getMissCount());
+}
+
+TEST_F(LocalIdsCacheTests, GivenCacheWithMultipleSetsWhenGetLocalIdsForGroupThenEntryIsCommitedOnlyIntoSetSelectedByGroupSize) {
+    localIdsCache = std::make_unique<MockLocalIdsCache>(4 * NEO::LocalIdsCache::waysPerSet);
+    EXPECT_EQ(4U, localIdsCache->numSets);
+    auto gfxCoreHelper = NEO::GfxCoreHelper::create(NEO::defaultHwInfo->platform.eRenderCoreFamily);
+
+    localIdsCache->setLocalIdsForGroup(groupSize, perThreadData.data(), *gfxCoreHelper.get());
+
+    const auto setIndex = localIdsCache->getSetIndex(groupSize);
+    for (size_t entryIndex = 0; entryIndex < localIdsCache->cache.size(); entryIndex++) {
+        const bool isInSelectedSet = entryIndex / NEO::LocalIdsCache::waysPerSet == setIndex;
+        EXPECT_EQ(isInSelectedSet && (entryIndex % NEO::LocalIdsCache::waysPerSet == 0), localIdsCache->cache[entryIndex].groupSizeKey == NEO::LocalIdsCache::getGroupSizeKey(groupSize));
+    }
+}
+
+TEST_F(LocalIdsCacheTests, GivenDistinctGroupSizesFittingIntoCacheWhenGetLocalIdsForGroupRepeatedlyThenLocalIdsAreGeneratedOncePerGroupSize) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.PrintLocalIdsCacheStatistics.set(true);
+    localIdsCache = std::make_unique<MockLocalIdsCache>(64);
+    auto gfxCoreHelper = NEO::GfxCoreHelper::create(NEO::defaultHwInfo->platform.eRenderCoreFamily);
+    const std::array<Vec3<uint16_t>, 4> groupSizes = {{{8, 1, 1}, {16, 1, 1}, {32, 1, 1}, {64, 1, 1}}};
+
+    for (int iteration = 0; iteration < 3; iteration++) {
+        for (auto &group : groupSizes) {
+            localIdsCache->setLocalIdsForGroup(group, perThreadData.data(), *gfxCoreHelper.get());
+        }
+    }
+    EXPECT_EQ(groupSizes.size(), localIdsCache->getMissCount());
+    EXPECT_EQ(2 * groupSizes.size(), localIdsCache->getHitCount());
+}
+
+TEST_F(LocalIdsCacheTests, GivenGroupSizesEvictingEachOtherWhenSettingLocalIdsFromMultipleThreadsThenEachThreadGetsLocalIdsOfItsGroup) {
+    localIdsCache = std::make_unique<MockLocalIdsCache>(NEO::LocalIdsCache::waysPerSet);
+    auto gfxCoreHelper = NEO::GfxCoreHelper::create(NEO::defaultHwInfo->platform.eRenderCoreFamily);
+    const std::array<Vec3<uint16_t>, 6> groupSizes = {{{2, 1, 1}, {4, 2, 1}, {8, 1, 1}, {16, 2, 1}, {32, 1, 1}, {64, 1, 1}}};
+
+    std::array<std::array<uint8_t, 2048>, groupSizes.size()> expectedLocalIds = {};
+    for (size_t groupId = 0; groupId < groupSizes.size(); groupId++) {
+        NEO::generateLocalIDs(expectedLocalIds[groupId].data(), 32u, {groupSizes[groupId][0], groupSizes[groupId][1], groupSizes[groupId][2]}, {0, 1, 2}, false, 32u, *gfxCoreHelper.get());
+    }
+
+    std::atomic<uint32_t> numMismatches{0U};
+    std::vector<std::thread> threads;
+    for (uint32_t threadId = 0; threadId < 4; threadId++) {
+        threads.emplace_back([&, threadId]() {
+            std::array<uint8_t, 2048> localIds = {};
+            for (uint32_t iteration = 0; iteration < 500; iteration++) {
+                const auto groupId = (iteration + threadId) % groupSizes.size();
+                localIdsCache->setLocalIdsForGroup(groupSizes[groupId], localIds.data(), *gfxCoreHelper.get());
+                const auto localIdsSize = localIdsCache->getLocalIdsSizeForGroup(groupSizes[groupId], *gfxCoreHelper.get());
+                if (0 != memcmp(localIds.data(), expectedLocalIds[groupId].data(), localIdsSize)) {
+                    numMismatches++;
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(0U, numMismatches);
+}
+
+TEST(LocalIdsCacheTest, givenLayoutParametersWhenGettingLayoutKeyThenKeyIsUniquePerLayout) {
+    const auto key = NEO::LocalIdsCache::getLayoutKey({0, 1, 2}, 32u, 32u, false);
+    EXPECT_EQ(key, NEO::LocalIdsCache::getLayoutKey({0, 1, 2}, 32u, 32u, false));
+    EXPECT_NE(key, NEO::LocalIdsCache::getLayoutKey({1, 0, 2}, 32u, 32u, false));
+    EXPECT_NE(key, NEO::LocalIdsCache::getLayoutKey({0, 1, 2}, 16u, 32u, false));
+    EXPECT_NE(key, NEO::LocalIdsCache::getLayoutKey({0, 1, 2}, 32u, 64u, false));
+    EXPECT_NE(key, NEO::LocalIdsCache::getLayoutKey({0, 1, 2}, 32u, 32u, true));
+}
+
+TEST(LocalIdsCacheTest, givenLocalIdsCacheSizeDebugFlagWhenGettingSharedCacheSizeThenValueFromFlagIsReturned) {
+    DebugManagerStateRestore restorer;
+    EXPECT_EQ(NEO::LocalIdsCache::defaultSharedCacheSize, NEO::LocalIdsCache::getSharedCacheSize());
+
+    DebugManager.flags.LocalIdsCacheSize.set(128);
+    EXPECT_EQ(128U, NEO::LocalIdsCache::getSharedCacheSize());
+}
+
+TEST(LocalIdsCacheTest, givenPrintLocalIdsCacheStatisticsDebugFlagWhenCacheIsDestroyedThenCountersArePrinted) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.PrintLocalIdsCacheStatistics.set(true);
+    auto gfxCoreHelper = NEO::GfxCoreHelper::create(NEO::defaultHwInfo->platform.eRenderCoreFamily);
+    std::array<uint8_t, 2048> perThreadData = {0};
+    auto localIdsCache = std::make_unique<MockLocalIdsCache>(1u);
+    localIdsCache->setLocalIdsForGroup({8, 1, 1}, perThreadData.data(), *gfxCoreHelper.get());
+    localIdsCache->setLocalIdsForGroup({8, 1, 1}, perThreadData.data(), *gfxCoreHelper.get());
+
+    testing::internal::CaptureStdout();
+    localIdsCache.reset();
+    auto output = testing::internal::GetCapturedStdout();
+    EXPECT_NE(std::string::npos, output.find("hits: 1, misses: 1"));
+}
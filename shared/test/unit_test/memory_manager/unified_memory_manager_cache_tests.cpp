@@ -15,6 +15,9 @@
 
 #include "gtest/gtest.h"
 
+#include <set>
+#include <thread>
+
 using namespace NEO;
 
 TEST(SvmDeviceAllocationCacheTest, givenAllocationCacheDefaultWhenCheckingIfEnabledThenItIsDisabled) {
@@ -59,24 +62,25 @@ TEST(SvmDeviceAllocationCacheTest, givenAllocationCacheEnabledWhenFreeingDeviceA
         ASSERT_NE(testData.allocation, nullptr);
     }
     size_t expectedCacheSize = 0u;
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), expectedCacheSize);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), expectedCacheSize);
 
     for (auto const &testData : testDataset) {
         svmManager->freeSVMAlloc(testData.allocation);
-        EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), ++expectedCacheSize);
+        EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), ++expectedCacheSize);
         bool foundInCache = false;
-        for (auto i = 0u; i < svmManager->usmDeviceAllocationsCache.allocations.size(); ++i) {
-            if (svmManager->usmDeviceAllocationsCache.allocations[i].allocation == testData.allocation) {
+        auto &sizeClass = svmManager->usmDeviceAllocationsCache.sizeClasses[SVMAllocsManager::SvmAllocationCache::getSizeClassIndex(testData.allocationSize)];
+        for (auto &cachedAllocation : sizeClass.allocations) {
+            if (cachedAllocation.allocation == testData.allocation) {
                 foundInCache = true;
                 break;
             }
         }
         EXPECT_TRUE(foundInCache);
     }
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), testDataset.size());
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), testDataset.size());
 
     svmManager->trimUSMDeviceAllocCache();
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
 }
 
 TEST(SvmDeviceAllocationCacheTest, givenAllocationsWithDifferentSizesWhenAllocatingAfterFreeThenReturnCorrectCachedAllocation) {
@@ -108,26 +112,26 @@ TEST(SvmDeviceAllocationCacheTest, givenAllocationsWithDifferentSizesWhenAllocat
     }
 
     size_t expectedCacheSize = 0u;
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), expectedCacheSize);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), expectedCacheSize);
 
     for (auto const &testData : testDataset) {
         svmManager->freeSVMAlloc(testData.allocation);
     }
 
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), testDataset.size());
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), testDataset.size());
 
     std::vector<void *> allocationsToFree;
 
     for (auto &testData : testDataset) {
         auto secondAllocation = svmManager->createUnifiedMemoryAllocation(testData.allocationSize, unifiedMemoryProperties);
-        EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), testDataset.size() - 1);
+        EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), testDataset.size() - 1);
         EXPECT_EQ(secondAllocation, testData.allocation);
         svmManager->freeSVMAlloc(secondAllocation);
-        EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), testDataset.size());
+        EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), testDataset.size());
     }
 
     svmManager->trimUSMDeviceAllocCache();
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
 }
 
 TEST(SvmDeviceAllocationCacheTest, givenMultipleAllocationsWhenAllocatingAfterFreeThenReturnAllocationsInCacheStartingFromSmallest) {
@@ -155,29 +159,29 @@ TEST(SvmDeviceAllocationCacheTest, givenMultipleAllocationsWhenAllocatingAfterFr
         ASSERT_NE(testData.allocation, nullptr);
     }
 
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
 
     for (auto const &testData : testDataset) {
         svmManager->freeSVMAlloc(testData.allocation);
     }
 
     size_t expectedCacheSize = testDataset.size();
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), expectedCacheSize);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), expectedCacheSize);
 
     auto allocationLargerThanInCache = svmManager->createUnifiedMemoryAllocation(allocationSizeBasis << 3, unifiedMemoryProperties);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), expectedCacheSize);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), expectedCacheSize);
 
     auto firstAllocation = svmManager->createUnifiedMemoryAllocation(allocationSizeBasis, unifiedMemoryProperties);
     EXPECT_EQ(firstAllocation, testDataset[0].allocation);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), --expectedCacheSize);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), --expectedCacheSize);
 
     auto secondAllocation = svmManager->createUnifiedMemoryAllocation(allocationSizeBasis, unifiedMemoryProperties);
     EXPECT_EQ(secondAllocation, testDataset[1].allocation);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), --expectedCacheSize);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), --expectedCacheSize);
 
     auto thirdAllocation = svmManager->createUnifiedMemoryAllocation(allocationSizeBasis, unifiedMemoryProperties);
     EXPECT_EQ(thirdAllocation, testDataset[2].allocation);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
 
     svmManager->freeSVMAlloc(firstAllocation);
     svmManager->freeSVMAlloc(secondAllocation);
@@ -185,7 +189,7 @@ TEST(SvmDeviceAllocationCacheTest, givenMultipleAllocationsWhenAllocatingAfterFr
     svmManager->freeSVMAlloc(allocationLargerThanInCache);
 
     svmManager->trimUSMDeviceAllocCache();
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
 }
 
 struct SvmDeviceAllocationCacheTestDataType {
@@ -255,12 +259,12 @@ TEST(SvmDeviceAllocationCacheTest, givenAllocationsWithDifferentFlagsWhenAllocat
         for (auto &testData : testDataset) {
             testData.allocation = svmManager->createUnifiedMemoryAllocation(testData.allocationSize, testData.unifiedMemoryProperties);
         }
-        ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+        ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
 
         for (auto &testData : testDataset) {
             svmManager->freeSVMAlloc(testData.allocation);
         }
-        ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), testDataset.size());
+        ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), testDataset.size());
 
         auto allocationFromCache = svmManager->createUnifiedMemoryAllocation(allocationDataToVerify.allocationSize, allocationDataToVerify.unifiedMemoryProperties);
         EXPECT_EQ(allocationFromCache, allocationDataToVerify.allocation);
@@ -273,7 +277,7 @@ TEST(SvmDeviceAllocationCacheTest, givenAllocationsWithDifferentFlagsWhenAllocat
         svmManager->freeSVMAlloc(allocationNotFromCache);
 
         svmManager->trimUSMDeviceAllocCache();
-        ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+        ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
     }
 }
 
@@ -297,20 +301,213 @@ TEST(SvmDeviceAllocationCacheTest, givenDeviceOutOfMemoryWhenAllocatingThenCache
     auto allocationInCache = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
     auto allocationInCache2 = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
     auto allocationInCache3 = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
     svmManager->freeSVMAlloc(allocationInCache);
     svmManager->freeSVMAlloc(allocationInCache2);
     svmManager->freeSVMAllocDefer(allocationInCache3);
 
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 3u);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 3u);
     ASSERT_NE(svmManager->getSVMAlloc(allocationInCache), nullptr);
     ASSERT_NE(svmManager->getSVMAlloc(allocationInCache2), nullptr);
     ASSERT_NE(svmManager->getSVMAlloc(allocationInCache3), nullptr);
     auto ptr = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k * 2, unifiedMemoryProperties);
     EXPECT_NE(ptr, nullptr);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
     svmManager->freeSVMAlloc(ptr);
 
     svmManager->trimUSMDeviceAllocCache();
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
+}
+
+TEST(SvmAllocationCacheTest, givenSizesWhenGettingSizeClassIndexThenIndexIsMonotonicAndBoundedByNumberOfSizeClasses) {
+    using SvmAllocationCache = SVMAllocsManager::SvmAllocationCache;
+    EXPECT_EQ(0u, SvmAllocationCache::getSizeClassIndex(1u));
+    EXPECT_EQ(0u, SvmAllocationCache::getSizeClassIndex(MemoryConstants::pageSize64k));
+    EXPECT_EQ(1u, SvmAllocationCache::getSizeClassIndex(MemoryConstants::pageSize64k + 1));
+    EXPECT_EQ(4u, SvmAllocationCache::getSizeClassIndex(MemoryConstants::pageSize64k * 2));
+    EXPECT_EQ(5u, SvmAllocationCache::getSizeClassIndex(MemoryConstants::pageSize64k * 2 + 1));
+    EXPECT_EQ(SvmAllocationCache::numSizeClasses - 1, SvmAllocationCache::getSizeClassIndex(std::numeric_limits<size_t>::max()));
+
+    size_t previousIndex = 0u;
+    for (size_t size = 1u; size < MemoryConstants::gigaByte; size += MemoryConstants::pageSize64k / 3) {
+        auto index = SvmAllocationCache::getSizeClassIndex(size);
+        EXPECT_GE(index, previousIndex);
+        EXPECT_LE(index, previousIndex + 1);
+        previousIndex = index;
+    }
+}
+
+TEST(SvmDeviceAllocationCacheTest, givenAllocationCacheEnabledWhenCacheSizeLimitIsReachedThenAllocationIsFreedInsteadOfCached) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    DebugManager.flags.ExperimentalEnableDeviceAllocationCache.set(1);
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    ASSERT_TRUE(svmManager->usmDeviceAllocationsCacheEnabled);
+
+    auto maxCacheSize = static_cast<size_t>(device->getGlobalMemorySize(static_cast<uint32_t>(device->getDeviceBitfield().to_ulong())) * SVMAllocsManager::SvmAllocationCache::maxPercentOfMemoryToCache);
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::DEVICE_UNIFIED_MEMORY, 1, rootDeviceIndices, deviceBitfields);
+    unifiedMemoryProperties.device = device;
+    auto allocation = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    ASSERT_NE(allocation, nullptr);
+
+    svmManager->usmDeviceAllocationsCache.cachedSizePerRootDevice[device->getRootDeviceIndex()] = maxCacheSize;
+    auto numAllocsBeforeFree = svmManager->getNumAllocs();
+    svmManager->freeSVMAlloc(allocation);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
+    EXPECT_EQ(svmManager->getNumAllocs(), numAllocsBeforeFree - 1);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getCachedSize(device->getRootDeviceIndex()), maxCacheSize);
+
+    svmManager->usmDeviceAllocationsCache.cachedSizePerRootDevice[device->getRootDeviceIndex()] = 0u;
+    allocation = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    svmManager->freeSVMAlloc(allocation);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 1u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getCachedSize(), MemoryConstants::pageSize64k);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getCachedSize(device->getRootDeviceIndex()), MemoryConstants::pageSize64k);
+
+    svmManager->trimUSMDeviceAllocCache();
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getCachedSize(), 0u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getCachedSize(device->getRootDeviceIndex()), 0u);
+}
+
+TEST(SvmDeviceAllocationCacheTest, givenAllocationCacheEnabledWhenCacheSizeLimitIsReachedOnOneRootDeviceThenAllocationsOfOtherRootDeviceAreStillCached) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(2, 1));
+    DebugManagerStateRestore restore;
+    DebugManager.flags.ExperimentalEnableDeviceAllocationCache.set(1);
+    auto rootDevice = deviceFactory->rootDevices[0];
+    auto secondRootDevice = deviceFactory->rootDevices[1];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(rootDevice->getMemoryManager(), false);
+    ASSERT_TRUE(svmManager->usmDeviceAllocationsCacheEnabled);
+
+    auto maxCacheSize = static_cast<size_t>(rootDevice->getGlobalMemorySize(static_cast<uint32_t>(rootDevice->getDeviceBitfield().to_ulong())) * SVMAllocsManager::SvmAllocationCache::maxPercentOfMemoryToCache);
+    svmManager->usmDeviceAllocationsCache.cachedSizePerRootDevice[rootDevice->getRootDeviceIndex()] = maxCacheSize;
+
+    RootDeviceIndicesContainer rootDeviceIndices = {secondRootDevice->getRootDeviceIndex()};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{secondRootDevice->getRootDeviceIndex(), secondRootDevice->getDeviceBitfield()}};
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::DEVICE_UNIFIED_MEMORY, 1, rootDeviceIndices, deviceBitfields);
+    unifiedMemoryProperties.device = secondRootDevice;
+    auto allocation = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    ASSERT_NE(allocation, nullptr);
+
+    svmManager->freeSVMAlloc(allocation);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 1u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getCachedSize(rootDevice->getRootDeviceIndex()), maxCacheSize);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getCachedSize(secondRootDevice->getRootDeviceIndex()), MemoryConstants::pageSize64k);
+
+    svmManager->trimUSMDeviceAllocCache();
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getCachedSize(secondRootDevice->getRootDeviceIndex()), 0u);
+}
+
+TEST(SvmDeviceAllocationCacheTest, givenAllocationCacheEnabledWhenFreeingAndReusingAllocationsFromMultipleThreadsThenEachCachedAllocationIsHandedOutOnce) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    DebugManager.flags.ExperimentalEnableDeviceAllocationCache.set(1);
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    ASSERT_TRUE(svmManager->usmDeviceAllocationsCacheEnabled);
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::DEVICE_UNIFIED_MEMORY, 1, rootDeviceIndices, deviceBitfields);
+    unifiedMemoryProperties.device = device;
+
+    constexpr uint32_t numThreads = 4u;
+    constexpr uint32_t numAllocationsPerThread = 8u;
+    auto getAllocationSize = [](uint32_t allocationId) { return MemoryConstants::pageSize64k << (allocationId % 3); };
+
+    std::vector<std::vector<void *>> allocationsPerThread(numThreads);
+    for (auto &allocations : allocationsPerThread) {
+        for (uint32_t allocationId = 0u; allocationId < numAllocationsPerThread; ++allocationId) {
+            allocations.push_back(svmManager->createUnifiedMemoryAllocation(getAllocationSize(allocationId), unifiedMemoryProperties));
+            ASSERT_NE(allocations.back(), nullptr);
+        }
+    }
+
+    std::vector<std::thread> threads;
+    for (uint32_t threadId = 0u; threadId < numThreads; ++threadId) {
+        threads.emplace_back([&, threadId]() {
+            for (auto allocation : allocationsPerThread[threadId]) {
+                svmManager->freeSVMAlloc(allocation);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), numThreads * numAllocationsPerThread);
+
+    std::vector<std::vector<void *>> reusedAllocationsPerThread(numThreads);
+    threads.clear();
+    for (uint32_t threadId = 0u; threadId < numThreads; ++threadId) {
+        threads.emplace_back([&, threadId]() {
+            for (uint32_t allocationId = 0u; allocationId < numAllocationsPerThread; ++allocationId) {
+                reusedAllocationsPerThread[threadId].push_back(svmManager->createUnifiedMemoryAllocation(getAllocationSize(allocationId), unifiedMemoryProperties));
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
+
+    std::set<void *> uniqueAllocations;
+    for (auto &allocations : reusedAllocationsPerThread) {
+        for (auto allocation : allocations) {
+            EXPECT_TRUE(uniqueAllocations.insert(allocation).second);
+            svmManager->freeSVMAlloc(allocation);
+        }
+    }
+    EXPECT_EQ(uniqueAllocations.size(), numThreads * numAllocationsPerThread);
+
+    svmManager->trimUSMDeviceAllocCache();
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
+}
+
+TEST(SvmHostAllocationCacheTest, givenAllocationCacheDefaultWhenCheckingIfEnabledThenItIsDisabled) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    ASSERT_EQ(DebugManager.flags.ExperimentalEnableHostAllocationCache.get(), -1);
+    EXPECT_FALSE(svmManager->usmHostAllocationsCacheEnabled);
+}
+
+TEST(SvmHostAllocationCacheTest, givenAllocationCacheEnabledWhenFreeingHostAllocationThenItIsReusedForNextAllocation) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    DebugManager.flags.ExperimentalEnableHostAllocationCache.set(1);
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    ASSERT_TRUE(svmManager->usmHostAllocationsCacheEnabled);
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::HOST_UNIFIED_MEMORY, 1, rootDeviceIndices, deviceBitfields);
+    auto allocation = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize, unifiedMemoryProperties);
+    ASSERT_NE(allocation, nullptr);
+    svmManager->freeSVMAlloc(allocation);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), 1u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
+
+    SVMAllocsManager::UnifiedMemoryProperties writeCombinedProperties(InternalMemoryType::HOST_UNIFIED_MEMORY, 1, rootDeviceIndices, deviceBitfields);
+    writeCombinedProperties.allocationFlags.allocFlags.allocWriteCombined = true;
+    auto allocationNotFromCache = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize, writeCombinedProperties);
+    EXPECT_NE(allocationNotFromCache, allocation);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), 1u);
+
+    auto allocationFromCache = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize, unifiedMemoryProperties);
+    EXPECT_EQ(allocationFromCache, allocation);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), 0u);
+
+    svmManager->freeSVMAlloc(allocationFromCache);
+    svmManager->freeSVMAlloc(allocationNotFromCache);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), 2u);
+
+    svmManager->trimUSMHostAllocCache();
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), 0u);
+    EXPECT_EQ(svmManager->getNumAllocs(), 0u);
 }
@@ -373,3 +373,101 @@ TEST_F(SVMLocalMemoryAllocatorTest, givenAlignmentThenSharedUnifiedMemoryAllocat
         svmManager->freeSVMAlloc(ptr);
     } while (alignment != 0);
 }
+
+TEST(SvmAllocationTrackerTest, givenAllocationFoundInTrackerWhenLookingUpPointerInsideItThenLastHitServesTheLookup) {
+    MockGraphicsAllocation graphicsAllocation(reinterpret_cast<void *>(0x10000), 0x10000, MemoryConstants::pageSize64k);
+    SvmAllocationData allocData(0);
+    allocData.gpuAllocations.addAllocation(&graphicsAllocation);
+    allocData.size = MemoryConstants::pageSize64k;
+
+    SVMAllocsManager::MapBasedAllocationTracker tracker;
+    tracker.insert(allocData);
+
+    auto basePtr = reinterpret_cast<const void *>(0x10000);
+    auto interiorPtr = reinterpret_cast<const void *>(0x10000 + MemoryConstants::pageSize);
+    auto svmData = tracker.get(basePtr);
+    ASSERT_NE(nullptr, svmData);
+
+    EXPECT_EQ(svmData, tracker.getFromLastHit(basePtr));
+    EXPECT_EQ(svmData, tracker.getFromLastHit(interiorPtr));
+    EXPECT_EQ(nullptr, tracker.getFromLastHit(reinterpret_cast<const void *>(0x10000 + MemoryConstants::pageSize64k)));
+    EXPECT_EQ(svmData, tracker.get(interiorPtr));
+}
+
+TEST(SvmAllocationTrackerTest, givenLastHitWhenAllocationIsRemovedThenLastHitIsNotUsed) {
+    MockGraphicsAllocation graphicsAllocation(reinterpret_cast<void *>(0x10000), 0x10000, MemoryConstants::pageSize64k);
+    SvmAllocationData allocData(0);
+    allocData.gpuAllocations.addAllocation(&graphicsAllocation);
+    allocData.size = MemoryConstants::pageSize64k;
+
+    SVMAllocsManager::MapBasedAllocationTracker tracker;
+    tracker.insert(allocData);
+
+    auto basePtr = reinterpret_cast<const void *>(0x10000);
+    ASSERT_NE(nullptr, tracker.get(basePtr));
+    ASSERT_NE(nullptr, tracker.getFromLastHit(basePtr));
+
+    tracker.remove(allocData);
+    EXPECT_EQ(nullptr, tracker.getFromLastHit(basePtr));
+    EXPECT_EQ(nullptr, tracker.get(basePtr));
+}
+
+TEST(SvmAllocationTrackerTest, givenLastHitInOneTrackerWhenLookingUpInAnotherTrackerThenLastHitIsNotUsed) {
+    MockGraphicsAllocation graphicsAllocation(reinterpret_cast<void *>(0x10000), 0x10000, MemoryConstants::pageSize64k);
+    SvmAllocationData allocData(0);
+    allocData.gpuAllocations.addAllocation(&graphicsAllocation);
+    allocData.size = MemoryConstants::pageSize64k;
+
+    SVMAllocsManager::MapBasedAllocationTracker tracker;
+    SVMAllocsManager::MapBasedAllocationTracker otherTracker;
+    tracker.insert(allocData);
+
+    auto basePtr = reinterpret_cast<const void *>(0x10000);
+    ASSERT_NE(nullptr, tracker.get(basePtr));
+    EXPECT_EQ(nullptr, otherTracker.getFromLastHit(basePtr));
+    EXPECT_EQ(nullptr, otherTracker.get(basePtr));
+}
+
+TEST(SvmAllocationTrackerTest, givenLookupsAlternatingBetweenTrackersWhenLookingUpAgainThenEachTrackerKeepsItsLastHit) {
+    MockGraphicsAllocation graphicsAllocation(reinterpret_cast<void *>(0x10000), 0x10000, MemoryConstants::pageSize64k);
+    SvmAllocationData allocData(0);
+    allocData.gpuAllocations.addAllocation(&graphicsAllocation);
+    allocData.size = MemoryConstants::pageSize64k;
+
+    MockGraphicsAllocation otherGraphicsAllocation(reinterpret_cast<void *>(0x40000), 0x40000, MemoryConstants::pageSize64k);
+    SvmAllocationData otherAllocData(0);
+    otherAllocData.gpuAllocations.addAllocation(&otherGraphicsAllocation);
+    otherAllocData.size = MemoryConstants::pageSize64k;
+
+    SVMAllocsManager::MapBasedAllocationTracker tracker;
+    SVMAllocsManager::MapBasedAllocationTracker otherTracker;
+    tracker.insert(allocData);
+    otherTracker.insert(otherAllocData);
+
+    auto basePtr = reinterpret_cast<const void *>(0x10000);
+    auto otherBasePtr = reinterpret_cast<const void *>(0x40000);
+    auto svmData = tracker.get(basePtr);
+    auto otherSvmData = otherTracker.get(otherBasePtr);
+    ASSERT_NE(nullptr, svmData);
+    ASSERT_NE(nullptr, otherSvmData);
+
+    EXPECT_EQ(svmData, tracker.getFromLastHit(basePtr));
+    EXPECT_EQ(otherSvmData, otherTracker.getFromLastHit(otherBasePtr));
+}
+
+TEST(SvmAllocationTrackerTest, givenLastHitWhenAllocationIsErasedDirectlyThenLastHitIsNotUsed) {
+    MockGraphicsAllocation graphicsAllocation(reinterpret_cast<void *>(0x10000), 0x10000, MemoryConstants::pageSize64k);
+    SvmAllocationData allocData(0);
+    allocData.gpuAllocations.addAllocation(&graphicsAllocation);
+    allocData.size = MemoryConstants::pageSize64k;
+
+    SVMAllocsManager::MapBasedAllocationTracker tracker;
+    tracker.insert(allocData);
+
+    auto basePtr = reinterpret_cast<const void *>(0x10000);
+    ASSERT_NE(nullptr, tracker.get(basePtr));
+
+    tracker.erase(tracker.allocations.find(basePtr));
+    EXPECT_EQ(nullptr, tracker.getFromLastHit(basePtr));
+    EXPECT_EQ(0u, tracker.getNumAllocs());
+}
@@ -23,7 +23,7 @@ TEST_F(DrmBufferObjectPrelimTest, GivenCompletionAddressWhenCallingExecThenRetur
     constexpr uint64_t expectedCompletionValue = completionValue;
 
     ExecObject execObjectsStorage = {};
-    auto ret = bo->exec(0, 0, 0, false, osContext.get(), 0, 1, nullptr, 0u, &execObjectsStorage, completionAddress, completionValue);
+    auto ret = bo->exec(0, 0, 0, false, osContext.get(), 0, 1, nullptr, 0u, &execObjectsStorage, completionAddress, completionValue, false);
     EXPECT_EQ(0, ret);
     EXPECT_EQ(completionAddress, mock->context.completionAddress);
     EXPECT_EQ(expectedCompletionValue, mock->context.completionValue);
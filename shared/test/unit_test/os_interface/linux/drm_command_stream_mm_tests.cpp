@@ -202,3 +202,100 @@ HWTEST_TEMPLATED_F(DrmCommandStreamMemExecTest, GivenDrmSupportsCompletionFenceA
 
     mm->freeGraphicsMemory(allocation);
 }
+
+HWTEST_TEMPLATED_F(DrmCommandStreamMemExecTest, givenSameResidencyInConsecutiveSubmissionsWhenCallingCsrExecThenOnlyExecObjectsOfChangedBufferObjectsAreFilled) {
+    mock->isVmBindAvailableCall.callParent = false;
+    mock->isVmBindAvailableCall.returnValue = false;
+
+    TestedBufferObject bo(rootDeviceIndex, mock, 128);
+    MockDrmAllocation cmdBuffer(rootDeviceIndex, AllocationType::COMMAND_BUFFER, MemoryPool::System4KBPages);
+    cmdBuffer.bufferObjects[0] = &bo;
+    uint8_t buff[128];
+
+    LinearStream cs(&cmdBuffer, buff, 128);
+    CommandStreamReceiverHw<FamilyType>::addBatchBufferEnd(cs, nullptr);
+    EncodeNoop<FamilyType>::alignToCacheLine(cs);
+
+    BatchBuffer batchBuffer = BatchBufferHelper::createDefaultBatchBuffer(cs.getGraphicsAllocation(), &cs, cs.getUsed());
+
+    TestedBufferObject residentBo0(rootDeviceIndex, mock, 128);
+    TestedBufferObject residentBo1(rootDeviceIndex, mock, 128);
+    auto *testCsr = static_cast<TestedDrmCommandStreamReceiver<FamilyType> *>(csr);
+    EXPECT_TRUE(testCsr->reuseExecObjects);
+
+    testCsr->residency = {&residentBo0, &residentBo1};
+    EXPECT_EQ(0, testCsr->exec(batchBuffer, 0, 1, 0));
+    EXPECT_EQ(&testCsr->execObjectsStorage[0], residentBo0.execObjectPointerFilled);
+    EXPECT_EQ(&testCsr->execObjectsStorage[1], residentBo1.execObjectPointerFilled);
+    EXPECT_EQ(&testCsr->execObjectsStorage[2], bo.execObjectPointerFilled);
+
+    residentBo0.execObjectPointerFilled = nullptr;
+    residentBo1.execObjectPointerFilled = nullptr;
+    residentBo1.markForCapture();
+    testCsr->residency = {&residentBo0, &residentBo1};
+    EXPECT_EQ(0, testCsr->exec(batchBuffer, 0, 1, 0));
+    EXPECT_EQ(nullptr, residentBo0.execObjectPointerFilled);
+    EXPECT_EQ(&testCsr->execObjectsStorage[1], residentBo1.execObjectPointerFilled);
+
+    residentBo1.execObjectPointerFilled = nullptr;
+    testCsr->residency = {&residentBo0, &residentBo1};
+    EXPECT_EQ(0, testCsr->exec(batchBuffer, 0, 2, 0));
+    EXPECT_EQ(&testCsr->execObjectsStorage[0], residentBo0.execObjectPointerFilled);
+    EXPECT_EQ(&testCsr->execObjectsStorage[1], residentBo1.execObjectPointerFilled);
+
+    residentBo0.execObjectPointerFilled = nullptr;
+    residentBo1.execObjectPointerFilled = nullptr;
+    testCsr->residency = {&residentBo0};
+    EXPECT_EQ(0, testCsr->exec(batchBuffer, 0, 2, 0));
+    EXPECT_EQ(nullptr, residentBo0.execObjectPointerFilled);
+    EXPECT_EQ(&testCsr->execObjectsStorage[1], bo.execObjectPointerFilled);
+
+    testCsr->residency = {&residentBo0, &residentBo1};
+    EXPECT_EQ(0, testCsr->exec(batchBuffer, 0, 2, 0));
+    EXPECT_EQ(nullptr, residentBo0.execObjectPointerFilled);
+    EXPECT_EQ(&testCsr->execObjectsStorage[1], residentBo1.execObjectPointerFilled);
+}
+
+HWTEST_TEMPLATED_F(DrmCommandStreamMemExecTest, givenExecObjectsReuseDisabledWhenCallingCsrExecWithSameResidencyThenAllExecObjectsAreFilled) {
+    mock->isVmBindAvailableCall.callParent = false;
+    mock->isVmBindAvailableCall.returnValue = false;
+
+    TestedBufferObject bo(rootDeviceIndex, mock, 128);
+    MockDrmAllocation cmdBuffer(rootDeviceIndex, AllocationType::COMMAND_BUFFER, MemoryPool::System4KBPages);
+    cmdBuffer.bufferObjects[0] = &bo;
+    uint8_t buff[128];
+
+    LinearStream cs(&cmdBuffer, buff, 128);
+    CommandStreamReceiverHw<FamilyType>::addBatchBufferEnd(cs, nullptr);
+    EncodeNoop<FamilyType>::alignToCacheLine(cs);
+
+    BatchBuffer batchBuffer = BatchBufferHelper::createDefaultBatchBuffer(cs.getGraphicsAllocation(), &cs, cs.getUsed());
+
+    TestedBufferObject residentBo(rootDeviceIndex, mock, 128);
+    auto *testCsr = static_cast<TestedDrmCommandStreamReceiver<FamilyType> *>(csr);
+    testCsr->reuseExecObjects = false;
+
+    for (auto submission = 0u; submission < 2u; submission++) {
+        residentBo.execObjectPointerFilled = nullptr;
+        testCsr->residency = {&residentBo};
+        EXPECT_EQ(0, testCsr->exec(batchBuffer, 0, 1, 0));
+        EXPECT_EQ(&testCsr->execObjectsStorage[0], residentBo.execObjectPointerFilled);
+    }
+}
+
+HWTEST_F(DrmCommandStreamMMTest, givenDebugFlagSetWhenCreatingCsrThenExecObjectsReuseIsConfigured) {
+    DebugManagerStateRestore dbgRestorer;
+    MockExecutionEnvironment executionEnvironment;
+    auto drm = new DrmMockCustom(*executionEnvironment.rootDeviceEnvironments[0]);
+
+    executionEnvironment.rootDeviceEnvironments[0]->osInterface = std::make_unique<OSInterface>();
+    executionEnvironment.rootDeviceEnvironments[0]->osInterface->setDriverModel(std::unique_ptr<DriverModel>(drm));
+    executionEnvironment.rootDeviceEnvironments[0]->memoryOperationsInterface = DrmMemoryOperationsHandler::create(*drm, 0u);
+    executionEnvironment.rootDeviceEnvironments[0]->initGmm();
+
+    for (auto enable : {0, 1}) {
+        DebugManager.flags.EnableDrmExecObjectsReuse.set(enable);
+        TestedDrmCommandStreamReceiver<FamilyType> csr(executionEnvironment, 0, 1);
+        EXPECT_EQ(!!enable, csr.reuseExecObjects);
+    }
+}
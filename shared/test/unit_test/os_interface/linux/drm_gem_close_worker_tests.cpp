@@ -15,6 +15,7 @@
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
 #include "shared/source/os_interface/linux/drm_memory_operations_handler.h"
 #include "shared/source/os_interface/os_interface.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_execution_environment.h"
 #include "shared/test/common/os_interface/linux/device_command_stream_fixture.h"
 #include "shared/test/common/test_macros/test.h"
@@ -26,6 +27,7 @@
 #include <mutex>
 #include <sched.h>
 #include <thread>
+#include <vector>
 
 using namespace NEO;
 
@@ -187,3 +189,78 @@ TEST_F(DrmGemCloseWorkerTests, givenDrmGemCloseWorkerWhenCloseIsCalledMultipleTi
     worker->close(true);
     EXPECT_EQ(nullptr, worker->thread);
 }
+
+TEST_F(DrmGemCloseWorkerTests, givenMultipleProducersWhenPushingBufferObjectsThenAllAreClosedAndStatisticsAreUpdated) {
+    constexpr uint32_t numThreads = 4;
+    constexpr uint32_t numBosPerThread = 64;
+    this->drmMock->gemCloseExpected = numThreads * numBosPerThread;
+
+    auto worker = std::make_unique<DrmGemCloseWorker>(*mm);
+
+    std::vector<std::thread> producers;
+    for (uint32_t threadId = 0; threadId < numThreads; threadId++) {
+        producers.emplace_back([&] {
+            for (uint32_t i = 0; i < numBosPerThread; i++) {
+                worker->push(new BufferObject(rootDeviceIndex, this->drmMock, 3, 1, 0, 1));
+            }
+        });
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+
+    while (!worker->isEmpty() && (deadCnt-- > 0)) {
+        sched_yield();
+    }
+
+    EXPECT_TRUE(worker->isEmpty());
+    EXPECT_EQ(0u, worker->getQueueDepth());
+    EXPECT_EQ(numThreads * numBosPerThread, worker->getNumClosed());
+    EXPECT_LE(1u, worker->getMaxQueueDepth());
+    EXPECT_LE(worker->getMaxQueueDepth(), numThreads * numBosPerThread);
+    EXPECT_LE(worker->getMaxCloseLatencyUs(), worker->getTotalCloseLatencyUs());
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenReferencedBufferObjectsWhenPushedAndClosedThenCloseWorkerLinkIsClearedAndObjectsStayAlive) {
+    this->drmMock->gemCloseExpected = -1;
+
+    auto worker = std::make_unique<DrmGemCloseWorker>(*mm);
+    auto bo0 = new BufferObject(rootDeviceIndex, this->drmMock, 3, 1, 0, 1);
+    auto bo1 = new BufferObject(rootDeviceIndex, this->drmMock, 3, 1, 0, 1);
+    bo0->reference();
+    bo1->reference();
+    EXPECT_EQ(nullptr, bo0->closeWorkerNext);
+
+    worker->push(bo0);
+    worker->push(bo1);
+
+    while (!worker->isEmpty() && (deadCnt-- > 0)) {
+        sched_yield();
+    }
+
+    EXPECT_TRUE(worker->isEmpty());
+    EXPECT_EQ(2u, worker->getNumClosed());
+    EXPECT_EQ(nullptr, bo0->closeWorkerNext);
+    EXPECT_EQ(nullptr, bo1->closeWorkerNext);
+    EXPECT_EQ(1u, bo0->getRefCount());
+    EXPECT_EQ(1u, bo1->getRefCount());
+
+    worker->close(true);
+    mm->unreference(bo0, true);
+    mm->unreference(bo1, true);
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenPrintGemCloseWorkerStatisticsWhenWorkerIsDestroyedThenStatisticsArePrinted) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.PrintGemCloseWorkerStatistics.set(true);
+    this->drmMock->gemCloseExpected = 1;
+
+    auto worker = new DrmGemCloseWorker(*mm);
+    worker->push(new BufferObject(rootDeviceIndex, this->drmMock, 3, 1, 0, 1));
+    worker->close(true);
+
+    testing::internal::CaptureStdout();
+    delete worker;
+    auto output = testing::internal::GetCapturedStdout();
+    EXPECT_NE(std::string::npos, output.find("Gem close worker closed: 1,"));
+}
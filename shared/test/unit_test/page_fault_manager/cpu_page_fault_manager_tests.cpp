@@ -868,3 +868,148 @@ TEST_F(PageFaultManagerTest, givenNoUsmInitialPlacementFlagsWHenInsertingUsmAllo
     EXPECT_EQ(PageFaultManager::AllocationDomain::Cpu, pageFaultManager->memoryData.at(allocs[3]).domain);
     EXPECT_EQ(allocs[3], unifiedMemoryManager->nonGpuDomainAllocs[3]);
 }
+
+TEST_F(PageFaultManagerTest, givenTrackedAllocationsWhenVerifyingAddressesAroundThemThenOnlyAddressesInsideAllocationsAreHandled) {
+    void *alloc1 = reinterpret_cast<void *>(0x1000);
+    void *alloc2 = reinterpret_cast<void *>(0x3000);
+
+    pageFaultManager->insertAllocation(alloc2, 0x100, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->insertAllocation(alloc1, 0x100, unifiedMemoryManager.get(), nullptr, {});
+
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(0x800)));
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(0x1100)));
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(0x3100)));
+    EXPECT_EQ(0, pageFaultManager->allowMemoryAccessCalled);
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(0x30ff)));
+    EXPECT_EQ(alloc2, pageFaultManager->allowedMemoryAccessAddress);
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(alloc1));
+    EXPECT_EQ(alloc1, pageFaultManager->allowedMemoryAccessAddress);
+}
+
+TEST_F(PageFaultManagerTest, givenMigrationChunkSizeDebugFlagWhenInsertingAllocationsThenOnlyAllocationsLargerThanChunkAreTrackedInChunks) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SharedAllocationMigrationChunkSize.set(3);
+    auto chunkedPageFaultManager = std::make_unique<MockPageFaultManager>();
+    EXPECT_EQ(MemoryConstants::pageSize, chunkedPageFaultManager->migrationChunkSize);
+
+    void *alloc1 = reinterpret_cast<void *>(0x10000);
+    void *alloc2 = reinterpret_cast<void *>(0x100000);
+    chunkedPageFaultManager->insertAllocation(alloc1, MemoryConstants::pageSize, unifiedMemoryManager.get(), nullptr, {});
+    chunkedPageFaultManager->insertAllocation(alloc2, 3 * MemoryConstants::pageSize + 1, unifiedMemoryManager.get(), nullptr, {});
+
+    EXPECT_TRUE(chunkedPageFaultManager->memoryData[alloc1].cpuChunks.empty());
+    EXPECT_EQ(std::vector<bool>(4, true), chunkedPageFaultManager->memoryData[alloc2].cpuChunks);
+
+    memoryProperties.allocFlags.usmInitialPlacementGpu = 1;
+    void *alloc3 = reinterpret_cast<void *>(0x200000);
+    chunkedPageFaultManager->insertAllocation(alloc3, 2 * MemoryConstants::pageSize, unifiedMemoryManager.get(), nullptr, memoryProperties);
+    EXPECT_EQ(std::vector<bool>(2, false), chunkedPageFaultManager->memoryData[alloc3].cpuChunks);
+}
+
+TEST_F(PageFaultManagerTest, givenChunkedAllocationInGpuDomainWhenPageFaultsOccurThenOnlyFaultedChunksAreMigratedAndMovedBack) {
+    constexpr size_t chunkSize = MemoryConstants::pageSize;
+    pageFaultManager->migrationChunkSize = chunkSize;
+    void *alloc = reinterpret_cast<void *>(0x10000);
+
+    pageFaultManager->insertAllocation(alloc, 4 * chunkSize, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(0, pageFaultManager->transferToGpuCalled);
+    EXPECT_EQ(1, pageFaultManager->transferRangeToGpuCalled);
+    EXPECT_EQ(0u, pageFaultManager->transferRangeToGpuOffset);
+    EXPECT_EQ(4 * chunkSize, pageFaultManager->transferRangeToGpuSize);
+    EXPECT_EQ(alloc, pageFaultManager->protectedMemoryAccessAddress);
+    EXPECT_EQ(4 * chunkSize, pageFaultManager->protectedSize);
+    EXPECT_EQ(0u, unifiedMemoryManager->nonGpuDomainAllocs.size());
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(alloc, 2 * chunkSize + 5)));
+    EXPECT_EQ(0, pageFaultManager->transferToCpuCalled);
+    EXPECT_EQ(1, pageFaultManager->transferRangeToCpuCalled);
+    EXPECT_EQ(2 * chunkSize, pageFaultManager->transferRangeToCpuOffset);
+    EXPECT_EQ(chunkSize, pageFaultManager->transferRangeToCpuSize);
+    EXPECT_EQ(ptrOffset(alloc, 2 * chunkSize), pageFaultManager->allowedMemoryAccessAddress);
+    EXPECT_EQ(chunkSize, pageFaultManager->accessAllowedSize);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::Cpu, pageFaultManager->memoryData[alloc].domain);
+    EXPECT_EQ(1u, unifiedMemoryManager->nonGpuDomainAllocs.size());
+    EXPECT_EQ(1, pageFaultManager->allowCPUMemoryEvictionCalled);
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(alloc, 2 * chunkSize)));
+    EXPECT_EQ(1, pageFaultManager->transferRangeToCpuCalled);
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(alloc, 3 * chunkSize)));
+    EXPECT_EQ(2, pageFaultManager->transferRangeToCpuCalled);
+    EXPECT_EQ(3 * chunkSize, pageFaultManager->transferRangeToCpuOffset);
+    EXPECT_EQ(1u, unifiedMemoryManager->nonGpuDomainAllocs.size());
+    EXPECT_EQ(1, pageFaultManager->allowCPUMemoryEvictionCalled);
+
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(unifiedMemoryManager.get());
+    EXPECT_EQ(2, pageFaultManager->transferRangeToGpuCalled);
+    EXPECT_EQ(2 * chunkSize, pageFaultManager->transferRangeToGpuOffset);
+    EXPECT_EQ(2 * chunkSize, pageFaultManager->transferRangeToGpuSize);
+    EXPECT_EQ(ptrOffset(alloc, 2 * chunkSize), pageFaultManager->protectedMemoryAccessAddress);
+    EXPECT_EQ(2 * chunkSize, pageFaultManager->protectedSize);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::Gpu, pageFaultManager->memoryData[alloc].domain);
+    EXPECT_EQ(std::vector<bool>(4, false), pageFaultManager->memoryData[alloc].cpuChunks);
+}
+
+TEST_F(PageFaultManagerTest, givenChunkedAllocationWithPartialLastChunkWhenLastChunkFaultsThenOnlyRemainingBytesAreMigrated) {
+    constexpr size_t chunkSize = MemoryConstants::pageSize;
+    pageFaultManager->migrationChunkSize = chunkSize;
+    void *alloc = reinterpret_cast<void *>(0x10000);
+
+    pageFaultManager->insertAllocation(alloc, 2 * chunkSize + 0x100, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(alloc, 2 * chunkSize + 0x80)));
+    EXPECT_EQ(2 * chunkSize, pageFaultManager->transferRangeToCpuOffset);
+    EXPECT_EQ(0x100u, pageFaultManager->transferRangeToCpuSize);
+    EXPECT_EQ(0x100u, pageFaultManager->accessAllowedSize);
+}
+
+TEST_F(PageFaultManagerTest, givenAubOrTbxHandlerAndChunkedAllocationWhenPageFaultOccursThenChunkIsUnprotectedBeforeTransfer) {
+    constexpr size_t chunkSize = MemoryConstants::pageSize;
+    pageFaultManager->migrationChunkSize = chunkSize;
+    pageFaultManager->gpuDomainHandler = &MockPageFaultManager::unprotectAndTransferMemory;
+    void *alloc = reinterpret_cast<void *>(0x10000);
+
+    pageFaultManager->insertAllocation(alloc, 2 * chunkSize, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(alloc));
+    EXPECT_EQ(1, pageFaultManager->allowMemoryAccessCalled);
+    EXPECT_EQ(1, pageFaultManager->transferRangeToCpuCalled);
+    EXPECT_EQ(0, pageFaultManager->allowCPUMemoryEvictionCalled);
+}
+
+TEST_F(PageFaultManagerTest, givenPartiallyMigratedChunkedAllocationWhenCustomGpuDomainHandlerIsUsedThenRemainingChunksAreMigratedBeforeHandler) {
+    constexpr size_t chunkSize = MemoryConstants::pageSize;
+    pageFaultManager->migrationChunkSize = chunkSize;
+    void *alloc = reinterpret_cast<void *>(0x10000);
+
+    pageFaultManager->insertAllocation(alloc, 3 * chunkSize, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(alloc));
+    EXPECT_EQ(1, pageFaultManager->transferRangeToCpuCalled);
+
+    pageFaultManager->gpuDomainHandler = [](PageFaultManager *, void *, PageFaultManager::PageFaultData &) {};
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(alloc, chunkSize)));
+    EXPECT_EQ(3, pageFaultManager->transferRangeToCpuCalled);
+    EXPECT_EQ(2 * chunkSize, pageFaultManager->transferRangeToCpuOffset);
+    EXPECT_EQ(std::vector<bool>(3, true), pageFaultManager->memoryData[alloc].cpuChunks);
+}
+
+TEST_F(PageFaultManagerTest, givenPartiallyMigratedChunkedAllocationWhenRemovingThenWholeAllocationIsAccessible) {
+    constexpr size_t chunkSize = MemoryConstants::pageSize;
+    pageFaultManager->migrationChunkSize = chunkSize;
+    void *alloc = reinterpret_cast<void *>(0x10000);
+
+    pageFaultManager->insertAllocation(alloc, 3 * chunkSize, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(alloc));
+
+    pageFaultManager->removeAllocation(alloc);
+    EXPECT_EQ(alloc, pageFaultManager->allowedMemoryAccessAddress);
+    EXPECT_EQ(3 * chunkSize, pageFaultManager->accessAllowedSize);
+    EXPECT_EQ(0u, unifiedMemoryManager->nonGpuDomainAllocs.size());
+}
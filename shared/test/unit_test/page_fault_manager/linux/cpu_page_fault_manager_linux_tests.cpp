@@ -10,6 +10,7 @@
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_cpu_page_fault_manager.h"
 #include "shared/test/common/mocks/mock_device.h"
+#include "shared/test/common/mocks/mock_execution_environment.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 #include "shared/test/common/mocks/mock_memory_operations_handler.h"
 
@@ -243,3 +244,71 @@ TEST_F(PageFaultManagerLinuxTest, givenDefaultSaHandlerWhenOverwritingNewHandler
     mockPageFaultManager.reset();
     sigaction(SIGSEGV, &originalHandler, nullptr);
 }
+
+class MockChunkMigrationPageFaultManagerLinux : public PageFaultManagerLinux {
+  public:
+    using PageFaultManagerLinux::memoryData;
+    using PageFaultManagerLinux::migrationChunkSize;
+    using PageFaultManagerLinux::PageFaultManagerLinux;
+
+    void transferToCpu(void *ptr, size_t size, void *cmdQ) override {
+        transferredToCpuSize += size;
+    }
+    void transferToGpu(void *ptr, void *cmdQ) override {
+        transferredToGpuSize += memoryData[ptr].size;
+    }
+    void transferRangeToCpu(void *ptr, size_t offset, size_t size, void *cmdQ) override {
+        transferredToCpuSize += size;
+    }
+    void transferRangeToGpu(void *ptr, size_t offset, size_t size, void *cmdQ) override {
+        transferredToGpuSize += size;
+    }
+    void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager) override {}
+    void setCpuAllocEvictable(bool evictable, void *ptr, SVMAllocsManager *unifiedMemoryManager) override {}
+    void allowCPUMemoryEviction(void *ptr, PageFaultData &pageFaultData) override {}
+
+    size_t transferredToCpuSize = 0u;
+    size_t transferredToGpuSize = 0u;
+};
+
+TEST_F(PageFaultManagerLinuxTest, givenProtectedSharedAllocationWhenHostTouchesFewChunksThenChunkedMigrationMovesOnlyTouchedChunks) {
+    MockExecutionEnvironment executionEnvironment;
+    MockMemoryManager memoryManager(executionEnvironment);
+    SVMAllocsManager unifiedMemoryManager(&memoryManager, false);
+
+    constexpr size_t chunkSize = 64 * MemoryConstants::kiloByte;
+    constexpr size_t allocSize = 8 * chunkSize;
+
+    auto touchChunksAndGetMigratedSizes = [&](size_t migrationChunkSize) {
+        auto pageFaultManager = std::make_unique<MockChunkMigrationPageFaultManagerLinux>();
+        pageFaultManager->migrationChunkSize = migrationChunkSize;
+        auto ptr = static_cast<uint8_t *>(mmap(nullptr, allocSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0));
+        EXPECT_NE(MAP_FAILED, ptr);
+
+        pageFaultManager->insertAllocation(ptr, allocSize, &unifiedMemoryManager, nullptr, {});
+        pageFaultManager->moveAllocationToGpuDomain(ptr);
+        pageFaultManager->transferredToGpuSize = 0u;
+
+        ptr[chunkSize + 1] = 1;
+        ptr[6 * chunkSize] = 2;
+        ptr[6 * chunkSize + 2] = 3;
+        EXPECT_EQ(1u, ptr[chunkSize + 1]);
+        EXPECT_EQ(2u, ptr[6 * chunkSize]);
+        EXPECT_EQ(3u, ptr[6 * chunkSize + 2]);
+
+        pageFaultManager->moveAllocationToGpuDomain(ptr);
+        auto migratedSizes = std::make_pair(pageFaultManager->transferredToCpuSize, pageFaultManager->transferredToGpuSize);
+
+        pageFaultManager->removeAllocation(ptr);
+        munmap(ptr, allocSize);
+        return migratedSizes;
+    };
+
+    auto wholeAllocationMigration = touchChunksAndGetMigratedSizes(0u);
+    EXPECT_EQ(allocSize, wholeAllocationMigration.first);
+    EXPECT_EQ(allocSize, wholeAllocationMigration.second);
+
+    auto chunkedMigration = touchChunksAndGetMigratedSizes(chunkSize);
+    EXPECT_EQ(2 * chunkSize, chunkedMigration.first);
+    EXPECT_EQ(2 * chunkSize, chunkedMigration.second);
+}
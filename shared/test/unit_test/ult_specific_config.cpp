@@ -33,6 +33,10 @@ void PageFaultManager::transferToCpu(void *ptr, size_t size, void *cmdQ) {
 }
 void PageFaultManager::transferToGpu(void *ptr, void *cmdQ) {
 }
+void PageFaultManager::transferRangeToCpu(void *ptr, size_t offset, size_t size, void *cmdQ) {
+}
+void PageFaultManager::transferRangeToGpu(void *ptr, size_t offset, size_t size, void *cmdQ) {
+}
 void PageFaultManager::allowCPUMemoryEviction(void *ptr, PageFaultData &pageFaultData) {
 }
 CompilerCacheConfig getDefaultCompilerCacheConfig() { return {}; }
@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/os_thread.h"
+#include "shared/source/utilities/deferred_submission_flusher.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+
+#include "gtest/gtest.h"
+
+#include <thread>
+
+using namespace NEO;
+
+class MockDeferredSubmissionFlusher : public DeferredSubmissionFlusher {
+  public:
+    using DeferredSubmissionFlusher::DeferredSubmissionFlusher;
+    using DeferredSubmissionFlusher::flusherThread;
+};
+
+class MockDeferredSubmissionClient : public DeferredSubmissionClient {
+  public:
+    bool flushDeferredSubmission(bool onlyStale) override {
+        if (onlyStale) {
+            staleFlushCalled++;
+        } else {
+            flushCalled++;
+        }
+        if (remainingDeferredRounds > 0) {
+            remainingDeferredRounds--;
+            return true;
+        }
+        return false;
+    }
+
+    const CommandStreamReceiver *getDeferredSubmissionCsr() const override {
+        return csr;
+    }
+
+    const CommandStreamReceiver *csr = nullptr;
+    std::atomic<uint32_t> flushCalled{0};
+    std::atomic<uint32_t> staleFlushCalled{0};
+    std::atomic<uint32_t> remainingDeferredRounds{0};
+};
+
+TEST(DeferredSubmissionFlusherTest, givenDefaultDebugSettingsWhenCheckingIfEnabledThenFalseIsReturned) {
+    DebugManagerStateRestore restorer;
+    EXPECT_FALSE(DeferredSubmissionFlusher::isEnabled());
+
+    DebugManager.flags.ImmediateCmdListAppendCoalescing.set(1);
+    EXPECT_TRUE(DeferredSubmissionFlusher::isEnabled());
+}
+
+TEST(DeferredSubmissionFlusherTest, givenNoRegisteredClientsWhenFlusherIsCreatedThenFlusherThreadIsNotStarted) {
+    MockDeferredSubmissionFlusher flusher(std::chrono::microseconds(0));
+    EXPECT_EQ(nullptr, flusher.flusherThread.get());
+
+    MockDeferredSubmissionClient client;
+    flusher.registerClient(&client);
+    EXPECT_NE(nullptr, flusher.flusherThread.get());
+    EXPECT_EQ(1u, flusher.getNumClients());
+
+    flusher.unregisterClient(&client);
+    EXPECT_EQ(0u, flusher.getNumClients());
+}
+
+TEST(DeferredSubmissionFlusherTest, givenDeferredSubmissionNotifiedWhenFlushingClientsOfCsrThenOnlyClientsSubmittingToThatCsrAreFlushedWithoutStaleCheck) {
+    MockDeferredSubmissionFlusher flusher(std::chrono::microseconds(std::chrono::seconds(60)));
+    MockDeferredSubmissionClient client0;
+    MockDeferredSubmissionClient client1;
+    MockDeferredSubmissionClient client2;
+    client0.csr = reinterpret_cast<CommandStreamReceiver *>(0x1000);
+    client1.csr = reinterpret_cast<CommandStreamReceiver *>(0x1000);
+    client2.csr = reinterpret_cast<CommandStreamReceiver *>(0x2000);
+    flusher.registerClient(&client0);
+    flusher.registerClient(&client1);
+    flusher.registerClient(&client2);
+    flusher.notifyDeferredSubmission();
+
+    flusher.flushClientsOf(client0.csr);
+    EXPECT_EQ(1u, client0.flushCalled);
+    EXPECT_EQ(1u, client1.flushCalled);
+    EXPECT_EQ(0u, client2.flushCalled);
+
+    flusher.unregisterClient(&client0);
+    flusher.flushClientsOf(client1.csr);
+    EXPECT_EQ(1u, client0.flushCalled);
+    EXPECT_EQ(2u, client1.flushCalled);
+    EXPECT_EQ(0u, client2.flushCalled);
+
+    flusher.flushClientsOf(client2.csr);
+    EXPECT_EQ(1u, client2.flushCalled);
+    EXPECT_EQ(0u, client2.staleFlushCalled);
+
+    flusher.unregisterClient(&client1);
+    flusher.unregisterClient(&client2);
+}
+
+TEST(DeferredSubmissionFlusherTest, givenNoDeferredSubmissionNotifiedWhenFlushingClientsOfCsrThenClientsAreNotFlushed) {
+    MockDeferredSubmissionFlusher flusher(std::chrono::microseconds(std::chrono::seconds(60)));
+    MockDeferredSubmissionClient client;
+    client.csr = reinterpret_cast<CommandStreamReceiver *>(0x1000);
+    flusher.registerClient(&client);
+
+    flusher.flushClientsOf(client.csr);
+    EXPECT_EQ(0u, client.flushCalled);
+
+    flusher.unregisterClient(&client);
+}
+
+TEST(DeferredSubmissionFlusherTest, givenNoDeferredSubmissionNotifiedWhenIdleIntervalPassesThenClientsAreNotFlushed) {
+    MockDeferredSubmissionFlusher flusher(std::chrono::microseconds(0));
+    MockDeferredSubmissionClient client;
+    flusher.registerClient(&client);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    EXPECT_EQ(0u, flusher.getNumIdleFlushRounds());
+    EXPECT_EQ(0u, client.staleFlushCalled);
+
+    flusher.unregisterClient(&client);
+}
+
+TEST(DeferredSubmissionFlusherTest, givenDeferredSubmissionNotifiedWhenIdleIntervalPassesThenStaleSubmissionsAreFlushedByFlusherThread) {
+    MockDeferredSubmissionFlusher flusher(std::chrono::microseconds(100));
+    MockDeferredSubmissionClient client;
+    flusher.registerClient(&client);
+
+    flusher.notifyDeferredSubmission();
+    while (client.staleFlushCalled == 0) {
+        std::this_thread::yield();
+    }
+
+    flusher.unregisterClient(&client);
+    EXPECT_EQ(0u, client.flushCalled);
+    EXPECT_LE(1u, flusher.getNumIdleFlushRounds());
+}
+
+TEST(DeferredSubmissionFlusherTest, givenClientStillDeferringAfterIdleFlushWhenRoundEndsThenFlusherKeepsFlushingUntilNothingIsDeferred) {
+    MockDeferredSubmissionFlusher flusher(std::chrono::microseconds(10));
+    MockDeferredSubmissionClient client;
+    client.remainingDeferredRounds = 2;
+    flusher.registerClient(&client);
+
+    flusher.notifyDeferredSubmission();
+    while (client.staleFlushCalled < 3) {
+        std::this_thread::yield();
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    flusher.unregisterClient(&client);
+    EXPECT_EQ(3u, client.staleFlushCalled);
+    EXPECT_EQ(3u, flusher.getNumIdleFlushRounds());
+}
@@ -31,18 +31,26 @@ class HeapAllocatorUnderTest : public HeapAllocator {
     size_t getThresholdSize() const { return this->sizeThreshold; }
     using HeapAllocator::defragment;
 
-    uint64_t getFromFreedChunks(size_t size, std::vector<HeapChunk> &vec, size_t requiredAlignment) {
+    uint64_t getFromFreedChunks(size_t size, FreedHeapChunks &freedChunks, size_t requiredAlignment) {
         size_t sizeOfFreedChunk;
-        return HeapAllocator::getFromFreedChunks(size, vec, sizeOfFreedChunk, requiredAlignment);
+        return HeapAllocator::getFromFreedChunks(size, freedChunks, sizeOfFreedChunk, requiredAlignment);
     }
-    void storeInFreedChunks(uint64_t ptr, size_t size, std::vector<HeapChunk> &vec) { return HeapAllocator::storeInFreedChunks(ptr, size, vec); }
+    void storeInFreedChunks(uint64_t ptr, size_t size, FreedHeapChunks &freedChunks) { return HeapAllocator::storeInFreedChunks(ptr, size, freedChunks); }
 
-    std::vector<HeapChunk> &getFreedChunksSmall() { return this->freedChunksSmall; };
-    std::vector<HeapChunk> &getFreedChunksBig() { return this->freedChunksBig; };
+    FreedHeapChunks &getFreedChunksSmall() { return this->freedChunksSmall; };
+    FreedHeapChunks &getFreedChunksBig() { return this->freedChunksBig; };
 
     using HeapAllocator::allocationAlignment;
 };
 
+std::vector<HeapChunk> getChunksInAddressOrder(const FreedHeapChunks &freedChunks) {
+    std::vector<HeapChunk> chunks;
+    for (auto &chunk : freedChunks.chunksByAddress) {
+        chunks.emplace_back(chunk.first, chunk.second);
+    }
+    return chunks;
+}
+
 TEST(HeapAllocatorTest, WhenHeapAllocatorIsCreatedWithAlignmentThenAlignmentIsSet) {
     uint64_t ptrBase = 0x100000llu;
     size_t size = 1024 * 4096;
@@ -79,10 +87,10 @@ TEST(HeapAllocatorTest, GivenExactSizeChunkInFreedChunksWhenGetIsCalledThenChunk
     size_t size = 1024 * 4096;
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreedHeapChunks freedChunks;
     uint64_t ptrFreed = 0x101000llu;
     size_t sizeFreed = MemoryConstants::pageSize * 2;
-    freedChunks.emplace_back(ptrFreed, sizeFreed);
+    freedChunks.insert(ptrFreed, sizeFreed);
 
     auto ptrReturned = heapAllocator->getFromFreedChunks(sizeFreed, freedChunks, allocationAlignment);
 
@@ -95,15 +103,15 @@ TEST(HeapAllocatorTest, GivenOnlySmallerSizeChunksInFreedChunksWhenGetIsCalledTh
     size_t size = 1024 * 4096;
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreedHeapChunks freedChunks;
 
-    freedChunks.emplace_back(0x100000llu, 4096);
-    freedChunks.emplace_back(0x101000llu, 4096);
-    freedChunks.emplace_back(0x105000llu, 4096);
-    freedChunks.emplace_back(0x104000llu, 4096);
-    freedChunks.emplace_back(0x102000llu, 8192);
-    freedChunks.emplace_back(0x109000llu, 8192);
-    freedChunks.emplace_back(0x107000llu, 4096);
+    freedChunks.insert(0x100000llu, 4096);
+    freedChunks.insert(0x101000llu, 4096);
+    freedChunks.insert(0x105000llu, 4096);
+    freedChunks.insert(0x104000llu, 4096);
+    freedChunks.insert(0x102000llu, 8192);
+    freedChunks.insert(0x109000llu, 8192);
+    freedChunks.insert(0x107000llu, 4096);
 
     EXPECT_EQ(7u, freedChunks.size());
 
@@ -113,28 +121,28 @@ TEST(HeapAllocatorTest, GivenOnlySmallerSizeChunksInFreedChunksWhenGetIsCalledTh
     EXPECT_EQ(7u, freedChunks.size());
 }
 
-TEST(HeapAllocatorTest, GivenOnlyBiggerSizeChunksInFreedChunksWhenGetIsCalledThenBestFitChunkIsReturned) {
+TEST(HeapAllocatorTest, GivenOnlyBiggerSizeChunksInFreedChunksWhenGetIsCalledThenBestFitChunkWithLowestAddressIsReturned) {
     uint64_t ptrBase = 0x100000llu;
     size_t size = 1024 * 4096;
     auto pUpperBound = ptrBase + size;
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreedHeapChunks freedChunks;
     uint64_t ptrExpected = 0llu;
 
     pUpperBound -= 4096;
-    freedChunks.emplace_back(pUpperBound, 4096);
+    freedChunks.insert(pUpperBound, 4096);
     pUpperBound -= 5 * 4096;
-    freedChunks.emplace_back(pUpperBound, 5 * 4096);
+    freedChunks.insert(pUpperBound, 5 * 4096);
     pUpperBound -= 4 * 4096;
-    freedChunks.emplace_back(pUpperBound, 4 * 4096);
-    ptrExpected = pUpperBound;
+    freedChunks.insert(pUpperBound, 4 * 4096);
 
     pUpperBound -= 5 * 4096;
-    freedChunks.emplace_back(pUpperBound, 5 * 4096);
+    freedChunks.insert(pUpperBound, 5 * 4096);
     pUpperBound -= 4 * 4096;
-    freedChunks.emplace_back(pUpperBound, 4 * 4096);
+    freedChunks.insert(pUpperBound, 4 * 4096);
+    ptrExpected = pUpperBound;
 
     EXPECT_EQ(5u, freedChunks.size());
 
@@ -151,15 +159,15 @@ TEST(HeapAllocatorTest, GivenOnlyMoreThanTwiceBiggerSizeChunksInFreedChunksWhenG
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreedHeapChunks freedChunks;
     uint64_t ptrExpected = 0llu;
     size_t requestedSize = 3 * 4096;
 
-    freedChunks.emplace_back(pLowerBound, 4096);
+    freedChunks.insert(pLowerBound, 4096);
     pLowerBound += 4096;
-    freedChunks.emplace_back(pLowerBound, 9 * 4096);
+    freedChunks.insert(pLowerBound, 9 * 4096);
     pLowerBound += 9 * 4096;
-    freedChunks.emplace_back(pLowerBound, 7 * 4096);
+    freedChunks.insert(pLowerBound, 7 * 4096);
 
     size_t deltaSize = 7 * 4096 - requestedSize;
     ptrExpected = pLowerBound + deltaSize;
@@ -171,8 +179,8 @@ TEST(HeapAllocatorTest, GivenOnlyMoreThanTwiceBiggerSizeChunksInFreedChunksWhenG
     EXPECT_EQ(ptrExpected, ptrReturned);
     EXPECT_EQ(3u, freedChunks.size());
 
-    EXPECT_EQ(pLowerBound, freedChunks[2].ptr);
-    EXPECT_EQ(deltaSize, freedChunks[2].size);
+    EXPECT_EQ(pLowerBound, getChunksInAddressOrder(freedChunks)[2].ptr);
+    EXPECT_EQ(deltaSize, getChunksInAddressOrder(freedChunks)[2].size);
 }
 
 TEST(HeapAllocatorTest, GivenMoreThanTwiceBiggerSizeChunksInFreedChunksWhenGetIsCalledAndAlignmentDoesNotThenNullIsReturned) {
@@ -184,13 +192,13 @@ TEST(HeapAllocatorTest, GivenMoreThanTwiceBiggerSizeChunksInFreedChunksWhenGetIs
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreedHeapChunks freedChunks;
     uint64_t ptrExpected = 0llu;
     size_t requestedSize = 2 * 4096;
 
-    freedChunks.emplace_back(pLowerBound, 9 * 4096);
+    freedChunks.insert(pLowerBound, 9 * 4096);
     pLowerBound += 9 * 4096;
-    freedChunks.emplace_back(pLowerBound, 3 * 4096);
+    freedChunks.insert(pLowerBound, 3 * 4096);
 
     EXPECT_EQ(2u, freedChunks.size());
 
@@ -207,18 +215,18 @@ TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToLeftBoundaryOfIncomingChunkWhe
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreedHeapChunks freedChunks;
     uint64_t ptrExpected = 0llu;
     size_t expectedSize = 9 * 4096;
 
-    freedChunks.emplace_back(pLowerBound, 4096);
+    freedChunks.insert(pLowerBound, 4096);
     pLowerBound += 4096;
-    freedChunks.emplace_back(pLowerBound, 9 * 4096);
+    freedChunks.insert(pLowerBound, 9 * 4096);
     ptrExpected = pLowerBound;
     pLowerBound += 9 * 4096;
 
-    EXPECT_EQ(ptrExpected, freedChunks[1].ptr);
-    EXPECT_EQ(expectedSize, freedChunks[1].size);
+    EXPECT_EQ(ptrExpected, getChunksInAddressOrder(freedChunks)[1].ptr);
+    EXPECT_EQ(expectedSize, getChunksInAddressOrder(freedChunks)[1].size);
 
     EXPECT_EQ(2u, freedChunks.size());
 
@@ -231,8 +239,8 @@ TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToLeftBoundaryOfIncomingChunkWhe
 
     EXPECT_EQ(2u, freedChunks.size());
 
-    EXPECT_EQ(ptrExpected, freedChunks[1].ptr);
-    EXPECT_EQ(expectedSize, freedChunks[1].size);
+    EXPECT_EQ(ptrExpected, getChunksInAddressOrder(freedChunks)[1].ptr);
+    EXPECT_EQ(expectedSize, getChunksInAddressOrder(freedChunks)[1].size);
 }
 
 TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToRightBoundaryOfIncomingChunkWhenStoreIsCalledThenChunkIsMerged) {
@@ -242,11 +250,11 @@ TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToRightBoundaryOfIncomingChunkWh
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreedHeapChunks freedChunks;
     uint64_t ptrExpected = 0llu;
     size_t expectedSize = 9 * 4096;
 
-    freedChunks.emplace_back(pLowerBound, 4096);
+    freedChunks.insert(pLowerBound, 4096);
     pLowerBound += 4096;
     pLowerBound += 4096; // space between stored chunk and chunk to store
 
@@ -254,11 +262,11 @@ TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToRightBoundaryOfIncomingChunkWh
     size_t sizeToStore = 2 * 4096;
     pLowerBound += sizeToStore;
 
-    freedChunks.emplace_back(pLowerBound, 9 * 4096);
+    freedChunks.insert(pLowerBound, 9 * 4096);
     ptrExpected = pLowerBound;
 
-    EXPECT_EQ(ptrExpected, freedChunks[1].ptr);
-    EXPECT_EQ(expectedSize, freedChunks[1].size);
+    EXPECT_EQ(ptrExpected, getChunksInAddressOrder(freedChunks)[1].ptr);
+    EXPECT_EQ(expectedSize, getChunksInAddressOrder(freedChunks)[1].size);
 
     EXPECT_EQ(2u, freedChunks.size());
 
@@ -269,8 +277,8 @@ TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToRightBoundaryOfIncomingChunkWh
 
     EXPECT_EQ(2u, freedChunks.size());
 
-    EXPECT_EQ(ptrExpected, freedChunks[1].ptr);
-    EXPECT_EQ(expectedSize, freedChunks[1].size);
+    EXPECT_EQ(ptrExpected, getChunksInAddressOrder(freedChunks)[1].ptr);
+    EXPECT_EQ(expectedSize, getChunksInAddressOrder(freedChunks)[1].size);
 }
 
 TEST(HeapAllocatorTest, GivenStoredChunkNotAdjacentToIncomingChunkWhenStoreIsCalledThenNewFreeChunkIsCreated) {
@@ -280,11 +288,11 @@ TEST(HeapAllocatorTest, GivenStoredChunkNotAdjacentToIncomingChunkWhenStoreIsCal
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreedHeapChunks freedChunks;
 
-    freedChunks.emplace_back(pLowerBound, 4096);
+    freedChunks.insert(pLowerBound, 4096);
     pLowerBound += 4096;
-    freedChunks.emplace_back(pLowerBound, 9 * 4096);
+    freedChunks.insert(pLowerBound, 9 * 4096);
     pLowerBound += 9 * 4096;
 
     pLowerBound += 9 * 4096;
@@ -298,8 +306,8 @@ TEST(HeapAllocatorTest, GivenStoredChunkNotAdjacentToIncomingChunkWhenStoreIsCal
 
     EXPECT_EQ(3u, freedChunks.size());
 
-    EXPECT_EQ(ptrToStore, freedChunks[2].ptr);
-    EXPECT_EQ(sizeToStore, freedChunks[2].size);
+    EXPECT_EQ(ptrToStore, getChunksInAddressOrder(freedChunks)[2].ptr);
+    EXPECT_EQ(sizeToStore, getChunksInAddressOrder(freedChunks)[2].size);
 }
 
 TEST(HeapAllocatorTest, GivenStoredChunkExpandableByIncomingChunkWhenStoreIsCalledThenChunksAreMerged) {
@@ -307,10 +315,10 @@ TEST(HeapAllocatorTest, GivenStoredChunkExpandableByIncomingChunkWhenStoreIsCall
     size_t size = 1024 * 4096;
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreedHeapChunks freedChunks;
 
-    freedChunks.emplace_back(0x100000llu, 4096);
-    freedChunks.emplace_back(0x103000llu, 4096);
+    freedChunks.insert(0x100000llu, 4096);
+    freedChunks.insert(0x103000llu, 4096);
 
     EXPECT_EQ(2u, freedChunks.size());
 
@@ -781,7 +789,7 @@ TEST(HeapAllocatorTest, WhenMemoryIsAllocatedThenAllocationsDoNotOverlap) {
     alignedFree(pBasePtr);
 }
 
-TEST(HeapAllocatorTest, GivenLargeAllocationsWhenFreeingThenSpaceIsDefragmented) {
+TEST(HeapAllocatorTest, GivenLargeAllocationsWhenFreeingThenAdjacentChunksAreCoalescedOnFree) {
     uint64_t ptrBase = 0x100000llu;
     uint64_t basePtr = 0x100000llu;
     size_t size = 1024 * 4096;
@@ -793,7 +801,7 @@ TEST(HeapAllocatorTest, GivenLargeAllocationsWhenFreeingThenSpaceIsDefragmented)
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, threshold);
 
-    std::vector<HeapChunk> &freedChunks = heapAllocator->getFreedChunksBig();
+    FreedHeapChunks &freedChunks = heapAllocator->getFreedChunksBig();
 
     // 0, 1, 2 - can be merged to one
     // 6,7,8,10 - can be merged to one
@@ -820,24 +828,18 @@ TEST(HeapAllocatorTest, GivenLargeAllocationsWhenFreeingThenSpaceIsDefragmented)
     heapAllocator->free(ptrs[7], allocSize);
     heapAllocator->free(ptrs[8], doubleallocSize);
 
-    // 0,1  merged on free,
-    // 2
-    // 6,7 - merged on free
-    // 8, 10 - merged on free
-    EXPECT_EQ(4u, freedChunks.size());
-
-    heapAllocator->defragment();
-
+    // 0, 1, 2 - merged on free
+    // 6, 7, 8, 10 - merged on free
     ASSERT_EQ(2u, freedChunks.size());
 
-    EXPECT_EQ(basePtr, freedChunks[0].ptr);
-    EXPECT_EQ(3 * allocSize, freedChunks[0].size);
+    EXPECT_EQ(basePtr, getChunksInAddressOrder(freedChunks)[0].ptr);
+    EXPECT_EQ(3 * allocSize, getChunksInAddressOrder(freedChunks)[0].size);
 
-    EXPECT_EQ((basePtr + 6 * allocSize), freedChunks[1].ptr);
-    EXPECT_EQ(5 * allocSize, freedChunks[1].size);
+    EXPECT_EQ((basePtr + 6 * allocSize), getChunksInAddressOrder(freedChunks)[1].ptr);
+    EXPECT_EQ(5 * allocSize, getChunksInAddressOrder(freedChunks)[1].size);
 }
 
-TEST(HeapAllocatorTest, GivenSmallAllocationsWhenFreeingThenSpaceIsDefragmented) {
+TEST(HeapAllocatorTest, GivenSmallAllocationsWhenFreeingThenAdjacentChunksAreCoalescedOnFree) {
     uint64_t ptrBase = 0x100000llu;
     uint64_t basePtr = 0x100000;
 
@@ -850,7 +852,7 @@ TEST(HeapAllocatorTest, GivenSmallAllocationsWhenFreeingThenSpaceIsDefragmented)
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, threshold);
 
-    std::vector<HeapChunk> &freedChunks = heapAllocator->getFreedChunksSmall();
+    FreedHeapChunks &freedChunks = heapAllocator->getFreedChunksSmall();
 
     // 0, 1, 2 - can be merged to one
     // 6,7,8,10 - can be merged to one
@@ -877,21 +879,15 @@ TEST(HeapAllocatorTest, GivenSmallAllocationsWhenFreeingThenSpaceIsDefragmented)
     heapAllocator->free(ptrs[7], allocSize);
     heapAllocator->free(ptrs[10], allocSize);
 
-    // 0,1  merged on free,
-    // 2
-    // 6, - merged on free
-    // 7, 8, 10 - merged on free
-    EXPECT_EQ(4u, freedChunks.size());
-
-    heapAllocator->defragment();
-
+    // 0, 1, 2 - merged on free
+    // 6, 7, 8, 10 - merged on free
     ASSERT_EQ(2u, freedChunks.size());
 
-    EXPECT_EQ((upperLimitPtr - 3 * allocSize), freedChunks[0].ptr);
-    EXPECT_EQ(3 * allocSize, freedChunks[0].size);
+    EXPECT_EQ((upperLimitPtr - 10 * allocSize), getChunksInAddressOrder(freedChunks)[0].ptr);
+    EXPECT_EQ(5 * allocSize, getChunksInAddressOrder(freedChunks)[0].size);
 
-    EXPECT_EQ((upperLimitPtr - 10 * allocSize), freedChunks[1].ptr);
-    EXPECT_EQ(5 * allocSize, freedChunks[1].size);
+    EXPECT_EQ((upperLimitPtr - 3 * allocSize), getChunksInAddressOrder(freedChunks)[1].ptr);
+    EXPECT_EQ(3 * allocSize, getChunksInAddressOrder(freedChunks)[1].size);
 }
 
 TEST(HeapAllocatorTest, Given10SmallAllocationsWhenFreedInTheSameOrderThenLastChunkFreedReturnsWholeSpaceToFreeRange) {
@@ -901,7 +897,7 @@ TEST(HeapAllocatorTest, Given10SmallAllocationsWhenFreedInTheSameOrderThenLastCh
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, threshold);
 
-    std::vector<HeapChunk> &freedChunks = heapAllocator->getFreedChunksSmall();
+    FreedHeapChunks &freedChunks = heapAllocator->getFreedChunksSmall();
 
     uint64_t ptrs[10];
     size_t sizes[10];
@@ -937,8 +933,8 @@ TEST(HeapAllocatorTest, Given10SmallAllocationsWhenMergedToBigAllocatedAsSmallSp
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, threshold);
 
-    std::vector<HeapChunk> &freedChunksSmall = heapAllocator->getFreedChunksSmall();
-    std::vector<HeapChunk> &freedChunksBig = heapAllocator->getFreedChunksBig();
+    FreedHeapChunks &freedChunksSmall = heapAllocator->getFreedChunksSmall();
+    FreedHeapChunks &freedChunksBig = heapAllocator->getFreedChunksBig();
 
     uint64_t ptrs[10];
     size_t sizes[10];
@@ -998,8 +994,8 @@ TEST(HeapAllocatorTest, Given10SmallAllocationsWhenMergedToBigAllocatedAsSmallNo
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, threshold);
 
-    std::vector<HeapChunk> &freedChunksSmall = heapAllocator->getFreedChunksSmall();
-    std::vector<HeapChunk> &freedChunksBig = heapAllocator->getFreedChunksBig();
+    FreedHeapChunks &freedChunksSmall = heapAllocator->getFreedChunksSmall();
+    FreedHeapChunks &freedChunksBig = heapAllocator->getFreedChunksBig();
 
     uint64_t ptrs[10];
     size_t sizes[10];
@@ -1449,3 +1445,69 @@ TEST(HeapAllocatorTest, givenZeroAlignmentPassedWhenAllocatingMemoryWithCustomAl
     uint64_t ptr = heapAllocator.allocateWithCustomAlignment(ptrSize, 0u);
     EXPECT_EQ(alignUp(heapBase, allocationAlignment), ptr);
 }
+
+TEST(HeapAllocatorTest, givenChunkFreedBetweenTwoFreedChunksWhenStoringThenAllThreeChunksAreCoalesced) {
+    uint64_t ptrBase = 0x100000llu;
+    size_t size = 1024 * 4096;
+    auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
+
+    FreedHeapChunks freedChunks;
+    heapAllocator->storeInFreedChunks(0x100000llu, 4096, freedChunks);
+    heapAllocator->storeInFreedChunks(0x102000llu, 2 * 4096, freedChunks);
+    EXPECT_EQ(2u, freedChunks.size());
+
+    heapAllocator->storeInFreedChunks(0x101000llu, 4096, freedChunks);
+    ASSERT_EQ(1u, freedChunks.size());
+    EXPECT_EQ(0x100000llu, getChunksInAddressOrder(freedChunks)[0].ptr);
+    EXPECT_EQ(4 * 4096u, getChunksInAddressOrder(freedChunks)[0].size);
+    EXPECT_EQ(1u, freedChunks.chunksBySize.size());
+}
+
+TEST(HeapAllocatorTest, givenSplittableChunkWithUnalignedTailAndAlignedBiggerChunkWhenGetIsCalledThenAlignedChunkIsUsedAndFirstChunkIsNotModified) {
+    uint64_t ptrBase = 0x100000llu;
+    size_t size = 1024 * 4096;
+    auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
+
+    FreedHeapChunks freedChunks;
+    freedChunks.insert(0x100000llu, 9 * 4096);
+    freedChunks.insert(0x200000llu, 16 * 4096);
+
+    auto ptrReturned = heapAllocator->getFromFreedChunks(4 * 4096, freedChunks, 4 * 4096);
+
+    EXPECT_EQ(0x200000llu + 12 * 4096, ptrReturned);
+    ASSERT_EQ(2u, freedChunks.size());
+    EXPECT_EQ(9 * 4096u, getChunksInAddressOrder(freedChunks)[0].size);
+    EXPECT_EQ(12 * 4096u, getChunksInAddressOrder(freedChunks)[1].size);
+}
+
+TEST(HeapAllocatorTest, givenRandomAllocationsAndFreesWhenAllMemoryIsFreedThenNoFreedChunksRemainAndWholeHeapIsAvailable) {
+    uint64_t ptrBase = 0x100000llu;
+    size_t size = 1024 * 4096;
+    auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
+
+    std::mt19937 generator(0u);
+    std::uniform_int_distribution<size_t> pagesDistribution(1u, 32u);
+    std::vector<std::pair<uint64_t, size_t>> allocations;
+    for (uint32_t iteration = 0u; iteration < 512u; ++iteration) {
+        if (!allocations.empty() && (generator() % 3 == 0)) {
+            auto index = generator() % allocations.size();
+            heapAllocator->free(allocations[index].first, allocations[index].second);
+            allocations.erase(allocations.begin() + index);
+            continue;
+        }
+        size_t allocationSize = pagesDistribution(generator) * MemoryConstants::pageSize;
+        auto ptr = heapAllocator->allocate(allocationSize);
+        if (ptr != 0llu) {
+            allocations.emplace_back(ptr, allocationSize);
+        }
+    }
+    for (auto &allocation : allocations) {
+        heapAllocator->free(allocation.first, allocation.second);
+    }
+
+    EXPECT_EQ(0u, heapAllocator->getFreedChunksSmall().size());
+    EXPECT_EQ(0u, heapAllocator->getFreedChunksBig().size());
+    EXPECT_EQ(size, heapAllocator->getLeftSize());
+    EXPECT_EQ(ptrBase, heapAllocator->getLeftBound());
+    EXPECT_EQ(ptrBase + size, heapAllocator->getRightBound());
+}
@@ -0,0 +1,179 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/os_thread.h"
+#include "shared/source/utilities/host_wait_multiplexer.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+
+#include "gtest/gtest.h"
+
+#include <array>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+class MockHostWaitMultiplexer : public HostWaitMultiplexer {
+  public:
+    using HostWaitMultiplexer::getNextPollInterval;
+    using HostWaitMultiplexer::HostWaitMultiplexer;
+    using HostWaitMultiplexer::pollerThread;
+};
+
+TEST(HostWaitMultiplexerTest, givenDefaultDebugSettingsWhenCheckingIfEnabledThenFalseIsReturned) {
+    DebugManagerStateRestore restorer;
+    EXPECT_FALSE(HostWaitMultiplexer::isEnabled());
+
+    DebugManager.flags.EnableHostWaitMultiplexer.set(1);
+    EXPECT_TRUE(HostWaitMultiplexer::isEnabled());
+
+    DebugManager.flags.EnableHostWaitMultiplexer.set(0);
+    EXPECT_FALSE(HostWaitMultiplexer::isEnabled());
+}
+
+TEST(HostWaitMultiplexerTest, givenAlreadyCompletedCheckWhenWaitingThenTrueIsReturnedWithoutStartingPollerThread) {
+    MockHostWaitMultiplexer multiplexer(std::chrono::microseconds(0));
+
+    EXPECT_TRUE(multiplexer.wait([]() { return true; }, std::chrono::microseconds(0)));
+    EXPECT_EQ(nullptr, multiplexer.pollerThread.get());
+    EXPECT_EQ(0u, multiplexer.getNumPollRounds());
+    EXPECT_EQ(0u, multiplexer.getNumWaiters());
+}
+
+TEST(HostWaitMultiplexerTest, givenNeverCompletingCheckWhenWaitingThenFalseIsReturnedAfterTimeoutAndWaiterIsUnregistered) {
+    MockHostWaitMultiplexer multiplexer(std::chrono::microseconds(0));
+
+    EXPECT_FALSE(multiplexer.wait([]() { return false; }, std::chrono::microseconds(1000)));
+    EXPECT_NE(nullptr, multiplexer.pollerThread.get());
+    EXPECT_EQ(0u, multiplexer.getNumWaiters());
+    EXPECT_EQ(0u, multiplexer.getNumWakeups());
+}
+
+TEST(HostWaitMultiplexerTest, givenWaiterParkedWhenCompletionIsSignaledFromOtherThreadThenWaiterIsWokenByPoller) {
+    MockHostWaitMultiplexer multiplexer(std::chrono::microseconds(0));
+    std::atomic<bool> completed{false};
+
+    std::thread signalingThread([&]() {
+        while (multiplexer.getNumWaiters() == 0) {
+            std::this_thread::yield();
+        }
+        completed.store(true);
+    });
+
+    EXPECT_TRUE(multiplexer.wait([&]() { return completed.load(); }, std::chrono::microseconds(std::chrono::seconds(60))));
+    signalingThread.join();
+
+    EXPECT_EQ(1u, multiplexer.getNumWakeups());
+    EXPECT_LE(1u, multiplexer.getNumPollRounds());
+    EXPECT_EQ(0u, multiplexer.getNumWaiters());
+}
+
+TEST(HostWaitMultiplexerTest, givenManyWaitersOnDifferentCompletionsWhenCompletionsAreSignaledOneByOneThenEachWaiterIsWokenOnce) {
+    constexpr size_t waitersCount = 16;
+    MockHostWaitMultiplexer multiplexer(std::chrono::microseconds(10));
+    std::array<std::atomic<bool>, waitersCount> completions = {};
+    std::array<std::atomic<bool>, waitersCount> results = {};
+
+    std::vector<std::thread> waitingThreads;
+    for (size_t i = 0; i < waitersCount; i++) {
+        waitingThreads.emplace_back([&, i]() {
+            results[i] = multiplexer.wait([&, i]() { return completions[i].load(); }, std::chrono::microseconds(std::chrono::seconds(60)));
+        });
+    }
+
+    while (multiplexer.getNumWaiters() != waitersCount) {
+        std::this_thread::yield();
+    }
+
+    for (size_t i = 0; i < waitersCount; i++) {
+        completions[i].store(true);
+        waitingThreads[i].join();
+        EXPECT_TRUE(results[i]);
+        EXPECT_EQ(waitersCount - i - 1, multiplexer.getNumWaiters());
+    }
+
+    EXPECT_EQ(waitersCount, multiplexer.getNumWakeups());
+}
+
+TEST(HostWaitMultiplexerTest, givenNoWaitersWhenPollerThreadIsStartedThenPollerSleepsUntilNextWaiterIsRegistered) {
+    MockHostWaitMultiplexer multiplexer(std::chrono::microseconds(0));
+
+    EXPECT_FALSE(multiplexer.wait([]() { return false; }, std::chrono::microseconds(100)));
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    auto pollRoundsWithoutWaiters = multiplexer.getNumPollRounds();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_EQ(pollRoundsWithoutWaiters, multiplexer.getNumPollRounds());
+
+    uint32_t checksCount = 0;
+    EXPECT_TRUE(multiplexer.wait([&]() { return ++checksCount == 3; }, std::chrono::microseconds(std::chrono::seconds(60))));
+    EXPECT_LT(pollRoundsWithoutWaiters, multiplexer.getNumPollRounds());
+}
+
+TEST(HostWaitMultiplexerTest, givenSlowCompletionCheckWhenOtherWaiterRegistersThenRegistrationIsNotBlockedByCheck) {
+    MockHostWaitMultiplexer multiplexer(std::chrono::microseconds(0));
+    std::atomic<bool> slowCheckEntered{false};
+
+    std::thread slowWaiterThread([&]() {
+        uint32_t checksCount = 0;
+        EXPECT_TRUE(multiplexer.wait([&]() {
+            if (checksCount++ == 0) {
+                return false;
+            }
+            slowCheckEntered = true;
+            while (multiplexer.getNumWaiters() < 2) {
+                std::this_thread::yield();
+            }
+            return true;
+        },
+                                     std::chrono::microseconds(std::chrono::seconds(60))));
+    });
+
+    while (!slowCheckEntered) {
+        std::this_thread::yield();
+    }
+    uint32_t checksCount = 0;
+    EXPECT_TRUE(multiplexer.wait([&]() { return checksCount++ > 0; }, std::chrono::microseconds(std::chrono::seconds(60))));
+    slowWaiterThread.join();
+    EXPECT_EQ(2u, multiplexer.getNumWakeups());
+    EXPECT_EQ(0u, multiplexer.getNumWaiters());
+}
+
+TEST(HostWaitMultiplexerTest, givenCheckInProgressWhenWaitTimesOutThenWaitReturnsOnlyAfterCheckFinished) {
+    MockHostWaitMultiplexer multiplexer(std::chrono::microseconds(0));
+    std::atomic<uint32_t> checksCount{0};
+    std::atomic<bool> checkRunning{false};
+
+    bool result = multiplexer.wait([&]() {
+        if (checksCount++ == 0) {
+            return false;
+        }
+        checkRunning = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        checkRunning = false;
+        return true;
+    },
+                                   std::chrono::microseconds(1000));
+
+    EXPECT_FALSE(checkRunning);
+    EXPECT_EQ(checksCount > 1u, result);
+    EXPECT_EQ(0u, multiplexer.getNumWaiters());
+}
+
+TEST(HostWaitMultiplexerTest, givenPollRoundsWithoutWakeupsWhenComputingPollIntervalThenIntervalBacksOffUpToMaxAndResetsOnWakeup) {
+    MockHostWaitMultiplexer multiplexer(std::chrono::microseconds(100));
+
+    auto interval = multiplexer.getNextPollInterval(std::chrono::microseconds(100), 0);
+    EXPECT_EQ(std::chrono::microseconds(200), interval);
+    for (uint32_t i = 0; i < 10; i++) {
+        interval = multiplexer.getNextPollInterval(interval, 0);
+    }
+    EXPECT_EQ(HostWaitMultiplexer::maxPollInterval, interval);
+    EXPECT_EQ(std::chrono::microseconds(100), multiplexer.getNextPollInterval(interval, 1));
+
+    MockHostWaitMultiplexer yieldingMultiplexer(std::chrono::microseconds(0));
+    EXPECT_EQ(std::chrono::microseconds(0), yieldingMultiplexer.getNextPollInterval(std::chrono::microseconds(0), 0));
+}
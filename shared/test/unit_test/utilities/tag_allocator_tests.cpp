@@ -20,13 +20,17 @@
 
 #include "gtest/gtest.h"
 
+#include <atomic>
 #include <cstdint>
+#include <thread>
+#include <vector>
 
 using namespace NEO;
 
 struct TagAllocatorTest : public Test<MemoryAllocatorFixture> {
     void SetUp() override {
         DebugManager.flags.CreateMultipleSubDevices.set(4);
+        DebugManager.flags.TagAllocatorThreadCacheSize.set(0);
         MemoryAllocatorFixture::setUp();
     }
 
@@ -85,7 +89,7 @@ class MockTagAllocator : public TagAllocator<TagType> {
     using BaseClass::returnTagToDeferredPool;
     using BaseClass::rootDeviceIndices;
     using BaseClass::TagAllocator;
-    using BaseClass::usedTags;
+    using BaseClass::threadCacheSize;
     using BaseClass::TagAllocatorBase::cleanUpResources;
 
     MockTagAllocator(uint32_t rootDeviceIndex, MemoryManager *memoryManager, size_t tagCount,
@@ -106,11 +110,7 @@ class MockTagAllocator : public TagAllocator<TagType> {
     }
 
     TagNodeT *getFreeTagsHead() {
-        return this->freeTags.peekHead();
-    }
-
-    TagNodeT *getUsedTagsHead() {
-        return this->usedTags.peekHead();
+        return static_cast<TagNodeT *>(this->freeTags.peekHead());
     }
 
     size_t getGraphicsAllocationsCount() {
@@ -134,41 +134,53 @@ TEST_F(TagAllocatorTest, WhenTagAllocatorIsCreatedThenItIsCorrectlyInitialized)
     ASSERT_NE(nullptr, tagAllocator.getGraphicsAllocation());
 
     ASSERT_NE(nullptr, tagAllocator.getFreeTagsHead());
-    EXPECT_EQ(nullptr, tagAllocator.getUsedTagsHead());
 
     void *gfxMemory = tagAllocator.getGraphicsAllocation()->getUnderlyingBuffer();
     void *head = reinterpret_cast<void *>(tagAllocator.getFreeTagsHead()->tagForCpuAccess);
     EXPECT_EQ(gfxMemory, head);
 }
 
-TEST_F(TagAllocatorTest, WhenGettingAndReturningTagThenFreeAndUsedListsAreUpdated) {
+TEST_F(TagAllocatorTest, WhenGettingAndReturningTagThenFreeListIsUpdated) {
 
     MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 10, 16, deviceBitfield);
 
     ASSERT_NE(nullptr, tagAllocator.getGraphicsAllocation());
     ASSERT_NE(nullptr, tagAllocator.getFreeTagsHead());
-    EXPECT_EQ(nullptr, tagAllocator.getUsedTagsHead());
 
     auto tagNode = static_cast<TagNode<TimeStamps> *>(tagAllocator.getTag());
 
     EXPECT_NE(nullptr, tagNode);
 
-    IDList<TagNode<TimeStamps>> &freeList = tagAllocator.freeTags;
-    IDList<TagNode<TimeStamps>> &usedList = tagAllocator.usedTags;
+    auto &freeList = tagAllocator.freeTags;
 
-    bool isFoundOnUsedList = usedList.peekContains(*tagNode);
-    bool isFoundOnFreeList = freeList.peekContains(*tagNode);
-
-    EXPECT_FALSE(isFoundOnFreeList);
-    EXPECT_TRUE(isFoundOnUsedList);
+    EXPECT_FALSE(freeList.peekContains(*tagNode));
 
     tagAllocator.returnTag(tagNode);
 
-    isFoundOnUsedList = usedList.peekContains(*tagNode);
-    isFoundOnFreeList = freeList.peekContains(*tagNode);
+    EXPECT_TRUE(freeList.peekContains(*tagNode));
+}
+
+TEST_F(TagAllocatorTest, givenNodesNotAddressableByLockFreeHeadWhenReturningAndTakingTagsThenTagsAreReusedFromLockedList) {
+    DebugManager.flags.TagAllocatorThreadCacheSize.set(0);
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 2, 1, deviceBitfield);
+    tagAllocator.freeTags.enableLockedNodes();
 
-    EXPECT_TRUE(isFoundOnFreeList);
-    EXPECT_FALSE(isFoundOnUsedList);
+    auto tag0 = tagAllocator.getTag();
+    auto tag1 = tagAllocator.getTag();
+    EXPECT_TRUE(tagAllocator.freeTags.peekIsEmpty());
+
+    tagAllocator.returnTag(tag0);
+    tagAllocator.returnTag(tag1);
+    EXPECT_TRUE(tagAllocator.freeTags.peekContains(*tag0));
+    EXPECT_TRUE(tagAllocator.freeTags.peekContains(*tag1));
+
+    EXPECT_EQ(tag1, tagAllocator.getTag());
+    EXPECT_EQ(tag0, tagAllocator.getTag());
+    EXPECT_TRUE(tagAllocator.freeTags.peekIsEmpty());
+    EXPECT_EQ(1u, tagAllocator.getTagPoolCount());
+
+    tagAllocator.returnTag(tag0);
+    tagAllocator.returnTag(tag1);
 }
 
 TEST_F(TagAllocatorTest, WhenTagAllocatorIsCreatedThenItPopulatesTagsWithProperDeviceBitfield) {
@@ -233,11 +245,8 @@ TEST_F(TagAllocatorTest, givenInputTagCountWhenCreatingAllocatorThenRequestedNum
     MockTagAllocator<TimestampPackets<uint32_t, TimestampPacketConstants::preferredPacketCount>> tagAllocator(mockMemoryManager.get(), tagsCount, 1, deviceBitfield);
 
     size_t nodesFound = 0;
-    auto head = tagAllocator.freeTags.peekHead();
-
-    while (head) {
+    while (tagAllocator.freeTags.pop()) {
         nodesFound++;
-        head = head->next;
     }
     EXPECT_EQ(tagsCount, nodesFound);
 }
@@ -264,7 +273,7 @@ TEST_F(TagAllocatorTest, GivenSpecificOrderWhenReturningTagsThenFreeListIsUpdate
     EXPECT_EQ(2u, tagAllocator.getGraphicsAllocationsCount());
     EXPECT_EQ(2u, tagAllocator.getTagPoolCount());
 
-    IDList<TagNode<TimeStamps>> &freeList = tagAllocator.freeTags;
+    auto &freeList = tagAllocator.freeTags;
     bool isFoundOnFreeList = freeList.peekContains(*tagNodes[0]);
     EXPECT_FALSE(isFoundOnFreeList);
 
@@ -356,18 +365,18 @@ TEST_F(TagAllocatorTest, givenMultipleReferencesOnTagWhenReleasingThenReturnWhen
     MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 2, 1, deviceBitfield);
 
     auto tag = tagAllocator.getTag();
-    EXPECT_NE(nullptr, tagAllocator.getUsedTagsHead());
+    EXPECT_FALSE(tagAllocator.freeTags.peekContains(*tag));
     tagAllocator.returnTag(tag);
-    EXPECT_EQ(nullptr, tagAllocator.getUsedTagsHead()); // only 1 reference
+    EXPECT_TRUE(tagAllocator.freeTags.peekContains(*tag)); // only 1 reference
 
     tag = tagAllocator.getTag();
     tag->incRefCount();
-    EXPECT_NE(nullptr, tagAllocator.getUsedTagsHead());
+    EXPECT_FALSE(tagAllocator.freeTags.peekContains(*tag));
 
     tagAllocator.returnTag(tag);
-    EXPECT_NE(nullptr, tagAllocator.getUsedTagsHead()); // 1 reference left
+    EXPECT_FALSE(tagAllocator.freeTags.peekContains(*tag)); // 1 reference left
     tagAllocator.returnTag(tag);
-    EXPECT_EQ(nullptr, tagAllocator.getUsedTagsHead());
+    EXPECT_TRUE(tagAllocator.freeTags.peekContains(*tag));
 }
 
 TEST_F(TagAllocatorTest, givenNotReadyTagWhenReturnedThenMoveToFreeList) {
@@ -439,6 +448,104 @@ TEST_F(TagAllocatorTest, givenEmptyFreeListWhenAskingForNewTagThenTryToReleaseDe
     EXPECT_TRUE(tagAllocator.freeTags.peekIsEmpty()); // empty again - new pool wasnt allocated
 }
 
+TEST_F(TagAllocatorTest, givenThreadCacheEnabledWhenReturningTagsThenTagsAreReusedByReturningThreadAndHandedBackToFreeListInBulk) {
+    DebugManager.flags.TagAllocatorThreadCacheSize.set(3);
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 10, 1, deviceBitfield);
+    EXPECT_EQ(3u, tagAllocator.threadCacheSize);
+
+    TagNodeBase *tags[3] = {};
+    for (auto &tag : tags) {
+        tag = tagAllocator.getTag();
+    }
+
+    tagAllocator.returnTag(tags[0]);
+    tagAllocator.returnTag(tags[1]);
+    EXPECT_FALSE(tagAllocator.freeTags.peekContains(*tags[0]));
+    EXPECT_FALSE(tagAllocator.freeTags.peekContains(*tags[1]));
+
+    EXPECT_EQ(tags[1], tagAllocator.getTag());
+    tagAllocator.returnTag(tags[1]);
+
+    tagAllocator.returnTag(tags[2]);
+    EXPECT_TRUE(tagAllocator.freeTags.peekContains(*tags[0]));
+    EXPECT_TRUE(tagAllocator.freeTags.peekContains(*tags[1]));
+    EXPECT_TRUE(tagAllocator.freeTags.peekContains(*tags[2]));
+}
+
+TEST_F(TagAllocatorTest, givenThreadCacheEnabledWhenReturningThreadExitsThenCachedTagsAreHandedBackToFreeList) {
+    DebugManager.flags.TagAllocatorThreadCacheSize.set(16);
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 10, 1, deviceBitfield);
+
+    auto tag = tagAllocator.getTag();
+    std::thread returningThread([&]() {
+        tagAllocator.returnTag(tag);
+        EXPECT_FALSE(tagAllocator.freeTags.peekContains(*tag));
+    });
+    returningThread.join();
+
+    EXPECT_TRUE(tagAllocator.freeTags.peekContains(*tag));
+}
+
+TEST_F(TagAllocatorTest, givenThreadCacheEnabledWhenTagIsReturnedAfterThreadCachesOfExitingThreadWereDestroyedThenTagIsReturnedToFreeList) {
+    DebugManager.flags.TagAllocatorThreadCacheSize.set(16);
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 10, 1, deviceBitfield);
+
+    struct TagReturner {
+        ~TagReturner() {
+            allocator->returnTag(tag);
+        }
+        TagAllocatorBase *allocator = nullptr;
+        TagNodeBase *tag = nullptr;
+    };
+
+    TagNodeBase *tag = nullptr;
+    std::thread exitingThread([&]() {
+        // constructed before thread tag caches, so it is destroyed after them
+        thread_local TagReturner tagReturner;
+        tagReturner.allocator = &tagAllocator;
+        tagReturner.tag = tagAllocator.getTag();
+        tag = tagReturner.tag;
+    });
+    exitingThread.join();
+
+    EXPECT_TRUE(tagAllocator.freeTags.peekContains(*tag));
+}
+
+TEST_F(TagAllocatorTest, givenMultipleThreadsWhenConcurrentlyGettingAndReturningTagsThenEachTagIsOwnedByOneThreadAtATime) {
+    DebugManager.flags.TagAllocatorThreadCacheSize.set(-1);
+    constexpr uint32_t threadsCount = 8;
+    constexpr uint32_t iterationsCount = 2000;
+    constexpr uint32_t tagsPerIteration = 4;
+    constexpr uint32_t defaultThreadCacheSize = 16;
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, threadsCount * (tagsPerIteration + defaultThreadCacheSize) * 2, 1, deviceBitfield);
+
+    std::atomic<bool> ownershipViolated{false};
+    std::vector<std::thread> threads;
+    for (uint32_t thread = 0; thread < threadsCount; thread++) {
+        threads.emplace_back([&]() {
+            TagNode<TimeStamps> *tags[tagsPerIteration] = {};
+            for (uint32_t iteration = 0; iteration < iterationsCount; iteration++) {
+                for (auto &tag : tags) {
+                    tag = static_cast<TagNode<TimeStamps> *>(tagAllocator.getTag());
+                    tag->tagForCpuAccess->start = reinterpret_cast<uint64_t>(&tags);
+                }
+                for (auto &tag : tags) {
+                    if (tag->tagForCpuAccess->start != reinterpret_cast<uint64_t>(&tags)) {
+                        ownershipViolated = true;
+                    }
+                    tagAllocator.returnTag(tag);
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_FALSE(ownershipViolated);
+    EXPECT_EQ(1u, tagAllocator.getTagPoolCount());
+}
+
 TEST_F(TagAllocatorTest, givenTagAllocatorWhenGraphicsAllocationIsCreatedThenSetValidllocationType) {
     MockTagAllocator<TimestampPackets<uint32_t, TimestampPacketConstants::preferredPacketCount>> timestampPacketAllocator(mockRootDeviceIndex, memoryManager, 1, 1, sizeof(TimestampPackets<uint32_t, TimestampPacketConstants::preferredPacketCount>), false, mockDeviceBitfield);
     MockTagAllocator<HwTimeStamps> hwTimeStampsAllocator(mockRootDeviceIndex, memoryManager, 1, 1, sizeof(HwTimeStamps), false, mockDeviceBitfield);
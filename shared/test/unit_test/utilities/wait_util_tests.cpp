@@ -90,3 +90,100 @@ TEST(WaitTest, givenDebugFlagSetZeroWhenPollAddressProvidedMeetsCriteriaThenPaus
     EXPECT_TRUE(ret);
     EXPECT_EQ(oldCount + WaitUtils::waitCount, CpuIntrinsicsTests::pauseCounter);
 }
+
+TEST(WaitTest, givenCustomPredicateWhenPollAddressProvidedMeetsCriteriaThenReturnTrue) {
+    volatile uint64_t pollValue = 5u;
+    EXPECT_TRUE(WaitUtils::waitFunctionWithPredicate<const uint64_t>(&pollValue, 5u, [](uint64_t current, uint64_t expected) { return current == expected; }));
+    EXPECT_FALSE(WaitUtils::waitFunctionWithPredicate<const uint64_t>(&pollValue, 4u, [](uint64_t current, uint64_t expected) { return current == expected; }));
+}
+
+TEST(WaitTest, givenDefaultSettingsWhenSpinningOnPollAddressThenPauseDefaultTimeAndReturnWhetherCriteriaIsMet) {
+    WaitUtils::init();
+
+    volatile TagAddressType pollValue = 3u;
+
+    uint32_t oldCount = CpuIntrinsicsTests::pauseCounter.load();
+    EXPECT_TRUE(WaitUtils::spinFunction(&pollValue, 1u));
+    EXPECT_FALSE(WaitUtils::spinFunction(&pollValue, 4u));
+    EXPECT_EQ(oldCount + 2 * WaitUtils::waitCount, CpuIntrinsicsTests::pauseCounter);
+}
+
+class MockAdaptiveWaitPolicy : public WaitUtils::AdaptiveWaitPolicy {
+  public:
+    using WaitUtils::AdaptiveWaitPolicy::histogram;
+};
+
+TEST(AdaptiveWaitPolicyTest, givenWaitTimesWhenGettingBucketIndexThenLog2BucketIsReturned) {
+    EXPECT_EQ(0u, WaitUtils::AdaptiveWaitPolicy::getBucketIndex(0u));
+    EXPECT_EQ(0u, WaitUtils::AdaptiveWaitPolicy::getBucketIndex(1u));
+    EXPECT_EQ(1u, WaitUtils::AdaptiveWaitPolicy::getBucketIndex(2u));
+    EXPECT_EQ(1u, WaitUtils::AdaptiveWaitPolicy::getBucketIndex(3u));
+    EXPECT_EQ(6u, WaitUtils::AdaptiveWaitPolicy::getBucketIndex(100u));
+    EXPECT_EQ(WaitUtils::AdaptiveWaitPolicy::numHistogramBuckets - 1, WaitUtils::AdaptiveWaitPolicy::getBucketIndex(std::numeric_limits<uint64_t>::max()));
+}
+
+TEST(AdaptiveWaitPolicyTest, givenNotEnoughSamplesWhenGettingSpinTimeThenZeroIsReturned) {
+    WaitUtils::AdaptiveWaitPolicy waitPolicy;
+    for (uint32_t i = 0; i < WaitUtils::AdaptiveWaitPolicy::minSamplesToSpin - 1; i++) {
+        waitPolicy.recordWait(3u, 0u);
+    }
+    EXPECT_EQ(0u, waitPolicy.getSpinTimeUs());
+
+    waitPolicy.recordWait(3u, 0u);
+    EXPECT_EQ(4u, waitPolicy.getSpinTimeUs());
+}
+
+TEST(AdaptiveWaitPolicyTest, givenMostWaitsShortWhenGettingSpinTimeThenUpperBoundOfPercentileBucketIsReturned) {
+    WaitUtils::AdaptiveWaitPolicy waitPolicy;
+    for (uint32_t i = 0; i < 95; i++) {
+        waitPolicy.recordWait(10u, 0u);
+    }
+    for (uint32_t i = 0; i < 5; i++) {
+        waitPolicy.recordWait(10000u, 0u);
+    }
+    EXPECT_EQ(16u, waitPolicy.getSpinTimeUs());
+}
+
+TEST(AdaptiveWaitPolicyTest, givenMostWaitsLongerThanMaxSpinTimeWhenGettingSpinTimeThenZeroIsReturned) {
+    WaitUtils::AdaptiveWaitPolicy waitPolicy;
+    for (uint32_t i = 0; i < 50; i++) {
+        waitPolicy.recordWait(1u, 0u);
+    }
+    for (uint32_t i = 0; i < 50; i++) {
+        waitPolicy.recordWait(WaitUtils::AdaptiveWaitPolicy::maxSpinTimeUs * 4, 0u);
+    }
+    EXPECT_EQ(0u, waitPolicy.getSpinTimeUs());
+}
+
+TEST(AdaptiveWaitPolicyTest, givenDecayIntervalReachedWhenRecordingWaitThenHistogramIsHalved) {
+    MockAdaptiveWaitPolicy waitPolicy;
+    for (uint32_t i = 0; i < WaitUtils::AdaptiveWaitPolicy::decayInterval - 1; i++) {
+        waitPolicy.recordWait(1u, 0u);
+    }
+    EXPECT_EQ(WaitUtils::AdaptiveWaitPolicy::decayInterval - 1, waitPolicy.histogram[0].load());
+
+    waitPolicy.recordWait(1u, 0u);
+    EXPECT_EQ(WaitUtils::AdaptiveWaitPolicy::decayInterval / 2, waitPolicy.histogram[0].load());
+    EXPECT_EQ(WaitUtils::AdaptiveWaitPolicy::decayInterval, waitPolicy.getNumWaits());
+}
+
+TEST(AdaptiveWaitPolicyTest, givenRecordedWaitsWhenGettingPhaseTimesThenTimeIsSplitBetweenSpinAndYield) {
+    WaitUtils::AdaptiveWaitPolicy waitPolicy;
+    waitPolicy.recordWait(10u, 4u);
+    waitPolicy.recordWait(2u, 4u);
+
+    EXPECT_EQ(6u, waitPolicy.getPhaseTimeUs(WaitUtils::WaitPhase::spin));
+    EXPECT_EQ(6u, waitPolicy.getPhaseTimeUs(WaitUtils::WaitPhase::yield));
+    EXPECT_EQ(2u, waitPolicy.getNumWaits());
+}
+
+TEST(AdaptiveWaitPolicyTest, givenEnableAdaptiveWaitSpinDebugFlagWhenCheckingIfEnabledThenFlagIsRespected) {
+    DebugManagerStateRestore restore;
+    EXPECT_FALSE(WaitUtils::AdaptiveWaitPolicy::isEnabled());
+
+    DebugManager.flags.EnableAdaptiveWaitSpin.set(0);
+    EXPECT_FALSE(WaitUtils::AdaptiveWaitPolicy::isEnabled());
+
+    DebugManager.flags.EnableAdaptiveWaitSpin.set(1);
+    EXPECT_TRUE(WaitUtils::AdaptiveWaitPolicy::isEnabled());
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/worker_pool.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+TEST(WorkerPoolTest, givenDefaultNumWorkersThenCallingThreadIsNotCountedAndLimitIsRespected) {
+    auto numWorkers = WorkerPool::getDefaultNumWorkers();
+    EXPECT_LT(numWorkers, WorkerPool::defaultMaxThreads);
+    EXPECT_LE(numWorkers, static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 1u)) - 1);
+}
+
+TEST(WorkerPoolTest, givenPoolWithoutWorkersWhenRunningTasksThenAllTasksAreRunOnCallingThread) {
+    WorkerPool pool(0u);
+    std::vector<std::thread::id> executors(5);
+    pool.runTasks(executors.size(), [&](size_t task) { executors[task] = std::this_thread::get_id(); });
+
+    for (auto &executor : executors) {
+        EXPECT_EQ(std::this_thread::get_id(), executor);
+    }
+    EXPECT_EQ(0u, pool.getNumStartedWorkers());
+}
+
+TEST(WorkerPoolTest, givenSingleTaskWhenRunningTasksThenWorkersAreNotStarted) {
+    WorkerPool pool(2u);
+    size_t runCount = 0u;
+    pool.runTasks(1u, [&](size_t) { runCount++; });
+
+    EXPECT_EQ(1u, runCount);
+    EXPECT_EQ(0u, pool.getNumStartedWorkers());
+}
+
+TEST(WorkerPoolTest, givenPoolWithWorkersWhenRunningTasksRepeatedlyThenEachTaskRunsOnceAndWorkersAreStartedOnlyOnce) {
+    WorkerPool pool(3u);
+    for (int iteration = 0; iteration < 10; iteration++) {
+        std::vector<std::atomic<uint32_t>> runCounts(64);
+        pool.runTasks(runCounts.size(), [&](size_t task) { runCounts[task]++; });
+
+        for (auto &runCount : runCounts) {
+            EXPECT_EQ(1u, runCount.load());
+        }
+        EXPECT_EQ(3u, pool.getNumStartedWorkers());
+    }
+}
+
+TEST(WorkerPoolTest, givenBatchesFromMultipleThreadsWhenRunningTasksThenAllBatchesComplete) {
+    WorkerPool pool(2u);
+    constexpr size_t numCallers = 4u;
+    constexpr size_t numTasks = 32u;
+    std::vector<std::atomic<uint32_t>> runCounts(numCallers * numTasks);
+
+    std::vector<std::thread> callers;
+    for (size_t caller = 0; caller < numCallers; caller++) {
+        callers.emplace_back([&, caller]() {
+            pool.runTasks(numTasks, [&](size_t task) { runCounts[caller * numTasks + task]++; });
+        });
+    }
+    for (auto &caller : callers) {
+        caller.join();
+    }
+
+    for (auto &runCount : runCounts) {
+        EXPECT_EQ(1u, runCount.load());
+    }
+}
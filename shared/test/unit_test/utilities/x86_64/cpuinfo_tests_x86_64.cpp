@@ -32,6 +32,25 @@ void mockCpuidFunctionNotAvailableDisableAll(int cpuInfo[4], int functionId) {
     cpuInfo[3] = 0;
 }
 
+void mockCpuidEnableAllExceptOsXSave(int cpuInfo[4], int functionId) {
+    mockCpuidEnableAll(cpuInfo, functionId);
+    if (functionId == 1) {
+        cpuInfo[2] &= ~static_cast<int>(BIT(27));
+    }
+}
+
+uint64_t mockXgetbvCallCount = 0;
+
+uint64_t mockXgetbvEnableAll(uint32_t index) {
+    mockXgetbvCallCount++;
+    return ~0ull;
+}
+
+uint64_t mockXgetbvZmmStateDisabled(uint32_t index) {
+    mockXgetbvCallCount++;
+    return BIT(1) | BIT(2);
+}
+
 void mockCpuidReport36BitVirtualAddressSize(int cpuInfo[4], int functionId) {
     if (static_cast<uint32_t>(functionId) == 0x80000008) {
         cpuInfo[0] = 36 << 8;
@@ -51,6 +70,7 @@ TEST(CpuInfoTest, giveFunctionIsNotAvailableWhenFeatureIsNotSupportedThenMaskBit
 
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX2));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureClflush));
+    EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX512Bw));
 
     CpuInfo::cpuidFunc = defaultCpuidFunc;
 }
@@ -63,31 +83,70 @@ TEST(CpuInfoTest, giveFunctionIsAvailableWhenFeatureIsNotSupportedThenMaskBitIsO
 
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX2));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureClflush));
+    EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX512Bw));
 
     CpuInfo::cpuidFunc = defaultCpuidFunc;
 }
 
 TEST(CpuInfoTest, whenFeatureIsSupportedThenMaskBitIsOn) {
     void (*defaultCpuidFunc)(int[4], int) = CpuInfo::cpuidFunc;
+    uint64_t (*defaultXgetbvFunc)(uint32_t) = CpuInfo::xgetbvFunc;
     CpuInfo::cpuidFunc = mockCpuidEnableAll;
+    CpuInfo::xgetbvFunc = mockXgetbvEnableAll;
 
     CpuInfo testCpuInfo;
 
     EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX2));
     EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureClflush));
+    EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX512Bw));
+
+    CpuInfo::cpuidFunc = defaultCpuidFunc;
+    CpuInfo::xgetbvFunc = defaultXgetbvFunc;
+}
+
+TEST(CpuInfoTest, givenOsNotPreservingZmmStateWhenDetectingFeaturesThenAvx512BwIsNotSupported) {
+    void (*defaultCpuidFunc)(int[4], int) = CpuInfo::cpuidFunc;
+    uint64_t (*defaultXgetbvFunc)(uint32_t) = CpuInfo::xgetbvFunc;
+    CpuInfo::cpuidFunc = mockCpuidEnableAll;
+    CpuInfo::xgetbvFunc = mockXgetbvZmmStateDisabled;
+
+    CpuInfo testCpuInfo;
+
+    EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX2));
+    EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX512Bw));
+
+    CpuInfo::cpuidFunc = defaultCpuidFunc;
+    CpuInfo::xgetbvFunc = defaultXgetbvFunc;
+}
+
+TEST(CpuInfoTest, givenOsXSaveDisabledWhenDetectingFeaturesThenXgetbvIsNotCalledAndAvx512BwIsNotSupported) {
+    void (*defaultCpuidFunc)(int[4], int) = CpuInfo::cpuidFunc;
+    uint64_t (*defaultXgetbvFunc)(uint32_t) = CpuInfo::xgetbvFunc;
+    CpuInfo::cpuidFunc = mockCpuidEnableAllExceptOsXSave;
+    CpuInfo::xgetbvFunc = mockXgetbvEnableAll;
+    mockXgetbvCallCount = 0;
+
+    CpuInfo testCpuInfo;
+
+    EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX512Bw));
+    EXPECT_EQ(0u, mockXgetbvCallCount);
 
     CpuInfo::cpuidFunc = defaultCpuidFunc;
+    CpuInfo::xgetbvFunc = defaultXgetbvFunc;
 }
 
 TEST(CpuInfoTest, WhenGettingVirtualAddressSizeThenCorrectResultIsReturned) {
     void (*defaultCpuidFunc)(int[4], int) = CpuInfo::cpuidFunc;
+    uint64_t (*defaultXgetbvFunc)(uint32_t) = CpuInfo::xgetbvFunc;
     CpuInfo::cpuidFunc = mockCpuidReport36BitVirtualAddressSize;
+    CpuInfo::xgetbvFunc = mockXgetbvEnableAll;
 
     CpuInfo testCpuInfo;
 
     EXPECT_EQ(36u, testCpuInfo.getVirtualAddressSize());
 
     CpuInfo::cpuidFunc = defaultCpuidFunc;
+    CpuInfo::xgetbvFunc = defaultXgetbvFunc;
 }
 
 TEST(CpuInfo, WhenGettingCpuidexThenOperationSucceeds) {